@@ -14,6 +14,12 @@
 
 #include <stdint.h>
 #include <string.h> // Required for strcmp
+#include "Assets.h"
+#include "Objects.h"
+#include "DisplayList.h"
+#include "TextField.h"
+#include "Gauge.h"
+#include "SevenSeg.h"
 
 // API_draw_rectangle error codes
 #define ERR_RECT_WIDTH_INVALID            600  /**< The width parameter is 0 or negative, resulting in an empty rectangle. */
@@ -23,7 +29,27 @@
 #define ERR_WEIGHT_INVALID           	  604  /**< Weight is below 0, which is not possible for line thickness. */
 #define ERR_BITMAP_INVALID				  605  /**< Requested bitmap does not exist*/
 #define ERR_CIR_RADIUS_INVALID			  606  /**< Requested radius is 0 or negative*/
+#define ERR_MODE_INVALID				  607  /**< Requested screen mode does not exist or does not support the operation. */
+#define ERR_PALETTE_INVALID				  608  /**< Requested palette index is outside the 16-entry palette. */
+#define ERR_UPLOAD_INVALID				  609  /**< Upload data is not valid base64/QOI, or the image does not fit on the screen. */
+#define ERR_UPLOAD_NOT_STARTED			  610  /**< Upload data was received without an active upload. */
+#define ERR_CACHE_INVALID				  611  /**< Cache slot, format or size is not valid. */
+#define ERR_CACHE_MISS					  612  /**< Requested cache slot is empty or was evicted, upload it again. */
 #define ERR_FONT_INVALID				  613  /**< Requested font does not exist. */
+#define ERR_FONT_UPLOAD_INVALID			  614  /**< Font slot or size is not valid, or the glyph store is full. */
+#define ERR_TRANSFORM_INVALID			  615  /**< Rotation, mirror or scale of a bitmap is not valid. */
+#define ERR_SPRITE_INVALID				  616  /**< Sprite id does not exist, or the sprite does not fit on the screen. */
+#define ERR_SPRITE_FULL					  617  /**< The save buffer has no room for the pixels under the sprite. */
+#define ERR_TILEMAP_INVALID				  618  /**< Tile map id, tile set, size or tile index is not valid. */
+#define ERR_OBJECT_INVALID				  619  /**< Object id does not exist, or the object type or style is not valid. */
+#define ERR_LIST_INVALID				  620  /**< Display list id is not valid or not recorded, or the command can not be recorded. */
+#define ERR_LIST_FULL					  621  /**< The display list pool has no room for the command. */
+#define ERR_FLASH_FAILED				  622  /**< Erasing or programming the boot script sector failed. */
+#define ERR_CHART_INVALID				  623  /**< Strip chart id, region, scale or number of samples is not valid. */
+#define ERR_FIELD_INVALID				  624  /**< Text field id or font size is not valid, or the text is too long. */
+#define ERR_GAUGE_INVALID				  625  /**< Gauge id or value range is not valid, or the gauge was not created. */
+#define ERR_SEGMENT_INVALID				  626  /**< Seven-segment display id, digits or decimals are not valid, or the display was not created. */
+#define ERR_FLIP_FAILED					  627  /**< The page was not shown within two frames, the scan-out is not running. */
 
 
 
@@ -76,21 +102,43 @@ int API_draw_circle(int x0, int y0, int radius, int color, int reserved);
 /**
  * @brief Draws a bitmap on the screen at the specified upper-left position.
  *
- * This function takes a bitmap index from a global bitmap array and renders it
- * at the given (x, y) coordinates on the screen. Each bitmap is expected to have
- * the following format:
- * - bmp[0] = height of the bitmap in pixels
- * - bmp[1] = width of the bitmap in pixels
- * - bmp[2..] = pixel color data (row-major order)
+ * This function takes a bitmap index from the global bitmap table and renders it
+ * at the given (x, y) coordinates on the screen. Each table entry is an
+ * ASSET_Bitmap_t descriptor with the width, height and encoding (raw, RLE,
+ * 1 bpp or 4 bpp paletted) of the pixel data, see Assets.h.
+ * Numbers from CACHE_ID_BASE (100) select a slot of the RAM asset cache.
  *
  * @param x_lup The x-coordinate of the upper-left pixel where the bitmap will be drawn.
  * @param y_lup The y-coordinate of the upper-left pixel where the bitmap will be drawn.
- * @param bitnr The index of the bitmap in the global `bitmaps` array.
+ * @param bitnr The index of the bitmap in the global `bitmaps` table, or CACHE_ID_BASE + slot.
  *
- * @note The function assumes that the `bitmaps` array and `UB_VGA_SetPixel` function
- *       are properly defined and accessible.
+ * @note Pixels with color 0x01 are transparent and are not drawn.
  */
 int API_draw_bitmap(int x_lup, int y_lup, int bitnr);
+/**
+ * @brief Draws a bitmap with its primary color replaced.
+ *
+ * Palette index 1 of a 1 bpp or 4 bpp bitmap is replaced by @p color.
+ * Bitmaps without a palette are drawn unchanged.
+ *
+ * @param x_lup The x-coordinate of the upper-left pixel where the bitmap will be drawn.
+ * @param y_lup The y-coordinate of the upper-left pixel where the bitmap will be drawn.
+ * @param bitnr The index of the bitmap in the global `bitmaps` table.
+ * @param color 8-bit color for the primary palette entry.
+ */
+int API_draw_bitmap_color(int x_lup, int y_lup, int bitnr, int color);
+/**
+ * @brief Draws a bitmap scaled, rotated and/or mirrored.
+ *
+ * @param x_lup 	The x-coordinate of the upper-left pixel of the result.
+ * @param y_lup 	The y-coordinate of the upper-left pixel of the result.
+ * @param bitnr 	The index of the bitmap in the global `bitmaps` table, or CACHE_ID_BASE + slot.
+ * @param rotation 	Clockwise rotation in degrees (0, 90, 180 or 270).
+ * @param mirror 	0 = none, 1 = left-right, 2 = top-bottom, 3 = both (applied after the rotation).
+ * @param scale 	1..8 to enlarge, -2..-8 to shrink by that factor.
+ * @param color 	Color for palette index 1 of paletted bitmaps, -1 for the default palette.
+ */
+int API_draw_bitmap_ex(int x_lup, int y_lup, int bitnr, int rotation, int mirror, int scale, int color);
 /**
  * @brief Draws a rectangle on the VGA display.
  *
@@ -152,14 +200,79 @@ int API_draw_text(int x_lup, int y_lup, int color, char *text, char *fontname, i
  * @param y_lup     Upper-left Y-coordinate for the start of the text.
  * @param color     Color of the text pixels.
  * @param text      Pointer to the string of characters to be drawn.
- * @param fontname  Name of the font (e.g., "Arial", "Consolas").
+ * @param fontname  Font id ("0"-"7") or name (e.g., "arial", "consolas").
  * @param fontsize  Size of the font (1 for small, 2 for large/doubled).
  * @param fontstyle Style of the font (0 for normal, 1 for bold/italic).
  * * @return 0 on success, or an error code if the text wanders off the screen.
  */
 
+/**
+ * @brief Measures the rectangle that API_draw_text() would touch, without drawing.
+ *
+ * @param x_lup     Upper-left X-coordinate for the start of the text.
+ * @param y_lup     Upper-left Y-coordinate for the start of the text.
+ * @param text      Pointer to the string of characters.
+ * @param fontname  Font id ("0"-"7") or name.
+ * @param fontsize  Size of the font.
+ * @param fontstyle Style of the font ("vet", "cursief" or normal).
+ * @param width     Returns the width in pixels, including wrapped lines.
+ * @param height    Returns the height in pixels.
+ *
+ * @return 0 on success, or an error code if the text wanders off the screen.
+ */
+int API_text_size(int x_lup, int y_lup, char *text, char *fontname, int fontsize, char *fontstyle,
+                  int *width, int *height);
+
+/**
+ * @brief Internal helper that lays out text for API_draw_text() and API_text_size().
+ *
+ * @param draw 		1 to draw the text, 0 to only measure it.
+ * @param width 	Returns the width of the touched pixels, may be NULL.
+ * @param height 	Returns the height of the touched pixels, may be NULL.
+ *
+ * @return 0 on success, or an error code.
+ */
+int _layout_text(int x_lup, int y_lup, int color, char *text, char *fontname, int fontsize,
+                 char *fontstyle, int draw, int *width, int *height);
+
 int _Min(int a, int b);
 
+/**
+ * @brief Looks up a bitmap in flash (`bitmaps` table) or in the asset cache.
+ *
+ * @param bitnr 	Bitmap number, CACHE_ID_BASE and up select a cache slot
+ * @param bmp 		Destination for the bitmap descriptor
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int _GetBitmap(int bitnr, const ASSET_Bitmap_t **bmp);
+
+/**
+ * @brief Draws a single GLCD (built-in font) character.
+ *
+ * @param x 		X-coordinate for the character
+ * @param y 		Y-coordinate for the character
+ * @param data 		Pointer to the character's data in the font array
+ * @param color 	Color of the pixels
+ * @param fontsize 	Scaling factor
+ * @param fontstyle 1 = normal, 2 = bold, 3 = italic
+ */
+void _draw_glcd_char(int x, int y, const unsigned short *data, int color, int fontsize, int fontstyle);
+
+/**
+ * @brief Draws a single packed (uploaded font) character.
+ *
+ * @param x 		X-coordinate for the character
+ * @param y 		Y-coordinate for the character
+ * @param data 		Pointer to the first row of the glyph
+ * @param width 	Glyph width in pixels
+ * @param height 	Glyph height in pixels
+ * @param color 	Color of the pixels
+ * @param fontsize 	Scaling factor
+ * @param fontstyle 1 = normal, 2 = bold, 3 = italic
+ */
+void _draw_packed_char(int x, int y, const uint8_t *data, int width, int height, int color, int fontsize, int fontstyle);
+
 /**
  * @brief Returns bigger of two numbers
  *
@@ -218,6 +331,23 @@ int _IsOnSegment(int x_p, int y_p, int x_1, int y_1, int x_2, int y_2);
  */
 int _IsInPolygon(int x_p, int y_p, int x_1, int y_1, int x_2, int y_2, int x_3, int y_3, int x_4, int y_4, int x_5, int y_5);
 
+/**
+ * @brief Copies a rectangle of the screen to another place.
+ *
+ * Source and destination may overlap (scrolling a region in place).
+ * Rectangles that do not overlap are copied by DMA2 in 8 bpp mode.
+ *
+ * @param x_src		Upper-left X-coordinate of the source
+ * @param y_src		Upper-left Y-coordinate of the source
+ * @param width		Width in pixels
+ * @param height	Height in pixels
+ * @param x_dst		Upper-left X-coordinate of the destination
+ * @param y_dst		Upper-left Y-coordinate of the destination
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_copy_rect (int x_src, int y_src, int width, int height, int x_dst, int y_dst);
+
 /**
  * @brief Sets all pixels to given color.
  *
@@ -227,4 +357,482 @@ int _IsInPolygon(int x_p, int y_p, int x_1, int y_1, int x_2, int y_2, int x_3,
  */
 int API_clearscreen (int color);
 
+/**
+ * @brief Switches the framebuffer mode.
+ *
+ * In 4 bpp mode every pixel is a 16-entry palette index and VGA_RAM1 holds
+ * two pages, so drawing can be done on a hidden page and flipped on vsync.
+ * The screen is cleared to black.
+ *
+ * @param bpp		Bits per pixel (8 or 4)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_mode (int bpp);
+
+/**
+ * @brief Switches to the character-cell text mode.
+ *
+ * The screen is a grid of VGA_TEXT_COLS x VGA_TEXT_ROWS cells of 8x12
+ * pixels. A cell holds a glyph index and two palette indices, the glyphs
+ * are expanded into the line buffer during scan-out. Writing a character
+ * costs two bytes, pixel drawing commands have no effect in this mode.
+ * The colors come from the 4 bpp palette.
+ *
+ * @param fontname	Font id or name of the glyphs, the left 8 columns are used
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_text_mode (char *fontname);
+
+/**
+ * @brief Writes a string into the cells from a given cell on (text mode).
+ *
+ * @param column	Column of the first character
+ * @param row		Row of the first character
+ * @param text		String, cut off at the end of the row
+ * @param color		Foreground color (nearest palette entry)
+ * @param background Background color (nearest palette entry)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_text_put (int column, int row, const char *text, int color, int background);
+
+/**
+ * @brief Writes a string as the next console line (text mode).
+ *
+ * Long strings continue on the next row. At the bottom the cells are
+ * scrolled up with one memmove.
+ *
+ * @param text		String
+ * @param color		Foreground color (nearest palette entry)
+ * @param background Background color (nearest palette entry)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_text_line (const char *text, int color, int background);
+
+/**
+ * @brief Sets one entry of the 4 bpp palette.
+ *
+ * All pixels drawn with this index change color with the next frame.
+ *
+ * @param index		Palette index (0-15)
+ * @param color		8-bit color value for this index
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_palette (int index, int color);
+
+/**
+ * @brief Shows the page that is being drawn on (4 bpp mode).
+ *
+ * The flip happens on the next vsync, drawing continues on the other page.
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_flip_page (void);
+
+/**
+ * @brief Writes the scan-out health counters as text.
+ *
+ * Frames output, lines skipped by a late line interrupt, DMA errors,
+ * largest and last-frame line interrupt latency (in TIM2 ticks of 15.9 ns,
+ * the pixels themselves are timed by TIM1/TIM4) and the CPU load of the
+ * VGA interrupts.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ * @param reset		Non-zero to clear the counters after reading
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_status (char *msg, int size, int reset);
+
+/**
+ * @brief Writes the dirty rectangle statistics as text.
+ *
+ * Closed frames, frames with a change, the dirty pixels and rectangles of
+ * the last frame, the largest and average dirty pixels per frame and the
+ * average in 1/1000 of the screen.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_dirty_status (char *msg, int size);
+
+/**
+ * @brief Starts an image upload at the given position.
+ *
+ * The image follows as a QOI file in base64 chunks (see API_upload_data()),
+ * its size is read from the QOI header.
+ *
+ * @param x_lup		The x-coordinate of the upper-left pixel of the image
+ * @param y_lup		The y-coordinate of the upper-left pixel of the image
+ * @param dither	1 to quantize to RGB332 with an ordered dither, 0 to round
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_upload_start (int x_lup, int y_lup, int dither);
+
+/**
+ * @brief Decodes the next base64 chunk of the uploaded image.
+ *
+ * Every completed image row is written to the framebuffer immediately.
+ *
+ * @param data		Base64 text, chunks may be split at any character
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_upload_data (char *data);
+
+/**
+ * @brief Reserves an asset cache slot, the data follows with API_upload_data().
+ *
+ * @param slot		Slot number (0-15), or -1 to select the slot by name
+ * @param name		Slot name, NULL for a numbered slot
+ * @param width		Width in pixels
+ * @param height	Height in pixels
+ * @param format	ASSET_FMT_RAW, ASSET_FMT_RLE, ASSET_FMT_1BPP or ASSET_FMT_4BPP
+ * @param size		Bytes of data, paletted formats start with their palette
+ * @param bitnr		Destination for the bitmap number of the slot, may be NULL
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_cache_store (int slot, char *name, int width, int height, int format, int size, int *bitnr);
+
+/**
+ * @brief Finds the bitmap number of a named bitmap, flash bitmaps first, then cache slots.
+ *
+ * @param name		Bitmap name (`bitmap_names` table) or cache slot name
+ * @param bitnr		Destination for the bitmap number
+ *
+ * @return			0 if succesfull, ERR_CACHE_MISS if the name is not known
+ */
+int API_find_bitmap (char *name, int *bitnr);
+
+/**
+ * @brief Writes the asset cache counters as text.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ * @param reset		Non-zero to clear hits, misses and evictions after reading
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_cache_status (char *msg, int size, int reset);
+
+/**
+ * @brief Starts the upload of a packed font blob into a font slot.
+ *
+ * The blob follows with API_upload_data(), see Font.h for the layout.
+ *
+ * @param id		Font id (3-7, ids 0-2 are the built-in fonts)
+ * @param name		Font name for `tekst`, may be NULL
+ * @param size		Size of the blob in bytes
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_font_store (int id, char *name, int size);
+
+/**
+ * @brief Creates or replaces a sprite, it is drawn at the next frame.
+ *
+ * @param id		Sprite id (0-15)
+ * @param bitnr		Bitmap number (flash or cache slot)
+ * @param x_lup		Upper-left x-coordinate
+ * @param y_lup		Upper-left y-coordinate
+ * @param z			Z-order, higher is drawn on top
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_set (int id, int bitnr, int x_lup, int y_lup, int z);
+
+/**
+ * @brief Moves a sprite, the old and new rectangle are redrawn at the next frame.
+ *
+ * @param id		Sprite id
+ * @param x_lup		New upper-left x-coordinate
+ * @param y_lup		New upper-left y-coordinate
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_move (int id, int x_lup, int y_lup);
+
+/**
+ * @brief Removes a sprite, the pixels under it are restored at the next frame.
+ *
+ * @param id		Sprite id
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_remove (int id);
+
+/**
+ * @brief Creates or replaces a tile map and draws it with all cells empty.
+ *
+ * @param id			Tile map id (0-3)
+ * @param bitnr			Bitmap number of the tile set, the tiles are stacked from top to bottom
+ * @param tile_height	Height of one tile in the tile set
+ * @param x_lup			Upper-left x-coordinate of the map
+ * @param y_lup			Upper-left y-coordinate of the map
+ * @param columns		Cells per row
+ * @param rows			Number of rows
+ * @param color			Color behind transparent pixels and empty cells
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_create (int id, int bitnr, int tile_height, int x_lup, int y_lup, int columns, int rows, int color);
+
+/**
+ * @brief Sets cells of a tile map, only the changed cells are drawn.
+ *
+ * @param id			Tile map id
+ * @param column		Column of the first cell
+ * @param row			Row of the first cell
+ * @param indices		Tile indices (255 = empty), continued on the next row
+ * @param count			Number of indices
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_set (int id, int column, int row, const uint8_t *indices, int count);
+
+/**
+ * @brief Draws all cells of a tile map.
+ *
+ * @param id			Tile map id
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_draw (int id);
+
+/**
+ * @brief Creates or replaces a strip chart and draws it empty.
+ *
+ * @param id			Strip chart id (0-3)
+ * @param x_lup			Upper-left x-coordinate of the region
+ * @param y_lup			Upper-left y-coordinate of the region
+ * @param width			Width of the region, one sample per column
+ * @param height		Height of the region
+ * @param min			Sample value at the bottom
+ * @param max			Sample value at the top
+ * @param color			Color of the trace
+ * @param background	Color of the region
+ * @param grid_color	Color of the grid lines
+ * @param grid			Pixels between two grid lines, 0 for no grid
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_chart_create (int id, int x_lup, int y_lup, int width, int height, int min, int max,
+					  int color, int background, int grid_color, int grid);
+
+/**
+ * @brief Appends samples to a strip chart, the plot scrolls left and only the new columns are drawn.
+ *
+ * @param id			Strip chart id
+ * @param samples		Sample values
+ * @param count			Number of samples
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_chart_add (int id, const int16_t *samples, int count);
+
+/**
+ * @brief Creates or replaces a retained object and draws it.
+ *
+ * @param id		Object id (0-31), also the z-order
+ * @param obj		Object description, copied into the object table
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_set (int id, const OBJ_t *obj);
+
+/**
+ * @brief Moves a retained object, only the old and new rectangles are redrawn.
+ *
+ * @param id		Object id
+ * @param x			New x-coordinate (line start, upper-left or center)
+ * @param y			New y-coordinate
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_move (int id, int x, int y);
+
+/**
+ * @brief Gives a retained object a new color, only its rectangle is redrawn.
+ *
+ * @param id		Object id
+ * @param color		New color
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_color (int id, int color);
+
+/**
+ * @brief Deletes a retained object, its rectangle is redrawn without it.
+ *
+ * @param id		Object id
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_delete (int id);
+
+/**
+ * @brief Looks up a command that can be recorded in a display list.
+ *
+ * @param name		Command name
+ *
+ * @return			Command layout, or NULL if the command can not be recorded
+ */
+const DL_Op_t *API_list_find_op (const char *name);
+
+/**
+ * @brief Starts recording a display list, an existing list with this id is replaced.
+ *
+ * @param id		Display list id (0-7)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_record (int id);
+
+/**
+ * @brief Adds one parsed command to the display list that is recorded.
+ *
+ * @param cmd		Parsed command
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_add (const DL_Cmd_t *cmd);
+
+/**
+ * @brief Stops recording a display list.
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_stop (void);
+
+/**
+ * @brief Returns whether a display list is recorded.
+ *
+ * @return			1 while recording, otherwise 0
+ */
+int API_list_recording (void);
+
+/**
+ * @brief Replays a display list, the other commands are still drawn after an error.
+ *
+ * @param id		Display list id
+ * @param dx		Offset added to every x-coordinate
+ * @param dy		Offset added to every y-coordinate
+ *
+ * @return			0 if succesfull, otherwise the first error code
+ */
+int API_list_play (int id, int dx, int dy);
+
+/**
+ * @brief Writes a display list to flash as boot script, or erases the boot script.
+ *
+ * @param id		Display list id, -1 only erases the boot script
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_save_boot (int id);
+
+/**
+ * @brief Writes the boot script size and the time to the first frame as text.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_boot_status (char *msg, int size);
+
+/**
+ * @brief Creates or replaces a text field, the field starts empty.
+ *
+ * @param id			Text field id (0-15)
+ * @param x				Upper-left x-coordinate
+ * @param y				Upper-left y-coordinate
+ * @param color			Text color
+ * @param background	Color of the cleared cells
+ * @param fontname		Font id or name
+ * @param fontsize		Font size multiplier
+ * @param fontstyle		"normaal", "vet" or "cursief"
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_field_set (int id, int x, int y, int color, int background,
+				   char *fontname, int fontsize, char *fontstyle);
+
+/**
+ * @brief Shows a new text in a text field, only the changed character cells are drawn.
+ *
+ * @param id			Text field id
+ * @param text			New text, one line
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_field_update (int id, const char *text);
+
+/**
+ * @brief Creates or replaces a gauge and draws the dial with the needle at the minimum.
+ *
+ * @param id			Gauge id (0-3)
+ * @param x				X-coordinate of the center
+ * @param y				Y-coordinate of the center
+ * @param radius		Radius of the dial
+ * @param min			Value at the start of the sweep
+ * @param max			Value at the end of the sweep
+ * @param color			Color of the ring, ticks and label
+ * @param background	Color of the dial
+ * @param needle_color	Color of the needle and the hub
+ * @param label			Text under the center, may be NULL
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_gauge_set (int id, int x, int y, int radius, int min, int max,
+				   int color, int background, int needle_color, const char *label);
+
+/**
+ * @brief Moves the needle of a gauge, only the old needle pixels are restored.
+ *
+ * @param id			Gauge id
+ * @param value			New value, clamped to min..max
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_gauge_value (int id, int value);
+
+/**
+ * @brief Creates or replaces a seven-segment display and draws it with all segments off.
+ *
+ * @param id			Display id (0-7)
+ * @param x				Upper-left x-coordinate
+ * @param y				Upper-left y-coordinate
+ * @param height		Digit height, the width and segment thickness follow from it
+ * @param digits		Number of digits (1-10)
+ * @param color			Color of a lit segment
+ * @param off_color		Color of an unlit segment
+ * @param background	Color around the segments
+ * @param decimals		Digits after the decimal point, 0 for none
+ * @param leading_zeros	1 to fill unused digits with zeros
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_segment_set (int id, int x, int y, int height, int digits, int color, int off_color,
+					 int background, int decimals, int leading_zeros);
+
+/**
+ * @brief Shows a number on a seven-segment display, only the toggled segments are filled.
+ *
+ * @param id			Display id
+ * @param value			Number, with the decimals as the last digits (1234 with 2 decimals is 12.34)
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_segment_value (int id, int32_t value);
+
 #endif /* INC_API_LIB_H_ */
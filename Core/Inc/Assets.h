@@ -0,0 +1,142 @@
+/**
+ * @file Assets.h
+ * @brief Bitmap asset header file
+ *
+ * This file contains the bitmap descriptor and the prototypes
+ * for the bitmap decoders. Pixels are written as horizontal spans,
+ * so flat areas are drawn at memset speed.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __ASSETS_H
+#define __ASSETS_H
+
+#include <stdint.h>
+
+// Bitmap formats
+#define ASSET_FMT_RAW			0 // 8 bpp, row-major, one byte per pixel
+#define ASSET_FMT_RLE			1 // 8 bpp, run-length encoded per row (see below)
+#define ASSET_FMT_1BPP			2 // 1 bpp, MSB is the left pixel, rows padded to a byte
+#define ASSET_FMT_4BPP			3 // 4 bpp, high nibble is the left pixel, rows padded to a byte
+
+// Bitmap flags
+#define ASSET_FLAG_OPAQUE		0x01 // No transparent pixels, can be copied by DMA
+
+#define ASSET_TRANSPARENT		0x01 // Color that is not drawn
+
+/**
+ * RLE format, every row starts with a new control byte, runs never cross rows:
+ * - 0x00-0x7F : literal run, the next (c+1) bytes are pixels
+ * - 0x80-0xFF : repeat run, the next byte is drawn (c&0x7F)+1 times,
+ *               a repeat run of ASSET_TRANSPARENT is skipped
+ */
+#define ASSET_RLE_REPEAT		0x80
+#define ASSET_RLE_COUNT			0x7F
+
+/**
+ * Paletted formats (1 bpp and 4 bpp) store indices into a palette of
+ * 2 or 16 colors. A palette entry of ASSET_TRANSPARENT is not drawn.
+ * The palette is given at draw time, or the default palette of the
+ * descriptor is used. Index 1 is the primary color: ASSET_DrawBitmapColor()
+ * only replaces this entry, so one icon can be drawn in every color.
+ */
+#define ASSET_PAL_PRIMARY		1
+
+/**
+ * Transforms: a rotation (clockwise) followed by an optional horizontal
+ * mirror. Every combination of rotations and flips is one of these 8
+ * values, use ASSET_Compose() to combine two transforms.
+ */
+#define ASSET_ROT_0				0x00
+#define ASSET_ROT_90			0x01
+#define ASSET_ROT_180			0x02
+#define ASSET_ROT_270			0x03
+#define ASSET_ROT_MASK			0x03
+#define ASSET_FLIP_H			0x04 // Mirror left-right
+#define ASSET_FLIP_V			(ASSET_FLIP_H | ASSET_ROT_180) // Mirror top-bottom
+
+#define ASSET_SCALE_MAX			8 // Largest up (8) or down (-8) scale factor
+#define ASSET_SCRATCH_SIZE		10000 // Largest RLE bitmap (pixels) that can be transformed
+
+/**
+ * @brief Bitmap descriptor.
+ */
+typedef struct {
+	uint16_t width;			/**< Width in pixels */
+	uint16_t height;		/**< Height in pixels */
+	uint8_t format;			/**< ASSET_FMT_... */
+	uint8_t flags;			/**< ASSET_FLAG_... */
+	uint16_t size;			/**< Size of the data in bytes */
+	const uint8_t *data;	/**< Encoded pixel data */
+	const uint8_t *palette;	/**< Default palette (paletted formats), otherwise NULL */
+	uint8_t transform;		/**< ASSET_ROT_.../ASSET_FLIP_... applied to the data, 0 for none */
+} ASSET_Bitmap_t;
+
+/**
+ * @brief Draws a bitmap with its upper-left corner at (x, y).
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns 1 (unknown format or corrupt data).
+ *
+ * @warning The bitmap must fit on the screen, the caller checks the bounds.
+ */
+int ASSET_DrawBitmap(const ASSET_Bitmap_t *bmp, int x, int y);
+
+/**
+ * @brief Draws a bitmap with its own palette replaced.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param palette Palette of 2 (1 bpp) or 16 (4 bpp) colors, NULL for the default palette.
+ * @return 0 if no errors occured, otherwise returns 1.
+ *
+ * @note Ignored for the 8 bpp formats.
+ */
+int ASSET_DrawBitmapPalette(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette);
+
+/**
+ * @brief Draws a paletted bitmap with its primary color replaced.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param color New color for palette index 1.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+int ASSET_DrawBitmapColor(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t color);
+
+/**
+ * @brief Draws a bitmap scaled, rotated and/or mirrored.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate of the result.
+ * @param y Upper-left Y-coordinate of the result.
+ * @param transform ASSET_ROT_... / ASSET_FLIP_..., applied after the transform of the descriptor.
+ * @param scale 1..ASSET_SCALE_MAX to enlarge, -2..-ASSET_SCALE_MAX to shrink (1/n).
+ * @param palette Palette for the paletted formats, NULL for the default palette.
+ * @return 0 if no errors occured, otherwise returns 1.
+ *
+ * @warning The result must fit on the screen, see ASSET_GetSize().
+ */
+int ASSET_DrawBitmapEx(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t transform, int scale, const uint8_t *palette);
+
+/**
+ * @brief Calculates the size of a transformed bitmap on the screen.
+ * @param bmp Bitmap descriptor.
+ * @param transform ASSET_ROT_... / ASSET_FLIP_...
+ * @param scale Scale factor, see ASSET_DrawBitmapEx().
+ * @param width Destination for the width in pixels.
+ * @param height Destination for the height in pixels.
+ */
+void ASSET_GetSize(const ASSET_Bitmap_t *bmp, uint8_t transform, int scale, uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Combines two transforms.
+ * @param first Transform that is applied first.
+ * @param then Transform that is applied to the result.
+ * @return The combined transform.
+ */
+uint8_t ASSET_Compose(uint8_t first, uint8_t then);
+
+#endif /* __ASSETS_H */
@@ -1,4020 +1,2459 @@
 /*
  * Bitmaps.h
  *
- *  Created on: Dec 8, 2025
- *      Author: tomfv
+ * Generated by asset_compiler.py from assets/manifest.txt, do not edit.
  */
 
 #ifndef INC_BITMAPS_H_
 #define INC_BITMAPS_H_
+
+#include "Assets.h"
+
 /**
  * @brief Bitmap library
  *
  *
  * @param bitmaps The index of the bitmaps, see note
  *
- * @note First six bitmaps are 100x100, it is not recommended to edit these by hand. Others are 32x32, editing by hand is possible, not ideal
- * @note 1. Arrow N, 2. Arrow W, 3. Arrow S, 4. Arrow E, 5. Smiley happy, 6. Smiley angry
- * @note 7. Michiel,8. Franc, 9. Xander 10. Piotr, 11. Daniel, 12. Tom
+ * @note Generated data, edit the PNG files or the manifest instead
+ * @note 0. arrow_N (32x32, 1bpp)
+ * @note 1. arrow_W (32x32, 1bpp, alias of arrow_N)
+ * @note 2. arrow_S (32x32, 1bpp, alias of arrow_N)
+ * @note 3. arrow_E (32x32, 1bpp, alias of arrow_N)
+ * @note 4. smiley_blij (32x32, 4bpp)
+ * @note 5. smiley_boos (32x32, 4bpp)
+ * @note 6. michiel (100x100, rle)
+ * @note 7. franc (100x100, rle)
+ * @note 8. xander (100x100, rle)
+ * @note 9. piotr (100x100, rle)
+ * @note 10. daniel (100x100, rle)
+ * @note 11. tom (100x100, rle)
  */
 
-const char michiel_bitmap[10002] = {
-		0x64, 0x64, 0x49, 0x29, 0x29, 0x29, 0x29, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x29, 0x49, 0x49, 0x6d, 0x68
-		, 0x48, 0x48, 0x68, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xd1, 0xd1, 0xb1, 0xad, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0x8d, 0x8d, 0x6d, 0x6d
-		, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x71, 0x71, 0x6d, 0x6d
-		, 0x6d, 0x4c, 0x48, 0x28, 0x28, 0x4d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x48, 0x28, 0x28, 0x48
-		, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x29, 0x29, 0x29, 0x4d, 0x4d, 0x4d, 0x49, 0x29, 0x49, 0x4d, 0x29
-		, 0x49, 0x6d, 0x6d, 0x68, 0x48, 0x68, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1
-		, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x6d, 0x8d, 0x6d, 0x49, 0x4d, 0x48, 0x48, 0x4d, 0x6d, 0x6d
-		, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x4d, 0x6d, 0x4d, 0x4d, 0x4d, 0x48, 0x48
-		, 0x48, 0x28, 0x49, 0x4d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x49, 0x29, 0x4d, 0x4d, 0x4d, 0x4d, 0x49
-		, 0x29, 0x29, 0x29, 0x29, 0x49, 0x6d, 0x69, 0x48, 0x44, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x4d, 0x49
-		, 0x28, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x4c, 0x49, 0x48, 0x48, 0x4d, 0x6d, 0x48
-		, 0x49, 0x4d, 0x48, 0x48, 0x48, 0x28, 0x28, 0x4d, 0x4d, 0x49, 0x4d, 0x48, 0x48, 0x4d, 0x49, 0x4d
-		, 0x4d, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x49, 0x69, 0x48, 0x48, 0x68, 0x89, 0x89, 0x8d
-		, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x48, 0x28, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x48, 0x48
-		, 0x49, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x49, 0x49, 0x28, 0x24, 0x48, 0x4d, 0x49, 0x48, 0x48
-		, 0x48, 0x4d, 0x49, 0x4d, 0x29, 0x4d, 0x4d, 0x29, 0x49, 0x29, 0x29, 0x49, 0x6d, 0x69, 0x48, 0x68
-		, 0x69, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6
-		, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x49, 0x6d, 0x6d, 0x6c, 0x6d, 0x4d, 0x4d, 0x6d
-		, 0x6d, 0x48, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x6d, 0x49, 0x48, 0x48, 0x49, 0x48, 0x28, 0x48, 0x48
-		, 0x49, 0x49, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49
-		, 0x69, 0x48, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd1
-		, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-		, 0x4d, 0x4c, 0x48, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x6d, 0x49, 0x4d, 0x4d, 0x4d, 0x48, 0x48, 0x49
-		, 0x49, 0x48, 0x48, 0x4d, 0x48, 0x49, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x49, 0x49, 0x69, 0x48, 0x48, 0x69, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x91, 0x8d, 0x6d, 0x6d, 0x6d, 0x48
-		, 0x49, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x49, 0x4d, 0x4c, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x4d, 0x6d
-		, 0x6d, 0x4d, 0x48, 0x48, 0x49, 0x4d, 0x4d, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x6d, 0x69, 0x48, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x4d, 0x6d, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x48, 0x28, 0x48, 0x4d, 0x4d, 0x4d, 0x48, 0x48, 0x48, 0x4d
-		, 0x6d, 0x49, 0x49, 0x4d, 0x49, 0x29, 0x49, 0x4d, 0x29, 0x29, 0x49, 0x6d, 0x6d, 0x68, 0x69, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6
-		, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xb1
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x4d, 0x6d
-		, 0x48, 0x4c, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x28, 0x28, 0x48, 0x4c, 0x4c
-		, 0x48, 0x28, 0x48, 0x6d, 0x6d, 0x29, 0x49, 0x29, 0x29, 0x29, 0x49, 0x4d, 0x29, 0x29, 0x49, 0x6d
-		, 0x6d, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x4d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x4d, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x28
-		, 0x48, 0x4d, 0x4c, 0x48, 0x49, 0x48, 0x48, 0x6d, 0x6d, 0x29, 0x49, 0x29, 0x29, 0x29, 0x29, 0x29
-		, 0x29, 0x29, 0x49, 0x4d, 0x69, 0x69, 0x8d, 0x8d, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d, 0x91, 0x8d, 0x8d, 0x6d, 0x6d
-		, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x4d, 0x6d, 0x6d, 0x4d, 0x4c, 0x48, 0x48, 0x48, 0x6d
-		, 0x6d, 0x6d, 0x48, 0x28, 0x48, 0x4d, 0x4c, 0x48, 0x49, 0x48, 0x28, 0x48, 0x6d, 0x29, 0x29, 0x29
-		, 0x29, 0x49, 0x4d, 0x29, 0x29, 0x29, 0x29, 0x49, 0x6d, 0x69, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0x92
-		, 0x91, 0x8d, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x4c, 0x29, 0x29, 0x29, 0x49, 0x4d, 0x4d, 0x29, 0x29, 0x49, 0x49, 0x6d, 0x69, 0x69, 0x89, 0x89
-		, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xd6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x91, 0x8d, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x6d, 0x4d, 0x48, 0x49, 0x4d, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x29, 0x49, 0x49, 0x29, 0x29, 0x49, 0x29, 0x29, 0x29, 0x49, 0x6d
-		, 0x69, 0x69, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x91, 0x8d, 0x91, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4d
-		, 0x4d, 0x48, 0x28, 0x48, 0x48, 0x28, 0x48, 0x4d, 0x6d, 0x49, 0x29, 0x29, 0x29, 0x29, 0x49, 0x49
-		, 0x29, 0x29, 0x29, 0x4d, 0x6d, 0x69, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1
-		, 0xd1, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x91, 0x92, 0x91, 0x91
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x6d, 0x6d
-		, 0x4c, 0x48, 0x48, 0x4d, 0x4d, 0x48, 0x28, 0x48, 0x48, 0x28, 0x28, 0x48, 0x4d, 0x29, 0x29, 0x29
-		, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x6d, 0x6d, 0x69, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d
-		, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd2, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6
-		, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xd2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2
-		, 0xb2, 0xb2, 0x91, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x4c, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x49, 0x48, 0x28, 0x28, 0x4c
-		, 0x4d, 0x49, 0x29, 0x28, 0x29, 0x29, 0x29, 0x24, 0x29, 0x49, 0x49, 0x6d, 0x6d, 0x69, 0x69, 0x89
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb2, 0xb6, 0xb6, 0xb2, 0xb2, 0x92, 0x91, 0x91, 0x6d, 0x6d, 0x4c, 0x6d, 0x71, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d
-		, 0x49, 0x48, 0x49, 0x4d, 0x4d, 0x49, 0x29, 0x29, 0x29, 0x49, 0x29, 0x24, 0x24, 0x49, 0x49, 0x6d
-		, 0x6d, 0x6d, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2
-		, 0xd6, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb6, 0xb2, 0xb2, 0x92, 0x91, 0x91, 0x6d, 0x6d, 0x6c, 0x6d
-		, 0x71, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x49
-		, 0x48, 0x28, 0x48, 0x49, 0x48, 0x28, 0x48, 0x49, 0x49, 0x29, 0x49, 0x29, 0x29, 0x49, 0x29, 0x29
-		, 0x29, 0x49, 0x49, 0x49, 0x6d, 0x69, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x91, 0x91
-		, 0x8d, 0x6d, 0x6d, 0x71, 0x6d, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x4d, 0x49
-		, 0x48, 0x48, 0x48, 0x49, 0x48, 0x28, 0x28, 0x49, 0x48, 0x28, 0x28, 0x48, 0x48, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x69, 0x6d, 0x6d, 0x69, 0x89, 0x8d, 0x8d, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd2, 0xd2, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2
-		, 0xb2, 0xb2, 0xb2, 0x92, 0x8d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x4d, 0x4d, 0x6d, 0x4d, 0x49, 0x49, 0x28, 0x48, 0x48, 0x28, 0x28, 0x48, 0x48, 0x28, 0x28, 0x48
-		, 0x48, 0x6d, 0x6d, 0x6d, 0x49, 0x4d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x8d, 0x8d, 0x8d, 0x89
-		, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xf6
-		, 0xd2, 0xd6, 0xf6, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2
-		, 0xd2, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xd1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x6d, 0x4d, 0x49, 0x48, 0x4d, 0x48, 0x28, 0x28, 0x49
-		, 0x48, 0x28, 0x28, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd2, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xd2, 0xd2
-		, 0xd1, 0xb1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x6d
-		, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x49, 0x49, 0x48, 0x28, 0x48, 0x4d
-		, 0x48, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x6d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x91, 0x8d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0x8d, 0x89, 0x89, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xb1, 0xb1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d
-		, 0x8d, 0x8d, 0x6d, 0x68, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49
-		, 0x28, 0x48, 0x49, 0x49, 0x49, 0x28, 0x28, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x4d, 0x8d, 0x8d, 0x91
-		, 0x92, 0x91, 0x8d, 0x91, 0x8d, 0x91, 0x6d, 0x8d, 0x8d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xad
-		, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb2, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x49, 0x4d, 0x49, 0x28, 0x49, 0x49, 0x49, 0x49, 0x28, 0x29, 0x49, 0x49, 0x48, 0x4c, 0x4d
-		, 0x4c, 0x92, 0x91, 0x91, 0x91, 0x8d, 0x91, 0x92, 0xb2, 0x92, 0x91, 0x91, 0x91, 0x6d, 0x8d, 0x8d
-		, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0x89, 0x8d, 0xad
-		, 0xb1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xd1, 0xad, 0xa9, 0xad, 0x6c, 0x6d, 0x6d, 0x6d
-		, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x49
-		, 0x49, 0x48, 0x48, 0x4c, 0x48, 0xd6, 0xb6, 0xb6, 0xb2, 0x92, 0xb2, 0xb2, 0xb2, 0xb6, 0xb6, 0x92
-		, 0x8d, 0x6d, 0x6d, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad
-		, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd2, 0xd6, 0xd6, 0xd6, 0xd1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d
-		, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1
-		, 0xb1, 0xd1, 0xd2, 0xd1, 0xd1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xd1, 0xd2, 0xad, 0xa9, 0xad
-		, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x6d, 0x6d, 0x4c, 0x4d, 0x4d, 0x49, 0x48, 0x48, 0x49
-		, 0x49, 0x49, 0x49, 0x28, 0x48, 0x48, 0x4d, 0x48, 0x48, 0xda, 0xfb, 0xfb, 0xdb, 0xda, 0xd6, 0xb6
-		, 0xb6, 0xb6, 0xb2, 0x91, 0x8d, 0x6d, 0x6d, 0x8d, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd2, 0xf6, 0xf6, 0xd6, 0xd1, 0xad
-		, 0xad, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x69, 0x44, 0x44, 0x44, 0x64, 0x69, 0x8d, 0xad
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xd2
-		, 0xd1, 0xad, 0xa9, 0xad, 0x8d, 0x6d, 0x6c, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x4d, 0x48, 0x48, 0x49
-		, 0x49, 0x48, 0x28, 0x49, 0x49, 0x48, 0x28, 0x28, 0x28, 0x48, 0x49, 0x49, 0x48, 0xd6, 0xda, 0xda
-		, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xda, 0xb6, 0xb2, 0x6d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x89, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xd1, 0xd2, 0xf6
-		, 0xf6, 0xf6, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0xb1, 0x6d, 0x48, 0x69, 0x49
-		, 0x49, 0x69, 0x89, 0x89, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xad
-		, 0x8d, 0x8d, 0xd2, 0xd2, 0xd1, 0xcd, 0xa9, 0xad, 0x8d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x4d, 0x4d
-		, 0x4d, 0x48, 0x48, 0x49, 0x49, 0x48, 0x28, 0x49, 0x48, 0x28, 0x28, 0x28, 0x28, 0x48, 0x49, 0x48
-		, 0x28, 0xfa, 0xda, 0xda, 0xd6, 0xda, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x8d, 0x6d, 0x8d
-		, 0x89, 0x69, 0x69, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x88, 0x88, 0x89
-		, 0xad, 0xd1, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0xd6
-		, 0x8d, 0x49, 0x49, 0x49, 0x69, 0xb2, 0xb2, 0xad, 0x8d, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xd1, 0xb1, 0xd2, 0xd2, 0xad, 0xad, 0x8d, 0x48, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x49, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28
-		, 0x28, 0x49, 0x49, 0x28, 0x28, 0xff, 0xff, 0xfb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xfb, 0xff, 0xff
-		, 0xff, 0x92, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x89, 0x69, 0x69, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x88, 0x8d, 0xcd, 0xd2, 0xf6, 0xf6, 0xf6, 0xf2, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1
-		, 0xad, 0xad, 0xad, 0xb2, 0xb2, 0x6d, 0x69, 0x69, 0x8d, 0xd2, 0xd2, 0xb1, 0xb1, 0xd1, 0xad, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2, 0xd2, 0xad, 0xad
-		, 0x8d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x4c, 0x4d, 0x49, 0x48, 0x28, 0x28, 0x49
-		, 0x28, 0x28, 0x28, 0x24, 0x28, 0x28, 0x28, 0x28, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb
-		, 0xda, 0xda, 0xda, 0xff, 0xff, 0xb6, 0x68, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x44
-		, 0x44, 0x44, 0x69, 0x69, 0x89, 0x89, 0x88, 0x68, 0x89, 0xad, 0xd1, 0xf2, 0xf6, 0xf6, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd2, 0xd2, 0xad, 0xad, 0xad, 0xad, 0xb2, 0xb1, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1
-		, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xb1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xad, 0x8d, 0x48, 0x4d, 0x4d, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x24, 0x24, 0x28, 0x49, 0x28, 0x28, 0x28, 0x24, 0x28, 0x28, 0x28, 0x28, 0x28, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xb6, 0x69, 0x68, 0x68, 0x8d, 0x8d, 0x8d
-		, 0x68, 0x44, 0x24, 0x44, 0x49, 0x48, 0x69, 0x8d, 0x89, 0x89, 0x89, 0x88, 0x89, 0xad, 0xd1, 0xd2
-		, 0xf6, 0xf2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xd2, 0xd2, 0xd1, 0xd2
-		, 0xd1, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xb1, 0x48, 0x48, 0x6d, 0x6d, 0x4d, 0x4c, 0x4d
-		, 0x4d, 0x6d, 0x4d, 0x49, 0x24, 0x24, 0x28, 0x49, 0x28, 0x28, 0x28, 0x28, 0x24, 0x28, 0x28, 0x28
-		, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xb2, 0x69, 0x68
-		, 0x69, 0x8d, 0x8d, 0x64, 0x48, 0x6d, 0x44, 0x24, 0x49, 0x48, 0x49, 0xb2, 0x8d, 0x89, 0x89, 0x89
-		, 0x89, 0xad, 0xd1, 0xd2, 0xf6, 0xf2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xcd, 0xcd, 0xd1, 0xd2, 0xb1, 0x6d, 0x6d, 0x6d
-		, 0x6c, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x24, 0x24, 0x28, 0x28, 0x28, 0x28, 0x24, 0x24
-		, 0x24, 0x28, 0x28, 0x28, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xd6, 0x69, 0x69, 0x69, 0x69, 0x89, 0x68, 0x44, 0x8d, 0x91, 0x49, 0x44, 0x44, 0x44, 0x69, 0x8d
-		, 0x8d, 0x89, 0x8d, 0x89, 0x89, 0xad, 0xd1, 0xf2, 0xf6, 0xf6, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xad, 0xcd, 0xcd, 0xd1, 0xd2
-		, 0xb1, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x28, 0x48, 0x28, 0x24, 0x28, 0x28, 0x28
-		, 0x28, 0x28, 0x28, 0x24, 0x24, 0x28, 0x28, 0x48, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x69, 0x8d, 0x8d, 0x69, 0x89, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x69
-		, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0xad, 0xd1, 0xf2, 0xf6, 0xf2, 0xd1, 0xd2
-		, 0xf2, 0xf2, 0xf2, 0xf2, 0xd6, 0xf6, 0xd2, 0xd2, 0xd2, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd2, 0xcd
-		, 0xad, 0xcd, 0xcd, 0xd2, 0xb1, 0x69, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x28, 0x48, 0x28
-		, 0x29, 0x29, 0x28, 0x24, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x4c, 0x6d, 0xdb, 0xdb, 0xfb
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x69, 0x89, 0x8d, 0x69, 0x8d, 0x69, 0x68
-		, 0x89, 0x89, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x89, 0x89, 0xad, 0xd2, 0xf6
-		, 0xf6, 0xd2, 0xd2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xd2, 0xd2, 0xad, 0xad, 0xcd, 0xd2, 0xb1, 0x69, 0x48, 0x49, 0x48, 0x48, 0x48, 0x49
-		, 0x48, 0x48, 0x4d, 0x48, 0x28, 0x29, 0x29, 0x28, 0x24, 0x24, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-		, 0x6d, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x69, 0x8d
-		, 0x8d, 0x89, 0x69, 0x89, 0x89, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x89
-		, 0x89, 0xad, 0xd2, 0xf6, 0xf6, 0xd2, 0xd2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xd2, 0xad, 0xad, 0xd1, 0xd2, 0xb1, 0x6d, 0x6d, 0x6d
-		, 0x4d, 0x48, 0x48, 0x49, 0x4d, 0x4d, 0x4d, 0x48, 0x24, 0x28, 0x29, 0x29, 0x24, 0x28, 0x49, 0x49
-		, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0xdb, 0xdb, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xff, 0xdf, 0xff
-		, 0xff, 0xda, 0x69, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad
-		, 0xad, 0x8d, 0x8d, 0x89, 0x89, 0xad, 0xd2, 0xf6, 0xf6, 0xd2, 0xd2, 0xd2, 0xf2, 0xf2, 0xf2, 0xd2
-		, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd2
-		, 0xf6, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xd1, 0xad, 0xd1, 0xd1, 0xd2
-		, 0x91, 0x49, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x4d, 0x48, 0x28, 0x28, 0x49, 0x29
-		, 0x28, 0x49, 0x49, 0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x6c, 0xb7, 0xb7, 0xbb, 0xd7, 0xdb, 0xfb, 0xff
-		, 0xff, 0xff, 0xdb, 0xdb, 0xfb, 0xff, 0xb2, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xf2, 0xf2, 0xd2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xd1, 0xad
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0x8d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x4d
-		, 0x4d, 0x49, 0x49, 0x28, 0x29, 0x49, 0x28, 0x28, 0x48, 0x4d, 0x4c, 0x4c, 0x6d, 0xdb, 0xdb, 0xb7
-		, 0xb7, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xd6, 0x69, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0xad, 0xcd, 0xd2, 0xf6
-		, 0xf6, 0xf2, 0xd2, 0xd2, 0xd2, 0xf2, 0xf2, 0xd2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xad, 0xad, 0xb1
-		, 0xad, 0xb1, 0xb1, 0xd1, 0xf2, 0xd2, 0xd2, 0xb2, 0x69, 0x48, 0x48, 0x48, 0x49, 0x4d, 0x48, 0x48
-		, 0x48, 0x4c, 0x6d, 0x4d, 0x4d, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x4c, 0x6d
-		, 0x6d, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xdb, 0xfb, 0xff, 0xd6, 0x6d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89
-		, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2, 0xf6, 0xd6, 0xd6, 0x8d, 0x48, 0x48, 0x48, 0x49
-		, 0x4d, 0x4d, 0x48, 0x48, 0x4c, 0x4c, 0x4d, 0x4d, 0x4d, 0x29, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28
-		, 0x49, 0x48, 0x4d, 0x6d, 0x6d, 0xd6, 0xb6, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xdb, 0xd7, 0xb6, 0xdb
-		, 0xdb, 0xdb, 0xb6, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xf6, 0xd2, 0xd2, 0xd2, 0xf2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xb2, 0x69
-		, 0x49, 0x48, 0x48, 0x49, 0x48, 0x48, 0x48, 0x4d, 0x4c, 0x48, 0x4d, 0x6d, 0x4d, 0x28, 0x28, 0x28
-		, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x49, 0x48, 0xb6, 0xb6, 0xb6, 0xdb, 0xdb, 0xff, 0xff
-		, 0xff, 0xdb, 0xdb, 0xdb, 0xdb, 0xd7, 0xd6, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xf6, 0xf2, 0xd2
-		, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf6, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2
-		, 0xd6, 0xb2, 0x69, 0x49, 0x49, 0x48, 0x48, 0x49, 0x48, 0x48, 0x4d, 0x4d, 0x48, 0x48, 0x4d, 0x6d
-		, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0x28, 0x49, 0x48, 0x48, 0xfb, 0xdb, 0xb6
-		, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xb1, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6
-		, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf2, 0xf6, 0xf6
-		, 0xf6, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xd1, 0xd6, 0xd6, 0x8d, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x4d, 0x4d
-		, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x28, 0x24, 0x28, 0x49, 0x48
-		, 0x28, 0xff, 0xff, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xb2
-		, 0x69, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89
-		, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xf2, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd6, 0xb2, 0x6d, 0x48, 0x48, 0x49, 0x69, 0x68, 0x68
-		, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x4d, 0x48, 0x28, 0x48, 0x49, 0x28
-		, 0x24, 0x28, 0x49, 0x48, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xda, 0xd6, 0xd6
-		, 0xdb, 0xdb, 0xff, 0xda, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0x89, 0x89, 0xad, 0xad, 0xad, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xad, 0xad, 0xad, 0xcd
-		, 0xcd, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0x8d, 0x49, 0x49, 0x49
-		, 0x48, 0x69, 0x68, 0x68, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x48
-		, 0x4d, 0x48, 0x48, 0x28, 0x48, 0x49, 0x49, 0x48, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0x8d, 0x69, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xcd, 0xcd, 0xad
-		, 0x64, 0x89, 0xa9, 0xad, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2
-		, 0xb1, 0x6d, 0x6d, 0x6d, 0x49, 0x6d, 0x6d, 0x69, 0x69, 0x69, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x48
-		, 0x48, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x28, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x28, 0xff, 0xff, 0xfb
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x69, 0x89, 0x8d
-		, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0x89, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1
-		, 0xad, 0xad, 0xb1, 0xd6, 0xd6, 0xb2, 0xb1, 0xb2, 0x91, 0x91, 0x8d, 0x6d, 0x6d, 0x69, 0x6d, 0x6d
-		, 0x6d, 0x4d, 0x4d, 0x48, 0x48, 0x4d, 0x4c, 0x4c, 0x6d, 0x4d, 0x28, 0x48, 0x49, 0x48, 0x48, 0x48
-		, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xda, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89
-		, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xd2, 0xcd, 0xad, 0xd2, 0xd2, 0xf6, 0xd6, 0xf2
-		, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xb2, 0xb2, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb1, 0x91
-		, 0x91, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x48, 0x49, 0x6d, 0x4c, 0x4c, 0x6d, 0x4d, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0xba, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x69, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0x89, 0x89, 0x68, 0x68, 0x89, 0xad, 0xad, 0xad, 0xd2, 0xad, 0x8d, 0x8d, 0xd2
-		, 0xf6, 0xf6, 0xf2, 0xf6, 0xd2, 0x69, 0x8d, 0xd2, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xb6, 0xb2, 0xb6, 0xb6, 0xb6
-		, 0xd6, 0xd6, 0xb6, 0xb6, 0xb2, 0x91, 0x6d, 0x6d, 0x69, 0x6d, 0x6d, 0x49, 0x69, 0x6d, 0x48, 0x6d
-		, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xbb, 0xba, 0xbb, 0xdb, 0xdb, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x6d, 0x89, 0x8d, 0x8d, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x89, 0x69, 0x44, 0x44, 0x44, 0x69, 0x8d, 0x44
-		, 0x00, 0x00, 0x00, 0x20, 0x69, 0xb1, 0xd6, 0xf6, 0xf6, 0xad, 0x20, 0xb2, 0xd2, 0xd1, 0xd2, 0xd1
-		, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xad, 0xad, 0xad, 0xb1, 0xd6
-		, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xb6, 0xb6, 0xb1, 0x8d, 0x91, 0x91, 0x8d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0xbb, 0xbb, 0xbb
-		, 0xbb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x68
-		, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0x68, 0x20, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8d, 0xd6, 0x8d, 0x00, 0xb1
-		, 0xd6, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1
-		, 0xad, 0xad, 0xad, 0xd6, 0xda, 0xda, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xb6, 0xb6
-		, 0xb6, 0xd6, 0xb6, 0xb1, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x4d, 0x4c, 0x48, 0x48, 0x48
-		, 0x48, 0x96, 0x9a, 0xbb, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xfb
-		, 0xfb, 0xff, 0xfb, 0x8d, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0x68, 0x64, 0xad, 0xad, 0x8d, 0x44
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x20, 0x00, 0x00, 0xb2, 0xd6, 0xd2, 0xd1, 0xd1, 0xd1, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xda, 0xfa, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xd6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xda, 0xd6, 0xb6, 0xb6, 0x8d, 0x6d, 0x69, 0x48, 0x6d, 0x6d
-		, 0x4d, 0x4d, 0x48, 0x48, 0x48, 0x9b, 0x96, 0x96, 0x96, 0x9a, 0xba, 0xba, 0xbb, 0xbb, 0xdb, 0xdb
-		, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xfb, 0xff, 0xb1, 0x68, 0x89, 0x89, 0xad, 0xad, 0xad, 0x20, 0x48
-		, 0xb1, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xd6, 0xda, 0xda, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xda, 0xda, 0xda, 0xd6, 0xb6, 0x92, 0x91, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d
-		, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x4c, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x96
-		, 0x96, 0x96, 0x9a, 0xbb, 0xba, 0xbb, 0xdb, 0xdb, 0xdb, 0xdb, 0xfb, 0xd6, 0x69, 0x89, 0x8d, 0xad
-		, 0xad, 0xad, 0x24, 0x00, 0x69, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x8d, 0x89
-		, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x89, 0xb2, 0xb1, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xd6
-		, 0xfa, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xda, 0xda, 0xfa, 0xda, 0xda, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x91, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x96, 0x96, 0x9b
-		, 0x9a, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xba, 0xbb, 0xbb, 0xdb, 0xdb, 0xd6
-		, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x69, 0xad, 0xd1, 0xd1, 0xd2, 0xcd, 0xad, 0x8d, 0x89, 0x68, 0x69, 0x8d, 0xb2, 0xd2, 0xb1, 0xb1
-		, 0xb1, 0xd1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xb2, 0xff, 0xfb, 0xfa, 0xfa, 0xda, 0xda, 0xda, 0xd6, 0xda, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xda, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb6, 0x8d, 0x6d, 0x6d
-		, 0x6d, 0x72, 0x76, 0x96, 0x96, 0x96, 0x96, 0x76, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x9a, 0x96
-		, 0xba, 0xbb, 0xbb, 0xdb, 0x8d, 0x69, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0x69, 0x20, 0x00, 0x00, 0x00
-		, 0x00, 0x20, 0x44, 0x69, 0xad, 0xcd, 0xcd, 0xcd, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xcd, 0xd2
-		, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0xad, 0xb1, 0x69, 0x92, 0xff, 0xfb, 0xfa, 0xda, 0xda, 0xd6, 0xb6
-		, 0xb6, 0xda, 0xfa, 0xfa, 0xfa, 0xda, 0xda, 0xfa, 0xfa, 0xda, 0xd6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6
-		, 0xb6, 0xb6, 0xb2, 0xb2, 0x91, 0x72, 0x72, 0x76, 0x96, 0x96, 0x96, 0x96, 0x96, 0x9a, 0x9b, 0x9b
-		, 0x9a, 0x9a, 0x9a, 0x9a, 0x96, 0x96, 0xba, 0xbb, 0x91, 0x68, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad
-		, 0x89, 0x69, 0x68, 0x64, 0x69, 0x89, 0x89, 0x89, 0x89, 0x89, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9
-		, 0x89, 0x89, 0x89, 0x88, 0x88, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0xad, 0xb1, 0x69, 0x24, 0x92, 0xff, 0xfb
-		, 0xfb, 0xfb, 0xfa, 0xda, 0xd6, 0xda, 0xda, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xfa, 0xda, 0xda
-		, 0xda, 0xda, 0xda, 0xd6, 0xb6, 0xd6, 0xd6, 0xb6, 0xb6, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76
-		, 0x76, 0x76, 0x9a, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9a, 0xba, 0x92, 0x68, 0x89, 0x89
-		, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x65, 0x84, 0x89, 0x89, 0x89, 0xa9
-		, 0xa9, 0xa9, 0x89, 0x89, 0x89, 0x89, 0xa9, 0xa9, 0xad, 0xad, 0xd1, 0xd1, 0xb1, 0xad, 0xb1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0xad, 0xb1, 0x6d
-		, 0x24, 0x24, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xda, 0xda, 0xd6, 0xd6, 0xb6, 0xb6
-		, 0xb5, 0xb6, 0xd6, 0xda, 0xfa, 0xfb, 0xfb, 0xda, 0xda, 0xda, 0xd6, 0xb6, 0xb6, 0x96, 0x96, 0x96
-		, 0x72, 0x72, 0x72, 0x72, 0x52, 0x52, 0x72, 0x76, 0x76, 0x9a, 0x9b, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb
-		, 0xb6, 0x69, 0x68, 0x89, 0x8d, 0x8d, 0xad, 0x8d, 0x89, 0x8d, 0x89, 0x68, 0x64, 0x64, 0x64, 0x64
-		, 0x64, 0x84, 0x84, 0x85, 0x89, 0xa9, 0xad, 0xcd, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d
-		, 0xad, 0xad, 0xb1, 0x8d, 0x24, 0x24, 0x49, 0x92, 0xb6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xda
-		, 0xda, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xda, 0xda, 0xfb, 0xfb, 0xfb, 0xda, 0xda
-		, 0xd6, 0x97, 0xbb, 0x96, 0x96, 0x9b, 0x96, 0x96, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x96, 0x9a
-		, 0x9a, 0x9b, 0xbb, 0xbb, 0xbb, 0x8d, 0x68, 0x89, 0x89, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x89
-		, 0x68, 0x64, 0x64, 0x64, 0x89, 0x89, 0xa9, 0xcd, 0xce, 0xce, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0x8d, 0xad, 0xad, 0xb1, 0x8d, 0x24, 0x25, 0x25, 0x29, 0x49, 0x49, 0x6d, 0x92
-		, 0xfb, 0xff, 0xff, 0xfb, 0xfa, 0xda, 0xda, 0xda, 0xd6, 0xd6, 0xd6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6
-		, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0x76, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96
-		, 0x76, 0x76, 0x96, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0xbb, 0xb6, 0x68, 0x89, 0x89, 0x8d, 0xad, 0xad
-		, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xa9, 0xad, 0xce, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xad, 0x45, 0x24, 0x25, 0x25
-		, 0x49, 0x49, 0x29, 0x25, 0x49, 0xb6, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfa, 0xda, 0xda, 0xda
-		, 0xda, 0xda, 0xda, 0xd6, 0xda, 0xda, 0xfb, 0xfb, 0xfb, 0x72, 0x72, 0x76, 0x72, 0x72, 0x72, 0x76
-		, 0x96, 0x96, 0x96, 0x76, 0x76, 0x76, 0x76, 0x76, 0x96, 0x9a, 0x9b, 0x9b, 0xbb, 0xbb, 0x6d, 0x68
-		, 0x89, 0x89, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xa9, 0xad, 0xce
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1
-		, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1
-		, 0x49, 0x20, 0x25, 0x25, 0x25, 0x49, 0x49, 0x29, 0x25, 0x25, 0x6d, 0xdb, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xfa, 0xfa, 0xda, 0xda, 0xfa, 0xd6, 0xda, 0xda, 0xd6, 0x96, 0x96, 0x96
-		, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x76, 0x76, 0x76, 0x76, 0x76, 0x96
-		, 0x9a, 0xbb, 0x92, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89
-		, 0xa9, 0xad, 0xad, 0xad, 0xd2, 0xd2, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd1, 0xd1, 0xd1, 0xd1
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xb1, 0xb1, 0xb1, 0x69, 0x20, 0x25, 0x25, 0x25, 0x29, 0x49, 0x29, 0x25, 0x25, 0x25, 0x29
-		, 0x6d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xda, 0xda, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0x76, 0x72, 0x72, 0x76, 0x76, 0x76, 0x76, 0x96, 0x97, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b
-		, 0x96, 0x96, 0x96, 0x76, 0x96, 0x96, 0x49, 0x44, 0x68, 0x88, 0x89, 0x8d, 0x8d, 0x8d, 0x89, 0x89
-		, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad, 0xa9, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d
-		, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x20, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29
-		, 0x29, 0x29, 0x29, 0x25, 0x25, 0x25, 0x6d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0x96, 0x96, 0x96, 0x72, 0x72, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76
-		, 0x96, 0x96, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x6e, 0x00, 0x44, 0x68, 0x68, 0x88, 0x89
-		, 0x8d, 0x8d, 0x89, 0x88, 0x89, 0x89, 0x89, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89
-		, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad
-		, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0x8d, 0x24, 0x24, 0x25
-		, 0x25, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xb6, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x97, 0x9b, 0x9b, 0x9b, 0x96, 0x96, 0x96
-		, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x96, 0x96, 0x04, 0x00, 0x24
-		, 0x68, 0x68, 0x68, 0x88, 0x89, 0x89, 0x89, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d
-		, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1
-		, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xd1, 0xb1, 0xad
-		, 0x8d, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x24, 0x49, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0x96, 0x96, 0x96
-		, 0x9b, 0x9b, 0x96, 0x96, 0x9b, 0x96, 0x76, 0x96, 0x96, 0x96, 0x76, 0x76, 0x96, 0x96, 0x96, 0x72
-		, 0x29, 0x00, 0x00, 0x24, 0x69, 0x68, 0x68, 0x68, 0x88, 0x89, 0x89, 0x88, 0x89, 0x89, 0x89, 0x89
-		, 0x8d, 0xad, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0xad, 0xb1, 0xb1
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0x44, 0x20, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xfa, 0x76, 0x96, 0x96, 0x76, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x76, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0x97, 0x72, 0x29, 0x04, 0x00, 0x00, 0x20, 0x69, 0x68, 0x68, 0x68, 0x68, 0x88, 0x89, 0x88
-		, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x8d, 0x8d
-		, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0xb1, 0x44, 0x20, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6d, 0x96
-		, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x96, 0x96, 0x96, 0x96, 0x76, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96
-		, 0x76, 0x72, 0x96, 0x96, 0x72, 0x29, 0x25, 0x24, 0x00, 0x00, 0x00, 0x20, 0x69, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x88, 0x88, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xa9, 0x89, 0xad, 0xad, 0xad, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x8d
-		, 0x89, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0x49, 0x00, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x49, 0x92, 0xb6, 0xff, 0xff, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x92, 0x4d, 0x05, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x20
-		, 0x68, 0x89, 0x88, 0x68, 0x68, 0x68, 0x68, 0x88, 0x89, 0x89, 0x89, 0xad, 0xad, 0x89, 0xad, 0xad
-		, 0xad, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0xad
-		, 0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xb1, 0xb1
-		, 0xb1, 0x49, 0x00, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x25, 0x25, 0x25, 0x29, 0x49, 0x6e, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x4e, 0x25, 0x05, 0x25, 0x29, 0x24, 0x00
-		, 0x00, 0x00, 0x00, 0x24, 0x68, 0x89, 0x89, 0x68, 0x68, 0x64, 0x68, 0x68, 0x89, 0x89, 0x89, 0x8d
-		, 0x89, 0x89, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1
-		, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1
-		, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0x49, 0x00, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29
-		, 0x49, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x76, 0x96, 0x96, 0x4d, 0x25, 0x04, 0x04, 0x25
-		, 0x25, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x89, 0x89, 0x89, 0x88, 0x64, 0x64, 0x68
-		, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad
-		, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0x49, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25
-		, 0x25, 0x05, 0x05, 0x25, 0x29, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x4e, 0x25, 0x00
-		, 0x04, 0x04, 0x04, 0x04, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x89, 0x89, 0x89
-		, 0x89, 0x88, 0x64, 0x64, 0x68, 0x88, 0x89, 0x89, 0x89, 0x89, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xd1
-		, 0xd2, 0xd2, 0xd1, 0xb1, 0xd1, 0xb1, 0xad, 0xb1, 0xad, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0x49, 0x20, 0x24
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25, 0x05, 0x05, 0x25, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92
-		, 0x29, 0x00, 0x00, 0x25, 0x04, 0x04, 0x24, 0x04, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-		, 0x68, 0x89, 0x89, 0x8d, 0x89, 0x89, 0x68, 0x64, 0x64, 0x68, 0x88, 0x89, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x89, 0x8d
-		, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0x44, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x05, 0x29, 0x25, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x96, 0x96, 0x96
-		, 0x96, 0x96, 0x4e, 0x25, 0x00, 0x00, 0x25, 0x24, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x24, 0x68, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x68, 0x68, 0x64, 0x68, 0x89
-		, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89
-		, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x44, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x29, 0x05, 0x05, 0x25, 0x25, 0x25
-		, 0x05, 0x97, 0x96, 0x72, 0x4d, 0x29, 0x00, 0x00, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x64, 0x69, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89
-		, 0x68, 0x68, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d
-		, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xb1, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x24, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x29, 0x25
-		, 0x04, 0x25, 0x25, 0x25, 0x25, 0x4e, 0x29, 0x05, 0x05, 0x00, 0x00, 0x04, 0x05, 0x04, 0x00, 0x00
-		, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x64, 0x68, 0x89, 0x89
-		, 0x89, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x68, 0x68, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xad
-		, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x24, 0x20, 0x24
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05
-		, 0x05, 0x25, 0x29, 0x25, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x04, 0x04
-		, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44
-		, 0x64, 0x68, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69
-		, 0x69, 0x89, 0x89, 0x89, 0x89, 0x69, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad
-		, 0x8d, 0x24, 0x20, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x25, 0x25, 0x25
-		, 0x05, 0x05, 0x25, 0x05, 0x05, 0x25, 0x25, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00
-		, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x44, 0x64, 0x68, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x69, 0x68
-		, 0x68, 0x68, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x24, 0x20, 0x24, 0x05, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05
-		, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x25, 0x04, 0x00, 0x04, 0x04, 0x05, 0x05
-		, 0x05, 0x05, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x64, 0x64, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d
-		, 0x89, 0x89, 0x89, 0x68, 0x68, 0x68, 0x69, 0x69, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1
-		, 0xd1, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x24, 0x00, 0x04, 0x05, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x05, 0x05, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25, 0x05, 0x25, 0x25, 0x04, 0x00, 0x00
-		, 0x00, 0x04, 0x04, 0x05, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x64, 0x68, 0x89
-		, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x69, 0x69, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x69, 0x24, 0x00, 0x24
-		, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x05, 0x05, 0x25, 0x05, 0x05, 0x25
-		, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00
-		, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-		, 0x69, 0x44, 0x68, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x69
-		, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d
-		, 0x69, 0x24, 0x20, 0x04, 0x05, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25
-		, 0x05, 0x05, 0x05, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x20, 0x49, 0x64, 0x64, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x89, 0x69, 0x69, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xad, 0xad, 0xad, 0x8d, 0x69, 0x24, 0x20, 0x04, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x05, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x68, 0x44, 0x68, 0x89, 0x89, 0x89, 0x89
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x69, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1
-		, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x68, 0x24, 0x00, 0x04, 0x05, 0x25, 0x25, 0x25
-		, 0x05, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x04, 0x04, 0x00
-		, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x69, 0x64, 0x68
-		, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x69, 0x68, 0x69, 0x8d, 0x8d
-		, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x69, 0x44, 0x20, 0x04
-		, 0x05, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x00, 0x00
-		, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x24, 0x69, 0x68, 0x68, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x69
-		, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x89
-		, 0x69, 0x24, 0x00, 0x04, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05
-		, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x69, 0x68, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x89, 0x69, 0x68, 0x68, 0x89, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad
-		, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x24, 0x00, 0x24, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x25, 0x05, 0x05, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x69, 0x68, 0x69, 0x89, 0x89, 0x89
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x8d, 0xad, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x24, 0x00, 0x24, 0x05, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x25, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x69, 0x69
-		, 0x69, 0x69, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68
-		, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1
-		, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x49, 0x24, 0x00, 0x24
-		, 0x25, 0x25, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x05, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x69, 0x69, 0x69, 0x69, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x89, 0x8d, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x69
-		, 0x44, 0x20, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x49, 0x69, 0x69, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0x8d, 0x89, 0x69, 0x44, 0x20, 0x00, 0x00, 0x05, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25
-		, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x04, 0x04, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x69, 0x69, 0x89, 0x89, 0x89
-		, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89
-		, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x45, 0x24, 0x04, 0x00, 0x05, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04
-		, 0x05, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x69
-		, 0x69, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1
-		, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x89, 0x69, 0x24, 0x00, 0x25, 0x04
-		, 0x05, 0x25, 0x25, 0x25, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x04, 0x05, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x20, 0x69, 0x69, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x69
-		, 0x24, 0x00, 0x25, 0x25, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89
-		, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0x8d, 0x8d, 0x69, 0x20, 0x00, 0x04, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x69, 0x89, 0x89, 0x89
-		, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xa9, 0x89, 0x8d, 0x45, 0x20, 0x00, 0x00, 0x04, 0x25, 0x25, 0x00, 0x00
-		, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00
-		, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00
-		, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-		, 0x69, 0x8d, 0x89, 0x89, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad
-		, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x69, 0x24, 0x24, 0x24, 0x00, 0x04
-		, 0x25, 0x25, 0x25, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x00
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x04, 0x00, 0x00, 0x20, 0x20, 0x69, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x49, 0x00
-		, 0x00, 0x04, 0x04, 0x04, 0x04, 0x25, 0x25, 0x25, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x20, 0x20, 0x44, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89
-		, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad
-		, 0xad, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x25, 0x25, 0x25, 0x05, 0x05, 0x04
-		, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00
-		, 0x00
-		};
+// Palettes, entry 0 is transparent
 
-const char franc_bitmap[10002] = {
-		0x64, 0x64, 0x49, 0x49, 0xb6, 0xb6, 0x49, 0x24, 0x24, 0x25, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x69, 0x69, 0x69, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49
-		, 0x48, 0x48, 0x48, 0x48, 0x91, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xb6, 0xb2, 0xb6, 0xb6, 0xb2, 0xb6
-		, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x6d, 0x6d, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0xb6, 0x49, 0x24, 0x49, 0x49, 0x49, 0x24, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6d, 0x6d, 0x6d, 0x24, 0x24, 0x28, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x49, 0x49, 0x4d, 0x49, 0x29, 0x28, 0x24, 0x6d, 0xd6, 0xdb, 0xdb, 0xdb, 0xd6, 0xb6, 0x92, 0x92
-		, 0x92, 0x92, 0x91, 0x91, 0xb6, 0xb6, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0x92
-		, 0x92, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x91, 0x6d, 0x71, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0x92, 0x92, 0xb6, 0x49, 0x24, 0x49
-		, 0x28, 0x24, 0x24, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24, 0x49, 0x71, 0x91, 0x49, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28, 0x28, 0x28, 0x24, 0x28, 0x71, 0x92, 0x92, 0x72, 0x6d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x91, 0xb6, 0xb6, 0xb2, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0xb2, 0xb2, 0x92, 0x92, 0x92
-		, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x91, 0x6d, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb6, 0x92
-		, 0xb6, 0x49, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x6d
-		, 0x49, 0x48, 0x48, 0x48, 0x24, 0x24, 0x24, 0x04, 0x04, 0x24, 0x48, 0x48, 0x24, 0x24, 0x49, 0x49
-		, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x71, 0x6d, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0x6d, 0x24, 0x24, 0x48, 0x69, 0x69, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x4d, 0x6d, 0x91, 0x71, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x8d, 0x6d
-		, 0x6d, 0x8d, 0x8d, 0x91, 0x91, 0x8d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x6d, 0x24, 0x00, 0x04, 0x24, 0x24, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0x92
-		, 0x92, 0xb2, 0xb2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x71, 0x6d, 0x72, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0xdb, 0xb6, 0x91, 0xb6, 0x6d, 0x49, 0x49, 0x6d, 0x91, 0x6d, 0x6d
-		, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x92, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x49, 0x6d, 0x91, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x71, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x96, 0x96, 0x6d, 0x49, 0x24, 0x48, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x92, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x72, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x71, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x6e, 0x92, 0x6d, 0x6e, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6e, 0x6e, 0x72, 0x71, 0x6d
-		, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6
-		, 0xb7, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x28, 0x24, 0x24, 0x24, 0x6e, 0x92, 0x6d
-		, 0x92, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e
-		, 0x92, 0x92, 0x71, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x28
-		, 0x24, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x4d, 0x49, 0x49, 0x6e, 0x92, 0x92, 0x92, 0x72
-		, 0x49, 0x25, 0x29, 0x6d, 0x72, 0x72, 0x91, 0x91, 0x91, 0x91, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x69, 0x6d, 0x8d, 0x92, 0x92, 0x6d, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49
-		, 0x49, 0x48, 0x48, 0x24, 0x24, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x49, 0x04, 0x24, 0x6e
-		, 0x92, 0x72, 0x72, 0x72, 0x49, 0x24, 0x29, 0x6d, 0x6e, 0x72, 0x92, 0x91, 0x8d, 0x69, 0x49, 0x48
-		, 0x69, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x69, 0x6d, 0x8d, 0x6d, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x4d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72
-		, 0x6e, 0x4d, 0x4d, 0x72, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x6d, 0x48
-		, 0x48, 0x48, 0x69, 0x68, 0x68, 0x69, 0x6d, 0x68, 0x6d, 0x91, 0x8d, 0x8d, 0x69, 0x48, 0x49, 0x4d
-		, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x49, 0x6d, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6
-		, 0xb7, 0x49, 0x49, 0x28, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72
-		, 0x6d, 0x6d, 0x48, 0x69, 0x69, 0x44, 0x69, 0x68, 0x6d, 0x48, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x69, 0x48, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d
-		, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-		, 0x24, 0x24, 0x44, 0x44, 0x24, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x6d, 0x24, 0x24, 0x24, 0x24
-		, 0x00, 0x49, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x72, 0x6e, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x68, 0x6d, 0x68, 0x69, 0x69, 0x68, 0x6d
-		, 0x6d, 0x8d, 0x8d, 0x68, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91
-		, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0x00, 0x24, 0x24, 0x24, 0x20, 0x00, 0x24
-		, 0x20, 0x00, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d
-		, 0x28, 0x24, 0x24, 0x24, 0x04, 0x49, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x4d, 0x29, 0x25, 0x6d
-		, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x49, 0x25, 0x91, 0xb1, 0x91, 0xb1, 0x8d, 0x6d, 0x8d, 0x6d, 0x68
-		, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x69, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x91, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb7, 0xb7, 0x24, 0x6d, 0x91
-		, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x28, 0x28, 0x49, 0x49, 0x28, 0x28, 0x24, 0x24, 0x04, 0x29, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72
-		, 0x4d, 0x24, 0x25, 0x6d, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x25, 0x4d, 0xdb, 0xb6, 0xb6, 0xb2, 0x91
-		, 0x91, 0xb2, 0x91, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0x8d, 0x68, 0x68, 0x44
-		, 0x48, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x6d, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x71, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb7
-		, 0xb7, 0x04, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x24, 0x24, 0x49, 0x49, 0x49, 0x28, 0x24, 0x24, 0x24, 0x24, 0x72, 0x72
-		, 0x72, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x92, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x6d, 0xb6, 0xb6
-		, 0xb6, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xb6, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xad, 0xad, 0xad, 0x8d, 0x44, 0x48, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49
-		, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x6d, 0x71, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0xb7, 0xb7, 0x00, 0x48, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x49, 0x28, 0x24, 0x49, 0x49, 0x49, 0x6d, 0x49, 0x24
-		, 0x69, 0x69, 0x8d, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x8d, 0x8d, 0xb6, 0xd6, 0xdb, 0xfb, 0xdb, 0xd6, 0xda, 0xb6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xd2, 0xd6, 0xb1, 0xd1, 0xd1, 0xb1, 0xd1, 0xb1, 0x69, 0x44, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x49, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x6d
-		, 0x6d, 0x71, 0x92, 0x92, 0x92, 0x92, 0x96, 0xb7, 0xb7, 0x00, 0x48, 0x49, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x49, 0x24, 0x24, 0x49, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x29, 0x24, 0x49, 0x49
-		, 0x6e, 0xb6, 0x92, 0x69, 0x8d, 0x89, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x6d, 0xd6, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb
-		, 0xfa, 0xda, 0xfa, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd1, 0xb1, 0xb1, 0x8d, 0x44, 0x48, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x6d, 0x92, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x91, 0x6d, 0x6d, 0x71, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb7, 0xb7, 0x00, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49
-		, 0x29, 0x29, 0x49, 0x4e, 0x72, 0xbb, 0xb6, 0x24, 0x04, 0x00, 0x00, 0x49, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x92, 0x92, 0x6e, 0x6d, 0x92, 0xdb, 0xdb, 0xfb, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1
-		, 0x8d, 0x44, 0x44, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x6d, 0x92, 0x92, 0x91
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x96, 0xb7
-		, 0xb7, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x49, 0x49, 0x49, 0x49
-		, 0x6d, 0x4d, 0x49, 0x49, 0x28, 0x49, 0x49, 0x49, 0x6e, 0xbb, 0xb6, 0x04, 0x24, 0x6d, 0x24, 0x49
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x6d, 0x92, 0xdb
-		, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6
-		, 0xd2, 0xd2, 0xd1, 0xb1, 0x8d, 0x44, 0x44, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49
-		, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x91, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0xbb, 0xb6, 0x04
-		, 0x4d, 0xbb, 0x49, 0x49, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72
-		, 0x72, 0x6d, 0x92, 0xdb, 0xdb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xd1, 0xb1, 0x8d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x49, 0x49, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d
-		, 0x6d, 0x6d, 0x71, 0x72, 0x92, 0x72, 0x72, 0x72, 0x72, 0x91, 0x91, 0x6d, 0x91, 0x91, 0x49, 0x24
-		, 0x24, 0x24, 0x24, 0x49, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x96, 0xb6, 0x04, 0x25, 0x49, 0x04, 0x4d, 0x92, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x72, 0x92, 0x6d, 0x8d, 0xdb, 0xdb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd1, 0xb1, 0x8d, 0x48, 0x48, 0x69
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x69, 0x49, 0x49, 0x49, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-		, 0x91, 0x91, 0x71, 0x6d, 0x6d, 0x6d, 0x71, 0x72, 0x92, 0x72, 0x72, 0x72, 0x72, 0x91, 0x91, 0x91
-		, 0x91, 0x91, 0x6d, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49
-		, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x96, 0xbb, 0x4d, 0x49, 0x6d, 0x6d, 0xb6, 0xb6, 0xd6, 0xdb, 0xb6
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0xd7, 0xfb, 0xfb, 0xfb, 0xff
-		, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1
-		, 0xad, 0x68, 0x69, 0x69, 0x69, 0x69, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x8d
-		, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72
-		, 0x72, 0xb5, 0x91, 0x91, 0x92, 0x92, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x91, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb6, 0xb6, 0xdb, 0xda, 0xda, 0xda
-		, 0xda, 0xda, 0xda, 0xd6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0xd6
-		, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0x8d, 0x68, 0x69, 0x6d, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x92
-		, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x71, 0x72, 0x72, 0x72, 0x72, 0xb6, 0x91, 0x6d, 0x6e, 0x72, 0x96, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda
-		, 0xfb, 0xda, 0xda, 0xd6, 0xda, 0xda, 0xb6, 0xb6, 0x92, 0x6d, 0x6d, 0x6e, 0x6e, 0x72, 0x72, 0x72
-		, 0x6e, 0x6d, 0x6d, 0xb6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xb2, 0xb2, 0xd6, 0xd6, 0xb1, 0xad, 0xb1, 0x8d, 0x68, 0xad, 0x8d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x49, 0x6d, 0x6d, 0x69, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x72, 0x72, 0x72, 0x72, 0x6d, 0x4d, 0x4d, 0x4e, 0x4d, 0x72, 0xb6
-		, 0xd6, 0xb6, 0xb6, 0xd6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xb6, 0xd6, 0xd6, 0xb6, 0xda, 0xfb, 0xda
-		, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0x8d, 0x6d, 0x6e
-		, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0xb6, 0xdb, 0xfb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xb2, 0xad, 0xad, 0x8d, 0x8d, 0x91, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0xa9
-		, 0x89, 0x6d, 0x49, 0x49, 0x24, 0x04, 0x00, 0x24, 0x24, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x24, 0x49
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x72, 0x72, 0x4d, 0x6e, 0x4e
-		, 0x4d, 0x4d, 0x4e, 0xb6, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xfa
-		, 0xda, 0xd6, 0xfb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xdb, 0xdb, 0xfb, 0xdb
-		, 0xb6, 0xb1, 0xb1, 0xb1, 0xb2, 0xfb, 0xfa, 0xb1, 0xad, 0xad, 0x8d, 0x8e, 0x6d, 0x8d, 0x8d, 0xb1
-		, 0xb1, 0xb1, 0x8d, 0xad, 0xa9, 0x69, 0x48, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x69, 0x6d
-		, 0x6d, 0x49, 0x24, 0x48, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x71
-		, 0x71, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4e, 0x72, 0xdb, 0xfb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda
-		, 0xda, 0xd6, 0xb6, 0xd6, 0xd6, 0xb6, 0xda, 0xdb, 0xda, 0xda, 0xb6, 0xb6, 0xd6, 0xda, 0xda, 0xda
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0xb6, 0xb6, 0xb6
-		, 0xdb, 0xd6, 0xb6, 0x8e, 0x6d, 0x8d, 0xad, 0xb2, 0xd6, 0xff, 0xfb, 0xb1, 0xb1, 0xb2, 0xb2, 0xb6
-		, 0xb2, 0xb2, 0xb2, 0xd2, 0xd2, 0xb1, 0x8d, 0xcd, 0xad, 0x69, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00
-		, 0x24, 0x24, 0x49, 0x6d, 0x6d, 0x6d, 0x49, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49
-		, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6e, 0x6e, 0xb6, 0xdb, 0xda, 0xda
-		, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xd6, 0xd6, 0xd6, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x6d, 0x6d, 0x49, 0x49, 0x4d, 0x49
-		, 0x49, 0x8d, 0xd6, 0xb6, 0xdb, 0xb6, 0xb2, 0xb6, 0x92, 0xb2, 0xb2, 0xd6, 0xdb, 0xfb, 0xfb, 0xd2
-		, 0xb2, 0xd6, 0xb6, 0xb2, 0xb2, 0xb2, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0xad, 0xad, 0x69, 0x49, 0x49
-		, 0x49, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x8d, 0x91, 0x6d, 0x49, 0x24
-		, 0x24, 0x00, 0x00, 0x04, 0x24, 0x24, 0x49, 0x49, 0x6d, 0x4d, 0x4d, 0x72, 0x72, 0x72, 0x72, 0x4e
-		, 0x92, 0xbb, 0xdb, 0xdb, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xd6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x91, 0x49, 0x6d
-		, 0x6d, 0x49, 0x25, 0x05, 0x00, 0x69, 0xd2, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb2, 0xd6, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xd2, 0xd1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xad
-		, 0xad, 0x69, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x69, 0x6d, 0x6d, 0x6d
-		, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x69, 0x49, 0x24, 0x49, 0x69, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x6e
-		, 0x6d, 0x4d, 0x6d, 0x6e, 0x6e, 0xb6, 0xdb, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6
-		, 0xb6, 0xb6, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x92
-		, 0x92, 0x6d, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x29, 0x00, 0x44, 0xd6, 0xb6, 0xdb, 0xfb, 0xfb, 0xdb
-		, 0xdb, 0xdb, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd2, 0xd1, 0xd2, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xd2, 0xb1, 0xad, 0xad, 0xad, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x48, 0x24, 0x00, 0x00, 0x24, 0x24
-		, 0x48, 0x49, 0x49, 0x6d, 0x6d, 0x6e, 0x8e, 0x8e, 0x92, 0x92, 0x6e, 0x6d, 0x6d, 0x92, 0x92, 0x92
-		, 0x92, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x6e, 0x6e, 0x92, 0xb6, 0xb6, 0xb6, 0x96, 0x96, 0x92
-		, 0x92, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x91
-		, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x6d, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x44, 0xb2, 0xd6
-		, 0xdb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd1, 0xb1, 0xd6, 0xd6
-		, 0xd6, 0xf6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0xd1, 0xad, 0x6d, 0x8d, 0x6d, 0x49, 0x49, 0x24, 0x24
-		, 0x00, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x49, 0x45, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0x92, 0x6e, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xb6, 0xb6
-		, 0x96, 0x92, 0x92, 0x92, 0xb6, 0x92, 0x92, 0x6d, 0x6d, 0x6d, 0x71, 0x91, 0x92, 0x91, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x91, 0x92, 0x6d, 0x49, 0x49, 0x00, 0x00, 0x25, 0x49
-		, 0x69, 0x69, 0xb2, 0xd7, 0xd7, 0xdb, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xdb, 0xdb, 0xfb, 0xfb, 0xd6
-		, 0xd1, 0xb1, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0xad, 0xad, 0xd2, 0xb1, 0xb2, 0x91, 0x6d
-		, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x24
-		, 0x24, 0x24, 0x49, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0x91, 0x24, 0x49, 0x29, 0x29, 0x49, 0x4e, 0x6e
-		, 0x6e, 0x72, 0xb6, 0xb6, 0x92, 0x92, 0x6d, 0x71, 0x96, 0x92, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x91, 0x6d, 0x24, 0x24
-		, 0x00, 0x00, 0x25, 0x04, 0x24, 0x44, 0x8d, 0xd7, 0xd7, 0xdb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6
-		, 0xd7, 0xd7, 0xd6, 0xb1, 0xad, 0xb1, 0xb1, 0xd2, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xad, 0x8d
-		, 0xb2, 0xb2, 0x8d, 0x69, 0x49, 0x44, 0x24, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x49, 0x69, 0x6d, 0x92, 0x92, 0x92, 0x91, 0x49, 0x29, 0x29
-		, 0x29, 0x49, 0x4e, 0x6e, 0x6e, 0x6d, 0x92, 0x92, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x49, 0x24, 0x24, 0x04, 0x29, 0x29, 0x29, 0x29, 0x24, 0x24, 0xd6, 0xdb, 0xdb, 0xfb, 0xfb
-		, 0xfb, 0xd6, 0xd6, 0xfb, 0xad, 0x8d, 0xb2, 0x89, 0x88, 0xad, 0xd1, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2
-		, 0xb1, 0xb1, 0x8d, 0x69, 0x6d, 0x6d, 0x49, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8d, 0x91, 0x92, 0xb2, 0x92
-		, 0x92, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4e, 0x4e, 0x6e, 0x4d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6e, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x4d, 0x6d, 0x6d, 0x69, 0x48, 0x44, 0x48, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29, 0x04, 0x6d
-		, 0xfb, 0xd7, 0xfb, 0xfb, 0xdb, 0xd6, 0xdb, 0xfb, 0xd7, 0xd7, 0xd6, 0xb2, 0xb1, 0xb2, 0xd2, 0xd2
-		, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1, 0xad, 0x6d, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0xb2, 0x92, 0x92, 0x92, 0x6d, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x6e, 0x6e, 0x49, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x4d, 0x49, 0x49, 0x6d, 0x49, 0x48, 0x49, 0x25, 0x49, 0x49, 0x25, 0x24, 0x24
-		, 0x29, 0x29, 0x29, 0x49, 0xb6, 0xd7, 0xdb, 0xdb, 0xd6, 0xd6, 0xfb, 0xdb, 0xfb, 0xfb, 0xdb, 0xdb
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x24, 0x24, 0x24, 0x48
-		, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x91, 0x91, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2
-		, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x92, 0x92, 0x92, 0xb6, 0x6d, 0x49, 0x4d, 0x4d, 0x4e, 0x6e
-		, 0x4d, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x49, 0x4d
-		, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x69, 0x8d, 0x49, 0x49
-		, 0x6d, 0x49, 0x24, 0x24, 0x49, 0x4d, 0x6e, 0x4d, 0x6d, 0xb6, 0xdb, 0xd6, 0xd6, 0xdb, 0xdb, 0xfb
-		, 0xfb, 0xfb, 0xdb, 0xfb, 0xd6, 0xd2, 0xd2, 0xad, 0xad, 0xb1, 0xd6, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d
-		, 0x29, 0x24, 0x24, 0x49, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb2, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xb2, 0xb6, 0xb2, 0xb2, 0xb2, 0x92, 0xb6, 0x6d, 0x49
-		, 0x4d, 0x4d, 0x6e, 0x6e, 0x49, 0x29, 0x6d, 0x6e, 0x72, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x92, 0x49, 0x29, 0x6d, 0x49, 0x49, 0x6d, 0x8d, 0x6d, 0x4d, 0x4d, 0x4d, 0x92, 0xd7, 0xd6
-		, 0xda, 0xda, 0xb2, 0xb2, 0xb2, 0xb2, 0xae, 0xad, 0xad, 0x89, 0x89, 0x8d, 0xb1, 0xb2, 0xd2, 0xb1
-		, 0xb1, 0xad, 0x8d, 0x92, 0x6d, 0x4d, 0x49, 0x6d, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb2
-		, 0xb2, 0x6d, 0x24, 0x29, 0x4d, 0x4d, 0x4e, 0x4d, 0x49, 0x4d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x49
-		, 0x6d, 0x6d, 0x6d, 0x69, 0x6d, 0x91, 0x49, 0x24, 0x6d, 0x6d, 0x24, 0x29, 0x49, 0x29, 0x25, 0x49
-		, 0x6e, 0x72, 0xb6, 0xd6, 0xdb, 0xd6, 0xb6, 0xd6, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xad, 0xad, 0xd2
-		, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0x8d, 0xad, 0xb2, 0xb6, 0x96, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0x92, 0x6d, 0x6d, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x24, 0x24, 0x49, 0x4d, 0x4d, 0x4d, 0x49, 0x6d, 0x71, 0x6d, 0x4d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49
-		, 0x49, 0x4d, 0x6d, 0x49, 0x4d, 0x49, 0x49, 0x6d, 0x6d, 0x91, 0x49, 0x24, 0x6d, 0x91, 0x49, 0x49
-		, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0x92, 0xb6, 0xd7, 0xdb, 0xdb, 0xdb, 0xfb, 0xd6, 0xd2, 0xb2, 0xb2
-		, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0xad, 0x8d, 0xad, 0xb1, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0x92, 0x6d, 0x4d, 0x48, 0x24, 0x24, 0x6d, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x6d, 0x6e, 0x6d, 0x49, 0x49, 0x49, 0x49
-		, 0x6d, 0x6d, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d
-		, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x69, 0x48
-		, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0xb2, 0xb2, 0x92, 0x92, 0xb6, 0xd6, 0xd6, 0xdb, 0xdb
-		, 0xda, 0xd6, 0xd6, 0xb2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xb2, 0xb1, 0xb1, 0x8d, 0xad, 0xb1, 0xb1
-		, 0xb1, 0x91, 0x6d, 0x49, 0x24, 0x04, 0x00, 0x24, 0x00, 0x24, 0x91, 0x92, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x6d, 0x91, 0x6d
-		, 0x69, 0x49, 0x49, 0x6d, 0x69, 0x69, 0x69, 0x49, 0x69, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d
-		, 0x6d, 0x49, 0x24, 0x49, 0x24, 0x04, 0x49, 0x25, 0x25, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x25, 0x29
-		, 0x69, 0x91, 0x91, 0x8d, 0x8d, 0x92, 0x91, 0x6d, 0x6d, 0x6d, 0x8d, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0xd6, 0xd6, 0xdb, 0xdb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0x8d
-		, 0x8d, 0xb1, 0xb1, 0xb1, 0xd1, 0x8d, 0x24, 0x00, 0x24, 0x24, 0x49, 0x6d, 0x49, 0x49, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xb6, 0xb6, 0x91, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x49, 0x6d, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x6d, 0x69, 0x6d, 0x49
-		, 0x49, 0x6d, 0x4d, 0x6d, 0x6d, 0x24, 0x00, 0x24, 0x24, 0x00, 0x29, 0x49, 0x25, 0x49, 0x6d, 0x49
-		, 0x4d, 0x29, 0x29, 0x6d, 0x72, 0x92, 0x91, 0x91, 0x91, 0x91, 0x92, 0x6d, 0x6d, 0x6d, 0x8d, 0x6d
-		, 0x4d, 0x71, 0x92, 0x6e, 0x92, 0xd6, 0xdb, 0xdb, 0xfb, 0xfb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2
-		, 0xb2, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xd1, 0x69, 0x45, 0x69, 0x6d, 0x92
-		, 0x4d, 0x49, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xb6, 0xb6, 0xb2, 0x49
-		, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x6d, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x49, 0x00, 0x49, 0x4d, 0x4d, 0x4d, 0x29, 0x00, 0x24, 0x29, 0x24, 0x24, 0x49
-		, 0x49, 0x49, 0x6d, 0x49, 0x6d, 0x49, 0x49, 0x6d, 0x72, 0x72, 0x91, 0x6d, 0x6d, 0x91, 0xb2, 0x6d
-		, 0x6d, 0x91, 0xb6, 0x92, 0x6d, 0x6d, 0x72, 0x72, 0x92, 0xb6, 0xb6, 0xd6, 0xdb, 0xdb, 0xd6, 0xb6
-		, 0xd6, 0xb6, 0xb2, 0xb2, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xf6, 0x8d
-		, 0x20, 0x45, 0x49, 0x8e, 0x69, 0x6d, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xb6, 0xb6
-		, 0x91, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x49, 0x69, 0x49, 0x49, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x00, 0x48, 0x49, 0x49, 0x4e, 0x4e, 0x29, 0x24
-		, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x49, 0x6d, 0x49, 0x4d, 0x6d, 0x72, 0x6e, 0x91, 0x91
-		, 0x8d, 0x91, 0xb6, 0x92, 0x91, 0xb6, 0xb6, 0x92, 0x6d, 0x92, 0x92, 0x92, 0xb2, 0x8e, 0x92, 0xb6
-		, 0xb6, 0xb6, 0xb2, 0xb1, 0xb2, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xd6, 0xd6, 0x24, 0x25, 0x65, 0x45, 0x45, 0x69, 0x8d, 0xd6, 0xda, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xb6, 0x92, 0x6d, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x6d
-		, 0x8d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x49, 0x24, 0x29
-		, 0x4d, 0x4e, 0x4e, 0x49, 0x49, 0x6d, 0x4d, 0x49, 0x6d, 0x6d, 0x49, 0x49, 0x4d, 0x49, 0x6d, 0x8d
-		, 0x6e, 0x92, 0x92, 0x92, 0x91, 0x91, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6e
-		, 0x6a, 0x4a, 0x8e, 0xd7, 0x92, 0x8d, 0x8d, 0x8d, 0x6d, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0xb2, 0xb2
-		, 0xb2, 0xb2, 0xb2, 0xb1, 0xd2, 0xd6, 0x6d, 0x00, 0x45, 0x45, 0x45, 0x65, 0x45, 0x45, 0x69, 0xb2
-		, 0xd6, 0xb6, 0xb1, 0x91, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x8d, 0x8d, 0x8d, 0x92, 0x92, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x49, 0x49, 0x24, 0x49, 0x4d, 0x4d, 0x4e, 0x4e, 0x4e, 0x6d, 0x4d, 0x49, 0x4d, 0x4e, 0x4d, 0x49
-		, 0x4d, 0x4d, 0x49, 0x91, 0x8d, 0x91, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x6d, 0x49, 0x6e
-		, 0x6e, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0xb7, 0xd7, 0x92, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb2
-		, 0xb2, 0xb2, 0xd2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xd6, 0xd6, 0x20, 0x25, 0x45, 0x45, 0x65, 0x69
-		, 0x69, 0x65, 0x65, 0x65, 0x69, 0x8d, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x6d, 0x69, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x92, 0x6d, 0x49, 0x49, 0x29, 0x49, 0x49, 0x6d, 0x4d, 0x4d, 0x6e, 0x72, 0x72, 0x6d
-		, 0x4d, 0x4e, 0x6e, 0x4d, 0x4d, 0x4d, 0x6d, 0x91, 0x92, 0x92, 0x92, 0xb6, 0x92, 0x6d, 0x91, 0x92
-		, 0x25, 0x45, 0x6a, 0x6a, 0x4a, 0x6a, 0x45, 0x46, 0x6a, 0x6a, 0x4a, 0x92, 0xdb, 0xdb, 0xd6, 0xb6
-		, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xd2, 0xd2, 0xd2, 0xb2, 0xb2, 0xb2, 0xd6, 0x6d, 0x20, 0x45
-		, 0x45, 0x65, 0x65, 0x45, 0x65, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x49, 0x20, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x4d, 0x6d, 0x8e, 0x92, 0x6e, 0x6e
-		, 0x6e, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x6d, 0x29, 0x25, 0x24, 0x49, 0x49, 0x49, 0x6d, 0x49
-		, 0x4d, 0x4e, 0x4e, 0x72, 0x6e, 0x49, 0x4e, 0x6e, 0x6d, 0x6d, 0x6d, 0x91, 0x6d, 0x92, 0x6d, 0x6d
-		, 0x29, 0x00, 0x49, 0x8e, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x46, 0x6a, 0x6a, 0x4a, 0x49
-		, 0xdb, 0xb7, 0xdb, 0xd6, 0xb6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xd6
-		, 0xb6, 0x20, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x69, 0x69, 0x65, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x92, 0x92
-		, 0x92, 0x92, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6d, 0x29, 0x49, 0x49, 0x49
-		, 0x49, 0x4d, 0x6d, 0x49, 0x49, 0x4d, 0x4e, 0x4e, 0x6e, 0x4e, 0x4e, 0x6e, 0x4d, 0x49, 0x24, 0x00
-		, 0x00, 0x6d, 0x49, 0x49, 0x49, 0x25, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x25, 0xd7, 0xd7, 0xb6, 0xb6, 0xb2, 0xb6, 0xb6, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6
-		, 0xb6, 0xb2, 0xb2, 0xd6, 0x69, 0x45, 0x45, 0x45, 0x45, 0x45, 0x69, 0x45, 0x45, 0x49, 0x6a, 0x6a
-		, 0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x92, 0x92, 0x92, 0x92, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x2a, 0x4e, 0x2e, 0x2a
-		, 0x29, 0x24, 0x00, 0x00, 0x00, 0x6d, 0x72, 0x6d, 0x6e, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a
-		, 0x45, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x4a, 0x25, 0xb7, 0xdb, 0xb6, 0xb6, 0xb2, 0xb2, 0xb6, 0xb6
-		, 0xd6, 0xd6, 0xd6, 0xb6, 0xb6, 0xb2, 0xd6, 0x8d, 0x45, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x49, 0x45
-		, 0x49, 0x6a, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x20, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x96, 0x96, 0x96, 0x96
-		, 0x92, 0x72, 0x72, 0x6e, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x00, 0x00
-		, 0x25, 0x2a, 0x4e, 0x4e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x92, 0x6e, 0x6e, 0x6a, 0x45, 0x6a
-		, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x45, 0x6a, 0x4a, 0x6a, 0x4a, 0x45, 0xb7, 0xdb, 0xdb, 0xd6
-		, 0xb6, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb6, 0xb6, 0xd6, 0xb2, 0x45, 0x45, 0x45, 0x45, 0x6a
-		, 0x6a, 0x45, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69
-		, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x96, 0x96, 0x96, 0x96, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x96, 0x96, 0x96, 0x72, 0x6d, 0x6d, 0x49, 0x49, 0x24, 0x00, 0x24, 0x24
-		, 0x00, 0x00, 0x00, 0x00, 0x25, 0x29, 0x4e, 0x4f, 0x4d, 0x49, 0x4d, 0x6d, 0x6d, 0x6d, 0x8e, 0x6e
-		, 0x6a, 0x6a, 0x45, 0x6a, 0x45, 0x6a, 0x6a, 0x4a, 0x46, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x49
-		, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xda, 0xdb, 0xd6, 0xb6, 0xb6, 0xd6, 0xb2, 0x49, 0x45
-		, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x69, 0x65, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x96, 0x92, 0x6e, 0x4d, 0x24, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4e, 0x4e, 0x4d, 0x6d, 0x6d
-		, 0x6d, 0x6e, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x46, 0x45, 0x6a, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x69, 0xd7, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd7
-		, 0x92, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x49, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x45, 0x65, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0x6d, 0x6d, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x24, 0x25, 0x49, 0x49, 0x49, 0x6d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4e
-		, 0x4e, 0x4e, 0x6d, 0x69, 0x49, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x46, 0x6a, 0x4a, 0x46
-		, 0x46, 0x4a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-		, 0xfb, 0xdb, 0xb6, 0x6a, 0x45, 0x45, 0x49, 0x4a, 0x45, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x65, 0x45, 0x45, 0x49
-		, 0x20, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x92, 0x92, 0x6d, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x24, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x49, 0x4e, 0x4e, 0x4e, 0x4e, 0x24, 0x00, 0x45, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x45, 0x4a
-		, 0x45, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x8e, 0xb6, 0xdb, 0xdb
-		, 0xdb, 0xdb, 0xff, 0xff, 0xdb, 0x8e, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x4a
-		, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x69, 0x65, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x28, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x25, 0x4a, 0x4a, 0x2a, 0x4e, 0x05, 0x00, 0x6a, 0x6a, 0x6a, 0x4a
-		, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x46, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x24, 0x00, 0x24, 0x49, 0x49, 0x6d, 0x8e, 0x49, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x45, 0x45
-		, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x65, 0x45, 0x45, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x24, 0x24, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x4d, 0x49, 0x24, 0x00, 0x00, 0x00, 0x05, 0x6f, 0x4a, 0x29, 0x4e, 0x25, 0x25
-		, 0x6e, 0x46, 0x6a, 0x46, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x45, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x45, 0x45, 0x45, 0x4a
-		, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x49, 0x6a, 0x69, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x00, 0x00
-		, 0x00, 0x28, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x24, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x73, 0x2a
-		, 0x25, 0x4a, 0x2a, 0x4a, 0x6a, 0x46, 0x4a, 0x46, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x6a, 0x45, 0x45
-		, 0x6a, 0x46, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x20, 0x45
-		, 0x45, 0x45, 0x4a, 0x4a, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x45, 0x6e, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x05, 0x2a, 0x05, 0x25, 0x29, 0x2a, 0x4a, 0x6a, 0x6a, 0x4a, 0x46, 0x6a, 0x6a, 0x4a, 0x4a
-		, 0x45, 0x6a, 0x25, 0x46, 0x4a, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x20, 0x00
-		, 0x00, 0x00, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x46, 0x4a, 0x46, 0x6a, 0x6a, 0x46, 0x46
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x49, 0x25, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2a, 0x25, 0x25, 0x29, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a
-		, 0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x4a, 0x25, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x49, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x4a, 0x45, 0x45, 0x6a
-		, 0x6a, 0x6a, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x49, 0x45, 0x6a, 0x6a, 0x45, 0x21, 0x46, 0x6a, 0x6a
-		, 0x45, 0x45, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2a, 0x05, 0x29, 0x29, 0x4a, 0x6a
-		, 0x46, 0x6a, 0x4a, 0x46, 0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x45, 0x25, 0x6a, 0x45, 0x45, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a
-		, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x6a, 0x45, 0x21
-		, 0x4a, 0x6a, 0x6a, 0x45, 0x4a, 0x6a, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00
-		, 0x00, 0x4d, 0x49, 0x49, 0x28, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x00, 0x04, 0x4e, 0x29, 0x05
-		, 0x29, 0x29, 0x6e, 0x6a, 0x45, 0x6a, 0x6a, 0x45, 0x6a, 0x4a, 0x46, 0x6a, 0x45, 0x45, 0x45, 0x6a
-		, 0x45, 0x46, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45
-		, 0x45, 0x6a, 0x6a, 0x4a, 0x45, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a
-		, 0x6e, 0x45, 0x21, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x20, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x00
-		, 0x29, 0x4e, 0x25, 0x25, 0x25, 0x4a, 0x6e, 0x6a, 0x45, 0x4a, 0x6a, 0x45, 0x6a, 0x6a, 0x45, 0x4a
-		, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x45, 0x45, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x4a
-		, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x21, 0x49, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25
-		, 0x04, 0x00, 0x00, 0x04, 0x4e, 0x29, 0x04, 0x25, 0x05, 0x4a, 0x6e, 0x6a, 0x4a, 0x45, 0x4a, 0x45
-		, 0x46, 0x6a, 0x45, 0x4a, 0x45, 0x45, 0x4a, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a
-		, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x46, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x25, 0x45, 0x4a, 0x46, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x25, 0x4e, 0x05, 0x24, 0x25, 0x25, 0x6e, 0x6e, 0x4a
-		, 0x6a, 0x45, 0x45, 0x4a, 0x45, 0x4a, 0x45, 0x4a, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x6a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x6a, 0x6a, 0x45, 0x45
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x6a, 0x6a, 0x6a, 0x4a, 0x6e, 0x45, 0x45, 0x4a, 0x45, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00
-		, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x2a, 0x2a, 0x00, 0x24, 0x25
-		, 0x25, 0x6e, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x46, 0x45, 0x45, 0x4a, 0x45, 0x45, 0x6a, 0x45
-		, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x46
-		, 0x6a, 0x46, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45
-		, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x20, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x24, 0x00, 0x25, 0x4e
-		, 0x25, 0x00, 0x24, 0x25, 0x25, 0x6e, 0x6a, 0x6a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x6a, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x25, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x45, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x49, 0x45, 0x49
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25
-		, 0x24, 0x04, 0x4e, 0x29, 0x00, 0x04, 0x24, 0x25, 0x45, 0x6a, 0x6a, 0x6a, 0x46, 0x4a, 0x4a, 0x4a
-		, 0x45, 0x25, 0x45, 0x45, 0x25, 0x46, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a
-		, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x6a, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x45, 0x45, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x25, 0x04, 0x29, 0x4e, 0x04, 0x04, 0x04, 0x24, 0x25, 0x49, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x46, 0x6a, 0x4a, 0x4a, 0x45, 0x21, 0x45, 0x25, 0x45, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x25, 0x4a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00
-		, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25, 0x4e, 0x25, 0x00, 0x04, 0x04, 0x04, 0x25
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x4a, 0x4a, 0x46, 0x45, 0x25, 0x45, 0x25, 0x45, 0x6a, 0x46
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x00, 0x00, 0x00, 0x4a, 0x45, 0x21, 0x4a, 0x4a
-		, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x45, 0x45, 0x45, 0x4a
-		, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x46, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x44, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4e, 0x29, 0x04, 0x04
-		, 0x24, 0x04, 0x04, 0x49, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x46, 0x45, 0x46, 0x4a, 0x45, 0x25, 0x45
-		, 0x25, 0x45, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x21, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a
-		, 0x45, 0x45, 0x45, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a
-		, 0x4e, 0x04, 0x04, 0x24, 0x04, 0x04, 0x04, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x45, 0x45
-		, 0x4a, 0x46, 0x25, 0x25, 0x25, 0x4a, 0x4a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x25
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x6a, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x4a, 0x4a, 0x45, 0x25, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a
-		, 0x4a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x24, 0x24
-		, 0x24, 0x00, 0x25, 0x4e, 0x25, 0x00, 0x04, 0x04, 0x04, 0x04, 0x24, 0x6a, 0x6a, 0x6a, 0x46, 0x6a
-		, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x46, 0x25, 0x25, 0x25, 0x4a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x46, 0x45, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x49, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00
-		, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x4e, 0x29, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x25, 0x6e
-		, 0x6a, 0x6a, 0x6a, 0x46, 0x4a, 0x46, 0x4a, 0x45, 0x25, 0x45, 0x45, 0x21, 0x25, 0x6a, 0x6a, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x6a, 0x45, 0x25, 0x45, 0x6a, 0x6a
-		, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x25, 0x04, 0x04, 0x04, 0x00
-		, 0x00, 0x05, 0x2a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x46, 0x46, 0x46, 0x4a, 0x45, 0x25, 0x45, 0x21
-		, 0x25, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x25, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x46, 0x6a, 0x45
-		, 0x25, 0x4a, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x29, 0x2a, 0x05, 0x24
-		, 0x04, 0x00, 0x00, 0x00, 0x05, 0x29, 0x25, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x46
-		, 0x45, 0x45, 0x25, 0x21, 0x25, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x45, 0x6a, 0x6a, 0x45, 0x21, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-		, 0x24, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x29
-		, 0x2a, 0x05, 0x04, 0x25, 0x04, 0x00, 0x00, 0x05, 0x29, 0x25, 0x05, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x25, 0x21, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x6a, 0x25, 0x00, 0x00, 0x20, 0x6a, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x46, 0x45, 0x6a, 0x6a, 0x45, 0x25, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x29, 0x29, 0x28, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x05, 0x2a, 0x25, 0x00, 0x04, 0x24, 0x00, 0x00, 0x05, 0x29, 0x25, 0x00, 0x25, 0x6a
-		, 0x4a, 0x6a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x25, 0x20, 0x25, 0x6a, 0x6a, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x25, 0x21, 0x6a, 0x6a, 0x45, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x4a, 0x6a, 0x4a, 0x25, 0x25, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x28, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x05, 0x2a, 0x29, 0x04, 0x00, 0x24, 0x24, 0x00, 0x05, 0x2a, 0x25
-		, 0x04, 0x00, 0x49, 0x6a, 0x46, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20
-		, 0x25, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x46, 0x46, 0x46, 0x46, 0x6a
-		, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x6a, 0x46, 0x25
-		, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x49, 0x49, 0x49, 0x49, 0x29
-		, 0x29, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x29, 0x29, 0x04, 0x00, 0x00, 0x00, 0x25
-		, 0x25, 0x2a, 0x25, 0x00, 0x00, 0x20, 0x6a, 0x6a, 0x4a, 0x46, 0x4a, 0x45, 0x46, 0x4a, 0x45, 0x45
-		, 0x45, 0x45, 0x25, 0x20, 0x25, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x46, 0x45
-		, 0x45, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x46, 0x46
-		, 0x6a, 0x6a, 0x25, 0x25, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x6a
-		, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49
-		, 0x29, 0x29, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x25, 0x29, 0x04, 0x00
-		, 0x00, 0x00, 0x05, 0x29, 0x29, 0x05, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x6a, 0x6a, 0x46, 0x46, 0x46
-		, 0x45, 0x46, 0x45, 0x45, 0x45, 0x45, 0x25, 0x20, 0x00, 0x6a, 0x6a, 0x4a, 0x46, 0x4a, 0x4a, 0x4a
-		, 0x4a, 0x46, 0x45, 0x45, 0x45, 0x25, 0x4a, 0x4a, 0x45, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a
-		, 0x6a, 0x6a, 0x45, 0x4a, 0x6a, 0x46, 0x25, 0x25, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x20, 0x00, 0x00, 0x00
-		, 0x00, 0x29, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x04
-		, 0x25, 0x05, 0x00, 0x00, 0x00, 0x05, 0x29, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x46, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x25, 0x00, 0x00, 0x6a, 0x6a, 0x4a
-		, 0x45, 0x45, 0x46, 0x4a, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x6a, 0x46, 0x45, 0x4a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x6a, 0x45, 0x21, 0x25, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24
-		, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x04, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x4a, 0x6a, 0x45, 0x4a, 0x6a, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x00
-		, 0x20, 0x4a, 0x6a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x6a, 0x45
-		, 0x45, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x46, 0x25, 0x00, 0x45
-		, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x05, 0x25, 0x05, 0x00, 0x00, 0x24
-		, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6a, 0x6a, 0x4a, 0x45, 0x46, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x45
-		, 0x45, 0x25, 0x20, 0x24, 0x6e, 0x6e, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46
-		, 0x45, 0x6a, 0x4a, 0x45, 0x45, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x46, 0x45, 0x4a
-		, 0x45, 0x25, 0x00, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x00
-		, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x25, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x4a
-		, 0x46, 0x45, 0x45, 0x45, 0x25, 0x25, 0x24, 0x8d, 0xd6, 0xb6, 0x6e, 0x4a, 0x4a, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x46, 0x6a, 0x45, 0x45, 0x46, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a
-		, 0x6a, 0x45, 0x45, 0x46, 0x25, 0x21, 0x01, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x45, 0x6a, 0x6a, 0x4a
-		, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20, 0x6d, 0xda, 0xd7, 0xb6, 0xb2, 0x69
-		, 0x4a, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x46, 0x6a, 0x6a, 0x6a
-		, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x46, 0x45, 0x25, 0x00, 0x25, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a
-		, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x25, 0x45, 0x45, 0x45, 0x45, 0x44, 0x24
-		, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00
-		, 0x49, 0x4a, 0x45, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x21, 0x45, 0xd7, 0xdb
-		, 0xdb, 0xdb, 0xdb, 0xb2, 0x69, 0x45, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46, 0x6a, 0x4a, 0x45, 0x45
-		, 0x4a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x45, 0x25, 0x00, 0x25, 0x6a
-		, 0x6a, 0x6a, 0x6a, 0x4a, 0x45, 0x25, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x25, 0x25, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x20, 0x6e, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0x6d, 0x20, 0x21, 0x25, 0x45, 0x46, 0x46
-		, 0x6a, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x4a, 0x4a, 0x6a, 0x4a, 0x46, 0x45, 0x45, 0x25
-		, 0x25, 0x00, 0x25, 0x6a, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x49, 0x6a, 0x6a, 0x4a, 0x4a, 0x46, 0x45, 0x45, 0x25
-		, 0x45, 0x45, 0x25, 0x45, 0x25, 0xb7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0x8e, 0x24
-		, 0x20, 0x25, 0x25, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x46, 0x4a, 0x4a, 0x46
-		, 0x45, 0x45, 0x25, 0x25, 0x25, 0x21, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x4a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24
-		, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x25, 0x6a, 0x4a, 0x4a, 0x46, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x21, 0x49, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xfb, 0xdb, 0xb6, 0x6d, 0x25, 0x21, 0x45, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x6a, 0x4a, 0x4a
-		, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x25, 0x25, 0x25, 0x25, 0x25, 0x4a, 0x4a, 0x46, 0x4a, 0x6a, 0x6a
-		, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x24, 0x24
-		, 0x24, 0x24, 0x44, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x25, 0x4a
-		, 0x4a, 0x46, 0x46, 0x46, 0x4a, 0x6a, 0x4a, 0x49, 0x45, 0x45, 0x45, 0x21, 0x69, 0xdb, 0xdb, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xd6, 0x6e, 0x45, 0x20, 0x25, 0x25, 0x25
-		, 0x46, 0x4a, 0x46, 0x46, 0x4a, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x25, 0x25, 0x21, 0x25, 0x4a, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x24, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x20
-		, 0x49, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xd6
-		, 0x8e, 0x45, 0x20, 0x21, 0x45, 0x46, 0x46, 0x46, 0x46, 0x45, 0x45, 0x45, 0x45, 0x25, 0x25, 0x20
-		, 0x00, 0x25, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x4a, 0x6a, 0x4a, 0x46, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x44, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x46, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x49, 0x49, 0x49, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xd6, 0x92, 0x49, 0x25, 0x21, 0x21, 0x45, 0x45, 0x25, 0x25, 0x25
-		, 0x25, 0x25, 0x20, 0x20, 0x21, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x4a, 0x4a, 0x46, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x4a, 0x4a, 0x45, 0x25, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x6e, 0xd7, 0xfb, 0xfb, 0xd6, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xdb, 0xdb, 0xb2, 0x8e, 0x49, 0x25
-		, 0x21, 0x00, 0x21, 0x25, 0x25, 0x25, 0x00, 0x25, 0x21, 0x45, 0x4a, 0x46, 0x4a, 0x6a, 0x6a, 0x4a
-		, 0x4a, 0x6a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x20, 0x24, 0x24
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x25, 0x25
-		, 0x45, 0x46, 0x4a, 0x45, 0x25, 0x25, 0x6a, 0xd7, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xdb, 0xd6, 0xdb
-		, 0xfb, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xdb
-		, 0xdb, 0xda, 0xda, 0xb6, 0xb2, 0x6d, 0x45, 0x21, 0x21, 0x00, 0x00, 0x00, 0x25, 0x4a, 0x46, 0x4a
-		, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44
-		, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25
-		, 0x25, 0x25, 0x25, 0x4a, 0x46, 0x46, 0x25, 0x25, 0x45, 0x6e, 0xdb, 0xff, 0xff, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xda, 0xb6, 0xd6, 0xdb, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xdb, 0xdb, 0xfb, 0xb6, 0x8e, 0x6a, 0x4a, 0x45, 0x25, 0x25, 0x25
-		, 0x92, 0x49, 0x4a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x4a, 0x4a, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00
-		, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-		, 0x00, 0x20, 0x25, 0x25, 0x05, 0x00, 0x49, 0x46, 0x45, 0x25, 0x25, 0x45, 0x6e, 0xdb, 0xdb, 0xdb
-		, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xfb, 0xdb, 0xda, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xfb, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x4a, 0x4a, 0x4a, 0x4a
-		, 0x6a, 0x6a, 0x4a, 0x49, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x6a, 0x4a, 0x4a, 0x45, 0x45
-		, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x48, 0x44, 0x44
-		, 0x48
-		};
-const char xander_bitmap[10002] = {
-0x64, 0x64
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xff, 0xdb, 0xdb, 0xdf, 0x8d, 0x8d, 0xd6, 0xb6, 0x69, 0x44
-	, 0x48, 0x69, 0x24, 0x24, 0x44, 0x24, 0x44, 0x48, 0x69, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x20, 0x00, 0x00, 0x24, 0x24, 0x24, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x24, 0x48, 0x69, 0x44, 0x44, 0x91, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0x8d, 0xdb
-	, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0x69, 0xb2
-	, 0xd6, 0xb2, 0x69, 0x24, 0x44, 0x69, 0x49, 0x24, 0x24, 0x24, 0x24, 0x48, 0x49, 0x49, 0x44, 0x44
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x20, 0x24, 0x20, 0x00
-	, 0x00, 0x20, 0x24, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x44, 0x69, 0x69
-	, 0x24, 0x6d, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0x8d, 0xdb, 0xba, 0xb6, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xff, 0xdb
-	, 0xdb, 0xb6, 0x69, 0xd6, 0xd6, 0xb2, 0x6d, 0x44, 0x24, 0x24, 0x6d, 0x24, 0x24, 0x24, 0x00, 0x24
-	, 0x48, 0x49, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24
-	, 0x00, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x20, 0x24
-	, 0x48, 0x49, 0x48, 0x69, 0x44, 0x48, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x8d, 0xba, 0xba, 0xb6, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0xff, 0xdb, 0xdb, 0xb6, 0x91, 0xda, 0xda, 0xb6, 0x69, 0x24, 0x24, 0x24, 0x69, 0x49
-	, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00
-	, 0x00, 0x20, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x69, 0x48, 0x44, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x8d, 0xb6, 0xda, 0xb6, 0xba, 0xdb
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xff, 0xdb, 0xdb, 0xb6, 0xb2, 0xff, 0xff, 0xb6, 0x24, 0x24
-	, 0x24, 0x24, 0x48, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00
-	, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x69, 0x69, 0x49, 0x48, 0x44, 0x48, 0xb6
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x8d, 0xb6
-	, 0xdb, 0xb6, 0xba, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xff, 0xdb, 0xdb, 0xb6, 0xb2, 0xff
-	, 0xff, 0x6d, 0x44, 0x24, 0x24, 0x24, 0x24, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x44, 0x69, 0x69
-	, 0x69, 0x48, 0x44, 0x92, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0x91, 0xb6, 0xdb, 0xb6, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xff, 0xdb
-	, 0xdb, 0xb6, 0x91, 0xff, 0xd6, 0x69, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x20
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44
-	, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x44, 0x49, 0x6d, 0x48, 0x44, 0x6d, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0xb6, 0xdb, 0xb6, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xda, 0xdb, 0xdf, 0xdb, 0xdb, 0xb6, 0xb2, 0xff, 0x92, 0x49, 0x24, 0x24, 0x24, 0x6d, 0x24, 0x24
-	, 0x44, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44
-	, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x20, 0x00, 0x20
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x6d, 0x69, 0x44, 0x69, 0xba, 0xda, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0x92, 0xdb, 0xb6, 0xba, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdf, 0xdb, 0xdb, 0xb6, 0xb6, 0x92, 0x91, 0x6d, 0x6d, 0x48
-	, 0x48, 0x6d, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x44, 0x48, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x69, 0x69, 0x44
-	, 0x92, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0xb6
-	, 0xdb, 0xb6, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0x91
-	, 0x8d, 0x91, 0x69, 0x24, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x69, 0x69, 0x44
-	, 0x24, 0x24, 0x44, 0x48, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68
-	, 0x69, 0x69, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x44
-	, 0x48, 0x69, 0x48, 0x44, 0x49, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xb2, 0x92, 0xdb, 0xb6, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0x91, 0xb6, 0x8d, 0x69, 0x91, 0x44, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x48
-	, 0x49, 0x6d, 0x49, 0x24, 0x24, 0x44, 0x69, 0x8d, 0x8d, 0x8d, 0x69, 0x8d, 0x8d, 0x69, 0x69, 0x8d
-	, 0x8d, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x44, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x92, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0x91, 0xdb, 0xb6, 0xba, 0xda, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xb6, 0xdb, 0xdb, 0xdb, 0xb6, 0x91, 0xda, 0x6d, 0x6d, 0x8d, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x44, 0x44, 0x6d, 0x6d, 0x44, 0x24, 0x44, 0x48, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x69, 0x69, 0x69, 0x69, 0x48, 0x44, 0x24, 0x24
-	, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x69, 0x6d, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0x91, 0xdb, 0xba, 0xba, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xfb, 0xdb, 0xdb, 0xb6, 0x91, 0xd6, 0x69, 0x6d, 0x91, 0x48, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x69, 0x8d, 0x44, 0x24, 0x44, 0x48, 0x6d, 0x91, 0x8d
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x69, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x24, 0x44, 0x48, 0x48, 0x44
-	, 0x6d, 0x49, 0x92, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x91
-	, 0xdb, 0xba, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xfb, 0xdb, 0xdb, 0x92, 0xb6, 0xb6, 0x44
-	, 0x6d, 0x92, 0x6d, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x69, 0x48, 0x24, 0x44, 0x68
-	, 0x8d, 0x91, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24
-	, 0x24, 0x44, 0x48, 0x48, 0x48, 0x6d, 0x69, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xb6, 0x6d, 0xbb, 0xba, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb
-	, 0xb2, 0xb6, 0x92, 0x48, 0xb6, 0x69, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48
-	, 0x44, 0x44, 0x68, 0x69, 0x8d, 0xb2, 0xb2, 0xb6, 0xd6, 0xb2, 0xb2, 0xb1, 0xb1, 0x91, 0x8d, 0x8d
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0xb1, 0xb2, 0xb1, 0x8d, 0x69, 0x44, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x48, 0x48, 0x69, 0x49, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x6d, 0xbb, 0xba, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xb6, 0xdb, 0xdb, 0xdb, 0xb6, 0xd6, 0x92, 0x6d, 0xdb, 0x6d, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x48, 0x44, 0x44, 0x68, 0x69, 0x8d, 0xb1, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0x6d, 0x48
-	, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x69, 0x6d, 0x49, 0x91
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0x8d, 0xb6, 0xda, 0xba, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0x92, 0x6d, 0xdb, 0x8d, 0x00, 0x00
-	, 0x00, 0x00, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x69, 0x69, 0x8d, 0x8d, 0xb2, 0xb6, 0xd6, 0xd6
-	, 0xd6, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xd6, 0xd6, 0xb2
-	, 0xb2, 0xb1, 0x8d, 0x69, 0x48, 0x44, 0x48, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x48, 0x48, 0x48
-	, 0x48, 0x6d, 0x6d, 0x6d, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0x8d
-	, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0xb6, 0x69
-	, 0xdb, 0x92, 0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x69, 0x8d, 0x8d, 0x8d, 0xb1
-	, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb1, 0x8d, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44
-	, 0x44, 0x48, 0x48, 0x48, 0x69, 0x48, 0x92, 0x6d, 0xb6, 0xdb, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xda, 0x8d, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xda, 0xdb
-	, 0xb6, 0x92, 0xb6, 0x49, 0xda, 0x92, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8d
-	, 0x8d, 0xb1, 0xb1, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2
-	, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1, 0x8d, 0x69, 0x48, 0x49, 0x69
-	, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x49, 0x48, 0x92, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xb6, 0xff, 0xda, 0xdb, 0xda, 0x92, 0xb6, 0x69, 0xb6, 0x92, 0x20, 0x24, 0x24, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x69, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xb6, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0xb1
-	, 0x6d, 0x48, 0x49, 0x69, 0x69, 0x48, 0x48, 0x48, 0x24, 0x24, 0x44, 0x44, 0x69, 0x49, 0x6d, 0x8d
-	, 0x92, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0xb6, 0xdb, 0xba, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xff, 0xda, 0xdb, 0xdb, 0xb2, 0xb6, 0x6d, 0x92, 0xb2, 0x24, 0x24
-	, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xb1, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xb2, 0xb1, 0x8d, 0x69, 0x48, 0x69, 0x6d, 0x48, 0x48, 0x48, 0x24, 0x24, 0x24, 0x44
-	, 0x48, 0x8d, 0x49, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x8d
-	, 0x92, 0xdb, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xff, 0xda, 0xdb, 0xdb, 0xb2, 0xb2, 0x92
-	, 0x6d, 0xb6, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb1, 0xb1, 0xb1, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x69, 0x44, 0x44, 0x6d, 0x69, 0x48, 0x69
-	, 0x44, 0x24, 0x24, 0x24, 0x24, 0x91, 0x6d, 0x91, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0x91, 0x92, 0xdb, 0xba, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xff, 0xda, 0xdb
-	, 0xdb, 0xb6, 0xb2, 0x92, 0x6d, 0x92, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x44, 0xb2, 0xb1
-	, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x69, 0x44, 0x24
-	, 0x44, 0x8d, 0x48, 0x49, 0x48, 0x24, 0x24, 0x24, 0x24, 0x91, 0x6d, 0x6d, 0xdb, 0xdb, 0xdf, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0x92, 0xdb, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda
-	, 0xd6, 0xff, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0x92, 0x8d, 0x92, 0x48, 0x44, 0x24, 0x24, 0x00, 0x00
-	, 0x00, 0x69, 0xd6, 0xb1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2
-	, 0x8d, 0x69, 0x44, 0x24, 0x24, 0x69, 0x69, 0x48, 0x69, 0x44, 0x24, 0x24, 0x24, 0x6d, 0x6d, 0x92
-	, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0x91, 0xdb, 0xba, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0xb6, 0x92, 0x8d, 0x49, 0x24
-	, 0x44, 0x24, 0x00, 0x00, 0x00, 0x8d, 0xd6, 0xb2, 0xd6, 0xd6, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x69, 0x44, 0x24, 0x20, 0x48, 0x69, 0x48, 0x69, 0x48, 0x24, 0x24
-	, 0x24, 0x48, 0x69, 0xb6, 0xff, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91
-	, 0x8d, 0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xb6, 0xd6, 0xb6
-	, 0x92, 0x6d, 0x49, 0x24, 0x44, 0x24, 0x00, 0x00, 0x00, 0xb1, 0xd6, 0xb2, 0xd6, 0xda, 0xda, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb2, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x69, 0x44, 0x24, 0x20, 0x24, 0x69, 0x48
-	, 0x49, 0x48, 0x24, 0x24, 0x24, 0x24, 0x49, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xb2, 0x91, 0xbb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xff, 0xdb, 0xdb
-	, 0xdb, 0xda, 0xdb, 0xd6, 0xb6, 0x92, 0x48, 0x44, 0x24, 0x24, 0x24, 0x00, 0x24, 0xb2, 0xb2, 0xd6
-	, 0xd6, 0xfa, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0x8d, 0x44, 0x24
-	, 0x20, 0x24, 0x68, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x6d, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x92, 0x92, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0x48, 0x24, 0x44, 0x24, 0x24, 0x00
-	, 0x44, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb2
-	, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2
-	, 0xd2, 0x8d, 0x68, 0x24, 0x00, 0x00, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x92, 0xdf
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xbb, 0xb6, 0x96, 0x92, 0x72, 0x6d, 0x4d, 0x49, 0x6d, 0xb6, 0xdb, 0xda
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0x8d, 0x24
-	, 0x24, 0x24, 0x24, 0x00, 0x49, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2
-	, 0xb2, 0xb2, 0xb1, 0x91, 0x91, 0x91, 0x8d, 0x8d, 0x8d, 0x8d, 0x91, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0x8d, 0x69, 0x44, 0x20, 0x00, 0x44, 0x48, 0x44, 0x48, 0x48, 0x24
-	, 0x24, 0x44, 0x6d, 0xb6, 0x92, 0x92, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d
-	, 0xb6, 0xdb, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xff
-	, 0xb6, 0xdb, 0xdb, 0x48, 0x44, 0x44, 0x24, 0x00, 0x69, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xb2, 0xb2, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x6d, 0x8d
-	, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xd6, 0xb1, 0x69, 0x44, 0x20, 0x00, 0x24, 0x48
-	, 0x44, 0x44, 0x48, 0x24, 0x44, 0x48, 0x48, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x72
-	, 0x72, 0x92, 0x92, 0x96, 0xdb, 0xba, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xda, 0xdb, 0xb6, 0xda, 0xff, 0x92, 0x24, 0x69, 0x24, 0x00, 0x8d, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb1, 0x8d, 0x8d, 0x69, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44
-	, 0x44, 0x48, 0x48, 0x69, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xd6, 0xb1, 0x69, 0x44
-	, 0x24, 0x00, 0x24, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x48, 0x49, 0x6d, 0x72, 0x92, 0x92, 0x92
-	, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb6, 0xba, 0xba, 0xba, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6
-	, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0x49, 0x49, 0x44, 0x00
-	, 0x91, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1, 0xb2, 0xb2, 0xb1, 0x8d, 0x8d, 0x8d, 0x69, 0x44, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0xb1
-	, 0xb2, 0xb1, 0x69, 0x68, 0x24, 0x00, 0x24, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x48, 0x6d, 0x92
-	, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x96, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xff
-	, 0xb6, 0x24, 0x49, 0x20, 0xb2, 0xd6, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d, 0x69
-	, 0x68, 0x68, 0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x48, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69
-	, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0xb1, 0x8d, 0x68, 0x24, 0x00, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44
-	, 0x44, 0x48, 0x6d, 0x92, 0x96, 0x96, 0xb6, 0xb6, 0xb6, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0x6d, 0x48, 0x24, 0xb2, 0xb2, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0xb1
-	, 0xb1, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0x69, 0x69, 0x69, 0x69
-	, 0x69, 0x69, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0x8d, 0xb1, 0xb2, 0x8d, 0x69, 0x24, 0x00, 0x24, 0x24
-	, 0x24, 0x44, 0x44, 0x48, 0x24, 0x44, 0x92, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x49, 0x69, 0xb2, 0x8d, 0x44, 0x44
-	, 0x69, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x48, 0x48, 0x68, 0x68, 0x69, 0x69
-	, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0xb1, 0xd6, 0x8d, 0x69
-	, 0x44, 0x00, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x92, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x6d
-	, 0x8d, 0x48, 0x24, 0x24, 0x44, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x44, 0x44
-	, 0x68, 0x68, 0x44, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x48, 0x44, 0x69, 0x69, 0x8d, 0x8d
-	, 0xb1, 0xd6, 0x8d, 0x69, 0x44, 0x00, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x91, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xb2, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6
-	, 0xb6, 0x92, 0x92, 0x6d, 0x69, 0x44, 0x24, 0x24, 0x44, 0x48, 0x69, 0x8d, 0x8d, 0x8d, 0x89, 0x69
-	, 0x68, 0x68, 0x44, 0x44, 0x68, 0x44, 0x44, 0x48, 0x44, 0x48, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0x68
-	, 0x44, 0x69, 0x8d, 0x8d, 0xb1, 0xb2, 0xb1, 0x69, 0x44, 0x20, 0x20, 0x24, 0x24, 0x24, 0x44, 0x44
-	, 0x24, 0x24, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0xff, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0x92, 0x92
-	, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x92, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x69, 0x69, 0x69, 0x69
-	, 0x8d, 0x8d, 0x89, 0x69, 0x69, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44
-	, 0x48, 0x69, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0x8d, 0x91, 0xb2, 0xb1, 0x8d, 0x48, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x44, 0x48, 0x24, 0x48, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x92, 0x71, 0x6d, 0x6d
-	, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x72, 0x92, 0x92, 0x92, 0x92, 0x96, 0x6d, 0x69, 0x6d, 0x69, 0x68
-	, 0x48, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x68, 0x48, 0x44, 0x44, 0x24, 0x44, 0x24
-	, 0x24, 0x20, 0x24, 0x44, 0x48, 0x44, 0x48, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0x8d
-	, 0x68, 0x24, 0x20, 0x24, 0x24, 0x24, 0x44, 0x48, 0x24, 0x49, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0x6d, 0x6d, 0x6d, 0x6d, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x96, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0x91, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x48, 0x44
-	, 0x44, 0x24, 0x24, 0x48, 0x24, 0x24, 0x44, 0x69, 0x69, 0x69, 0x68, 0x68, 0x69, 0x69, 0x8d, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0x8d, 0x69, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x49, 0x48, 0x6d, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x72, 0x92, 0x92, 0x92, 0x96, 0xb6, 0xb6, 0xb6, 0xda, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0x6d, 0x48, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0xb1, 0xb2, 0x8d
-	, 0x89, 0x69, 0x48, 0x48, 0x44, 0x24, 0x24, 0x48, 0x49, 0x48, 0x69, 0x69, 0x69, 0x69, 0x89, 0x8d
-	, 0x8d, 0x8d, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0x8d, 0x69, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48
-	, 0x49, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x24, 0x24, 0x24, 0x49, 0x69, 0x44
-	, 0x44, 0xd6, 0xd6, 0xb2, 0x8d, 0x69, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68
-	, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb6, 0xd6, 0xd6, 0xb1, 0x69, 0x24, 0x24, 0x24
-	, 0x24, 0x44, 0x48, 0x24, 0x6d, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x49, 0x44
-	, 0x49, 0x6d, 0x69, 0x24, 0x8d, 0xfa, 0xd6, 0xd6, 0xb1, 0x8d, 0x69, 0x68, 0x44, 0x44, 0x44, 0x44
-	, 0x68, 0x44, 0x44, 0x68, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xd6, 0xd6, 0xd6, 0xb2
-	, 0x8d, 0x44, 0x24, 0x24, 0x24, 0x48, 0x44, 0x6d, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0x92, 0x69, 0x69, 0x68, 0x44, 0x44, 0xd6, 0xfa, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x69
-	, 0x68, 0x44, 0x44, 0x44, 0x68, 0x68, 0x68, 0x69, 0x69, 0x89, 0x8d, 0xb1, 0xb1, 0xb2, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0x8d, 0x44, 0x24, 0x24, 0x48, 0x8d, 0x69, 0xba, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x6d, 0x68, 0x68, 0x44, 0x69, 0xfa, 0xfa, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xb1, 0x89, 0x69, 0x68, 0x48, 0x48, 0x48, 0x68, 0x68, 0x69, 0x69, 0x8d, 0xb1, 0xb2
-	, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x48, 0x44, 0x24, 0x48, 0x8d, 0xb2, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0x6d, 0x69, 0x48, 0xb1
-	, 0xfa, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xad, 0x8d, 0x69, 0x69, 0x68, 0x68, 0x69, 0x69, 0x69
-	, 0x8d, 0xb1, 0xb2, 0xb2, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0x69, 0x44, 0x24
-	, 0x44, 0x89, 0xd6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6
-	, 0x8d, 0x69, 0x69, 0xd6, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0x8d, 0x8d, 0x8d, 0x69
-	, 0x69, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xb2, 0x69, 0x48, 0x24, 0x44, 0x89, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xd6, 0x91, 0x8d, 0x8d, 0xd6, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd2, 0xd6, 0xb1, 0x69, 0x48, 0x24, 0x64, 0xad, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xb1, 0x8d, 0xb1, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2
-	, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb2, 0xb2, 0xd2, 0xb1, 0x69, 0x44, 0x44, 0xb1, 0xb2, 0xda, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xb2, 0xb1, 0xd6, 0xfa
-	, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb2, 0xb1, 0x69, 0x24, 0x8d
-	, 0xd6, 0xb2, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6
-	, 0xb2, 0xb2, 0xd6, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1
-	, 0xb1, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2
-	, 0xb1, 0x68, 0x48, 0xd6, 0xd6, 0x6d, 0x6d, 0x91, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xb6, 0xb2, 0xd2, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb2, 0xb2, 0xb1, 0x44, 0x6d, 0xd6, 0xb2, 0x20, 0x24, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-	, 0xd6, 0xb2, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb2, 0x91, 0x8d, 0xb1, 0x8d, 0x24, 0x24, 0x49, 0x92
-	, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xb2, 0xd6, 0xfa, 0xd6
-	, 0xd6, 0xd6, 0xda, 0xd6, 0xd2, 0xd2, 0xd2, 0xb1, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x48
-	, 0x20, 0x24, 0x49, 0x92, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0x8d, 0x89, 0x8d, 0xad
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0x24, 0x24, 0x6d, 0x6d, 0x6d, 0x92, 0x92, 0xba, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xd2, 0xd2, 0xd2
-	, 0xad, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x20, 0x24, 0x8d, 0xb6, 0xb6, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xb6, 0xb6, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xd2, 0xd2, 0xd2, 0xb1, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x24, 0x24, 0x48, 0x91, 0xb6, 0x92, 0xb6
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb6, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xb2, 0xb1, 0xb1
-	, 0xb1, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0xd2, 0xb1, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xad, 0xad
-	, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0x6d, 0x48, 0x44, 0x49
-	, 0x6d, 0x91, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad
-	, 0x8d, 0x8d, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0x8d, 0xb1
-	, 0x69, 0x6d, 0x6d, 0x6d, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x96, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x69, 0x68, 0x69, 0x69, 0x44, 0x24, 0x44, 0x64, 0x68, 0x89
-	, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0xad, 0xad
-	, 0x8d, 0x8d, 0xb1, 0xb1, 0x69, 0x91, 0x92, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0x92, 0x96, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xda
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xb1, 0x69, 0x68, 0x68, 0x44, 0x44
-	, 0x44, 0x44, 0x44, 0x69, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xad
-	, 0x8d, 0xad, 0xad, 0x8d, 0xad, 0xad, 0xb1, 0x91, 0x6d, 0x92, 0x91, 0x92, 0xb6, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x96, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda
-	, 0xda, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd6
-	, 0x69, 0x68, 0x44, 0x44, 0x44, 0x44, 0x69, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xad, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d, 0x91, 0xb2, 0xb6, 0xb6, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x96, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xda, 0xba, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xd6, 0xb2, 0x6d, 0x44, 0x44, 0x44, 0x44, 0x48, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0x91
-	, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x92, 0x96, 0xb6
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xba, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0xb1, 0x8d, 0x44, 0x44, 0x44, 0x48, 0x68, 0x8d, 0x8d
-	, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x8d, 0xb1, 0x8d, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0x92, 0x92, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xb6, 0xda, 0xda, 0xda
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb1, 0xb1, 0x8d, 0x68, 0x44, 0x44
-	, 0x68, 0x69, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x91, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xda, 0xda, 0xda, 0xda, 0xda, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda
-	, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0x91
-	, 0x8d, 0x69, 0x44, 0x44, 0x69, 0x8d, 0x89, 0x8d, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1
-	, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x91, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xda, 0xda, 0xdb, 0xda, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xda, 0xba, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xb6, 0xb1, 0xb2, 0xb1, 0x89, 0x69, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69
-	, 0x69, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xba, 0x92, 0x92, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0x91, 0xb1, 0xd2, 0xd6, 0xb2, 0xad, 0xad, 0xb1, 0xb1
-	, 0xb1, 0x8d, 0x8d, 0x69, 0x68, 0x69, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x8d, 0x8d, 0xb1, 0x6d, 0x24, 0x49, 0x49, 0x6d, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdb
-	, 0xba, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xb6, 0xb6, 0xda, 0xda, 0xda
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb2, 0x89, 0x8d, 0xb1, 0x8d
-	, 0x68, 0x68, 0x89, 0x89, 0x89, 0x69, 0x68, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x8d, 0xd2, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb6, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda
-	, 0xdb, 0xdb, 0xda, 0xdb, 0xba, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xb6
-	, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0x8d, 0x64, 0x64, 0x44, 0x44, 0x40, 0x40, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x69, 0x8d
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x8d, 0xb1, 0xb2, 0x24, 0x00, 0x00
-	, 0x24, 0x04, 0x49, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0xda, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x89, 0x64, 0x44, 0x44, 0x44, 0x64, 0x69, 0x89, 0x89, 0x8d, 0x89
-	, 0x68, 0x44, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x8d, 0xad, 0xb1
-	, 0xd6, 0x8d, 0x00, 0x00, 0x24, 0x24, 0x24, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xba, 0xda, 0xba, 0xba, 0x92, 0x92, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xba, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x8d, 0x89, 0x64, 0x64, 0x64, 0x89, 0x89
-	, 0x89, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69
-	, 0x69, 0x8d, 0xad, 0xb1, 0xb1, 0xd6, 0x69, 0x00, 0x24, 0x24, 0x00, 0x92, 0xdb, 0xdb, 0xda, 0xdb
-	, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xba, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xda, 0xba, 0xba
-	, 0xb6, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xba, 0xb6, 0xb6, 0xda, 0xda, 0xda
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x91, 0x89, 0x89
-	, 0x69, 0x69, 0x64, 0x89, 0x89, 0x69, 0x68, 0x69, 0x69, 0x68, 0x69, 0x69, 0x89, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x8d, 0x69, 0x69, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x24, 0x24, 0x24, 0x00, 0x49
-	, 0xb6, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xba, 0xba, 0xba
-	, 0xba, 0xba, 0xda, 0xba, 0xb6, 0x92, 0x92, 0xb6, 0xda, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xb6, 0xb6
-	, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xb6, 0x8d, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x89, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0x69, 0x00
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0xb6, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda
-	, 0xda, 0xda, 0xba, 0xba, 0xba, 0xda, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0xb1, 0x8d, 0x69, 0x68, 0x68, 0x48, 0x48, 0x68, 0x48, 0x48
-	, 0x48, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x8d, 0x8d, 0xad, 0xb1, 0xb1
-	, 0xb1, 0xad, 0x24, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0xb6, 0xb6, 0xdb, 0xdb, 0xb6
-	, 0xb6, 0xba, 0xb6, 0xba, 0xba, 0xba, 0xba, 0xb6, 0xb6, 0xba, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6
-	, 0xda, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0xdb, 0xb6, 0xb2, 0xb2, 0x69, 0x68, 0x48, 0x48
-	, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x8d, 0x8d
-	, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x49, 0x92, 0xdb, 0xdb, 0xda, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0x92, 0xb6, 0xb6, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda
-	, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xba, 0xda, 0xba, 0xb2, 0xb2
-	, 0x8d, 0x68, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0x8d, 0x68
-	, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x24, 0x6d, 0x91, 0xb6, 0xb6, 0xdb, 0xdb, 0xba, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xba, 0xb6, 0xb6
-	, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xba, 0xb6
-	, 0xda, 0xb6, 0x6d, 0xd6, 0xb1, 0x69, 0x68, 0x69, 0x8d, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x69, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0x8d, 0x20, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49
-	, 0x92, 0xb6, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xda
-	, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda
-	, 0xda, 0xba, 0xba, 0xb6, 0xdb, 0x6d, 0x44, 0xb1, 0xb1, 0x69, 0x68, 0x8d, 0x8d, 0xb1, 0xb1, 0xad
-	, 0xad, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0x8d, 0x20
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6d, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6
-	, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xda, 0xda, 0xda, 0xda, 0xba, 0xba, 0xb6, 0xb6, 0xda, 0x49, 0x24, 0x8d, 0x8d, 0x69, 0x48, 0x69
-	, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x48, 0x48, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0x8d
-	, 0x8d, 0x69, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x04, 0x6d, 0xda, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0x92, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xba, 0xb6, 0xba, 0xba, 0xb6, 0xb6, 0xb6, 0xba, 0xda
-	, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xba, 0xda, 0xba, 0xb6, 0xb6, 0xda, 0x92, 0x24, 0x24, 0x49
-	, 0x69, 0x44, 0x48, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x69, 0x69, 0x89
-	, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-	, 0x24, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00
-	, 0x71, 0xda, 0xb6, 0xb6, 0xb6, 0x92, 0x96, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xdb, 0xb6, 0x6d, 0xb6
-	, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xb6, 0xba, 0xba, 0xb6, 0xb6, 0xb6, 0xdb
-	, 0x6d, 0x24, 0x24, 0x24, 0x48, 0x48, 0x44, 0x69, 0x69, 0x69, 0x8d, 0x69, 0x69, 0x69, 0x44, 0x44
-	, 0x69, 0x69, 0x69, 0x69, 0x89, 0x8d, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x92, 0xb6, 0xb6, 0xb6, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xb6
-	, 0x6d, 0x00, 0x00, 0x92, 0xba, 0xb6, 0xba, 0xba, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xba, 0x49, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x48, 0x48, 0x68, 0x68, 0x68
-	, 0x44, 0x44, 0x44, 0x68, 0x69, 0x69, 0x69, 0x69, 0x89, 0x89, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xb6, 0xb6, 0xb6, 0x71, 0x6d, 0x49
-	, 0x49, 0x4d, 0x91, 0x24, 0x24, 0x00, 0x49, 0x92, 0xb6, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0xda
-	, 0xda, 0xba, 0xba, 0xba, 0xb6, 0xb6, 0xda, 0xb6, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24
-	, 0x48, 0x48, 0x44, 0x44, 0x44, 0x48, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x24, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x00, 0x04, 0x24, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28, 0x92
-	, 0xb6, 0x25, 0x29, 0x29, 0x29, 0x49, 0x29, 0x24, 0x24, 0x49, 0x6d, 0x92, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda
-	, 0xdb, 0xda, 0xda, 0xda, 0xba, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xdb, 0x92, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x24, 0x69, 0x8d, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x68, 0x44
-	, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x04
-	, 0x04, 0x04, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x4d, 0x6d, 0x92, 0x6d, 0x49, 0x49, 0x24, 0x24, 0x6d, 0x6d, 0x92
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0x49
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x24, 0xb1, 0x8d, 0x69, 0x68
-	, 0x48, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x24, 0x24, 0x00, 0x00, 0x04, 0x04, 0x24, 0x04, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x72, 0x6d, 0x6d, 0x24, 0x24, 0x28, 0x24
-	, 0x24, 0x49, 0x6d, 0x91, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb
-	, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00
-	, 0x24, 0x69, 0x48, 0x48, 0x48, 0x48, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x24, 0x24, 0x00, 0x04, 0x04, 0x04
-	, 0x04, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x29, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x00, 0x24, 0x49, 0x6d, 0x6d, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xda
-	, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xba
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-	, 0x00, 0x00, 0x24, 0x24, 0x00, 0x48, 0x69, 0x49, 0x49, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49
-	, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x24, 0x04
-	, 0x00, 0x00, 0x04, 0x24, 0x04, 0x04, 0x04, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x24, 0x24, 0x4d, 0x6d, 0x6d, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xba, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda
-	, 0xda, 0xda, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0x6d, 0x00, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x24, 0x48, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x6d, 0x24, 0x24, 0x4d, 0x4d, 0x6d
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda
-	, 0xda, 0xda, 0xda, 0xba, 0xda, 0xda, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x49, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x92, 0x8d, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x49, 0x48, 0x24, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x24, 0x24, 0x24, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x91, 0x6d, 0x49
-	, 0x49, 0x49, 0x4d, 0x6d, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xba, 0xba, 0xda, 0xda
-	, 0xda, 0xda, 0xda, 0xba, 0xda, 0xda, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x49, 0x91
-	, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x24, 0x49, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x04, 0x00, 0x24, 0x24, 0x04, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x6d
-	, 0x91, 0x91, 0x6d, 0x49, 0x6d, 0x49, 0x49, 0x6d, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xba, 0xda, 0xba, 0xda, 0xda, 0xda, 0xba, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xba, 0x6d, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-	, 0x00, 0x00, 0x6d, 0x92, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x49, 0x49, 0x48, 0x24, 0x00, 0x00, 0x24, 0x04
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00, 0x00, 0x04, 0x24, 0x24, 0x24
-	, 0x04, 0xb6, 0xb6, 0x8d, 0x8d, 0x91, 0x6d, 0xb6, 0xda, 0xb6, 0x71, 0x6d, 0x92, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xba, 0xda, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x92, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x6d
-	, 0x6d, 0x24, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00
-	, 0x00, 0x00, 0x04, 0x04, 0x04, 0xda, 0xb6, 0x6d, 0x91, 0x91, 0xb6, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x24, 0x48, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04
-	, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x24, 0x00, 0x04, 0xda, 0xb6, 0x8d, 0x91, 0x91, 0xda, 0xdb
-	, 0xda, 0xb6, 0xb6, 0xda, 0xda, 0xdb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0xda, 0xb6, 0x8d
-	, 0x91, 0x91, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xdb, 0xdb, 0xb6, 0xd6, 0xda, 0x91, 0xb2, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0x6d, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-	, 0x00, 0x24, 0x6d, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04
-	, 0x24, 0xda, 0xb6, 0x91, 0x91, 0x91, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xdb, 0xb2, 0xb1, 0xd6
-	, 0xb6, 0x71, 0x6d, 0xb6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x49, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x04, 0x00, 0xda, 0xb6, 0x91, 0x91, 0x6d, 0xb6, 0xb6, 0xb6, 0xb6, 0xda, 0xb6
-	, 0xb6, 0xad, 0x91, 0x92, 0xb6, 0x92, 0x71, 0x6d, 0xb6, 0xd6, 0xb1, 0x91, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x24, 0x24, 0x24, 0x24
-	, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x91, 0x49, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xda, 0xb6, 0x91, 0x6d, 0x91, 0xb6, 0xb6
-	, 0xb6, 0xda, 0xb6, 0xd6, 0xd6, 0x92, 0x71, 0x92, 0x92, 0x92, 0x92, 0x71, 0x6d, 0x91, 0x91, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x6d
-	, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x49
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x24, 0x04, 0xda, 0xb6, 0x91
-	, 0x6d, 0xb6, 0xb6, 0xd6, 0xdb, 0xb6, 0xd6, 0xd6, 0xb2, 0x91, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x6d
-	, 0x71, 0x6d, 0xb6, 0xff, 0xdb, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-	, 0xb6, 0xb6, 0xb6, 0x49, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-	, 0x00, 0x49, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-	, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00
-	, 0x24
-};
+const uint8_t palette_arrow[2] = {0x01, 0x43};
+const uint8_t palette_smiley[16] = {0x01, 0xdc, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
 
-const char piotr_bitmap[10002]={
-		0x64, 0x64, 0x00, 0x00, 0x00, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x4d, 0x71, 0x72, 0x72, 0x72, 0x72
-		, 0x72, 0x72, 0x49, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x49, 0x6d, 0x4d, 0x49, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x4d, 0x72
-		, 0x71, 0x71, 0x71, 0x71, 0x72, 0x71, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x6d, 0x72
-		, 0x71, 0x6d, 0x4d, 0x72, 0x71, 0x71, 0x71, 0x71, 0x72, 0x71, 0x4d, 0x24, 0x24, 0x24, 0x24, 0x24
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x28, 0x00, 0x00, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x6d, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x4d, 0x44
-		, 0x24, 0x44, 0x24, 0x24, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24
-		, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x28
-		, 0x00, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x72, 0x71, 0x71, 0x6d, 0x71, 0x71, 0x71, 0x71, 0x71
-		, 0x72, 0x71, 0x49, 0x24, 0x24, 0x44, 0x24, 0x24, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x24, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x71
-		, 0x71, 0x71, 0x71, 0x71, 0x72, 0x71, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d
-		, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x24, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x72
-		, 0x71, 0x71, 0x6d, 0x71, 0x72, 0x71, 0x71, 0x71, 0x71, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x71, 0x24, 0x00, 0x4d, 0x6d, 0x6d, 0x6d
-		, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x6d, 0x4d, 0x72, 0x71, 0x71, 0x6d, 0x71, 0x72, 0x71, 0x71, 0x71, 0x6d, 0x48, 0x48, 0x44
-		, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24
-		, 0x24, 0x24, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x00
-		, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49
-		, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x71, 0x71, 0x71, 0x6d, 0x6d, 0x71, 0x6d, 0x6d, 0x6d
-		, 0x49, 0x48, 0x44, 0x44, 0x48, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x49
-		, 0x6d, 0x71, 0x24, 0x00, 0x4d, 0x6d, 0x4d, 0x24, 0x24, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x71, 0x71, 0x71, 0x6d, 0x6d
-		, 0x71, 0x71, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x00, 0x00, 0x04, 0x4d, 0x24, 0x00, 0x4d, 0x28, 0x00, 0x00, 0x24, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x6d, 0x71
-		, 0x71, 0x71, 0x6d, 0x6d, 0x71, 0x71, 0x6d, 0x48, 0x48, 0x69, 0x8d, 0x68, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48
-		, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x69, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49
-		, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x4d
-		, 0x4d, 0x6d, 0x4d, 0x71, 0x71, 0x71, 0x4d, 0x6d, 0x71, 0x71, 0x6d, 0x48, 0x6d, 0x91, 0x68, 0x44
-		, 0x44, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x69, 0x69, 0x69, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x00, 0x00, 0x00
-		, 0x00, 0x28, 0x6d, 0x6d, 0x4d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x6d, 0x4d, 0x71, 0x71, 0x71, 0x4d, 0x6d, 0x71, 0x71, 0x6d, 0x6d
-		, 0x91, 0x68, 0x44, 0x44, 0x48, 0x69, 0x6d, 0x8d, 0x8d, 0x6d, 0x68, 0x48, 0x69, 0x69, 0x6d, 0x69
-		, 0x68, 0x44, 0x44, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x6d, 0x4d, 0x6d, 0x71, 0x6d, 0x6d, 0x6d
-		, 0x71, 0x6d, 0x6d, 0x8d, 0x68, 0x44, 0x48, 0x6d, 0x8d, 0x91, 0x8d, 0x8d, 0x8d, 0x6d, 0x8d, 0x6d
-		, 0x68, 0x48, 0x91, 0x91, 0x6d, 0x68, 0x48, 0x48, 0x69, 0x6d, 0x6d, 0x48, 0x68, 0x68, 0x48, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x49, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x71, 0x6d, 0x4d, 0x4d, 0x6d, 0x68, 0x68, 0x68, 0x48, 0x68, 0x8d, 0x91, 0x91, 0x8d, 0x69, 0x68
-		, 0x68, 0x48, 0x69, 0x91, 0x8d, 0x48, 0x6d, 0x92, 0x8d, 0x91, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d
-		, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x24, 0x00, 0x00, 0x24, 0x48, 0x24, 0x00, 0x4d, 0x6d, 0x24, 0x00
-		, 0x00, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x49, 0x49, 0x68, 0x48, 0x48, 0x48, 0x69, 0x8d, 0x8d, 0x8d
-		, 0x69, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x68, 0x8d, 0x68, 0x68, 0x6d, 0x8d, 0x8d, 0x6d, 0x69
-		, 0x48, 0x6d, 0x6d, 0x68, 0x68, 0x69, 0x68, 0x69, 0x68, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x44, 0x48, 0x48, 0x24, 0x00
-		, 0x49, 0x6d, 0x6d, 0x4d, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48
-		, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x49, 0x4d, 0x49, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x49, 0x48, 0x48, 0x44, 0x48, 0x69
-		, 0x8d, 0x91, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x8d, 0x6d, 0x6d, 0x68, 0x48, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6d, 0x6d, 0x69, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x44, 0x48, 0x24, 0x00, 0x49, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x48, 0x49, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d, 0x71, 0x6d, 0x48, 0x44
-		, 0x44, 0x48, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x68, 0x68, 0x68
-		, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x48, 0x44, 0x48, 0x69, 0x6d
-		, 0x69, 0x48, 0x48, 0x48, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44
-		, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x24, 0x00, 0x49, 0x72, 0x6d, 0x6d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x6d, 0x6d
-		, 0x72, 0x6d, 0x44, 0x44, 0x48, 0x8d, 0x91, 0x91, 0xb1, 0x8d, 0x6d, 0x68, 0x44, 0x44, 0x44, 0x48
-		, 0x68, 0x68, 0x68, 0x88, 0x8d, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0x8d, 0x8d, 0x89, 0x68, 0x68
-		, 0x48, 0x44, 0x44, 0x68, 0x6d, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x72, 0x72, 0x72, 0x6d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x6d, 0x6d, 0x6d, 0x72, 0x6d, 0x44, 0x44, 0x6d, 0x91, 0x91, 0xb2, 0x91, 0x8d, 0x8d, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x88, 0x8d, 0xb1, 0xb1, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xb2, 0xb1, 0xb1, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x69, 0x68, 0x48, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d
-		, 0x96, 0x97, 0x72, 0x72, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x72, 0x6d, 0x48, 0x44, 0x6d, 0xb2, 0x91, 0xb2
-		, 0x91, 0x91, 0x6d, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xb1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x6d, 0x68
-		, 0x69, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x71, 0xdb, 0xdf, 0x97, 0x72, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x6d, 0x92, 0x6d, 0x48, 0x48
-		, 0x91, 0xb6, 0x8d, 0x8d, 0x91, 0x8d, 0x6d, 0x8d, 0x8d, 0xb1, 0xb1, 0xd6, 0xd2, 0xd6, 0xfa, 0xda
-		, 0xfa, 0xfa, 0xfa, 0xfa, 0xd6, 0xf6, 0xf6, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb1
-		, 0x8d, 0x69, 0x8d, 0x68, 0x48, 0x48, 0x48, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0xb6, 0xff, 0xff, 0xbb, 0x72, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x6d, 0x72
-		, 0x92, 0x6d, 0x44, 0x6d, 0xb2, 0xb1, 0x68, 0x8d, 0x8d, 0x91, 0x91, 0xb2, 0xb1, 0xb1, 0xb1, 0xd6
-		, 0xd6, 0xd6, 0xfa, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0x68, 0x68, 0x68, 0x44, 0x68, 0x68, 0x68, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x6d, 0xb6, 0xff, 0xff, 0xbb, 0x72
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x48, 0x49, 0x72, 0x92, 0x96, 0x6d, 0x48, 0x6d, 0x91, 0x8d, 0x68, 0x68, 0x8d, 0xb2, 0xb2, 0xb1
-		, 0xad, 0xb1, 0xd2, 0xd6, 0xf6, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfa, 0xfa, 0xfa, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x48
-		, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0xb6
-		, 0xff, 0xff, 0xbb, 0x72, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48
-		, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x71, 0x71, 0x71, 0x6d, 0x6d, 0x68, 0x6d, 0x68, 0x44, 0x68
-		, 0x8d, 0x91, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xf6, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xd6, 0xd6, 0xd6, 0xb1, 0xb1, 0xd2, 0xd2
-		, 0xb1, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x92, 0xdf, 0xdf, 0x97, 0x72, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48
-		, 0x68, 0x44, 0x44, 0x68, 0x69, 0x8d, 0xb1, 0xd6, 0xb1, 0xd2, 0xf6, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6
-		, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x6d, 0x68, 0x68, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x6d, 0xb6, 0xbb, 0x92, 0x6e, 0x4d, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x44, 0x48, 0x6d
-		, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x68, 0x8d, 0xd1, 0xb1, 0xd2, 0xf6, 0xfa, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfa, 0xfa, 0xf6, 0xd6, 0xd6, 0xd2, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0x91, 0x6d, 0x68, 0x68
-		, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x72, 0x72, 0x6d
-		, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x68, 0xb1, 0xd2, 0xb2
-		, 0xd6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1
-		, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x48
-		, 0x6d, 0x72, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68
-		, 0x8d, 0xb2, 0xd6, 0xd6, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6
-		, 0xd2, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d, 0x6d, 0x6d, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x48, 0x44, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x48, 0x8d, 0xad, 0xd6, 0xd6, 0xd6, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xf6, 0xf6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xb2, 0x8d, 0x6d, 0x8d, 0x68, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x8d, 0xd2, 0xd6, 0xd6, 0xd6, 0xfa, 0xfa, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa
-		, 0xfa, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0xb1, 0xb1, 0xb2, 0x8d, 0x6d, 0x6d
-		, 0x69, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x44, 0x48, 0x6d, 0x6d, 0x4d, 0x4d
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x4d, 0x4d, 0x49, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0xb1, 0xd6, 0xd6, 0xd6, 0xf6
-		, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0x91, 0x6d, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x6d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x68, 0x69, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xd6, 0xd6, 0xd6
-		, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x6d, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x4d, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d, 0x4d, 0x49, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x69, 0x6d, 0x6d, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa
-		, 0xfa, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0x8d, 0x68, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x49, 0x4d, 0x4d, 0x49, 0x49
-		, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x49
-		, 0x48, 0x48, 0x44, 0x44, 0x69, 0x91, 0x6d, 0xd6, 0xd6, 0xd6, 0xd6, 0xda, 0xda, 0xfa, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xda, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x44
-		, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x49, 0x49, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x4d, 0x4d
-		, 0x49, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x6d, 0x6d, 0x48, 0x48, 0x44, 0x44, 0x68, 0x91, 0xb2, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0xad
-		, 0xad, 0x8d, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x48
-		, 0x48, 0x48, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4d, 0x69, 0x48, 0x44, 0x44, 0x44, 0x44, 0x8d, 0xb6, 0xd6
-		, 0xb2, 0xd6, 0xd6, 0xd6, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xd6, 0xb2, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x89, 0x68, 0x88, 0xad, 0x8d, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x49, 0x49, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x69, 0x92, 0xb2, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xb2, 0xd6, 0xd6, 0xd6, 0xdb, 0xfb, 0xfb
-		, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0xb2, 0x91, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0xb2, 0xb2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x8d, 0x8d, 0x89, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x69, 0xad, 0xb1, 0xb6, 0xd6, 0xd6, 0xad, 0x8d, 0xb1, 0xb2
-		, 0x91, 0x8d, 0xb2, 0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0xb2
-		, 0xb1, 0xb1, 0xb2, 0xd6, 0xfb, 0xfb, 0xdb, 0xfb, 0xd6, 0xd6, 0xb1, 0x69, 0x68, 0x8d, 0x8d, 0x68
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0xb1, 0xb2
-		, 0xd2, 0xb2, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xd6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-		, 0xff, 0xfb, 0xd6, 0xd6, 0xd6, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xb1
-		, 0x68, 0x88, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x6d, 0x8d
-		, 0x8d, 0x8d, 0xb1, 0xd6, 0xda, 0xdb, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfb, 0xfb, 0xff
-		, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xfb, 0xda, 0xd6, 0xfb, 0xfb, 0xfb, 0xda, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0x44, 0x44
-		, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x49, 0x48, 0x49, 0x6d, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x69, 0x8d, 0x8d, 0xb2, 0xd6, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xda, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2
-		, 0x8d, 0x8d, 0xb1, 0xb2, 0xd2, 0xd6, 0xd6, 0xb2, 0xad, 0x88, 0x68, 0x68, 0x44, 0x44, 0x44, 0x48
-		, 0x8d, 0x8d, 0x68, 0x44, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x49, 0x48, 0x48, 0x49, 0x6d
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0xd6, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xda, 0xda, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xda, 0xdb, 0x92, 0x6d, 0x69, 0x6d, 0xb2, 0x89, 0x8d, 0xb1, 0xd2, 0xb2, 0xb1, 0x8d, 0x68, 0x68
-		, 0x44, 0x44, 0x44, 0x69, 0xad, 0xd6, 0x6d, 0x44, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x49, 0x49
-		, 0x49, 0x48, 0x49, 0x6d, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x68, 0x6d, 0xb1, 0xd6, 0xda, 0xfb
-		, 0xfb, 0xd6, 0xb2, 0xb2, 0x8d, 0xb2, 0xdb, 0xfb, 0xfb, 0xda, 0xd6, 0xd6, 0xfb, 0xfb, 0xfa, 0xfa
-		, 0xd6, 0xd6, 0xd6, 0xfb, 0xd6, 0xff, 0xdb, 0x8d, 0x6d, 0x92, 0xd6, 0xb2, 0xb1, 0xad, 0xd1, 0xb1
-		, 0xb1, 0x8d, 0x68, 0x68, 0x48, 0x24, 0x68, 0xb1, 0xad, 0xd6, 0x6d, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x49, 0x6d, 0x48, 0x68, 0x68, 0x44, 0x6d, 0x6d
-		, 0xb1, 0xd6, 0xda, 0xfa, 0xd6, 0x8d, 0xb6, 0x6d, 0x8d, 0x92, 0xdb, 0xfb, 0xfa, 0xfa, 0xd6, 0xd6
-		, 0xd6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1, 0xad, 0x88, 0x68, 0x68, 0x48, 0x8d, 0xb1, 0xad, 0xd6, 0x6d, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x49, 0x6d, 0x6d, 0xb2
-		, 0x89, 0x44, 0x6d, 0x8d, 0xb2, 0xd6, 0xd6, 0xd2, 0x8d, 0xb2, 0xd7, 0xb2, 0x8d, 0xb6, 0xdb, 0xfa
-		, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0xb1, 0xad, 0x89, 0x68, 0x68, 0x69, 0xb1, 0xb1
-		, 0x8d, 0xd2, 0x69, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d
-		, 0x49, 0x6d, 0x6d, 0xd6, 0xd2, 0x44, 0x6d, 0x8d, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xfb, 0xd6, 0xdb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xda, 0xd6, 0xd2, 0xd6, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd6
-		, 0xd6, 0xfa, 0xda, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68
-		, 0x68, 0x8d, 0xd6, 0xd6, 0xad, 0xb1, 0x68, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x48, 0x49, 0x49, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x4d, 0x49, 0x6d, 0x6d, 0xd6, 0xf6, 0x8d, 0x6d, 0x91, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd2, 0xd6, 0xfa, 0xf6, 0xf6
-		, 0xd6, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb2, 0xd6, 0xd6, 0xb2, 0x8d, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x49, 0x6d, 0x6d, 0xb2, 0xd6, 0x8d, 0x6d, 0x92
-		, 0xd6, 0xd6, 0xd6, 0xdb, 0xfa, 0xf6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xd6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x8d, 0xd6, 0xd6, 0xb2, 0x69, 0x44, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x6d, 0x6d, 0x92
-		, 0xd6, 0xb1, 0x8d, 0x91, 0xb2, 0xd6, 0xda, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xf6
-		, 0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd6, 0xf6, 0xd6, 0xd6
-		, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xad, 0xd2
-		, 0x8d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49
-		, 0x48, 0x6d, 0x6d, 0x8d, 0xd6, 0xfa, 0xd6, 0x8d, 0xd2, 0xd6, 0xd6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfa, 0xd6, 0xfa, 0xfb, 0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xf6, 0xfa, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd6, 0xf6, 0xf6, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68
-		, 0x69, 0xb2, 0x8d, 0x8d, 0x8d, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x49, 0x48, 0x69, 0x6d, 0x6d, 0xd6, 0xfb, 0xd6, 0x8d, 0xd6, 0xd6, 0xd6, 0xfa
-		, 0xfb, 0xfb, 0xfb, 0xf6, 0xf6, 0xf6, 0xfb, 0xfb, 0xf6, 0xd6, 0xd6, 0xd2, 0xd6, 0xfa, 0xfa, 0xf6
-		, 0xd2, 0xb1, 0xd2, 0xd2, 0xd6, 0xd6, 0xf6, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xb2, 0x8d, 0x68, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x49, 0x6d, 0x69, 0xb2, 0xfb, 0xfb, 0xb1
-		, 0xd2, 0xd6, 0xd6, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd6, 0xd6, 0xd2
-		, 0xd6, 0xfa, 0xfa, 0xf6, 0xd2, 0xb1, 0xd2, 0xd2, 0xd6, 0xf6, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6
-		, 0xf6, 0xd6, 0xd6, 0xd6, 0xb2, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xb2, 0x69, 0x48, 0x44, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x49, 0x6d, 0x49
-		, 0x6d, 0xd6, 0xd6, 0xb1, 0xb2, 0xd2, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfa, 0xd6, 0xd6, 0xd2, 0xf6, 0xfb, 0xfb, 0xfa, 0xd6, 0xb1, 0xad, 0xb1, 0xb1, 0xd6, 0xfa, 0xfa
-		, 0xfb, 0xfa, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xb2, 0x8d, 0x8d, 0x68, 0x68, 0xb1, 0x8d, 0x48
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48
-		, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49
-		, 0x48, 0x49, 0x6d, 0x4d, 0x49, 0xb2, 0xd6, 0xb2, 0xb2, 0xd6, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfa, 0xd2, 0xd2, 0xd6, 0xfb, 0xfb, 0xff, 0xfb, 0xfa, 0xd2, 0xb1, 0xb1
-		, 0xb1, 0xd2, 0xfa, 0xfb, 0xfb, 0xfb, 0xfa, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x6d, 0x68
-		, 0x68, 0x8d, 0x8d, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49
-		, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x6d, 0x49, 0x48, 0x6d, 0xd6, 0xb6, 0xb2, 0xd6, 0xd6, 0xfb
-		, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd2, 0xd2, 0xd6, 0xfb, 0xff, 0xff, 0xfb
-		, 0xfb, 0xd6, 0xd6, 0xd2, 0xd1, 0xd2, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xb1, 0x8d, 0x68, 0x68, 0x68, 0xad, 0x8d, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x4d, 0x49, 0x48, 0x49, 0x8d, 0xb2
-		, 0xb2, 0xd6, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xdb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xf6, 0xf6, 0xd6
-		, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x68, 0xad, 0x68, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49
-		, 0x49, 0x48, 0x6d, 0xb1, 0xb1, 0xd6, 0xd6, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xdb, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x49, 0x49, 0x49, 0x48, 0x8d, 0xd2, 0xad, 0xb2, 0xd6, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb
-		, 0xfb, 0xfa, 0xfb, 0xfa, 0xda, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xad, 0x8d, 0x8d, 0x8d, 0x88, 0x68
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x6d, 0xb2, 0xb1, 0xb1, 0xd6, 0xd6
-		, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xf6, 0xfb, 0xd6, 0xd6
-		, 0xfa, 0xf6, 0xf6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xb2, 0xb2, 0xd2, 0x8d, 0x88
-		, 0x8d, 0xb1, 0x89, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x49, 0x69
-		, 0x8d, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xb1, 0xad, 0xb1, 0xb1, 0xb2
-		, 0xb2, 0xd6, 0xad, 0x88, 0x8d, 0xb1, 0x89, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49
-		, 0x48, 0x48, 0x49, 0x48, 0x6d, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfb, 0xfb, 0xdb, 0xdb, 0xdb, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1
-		, 0xad, 0xad, 0xad, 0xb1, 0xd2, 0xd6, 0xad, 0x68, 0xad, 0xb1, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x49, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0xb2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-		, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfb, 0xfb, 0xd6, 0xda, 0xfb, 0xd6, 0xd6
-		, 0xd6, 0xd2, 0xd2, 0xb1, 0xad, 0x8d, 0xad, 0xb1, 0xd2, 0xd6, 0x8d, 0x68, 0xad, 0xad, 0x68, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0xb1, 0xd6, 0xd6
-		, 0xd6, 0xf6, 0xd6, 0xd6, 0xb2, 0xb1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xf6, 0xfb
-		, 0xd7, 0xd6, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0x89, 0x88, 0xad, 0xb1, 0xd1, 0xd6, 0xd6, 0x8d, 0x68
-		, 0xad, 0x8d, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x8d, 0xd6, 0xd6, 0xd6, 0xfa, 0xfa, 0xd6, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xcd
-		, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xcd, 0xad, 0xad, 0xa9, 0xad, 0xa9, 0x88, 0x8d, 0xad, 0xd1, 0xd2
-		, 0xd6, 0xb1, 0x89, 0x88, 0x8d, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x48, 0x48, 0x48, 0x69, 0xb2, 0xd6, 0xd6, 0xd6, 0xfa, 0xf6, 0xd6, 0xd6, 0xd1, 0xad
-		, 0xa9, 0xad, 0xad, 0xcd, 0xcd, 0xcd, 0xcd, 0xd2, 0xd2, 0xcd, 0xcd, 0xcd, 0xcd, 0xad, 0xad, 0xad
-		, 0x8d, 0xad, 0xd1, 0xd2, 0xd6, 0xb1, 0x68, 0x89, 0x8d, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x8d, 0xd6, 0xb2, 0xd6, 0xfa, 0xfa
-		, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0xad, 0xcd, 0xcd, 0xcd, 0xd2, 0xd2, 0xd6, 0xf7, 0xd6, 0xd2, 0xcd
-		, 0xcd, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0xb2, 0x8d, 0x68, 0x8d, 0x68, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x69, 0xb1
-		, 0xb2, 0xb1, 0xd6, 0xfa, 0xf6, 0xd6, 0xd2, 0xd1, 0xb1, 0xb1, 0xd1, 0xcd, 0xd2, 0xd2, 0xd6, 0xfb
-		, 0xfb, 0xd6, 0xd6, 0xd2, 0xd2, 0xb2, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0xb1, 0x68, 0x68, 0x68
-		, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x8d, 0xb1, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1, 0xd2, 0xd2
-		, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0xb1, 0xb1
-		, 0x8d, 0x68, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x8d, 0xb1, 0xb1, 0xb2, 0xd6, 0xd6, 0xd6, 0xd2
-		, 0xb1, 0xb1, 0xb1, 0xb2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xb2, 0xad, 0xad, 0xad
-		, 0x8d, 0xad, 0xb1, 0xb1, 0x89, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x8d, 0xb1, 0xb1
-		, 0xd2, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xb2, 0xb1, 0xad, 0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x44, 0x44, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x44
-		, 0x48, 0x44, 0x48, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x69, 0x8d, 0xb1, 0x8d, 0xd6, 0xd6, 0xd2, 0xb1, 0xb1, 0xb1, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x44
-		, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x8d, 0x8d, 0x8d, 0xad, 0xd6, 0xd6, 0xb1, 0xb1, 0xb1, 0xb2
-		, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x68
-		, 0x68, 0x68, 0x44, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xd6
-		, 0xb2, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1, 0xad, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x68, 0x48, 0x44, 0x44, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x68, 0xad, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1
-		, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x44, 0x44, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x44, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x68, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd2, 0xd2
-		, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x44, 0x48, 0x68, 0x68
-		, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x8d, 0xad, 0xb1, 0x8d, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0xb1
-		, 0xb1, 0xb1, 0xb2, 0xd2, 0xd2, 0xb2, 0xb2, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x44
-		, 0x68, 0x68, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x48
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0x8d, 0x68
-		, 0x69, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xad, 0x8d, 0x8d, 0x69
-		, 0x68, 0x68, 0x44, 0x44, 0x68, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x6d, 0x6d, 0x8d, 0xad
-		, 0xad, 0xad, 0xb1, 0x8d, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d
-		, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x44, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x48, 0x91
-		, 0x92, 0x68, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x48, 0x48, 0x48, 0x68, 0x68, 0x68, 0x48, 0x44
-		, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24
-		, 0x44, 0x69, 0x92, 0xb6, 0x68, 0x68, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x68, 0x68
-		, 0x68, 0x68, 0x8d, 0x69, 0x6d, 0x8d, 0x69, 0x69, 0x68, 0x48, 0x48, 0x48, 0x68, 0x48, 0x44, 0x48
-		, 0x48, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x24, 0x44, 0x48, 0x71, 0x92, 0xb6, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad
-		, 0xad, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x68, 0x48, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x48, 0x49, 0x6d, 0x92, 0x92, 0xb6, 0x6d, 0x68, 0x68, 0x68, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44
-		, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x6d, 0x91, 0x72, 0x92, 0x96, 0xb6, 0x8d, 0x68, 0x68
-		, 0x68, 0x68, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x89, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x24, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x92, 0x92, 0xb6, 0xb6
-		, 0xb2, 0x68, 0x68, 0x68, 0x68, 0x88, 0x8d, 0x8d, 0x8d, 0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x89, 0x69
-		, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x6d, 0x92, 0x96, 0x96
-		, 0x96, 0xb6, 0xb6, 0xb6, 0x92, 0x68, 0x88, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x48, 0x6d
-		, 0x96, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0xb6, 0xb6, 0xb2, 0x88, 0x89, 0x68, 0x68, 0x89, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x68
-		, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44
-		, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24
-		, 0x24, 0x4d, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb2, 0x8d, 0x8d, 0x88
-		, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x48, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24
-		, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x96, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0x8d, 0x8d, 0x89, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x49, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x91, 0x8d, 0x89, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-		, 0x8d, 0x8d, 0x89, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb2, 0x8d, 0x89, 0x68, 0x69, 0x8d, 0x8d
-		, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x49, 0x92, 0x96, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x8d, 0x69
-		, 0x69, 0x69, 0x89, 0x89, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb2, 0x6d, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x49, 0x71, 0x96, 0x96, 0x96, 0x96, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x96, 0x96
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x91, 0x69, 0x6d, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x96, 0x96, 0x96, 0x96, 0x96, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0xb6
-		, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0xb6, 0xb6, 0x92, 0xb2, 0x8d, 0x69, 0x69, 0x69
-		, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x24, 0x44, 0x24, 0x24, 0x48, 0x71, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xb6, 0xb6
-		, 0xb6, 0x96, 0x96, 0xb6, 0xb6, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92, 0xb6, 0x92, 0x92, 0x92
-		, 0x92, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x92, 0x96, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0xb6, 0xb6, 0xb6, 0x96, 0x96, 0xb6, 0x96, 0x96, 0x92, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x49, 0x71, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xb6, 0x96, 0x96, 0x96, 0x96, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8d, 0x69, 0x68, 0x68, 0x68
-		, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x92
-		, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0xb6, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x91, 0x6d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x49
-		, 0x92, 0x92, 0x92, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96
-		, 0x96, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92
-		, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x8d, 0x6d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-		, 0x44
-};
-const char daniel_bitmap[10002] = {
-0x64, 0x64, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x6d, 0x4c
-, 0x48, 0x6c, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6c, 0x6c, 0x4c
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d
-, 0x6c, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x4d, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x4c
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x6c, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c
-, 0x4c, 0x4c, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x24
-, 0x48, 0x48, 0x48, 0x48, 0x44, 0x48, 0x6d, 0x28, 0x24, 0x24, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x6d
-, 0x6d, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x4c, 0x4c, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x48, 0x24, 0x24, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24
-, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x24, 0x00, 0x24, 0x24, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x4c, 0x6d, 0x4d
-, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x4c, 0x24, 0x24, 0x24, 0x48, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x24, 0x00, 0x24, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6c, 0x6d, 0x6d, 0x6c, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x68
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x69, 0x6d, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x24, 0x48, 0x48, 0x4c, 0x48, 0x24, 0x24, 0x24, 0x20, 0x24, 0x20
-, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x24, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x68
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x48, 0x4c, 0x6d, 0x4c, 0x68, 0x48, 0x48, 0x6d, 0x4c, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x4c, 0x6d
-, 0x48, 0x48, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x68, 0x48, 0x24, 0x6d, 0x4c, 0x24, 0x00, 0x00, 0x20
-, 0x20, 0x24, 0x24, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00, 0x44, 0x4d, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x68, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d
-, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x24, 0x6d, 0x48, 0x24
-, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x48, 0x48, 0x4c, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x68, 0x48, 0x48
-, 0x6d, 0x48, 0x69, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d
-, 0x24, 0x48, 0x20, 0x00, 0x20, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x20
-, 0x24, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x4c
-, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x68, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x20, 0x20, 0x00, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24
-, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x4d, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x4d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x4d, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6c
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-, 0x24, 0x00, 0x00, 0x20, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x24, 0x48, 0x48, 0x48, 0x48
-, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x68, 0x48, 0x4d, 0x4c, 0x6c
-, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x48
-, 0x24, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x48
-, 0x48, 0x48, 0x6d, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20
-, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x24, 0x20, 0x20, 0x00, 0x00, 0x20, 0x24, 0x24
-, 0x00, 0x00, 0x20, 0x48, 0x24, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x4c, 0x48, 0x6d, 0x4c, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48
-, 0x48, 0x24, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00
-, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x68, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x24, 0x24, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x00
-, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x48, 0x48
-, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48
-, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x48, 0x48, 0x4d, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x20, 0x24, 0x24, 0x20, 0x20
-, 0x00, 0x20, 0x4c, 0x6d, 0x4c, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x4c, 0x4c, 0x48, 0x4c, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c
-, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x64, 0x24, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x20, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x4c, 0x48, 0x48, 0x48
-, 0x4c, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x00
-, 0x20, 0x24, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x44, 0x64, 0x68, 0x64, 0x89, 0x89, 0x8d
-, 0x68, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x24, 0x00, 0x24, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x24, 0x20
-, 0x44, 0x68, 0x68, 0x24, 0x00, 0x20, 0x20, 0x44, 0x64, 0x64, 0x44, 0x44, 0x64, 0x68, 0x89, 0x89
-, 0x89, 0x8d, 0xad, 0x89, 0x68, 0x89, 0x68, 0x44, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x24, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x24
-, 0x44, 0x24, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x89, 0x44, 0x20, 0x24, 0x64, 0x68, 0x68, 0x64, 0x64
-, 0x68, 0x69, 0x68, 0x89, 0xb1, 0xad, 0xad, 0x89, 0xad, 0xad, 0x89, 0x44, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x48
-, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x24, 0x64, 0x68, 0x44, 0x68, 0x89, 0xad, 0xad, 0xb1, 0xad, 0x89, 0x68, 0x68, 0x89
-, 0x68, 0x68, 0x89, 0x89, 0x89, 0x89, 0xad, 0xb1, 0xd2, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0x89, 0x44
-, 0x20, 0x44, 0x24, 0x20, 0x00, 0x00, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6c
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x6d, 0x48
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x44, 0x68, 0x68, 0x68, 0x89, 0xad, 0xad, 0xb1, 0xb1, 0xb1
-, 0xad, 0xad, 0xad, 0xad, 0x8d, 0xad, 0xad, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xad
-, 0xad, 0xad, 0xad, 0x89, 0x68, 0x44, 0x24, 0x20, 0x00, 0x00, 0x24, 0x6d, 0x48, 0x6c, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x6c, 0x4c, 0x4c, 0x48
-, 0x48, 0x6d, 0x6d, 0x44, 0x00, 0x00, 0x00, 0x24, 0x20, 0x44, 0x68, 0x68, 0x89, 0xad, 0xad, 0xad
-, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xb1, 0xad, 0xb1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0x64, 0x24, 0x24, 0x20, 0x00, 0x00, 0x24, 0x6d
-, 0x4c, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c
-, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x6d
-, 0x6d, 0x4c, 0x48, 0x68, 0x6d, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x20, 0x20, 0x44, 0x89, 0x8d
-, 0xad, 0xad, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xad, 0x68, 0x44, 0x44, 0x00
-, 0x00, 0x00, 0x24, 0x6d, 0x6d, 0x4c, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x44, 0x89, 0xad, 0xad, 0xad, 0xb1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2
-, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd1, 0xad
-, 0xad, 0x8d, 0x44, 0x20, 0x00, 0x00, 0x24, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x4c, 0x4c, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x89, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xb2, 0xd2, 0xd6
-, 0xd6, 0xd2, 0xd2, 0xd2, 0xb2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2
-, 0xb1, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0x44, 0x00, 0x00, 0x00, 0x24, 0x4c, 0x6d, 0x6d, 0x6d, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x4d, 0x6d, 0x6d, 0x4c, 0x48, 0x68, 0x6d, 0x48, 0x48
-, 0x6d, 0x6d, 0x68, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x89, 0xad, 0xad, 0x89, 0x44, 0x44
-, 0x44, 0x44, 0x69, 0xad, 0xd2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd6, 0xd2, 0x89, 0x44, 0x44, 0x44, 0x44, 0x89, 0xad, 0xad, 0x64, 0x00, 0x00, 0x00, 0x48, 0x4c
-, 0x48, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48
-, 0x48, 0x48, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x6d, 0x6d, 0x4c, 0x48, 0x48
-, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x68, 0x48, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00, 0x44, 0xad, 0xad
-, 0x8d, 0x68, 0x69, 0x8d, 0x89, 0x69, 0x44, 0x44, 0x69, 0xad, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xd2, 0xd2, 0xad, 0x89, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0xad, 0x89, 0x00
-, 0x00, 0x00, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48
-, 0x48, 0x68, 0x4c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x4c, 0x6d, 0x6c
-, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x6c, 0x68, 0x68, 0x48, 0x68, 0x24, 0x00, 0x00, 0x00
-, 0x00, 0x68, 0xad, 0x8d, 0x69, 0x8d, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x69, 0x44, 0x64, 0x8d, 0xad
-, 0xd1, 0xd1, 0xad, 0xad, 0xd1, 0xd2, 0xad, 0x89, 0x44, 0x64, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x89
-, 0x69, 0x8d, 0x8d, 0x20, 0x00, 0x00, 0x48, 0x48, 0x6c, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c
-, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x68, 0x48, 0x48, 0x6d, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x4c, 0x6d, 0x6c, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x68, 0x68, 0x68, 0x48, 0x48, 0x6d
-, 0x48, 0x00, 0x00, 0x00, 0x20, 0x8d, 0xad, 0x8d, 0x89, 0x8d, 0x89, 0x64, 0x44, 0x44, 0x44, 0x44
-, 0x69, 0x69, 0x89, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89, 0x69, 0x69, 0x68, 0x49, 0x69
-, 0x69, 0x69, 0x69, 0x69, 0x69, 0x49, 0x49, 0x24, 0x00, 0x24, 0x4d, 0x6d, 0x48, 0x6d, 0x4c, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x48, 0x6d, 0x48, 0x6d, 0x6c
-, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6c, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x6c, 0x48, 0x68, 0x68
-, 0x48, 0x68, 0x68, 0x48, 0x48, 0x00, 0x00, 0x00, 0x44, 0x69, 0x49, 0x49, 0x45, 0x69, 0x69, 0x69
-, 0x69, 0x69, 0x6d, 0x69, 0x48, 0x49, 0x69, 0x69, 0x8d, 0xad, 0xb1, 0xad, 0x8d, 0x69, 0x49, 0x69
-, 0x44, 0x69, 0x69, 0x69, 0x8d, 0x69, 0x89, 0xad, 0x89, 0x68, 0x49, 0x24, 0x24, 0x89, 0x69, 0x6d
-, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x4c, 0x48, 0x48, 0x6d, 0x48, 0x6c
-, 0x48, 0x68, 0x68, 0x68, 0x48, 0x68, 0x48, 0x68, 0x89, 0x68, 0x00, 0x00, 0x44, 0x48, 0x24, 0x24
-, 0x69, 0x8d, 0x68, 0x44, 0xb2, 0x91, 0x4d, 0x91, 0x91, 0x44, 0x68, 0x69, 0x49, 0x45, 0x44, 0x49
-, 0x24, 0x49, 0x69, 0x44, 0x69, 0x6d, 0x6c, 0x6c, 0x8d, 0x8d, 0x44, 0x68, 0x89, 0x8d, 0x69, 0x44
-, 0x44, 0x89, 0x88, 0x6d, 0x4d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x48
-, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x4c, 0x88, 0x88, 0x89, 0x24, 0x00
-, 0x68, 0xad, 0x8d, 0x69, 0x89, 0x68, 0x44, 0x89, 0xb1, 0x4c, 0x48, 0x4c, 0x91, 0x89, 0x44, 0x89
-, 0x69, 0x69, 0xd2, 0xd2, 0x69, 0x69, 0x68, 0x64, 0x8d, 0x8c, 0x68, 0x8c, 0x8c, 0xad, 0x64, 0x68
-, 0x8d, 0xad, 0xad, 0x69, 0x44, 0xad, 0x88, 0x69, 0x48, 0x6d, 0x48, 0x48, 0x4d, 0x6d, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x48, 0x4c, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x68, 0x48, 0x68, 0x48, 0x48, 0x6d, 0x88
-, 0xad, 0x89, 0x20, 0x20, 0x69, 0xad, 0xad, 0xb1, 0xad, 0x8d, 0x89, 0x89, 0xad, 0x4c, 0x2c, 0x28
-, 0x8d, 0x89, 0x64, 0x8d, 0x48, 0x8d, 0xf6, 0xf6, 0xad, 0x69, 0x8d, 0x64, 0x89, 0x8d, 0x8c, 0x8c
-, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0x69, 0x44, 0xd1, 0xa9, 0x8d, 0x48, 0x6d, 0x6d, 0x48
-, 0x48, 0x6d, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x68, 0x48, 0x68, 0x48
-, 0x48, 0x6d, 0x6d, 0x89, 0xa9, 0xad, 0x44, 0x20, 0x89, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xad
-, 0xad, 0x8d, 0x6d, 0x8d, 0xad, 0x89, 0x8d, 0x69, 0x24, 0xad, 0xd6, 0xd6, 0xb1, 0x44, 0x8d, 0x8d
-, 0x89, 0x8d, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0x89, 0x68, 0xb1, 0xa9, 0x8d
-, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48
-, 0x4c, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x6c, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x68
-, 0x68, 0x68, 0x68, 0x48, 0x4d, 0x6d, 0x6d, 0x89, 0xa9, 0xd1, 0x64, 0x00, 0x89, 0xad, 0xad, 0xb1
-, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xa9, 0x89, 0x89, 0x8d, 0x8d, 0x69, 0x64, 0xd1, 0xd2, 0xd2
-, 0xd2, 0x89, 0x89, 0xad, 0x8d, 0x89, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0xd2, 0xd2, 0xb1, 0xad, 0x89
-, 0x89, 0xd1, 0xad, 0x6d, 0x4c, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x4c, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x4c, 0x48, 0x6d, 0x6c
-, 0x48, 0x48, 0x68, 0x6c, 0x68, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x89, 0xad, 0xad, 0x64, 0x44
-, 0x89, 0xad, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x89
-, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xad, 0xad, 0xad, 0xcd, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xb1, 0xad, 0x8d, 0x89, 0xd1, 0xad, 0x68, 0x4c, 0x6c, 0x4c, 0x4c, 0x48, 0x48, 0x48, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d
-, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x68, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x8d
-, 0xad, 0x88, 0x88, 0x8d, 0x8d, 0xad, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1
-, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd2, 0xf6, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xd2
-, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xad, 0xad, 0x89, 0xad, 0xad, 0x68, 0x48, 0x6d, 0x48, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x68, 0x68, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x8d, 0xad, 0x84, 0xad, 0xad, 0x8d, 0xad, 0xb1, 0xb1, 0xd2, 0xd2, 0xd2, 0xd1
-, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xd2, 0xf6, 0xd2, 0xd2, 0xd1, 0xad
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd2, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0x69
-, 0x48, 0x6d, 0x68, 0x6d, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x6d, 0x4c, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x68
-, 0x68, 0x48, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x8d, 0xad, 0x88, 0xad, 0xad, 0x8d, 0xad, 0xad, 0xad
-, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1, 0xb1, 0xd2, 0xd2, 0xf6
-, 0xd2, 0xd2, 0xd1, 0xd2, 0xd1, 0xad, 0xad, 0xad, 0xad, 0xcd, 0xad, 0xd2, 0xd1, 0xad, 0xad, 0xad
-, 0xad, 0xad, 0xad, 0x69, 0x48, 0x48, 0x6d, 0x6c, 0x4c, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x8d, 0xad, 0xad, 0xad, 0x8d
-, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xad, 0xad, 0x89, 0x88, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd1
-, 0xd1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd1, 0xd1, 0xad, 0xad, 0xad, 0x89, 0x84, 0x84, 0xa9, 0xad
-, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xd1, 0xad, 0x69, 0x48, 0x48, 0x6d, 0x68, 0x6d, 0x48, 0x48, 0x48
-, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x68, 0x48, 0x48, 0x48
-, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x68, 0x6d, 0x48
-, 0x48, 0x6d, 0x48, 0x48, 0x4c, 0x6d, 0x4c, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0xad, 0xb1, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0xad, 0xad, 0x89, 0x68, 0x44, 0x64, 0x89, 0xad, 0xad
-, 0xad, 0xad, 0x88, 0x89, 0xad, 0xb1, 0xd2, 0xd2, 0xd2, 0xad, 0x89, 0x68, 0xad, 0xad, 0xad, 0xad
-, 0x89, 0x64, 0x44, 0x68, 0xad, 0xad, 0xad, 0xad, 0xd1, 0xd2, 0xb1, 0x48, 0x48, 0x48, 0x6d, 0x68
-, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x68, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x68, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x48, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x4c, 0x4c, 0x68, 0x48, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x48, 0x4c, 0x8d, 0xd1, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x88, 0x44, 0x68
-, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8d
-, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x44, 0x44, 0x89, 0xad, 0xad, 0xad, 0xd1, 0xb1, 0x8d, 0x4c
-, 0x48, 0x48, 0x6d, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x68, 0x6d, 0x48, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x68, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4c, 0x68
-, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x6d, 0x48, 0x8d, 0xad, 0x89, 0x89, 0xad, 0xad, 0x8d
-, 0x8d, 0x89, 0x68, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x89, 0x69, 0x68
-, 0x89, 0xad, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xad, 0x8d, 0x69, 0x64, 0x89, 0xad, 0x8d, 0xad, 0x8d
-, 0x68, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x68, 0x6d, 0x6c, 0x4c, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x48, 0x68, 0x4c, 0x48, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x48, 0x48, 0x4c, 0x6c, 0x48, 0x48
-, 0x4d, 0x4c, 0x4c, 0x68, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x48, 0x44
-, 0x69, 0xad, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0x64, 0x44, 0x44, 0x68, 0x89, 0xad, 0xad, 0xad, 0xad
-, 0xad, 0xad, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xad, 0xad, 0x89, 0x69, 0x44, 0x20, 0x64, 0x8d, 0xad
-, 0xad, 0xad, 0xad, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x68, 0x6d, 0x6c, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x68, 0x6d, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x6d, 0x68, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c
-, 0x48, 0x48, 0x68, 0x24, 0x48, 0xad, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0x8d, 0x44, 0x00, 0x00, 0x68
-, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xa9, 0xa9, 0x89, 0x89, 0x89, 0x89, 0x89, 0x24, 0x00
-, 0x64, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x69, 0x48, 0x6d, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x48
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x4c, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x28, 0x44, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xd1, 0xad
-, 0xad, 0x44, 0x00, 0x20, 0x69, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0x8d, 0xb2, 0xb2, 0x8d, 0x8d
-, 0x6d, 0x44, 0x00, 0x64, 0xb1, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x48, 0x48, 0x6c, 0x48, 0x6d
-, 0x6d, 0x68, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4c, 0x4c, 0x48
-, 0x48, 0x4c, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x6c, 0x48, 0x68, 0x48, 0x24, 0x44, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0xd1, 0xb1, 0xb1, 0xb1, 0x44, 0x00, 0x20, 0x44, 0x45, 0x69, 0x69, 0xb2, 0x91, 0x8d
-, 0xb2, 0x8d, 0x69, 0x69, 0x44, 0x00, 0x64, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x6d, 0x48
-, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x68, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x4c, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x68, 0x48, 0x48, 0x68, 0x6d
-, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x4c, 0x4c, 0x4c, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x44, 0x00, 0x00
-, 0x44, 0x89, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0x64, 0x44, 0x69, 0x89, 0x89
-, 0x89, 0x89, 0x65, 0x69, 0x89, 0x8d, 0x8d, 0x8d, 0x69, 0x84, 0xcd, 0xb1, 0xb1, 0xad, 0xad, 0xad
-, 0xad, 0x8d, 0x68, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x4c, 0x6c, 0x6d, 0x6d, 0x6c, 0x6c, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x4c, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x68
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4d, 0x4c, 0x48, 0x4d, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x4d, 0x48
-, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x69, 0x8d, 0xad, 0xad, 0xad, 0xd1, 0xb1, 0xb1, 0xb1, 0xad
-, 0x89, 0x89, 0x8d, 0x8d, 0xae, 0xae, 0x89, 0x89, 0x8d, 0x8e, 0x8d, 0x8d, 0x89, 0xad, 0xb1, 0xb1
-, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x48, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x4d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4d, 0x4c, 0x48, 0x6d, 0x4c, 0x4c, 0x6c
-, 0x6d, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x89, 0x68, 0x89, 0xad, 0xad, 0x8d, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xad, 0x89, 0x89, 0xad, 0x8d, 0x8e, 0xae, 0x89, 0x89, 0x8e, 0xae, 0xae, 0x89
-, 0x89, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x48, 0x48, 0x48, 0x68, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6c, 0x4d, 0x48, 0x68, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4d, 0x4c, 0x48
-, 0x6c, 0x4c, 0x6d, 0x6d, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x8d, 0x68, 0x69
-, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x89, 0xad, 0x8d, 0x89, 0x8e, 0x89, 0x89
-, 0x8d, 0x8d, 0xae, 0x89, 0x8d, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x69, 0x48, 0x48, 0x48
-, 0x48, 0x68, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x68, 0x4d, 0x48, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x68, 0x68, 0x6d, 0x48, 0x24, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x68, 0x8d, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0x89, 0x89, 0x8d
-, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad, 0xad, 0x89, 0xad, 0xb1, 0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x89
-, 0x24, 0x24, 0x48, 0x68, 0x48, 0x68, 0x48, 0x6d, 0x4d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x48, 0x68, 0x48
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x68, 0xad, 0x89, 0x68, 0x64, 0x68, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xad
-, 0xad, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad, 0x89, 0x89, 0xb1, 0xb1, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x89, 0x44, 0x00, 0x00, 0x00, 0x48, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x48, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x68, 0xad, 0x89, 0x89, 0x68, 0x64, 0x68, 0x8d
-, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0xad, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad
-, 0xd1, 0xb1, 0x8d, 0x8d, 0x8d, 0x89, 0x68, 0x20, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x6d, 0x6d, 0x6c, 0x4c, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x68, 0xad, 0x8d, 0x89
-, 0x69, 0x44, 0x64, 0x68, 0x89, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0xad, 0x65, 0x85, 0x89, 0x89, 0x89
-, 0x85, 0x65, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x48, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d
-, 0x4c, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x48, 0x48, 0x68, 0x6d
-, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00
-, 0x44, 0xad, 0x8d, 0x8d, 0x8d, 0x68, 0x44, 0x44, 0x68, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89
-, 0x44, 0x44, 0x40, 0x40, 0x44, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x69, 0x44, 0x68, 0x68, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x48
-, 0x48, 0x48, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x68, 0x6d, 0x4c, 0x48, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x89, 0xad, 0x8d, 0x8d, 0x89, 0x68, 0x44, 0x44, 0x68, 0x69, 0x69
-, 0x69, 0x69, 0x69, 0x69, 0x68, 0x44, 0x44, 0x44, 0x68, 0x89, 0x89, 0x69, 0x69, 0x68, 0x68, 0x44
-, 0x68, 0x89, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x48, 0x6d, 0x6d
-, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x6d, 0x4c
-, 0x48, 0x68, 0x68, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x48
-, 0x6d, 0x4d, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x44, 0xad, 0xad, 0x8d, 0x89, 0x88, 0x68
-, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x44, 0x64, 0x68, 0x68, 0x44, 0x44
-, 0x44, 0x44, 0x44, 0x68, 0x68, 0x89, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x6d
-, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x68, 0xad
-, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x68, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x68, 0x68, 0x89, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d
-, 0x6c, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x48, 0x6d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x8d, 0xad, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x64, 0x44, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x68, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x48, 0x48
-, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x68, 0x89, 0x89, 0x68, 0x68, 0x68, 0x44
-, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x68, 0x69, 0x89
-, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x6d, 0x48
-, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48
-, 0x68, 0x68, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x24, 0x44
-, 0x68, 0x68, 0x68, 0x68, 0x64, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x44, 0x68
-, 0x68, 0x68, 0x89, 0x89, 0x8d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x4c, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x6d, 0x48
-, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x20, 0x24, 0x64, 0x68, 0x68, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-, 0x44, 0x48, 0x68, 0x69, 0x89, 0x89, 0x69, 0x89, 0x8d, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x68, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6c, 0x6d, 0x6d, 0x4c, 0x48
-, 0x6d, 0x6d, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6c, 0x68, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x68, 0x68, 0x68
-, 0x68, 0x68, 0x64, 0x68, 0x68, 0x69, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x00, 0x00, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6c, 0x6d
-, 0x6d, 0x6d, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x48
-, 0x68, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x24, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x68, 0x89, 0x69, 0x68, 0x68, 0x68, 0x89, 0x89, 0x69, 0x89, 0x89, 0x89, 0x8d, 0xad
-, 0x48, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d, 0x6c, 0x48, 0x6d, 0x6d, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x6c
-, 0x48, 0x48, 0x68, 0x68, 0x6c, 0x6c, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c
-, 0x48, 0x48, 0x4c, 0x6d, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89
-, 0x89, 0x8d, 0x8d, 0x8d, 0x24, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-, 0x48, 0x48, 0x48, 0x6d, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x6d, 0x48
-, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x48, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x8d, 0x8d
-, 0x8d, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0xad, 0x89, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x48, 0x48, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d
-, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x20, 0x00, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x68, 0x89, 0x88, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x68, 0x00, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x48
-, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x68, 0x48, 0x68, 0x68, 0x68, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x88, 0x89, 0x8d, 0x8d, 0x8d, 0x69, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x24, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x4d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x68
-, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0x89
-, 0x8d, 0x89, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x24
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x4c, 0x48, 0x48, 0x48
-, 0x6d, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x44, 0x89, 0x89, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x6d
-, 0x48, 0x48, 0x48, 0x6d, 0x6c, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x6c, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4c, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x68, 0x44, 0x20, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x6d, 0x6d, 0x4c
-, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x4d, 0x24, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x00, 0x24, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x68, 0x68, 0x68, 0x68
-, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d
-, 0x6d, 0x24, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x24, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6c, 0x48
-, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x6d
-, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x20, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24
-, 0x48, 0x6d, 0x48, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x68, 0x48
-, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x24, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x48, 0x68, 0x68, 0x68, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x6d, 0x6c, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x48, 0x6c, 0x6d, 0x48, 0x20, 0x24, 0x20, 0x20, 0x20
-, 0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x68, 0x68, 0x68, 0x68, 0x68, 0x48
-, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x6c, 0x48, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x68
-, 0x68, 0x68, 0x68, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x68, 0x6d
-, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20
-, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24
-, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x44, 0x68, 0x68, 0x68, 0x68, 0x6d, 0x6d, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48
-, 0x48, 0x68, 0x68, 0x6d, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20
-, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x6c, 0x68, 0x68, 0x6d, 0x6d, 0x48, 0x48
-, 0x48, 0x48, 0x48, 0x48, 0x6c, 0x68, 0x6d, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x44, 0x68, 0x6d
-, 0x6d, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6c, 0x6d, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x68, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x44, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x20, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x44, 0x48, 0x48, 0x48, 0x48, 0x4c, 0x6d, 0x6d
-, 0x6d, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x48, 0x48
-, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x00, 0x24, 0x48, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20
-, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x48, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x48, 0x6d, 0x68, 0x6c, 0x6d
-, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x44
-, 0x6d, 0x48, 0x6d, 0x6d, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x48, 0x6c, 0x6d, 0x6d, 0x48, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20
-, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x48, 0x6d, 0x6d, 0x68
-, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24
-, 0x00, 0x48, 0x68, 0x68, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24
-, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x00, 0x24, 0x92, 0x24, 0x00, 0x48, 0x68, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x44, 0x92, 0x92, 0x92, 0x44, 0x20, 0x68, 0x68, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x49, 0x92, 0x49, 0x00, 0x00, 0x48
-, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x49
-, 0x00, 0x00, 0x00, 0x24, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00
-, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x48, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00
-, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x48, 0x00, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20
-, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20
-, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20
-, 0x24
+const uint8_t bitmap_arrow_N[128] = {
+	0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+	0x00, 0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00,
+	0x01, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xf0,
+	0x1f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+	0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+	0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+	0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+	0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00
 };
 
-const char tom_bitmap[10002] = {
-0x64, 0x64, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb7, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xdb, 0xb6, 0x49, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x00, 0x24, 0x24, 0x24, 0x6d, 0xb7, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x72, 0x92, 0xb6, 0xdb, 0xb7
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xdb, 0xdb, 0x92, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6d, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96
-, 0x72, 0xb6, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0xdb
-, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x72
-, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xb7, 0x96, 0x72, 0xb6, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0x96, 0xbb, 0xdb
-, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x25, 0x24, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-, 0x00, 0x24, 0x04, 0x49, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0x96, 0xb7, 0xb7, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xdb
-, 0xbb, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x6d, 0x24
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x24, 0x00, 0x20, 0x24, 0x24, 0x6d, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96, 0x72, 0x6e, 0x6e, 0x92, 0xb6
-, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb
-, 0xdb, 0xb6, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x49, 0xb7, 0xdb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x72, 0x4d
-, 0x72, 0x4d, 0x49, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x96, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x49, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0x96, 0x92, 0x92, 0x92, 0x92, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x25, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xb6, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x72, 0x6e, 0x72, 0x72, 0x6e, 0x92, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x92, 0x45, 0x24
-, 0x24, 0x44, 0x44, 0x44, 0x49, 0x69, 0x48, 0x44, 0x44, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb6, 0xdb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x92, 0x4d, 0x92, 0x92, 0x92, 0xb7
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0x49, 0x49, 0x8d, 0xad, 0xad, 0xb1, 0xb2, 0xb1, 0xad, 0xad, 0x8d, 0x69, 0x69, 0x44
-, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x24, 0xb7, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x6e
-, 0x72, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0x6d, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1
-, 0xb1, 0xad, 0x8d, 0x8d, 0x89, 0x69, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xb7, 0x72, 0x72, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0x92, 0xb2, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xd2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xdb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x6e, 0x92, 0x92, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xb6, 0x8d, 0xb2, 0xb2
-, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x49
-, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e
-, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x72, 0x92, 0x72, 0x96, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb
-, 0xb6, 0xb2, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xad, 0x8d, 0x48, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x4d, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x72
-, 0x92, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xb2, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xb2, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0x8d, 0x69, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0x96, 0x6e, 0x92, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xd2, 0xd2, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0x8d, 0x69, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb7, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x72, 0x72, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xb2, 0xd2, 0xd2, 0xb2
-, 0xd2, 0xb1, 0xb2, 0xd2, 0xd2, 0xd2, 0xb2, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x68, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96, 0x72, 0x72, 0x72, 0x92, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x6d
-, 0x49, 0x69, 0x8d, 0xad, 0xb1, 0x8d, 0x8d, 0x8d, 0x69, 0x69, 0x69, 0x8d, 0x8d, 0xb1, 0xad, 0xad
-, 0xad, 0x8d, 0x8d, 0x44, 0x20, 0x24, 0x24, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x04, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x92, 0x6e
-, 0x72, 0x6e, 0x6e, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xdb, 0x6e, 0x20, 0x24, 0x20, 0x44, 0x89, 0xad, 0x69, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44
-, 0x44, 0x69, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x89, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb7, 0xb7, 0x72, 0x72, 0x72, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x6d, 0x69, 0x8d, 0x68, 0x44, 0x69, 0xad, 0x69, 0x44, 0x44
-, 0x44, 0x48, 0x69, 0x69, 0x44, 0x44, 0x64, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x24, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96, 0x6e, 0x92, 0x72, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xb2, 0x69, 0x44, 0x44, 0x40, 0x89
-, 0xb1, 0x69, 0x44, 0x44, 0x44, 0x44, 0x68, 0x69, 0x69, 0x69, 0x64, 0x68, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x92, 0x6e, 0x92, 0x72, 0x96, 0xb7
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0x44
-, 0x44, 0x44, 0x64, 0xb2, 0xad, 0x89, 0x64, 0x44, 0x44, 0x44, 0x44, 0x20, 0x44, 0x68, 0x69, 0x89
-, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0x69, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x25, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96, 0x6e
-, 0x72, 0x72, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xb6, 0x69, 0x64, 0x64, 0xb1, 0xd2, 0xad, 0x89, 0x89, 0x64, 0x64, 0x68, 0x69, 0x64
-, 0x44, 0x64, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xad, 0xad, 0x69, 0x24, 0x00, 0x00, 0x00, 0x20, 0x20
-, 0x20, 0x44, 0x49, 0x20, 0x00, 0x00, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb7, 0xb7, 0x6e, 0x72, 0x72, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb2, 0xad, 0x89, 0xad, 0xd2, 0xad, 0xad, 0xad, 0x89, 0x8d
-, 0x89, 0x68, 0x64, 0x64, 0x68, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0x8d, 0x69, 0x24, 0x20
-, 0x00, 0x20, 0x44, 0x68, 0x89, 0x8d, 0x89, 0x69, 0x20, 0x49, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xd6, 0xd2, 0xd2, 0xd2, 0xd2, 0xad
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d
-, 0x8d, 0x68, 0x20, 0x20, 0x44, 0x69, 0x89, 0x89, 0x64, 0x88, 0x84, 0x64, 0x49, 0xb6, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x92, 0xb7
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb2, 0xad
-, 0xb1, 0xd2, 0xd2, 0xad, 0xad, 0xad, 0x89, 0x89, 0xad, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xb1, 0xad
-, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x48, 0x24, 0x24, 0x69, 0x89, 0x68, 0x68, 0x89, 0xad, 0x89, 0x69
-, 0xb2, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0xb7, 0x72
-, 0x92, 0x6e, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb6, 0x8d, 0x89, 0xd1, 0xd1, 0xd2, 0xb1, 0xad, 0xd1, 0xad, 0x68, 0x68, 0xad, 0xb1, 0xd2
-, 0xd2, 0xd2, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x44, 0x44, 0x44, 0x8d, 0xad, 0x68, 0x40
-, 0x88, 0xad, 0x89, 0x8d, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x92, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb2, 0x68, 0x68, 0xad, 0xad, 0x89, 0x89, 0x8d, 0x89, 0x89, 0x89
-, 0x69, 0x64, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x89, 0x8d, 0x69, 0x44, 0x44, 0x69
-, 0x8d, 0x89, 0x64, 0x68, 0x88, 0xad, 0x8d, 0xb2, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb6, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x92, 0x44, 0x44, 0x44, 0x64, 0x44, 0x40
-, 0x40, 0x44, 0x44, 0x89, 0x8d, 0x69, 0x64, 0x69, 0x89, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x89, 0x89
-, 0x68, 0x44, 0x44, 0x69, 0x89, 0x68, 0x8d, 0x8d, 0x8d, 0x89, 0x8d, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0x96, 0x6e, 0x72, 0x72, 0x96, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x92, 0x44, 0x20
-, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x89, 0x8d, 0x8d
-, 0x8d, 0x89, 0x68, 0x68, 0x44, 0x44, 0x24, 0x68, 0x89, 0xad, 0xd1, 0xad, 0x8d, 0x69, 0xb6, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0xb7, 0x6e
-, 0x72, 0x72, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x92, 0x24, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20
-, 0x44, 0x69, 0x69, 0x68, 0x69, 0x68, 0x44, 0x44, 0x44, 0x24, 0x24, 0x68, 0xad, 0xb1, 0xad, 0xb1
-, 0x69, 0x8e, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0xb7, 0x72, 0x92, 0x72, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x20, 0x00, 0x00, 0x49, 0x69, 0x44, 0x44, 0x24, 0x44, 0x24
-, 0x20, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x44
-, 0x8d, 0xad, 0x8d, 0x44, 0x44, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0x72, 0x92, 0x6e, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x24, 0x00, 0x20, 0x91, 0xb6, 0xb6
-, 0xb2, 0x8d, 0x8d, 0x8d, 0x69, 0x24, 0x20, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x20, 0x24, 0x44, 0x44, 0x44, 0x24, 0x00, 0x92, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0x72, 0x92, 0x72, 0x96, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x49, 0x00
-, 0x69, 0x69, 0x69, 0x69, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x69, 0x44, 0x00, 0x24, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x20, 0x24, 0x44, 0x68, 0x69, 0x8d, 0x69, 0x44, 0x6d, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x96, 0x72
-, 0x96, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xdb, 0x6d, 0x24, 0x8d, 0x8d, 0x8d, 0x89, 0x69, 0x69, 0x69, 0x69, 0x69, 0x89, 0x89, 0x68
-, 0x24, 0x20, 0x00, 0x00, 0x00, 0x20, 0x44, 0x69, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x6d
-, 0x91, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0x96, 0x96, 0x72, 0x92, 0x72, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xdb, 0xb6, 0x6d, 0x24, 0x20, 0x69, 0xb1, 0x8d, 0xad, 0xad, 0xad, 0x8d, 0x8d
-, 0x8d, 0x89, 0x69, 0x69, 0x24, 0x20, 0x20, 0x24, 0x48, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x6d, 0x69, 0x69, 0x6d, 0x91, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0x96, 0x72, 0x72, 0x72, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xb7, 0xb7, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x24, 0x00, 0x20, 0x24, 0x48, 0x69, 0x69, 0x69
-, 0x69, 0x69, 0x69, 0x89, 0x89, 0x89, 0x69, 0x44, 0x24, 0x44, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0xb6, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0x72, 0x92, 0x72, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x96, 0xb7, 0xdb, 0xbb, 0xbb, 0x92, 0x49, 0x24, 0x20, 0x20, 0x24
-, 0x69, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x69, 0x89, 0x89, 0x69, 0x44, 0x44, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d
-, 0x91, 0xb6, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xb7, 0x72
-, 0x96, 0x72, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xb7, 0xb6, 0x92, 0x6d, 0x49, 0x24
-, 0x24, 0x20, 0x00, 0x44, 0x91, 0x69, 0x44, 0x44, 0x44, 0x64, 0x69, 0x8d, 0x8d, 0x8d, 0x64, 0x69
-, 0x91, 0xb1, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x91, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x92, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xb7, 0x92, 0x92, 0x72, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xb6, 0x6d, 0x6d
-, 0x49, 0x49, 0x49, 0x24, 0x24, 0x20, 0x20, 0x44, 0x6d, 0x69, 0x44, 0x44, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x89, 0x68, 0x6d, 0xb1, 0xb1, 0x91, 0xb1, 0xb1, 0xb1, 0xb1, 0x91, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d
-, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0x69, 0x68, 0x68, 0x69, 0x8d, 0x8d, 0x8d, 0xb6, 0xb6, 0xbb, 0xdb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x72, 0x92, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb
-, 0xb7, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x44, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x48, 0x69, 0x69, 0x44, 0x44, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1
-, 0xb1, 0x91, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x68, 0x68, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0x6d
-, 0x6d, 0x6d, 0x72, 0x96, 0xbb, 0xdb, 0xdb, 0xdb, 0xb7, 0xb7, 0x96, 0x72, 0x96, 0x92, 0xb7, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xdb, 0xdb, 0xdb, 0xb7, 0x72, 0x49, 0x48, 0x24, 0x24, 0x49, 0x49, 0x48, 0x24, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x69, 0xb2, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x68, 0x68, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0xb1, 0x91, 0x6d, 0x6d, 0x69, 0x24, 0x24, 0x49, 0x72, 0xbb, 0xbb, 0xb7, 0x96, 0x72
-, 0x92, 0x92, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xdb, 0xbb, 0xb6, 0x92, 0x72, 0x6d, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xb2, 0xb1, 0xb1, 0xb1
-, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0x91, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x68, 0x68
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x69, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x24
-, 0x6d, 0xbb, 0xb6, 0x92, 0x92, 0x96, 0xb7, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8d
-, 0xb1, 0xb1, 0x91, 0x8d, 0xb1, 0xb1, 0x8d, 0xb1, 0xb1, 0x91, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xd6, 0x8d, 0x68, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x69, 0x6d
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x49, 0x72, 0x92, 0x92, 0x92, 0x96, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xb6, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x6d, 0xb1, 0xb1, 0x91, 0x8d, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0x8d, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x89, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0xb1, 0xb1, 0x6d, 0x6d, 0x48, 0x24, 0x00, 0x24, 0x24, 0x00, 0x24, 0x6d, 0x92, 0x72, 0x92, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb
-, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x6d, 0x24, 0x24
-, 0x24, 0x24, 0x20, 0x00, 0x00, 0x20, 0x24, 0x20, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0xb1, 0x8d, 0xb1, 0x8d
-, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0xad, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0x6d, 0x69, 0x49, 0x24, 0x00, 0x20, 0x20, 0x24, 0x24, 0x24
-, 0x6d, 0x96, 0x96, 0xbb, 0xbb, 0xb7, 0xbb, 0xbb, 0xbb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6
-, 0xb6, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0xbb, 0xbb, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb
-, 0xb6, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0xb1
-, 0x91, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0xb1, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0xb1
-, 0xad, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0x8d, 0x68, 0x49, 0x24, 0x00, 0x00
-, 0x00, 0x20, 0x24, 0x24, 0x28, 0x92, 0x96, 0xbb, 0xba, 0xb6, 0xb6, 0xba, 0xb6, 0xb6, 0x96, 0xb6
-, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0xb6, 0x96, 0xb6, 0x91, 0xb6, 0xba, 0xb6, 0xb6, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xbb, 0xdb, 0x92, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x91, 0xb1, 0x8d
-, 0x8d, 0x8d, 0xad, 0xb1, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0x8d, 0xad, 0xb1, 0xb1, 0xb1
-, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0x8d, 0x68
-, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x49, 0x96, 0xba, 0xb6, 0xb6, 0xb6, 0xb6
-, 0xb6, 0xb6, 0x96, 0x96, 0xb6, 0xb6, 0xb6, 0x96, 0xb6, 0x96, 0x95, 0x95, 0x91, 0xb6, 0xb6, 0xb6
-, 0xb6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0x6d, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x8d, 0xb1, 0x91, 0x8d, 0x8d, 0x8d, 0xb1, 0x91, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0x8d, 0x68, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x6d, 0xb6
-, 0xb6, 0xb6, 0x92, 0xb6, 0xb6, 0xb6, 0x96, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0xb5, 0xb5, 0x95, 0x91, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x96, 0x49, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x00, 0x00, 0x00, 0x69, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d
-, 0xad, 0xb1, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1
-, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0x8d, 0x68, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24
-, 0x24, 0x24, 0x48, 0x91, 0xb6, 0x91, 0x91, 0xb5, 0x91, 0xb5, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x96
-, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x8d, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1
-, 0xb1, 0x8d, 0x8d, 0x8d, 0xb1, 0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xad, 0x8d, 0x48, 0x69, 0x24, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xbb, 0xbb, 0xbb
-, 0xbb, 0xbb, 0xdb, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x69, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0xb1, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x8d
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0x89, 0x44
-, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x48, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x72, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x8d, 0x91
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x8d, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x89, 0x89, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xad, 0x69, 0x44, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24
-, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x90, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdb, 0x6e, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24
-, 0x24, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x6d, 0x68, 0x8d, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xad, 0x68, 0x44, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x24, 0x48, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x92
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x24, 0x24, 0x24, 0x48, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x91, 0xb1, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0x48, 0x24, 0x69, 0x24, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x44, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xbb, 0xbb, 0xbb
-, 0xb7, 0xbb, 0xbb, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x44
-, 0x68, 0xb1, 0xb1, 0x8d, 0x8d, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0xad, 0xb1
-, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xad, 0xad, 0x44, 0x20
-, 0x69, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x6d, 0x91, 0x91
-, 0x91, 0x91, 0xb1, 0xb5, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90
-, 0x90, 0xb7, 0xb7, 0xb7, 0xb6, 0xb7, 0xbb, 0x92, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x20, 0x24, 0x20, 0x48, 0x91, 0x8d, 0x68
-, 0x8d, 0x8d, 0x69, 0x44, 0x68, 0xb1, 0x8d, 0x69, 0x8d, 0x68, 0x8d, 0x8d, 0x8d, 0x89, 0x8d, 0x8d
-, 0x8d, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2
-, 0xb2, 0x8d, 0x24, 0x44, 0x69, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-, 0x24, 0x68, 0xb5, 0x91, 0x91, 0xb1, 0xb5, 0xb5, 0x91, 0xb1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0x6d, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x24, 0x20, 0x24, 0x24, 0x20
-, 0x6d, 0x8d, 0x69, 0x8d, 0x8d, 0x8d, 0x68, 0x44, 0x6d, 0x8d, 0x68, 0x68, 0x68, 0x44, 0x44, 0x68
-, 0x69, 0x88, 0x8d, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x24, 0x48, 0x69, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x48, 0x91, 0x91, 0x91, 0xb5, 0xb5, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x96, 0x96, 0x96, 0x96, 0xb6, 0x96, 0x6d
-, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x24
-, 0x24, 0x24, 0x00, 0x44, 0x8d, 0x8d, 0x68, 0x8d, 0x8d, 0x8d, 0x44, 0x44, 0x8d, 0x6d, 0x68, 0x68
-, 0x48, 0x20, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x8d, 0x69, 0x24, 0x24, 0x44, 0x69, 0x8d, 0x8d, 0x89
-, 0x69, 0x68, 0x44, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x44, 0x69, 0x44, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20, 0x24, 0x6d, 0x91, 0x91, 0x91, 0xb1
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x69, 0x48, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x00, 0x00, 0x20
-, 0x00, 0x20, 0x24, 0x24, 0x24, 0x00, 0x24, 0x6d, 0x8d, 0x68, 0x69, 0x8d, 0x8d, 0x69, 0x44, 0x68
-, 0x8d, 0x68, 0x68, 0x48, 0x44, 0x20, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x8d, 0x68, 0x00, 0x00, 0x00
-, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44
-, 0x6d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48
-, 0x91, 0x91, 0x91, 0xb1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x49, 0x49, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x24, 0x44, 0x24, 0x24, 0x20, 0x44, 0x8d, 0x6d, 0x68, 0x89, 0x8d
-, 0x8d, 0x68, 0x68, 0x68, 0x69, 0x68, 0x44, 0x44, 0x24, 0x20, 0x24, 0x44, 0x68, 0x8d, 0x8d, 0x8d
-, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x00, 0x20, 0x48, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x24, 0x91, 0x91, 0xb5, 0xb5, 0xb1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x48, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x68, 0x8d
-, 0x69, 0x8d, 0x89, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44
-, 0x68, 0x8d, 0x8d, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x6d, 0xb5, 0xb1, 0xb1, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91, 0xb5, 0x91, 0x49, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x00
-, 0x00, 0x24, 0x6d, 0x8d, 0x6d, 0x8d, 0x8d, 0xad, 0x8d, 0x44, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44
-, 0x44, 0x20, 0x20, 0x48, 0x8d, 0x8d, 0x8d, 0x8d, 0x24, 0x00, 0x00, 0x00, 0x44, 0xb1, 0xad, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x24, 0x48, 0x69, 0x48, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0xb5, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6c, 0x91, 0x91, 0x91, 0x91
-, 0xb5, 0x6d, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00
-, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x8d, 0x69, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x68
-, 0x68, 0x44, 0x44, 0x64, 0x68, 0x44, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x68, 0x20, 0x00, 0x00, 0x20
-, 0x8d, 0xb2, 0xd2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8d, 0x44, 0x44, 0x68
-, 0x69, 0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20, 0x24
-, 0x24, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x8c, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6c
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x68, 0x8d, 0x69, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x68, 0x68, 0x44, 0x64, 0x68, 0x68, 0x64, 0x64, 0x68, 0x8d, 0x89, 0x88, 0x8d, 0x8d, 0x8d, 0x68
-, 0x44, 0x24, 0x44, 0x89, 0xad, 0xd2, 0xd2, 0x8d, 0x44, 0x20, 0x20, 0x20, 0x44, 0x68, 0x8d, 0xb1
-, 0x8d, 0x20, 0x44, 0x68, 0x69, 0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x91, 0x91, 0x6c, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x91, 0x91, 0x91, 0x91, 0x91, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x69, 0x68, 0x69
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x69, 0x68, 0x44, 0x68, 0x68, 0x68, 0x68, 0x68, 0x88, 0x8d, 0x68, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0xad, 0xad, 0xd2, 0xd2, 0xd1, 0xad, 0x8d, 0xad, 0xad
-, 0xad, 0xb1, 0xb1, 0xb1, 0x68, 0x20, 0x44, 0x68, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x8d, 0x8c, 0x6c, 0x6c, 0x8d, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x48, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24
-, 0x44, 0x6d, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x44, 0x44, 0x68, 0x8d, 0x68, 0x68, 0x88
-, 0x88, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x89, 0xad, 0xd1, 0xd2, 0xd2, 0xd1
-, 0xad, 0x89, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x44, 0x20, 0x48, 0x68, 0x6d, 0x48, 0x20, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6c, 0x6c, 0x6c, 0x8d, 0x91, 0x91, 0x91
-, 0x6d, 0x49, 0x48, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x20, 0x20, 0x24, 0x68, 0x6d, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x24, 0x44, 0x8d
-, 0x8d, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x88, 0x88, 0x89, 0xad
-, 0xd1, 0xd2, 0xd2, 0xd2, 0xad, 0x89, 0x89, 0x8d, 0xad, 0xad, 0xad, 0x8d, 0x24, 0x44, 0x68, 0x68
-, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x24
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xb5, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8d, 0x91, 0x6c, 0x6c
-, 0x6c, 0x91, 0x91, 0x6d, 0x49, 0x49, 0x48, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x69, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0x69
-, 0x44, 0x20, 0x44, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x89, 0x8d, 0x8d, 0x88, 0x89, 0x89
-, 0x88, 0x64, 0x64, 0x68, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x88, 0x89, 0x8d, 0x8d, 0x69
-, 0x20, 0x44, 0x68, 0x68, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x24, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x6c, 0x91, 0x6c, 0x6c, 0x6c, 0x91, 0x71, 0x71, 0x6d, 0x24, 0x24, 0x24, 0x20, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x6d, 0x68, 0x8d, 0x91
-, 0x68, 0x8d, 0x8d, 0x68, 0x24, 0x20, 0x68, 0xb1, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x88, 0x8d, 0x8d
-, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x68, 0x89, 0x8d, 0x89, 0x89, 0x89
-, 0x8d, 0x8d, 0x8d, 0x44, 0x20, 0x44, 0x68, 0x68, 0x6d, 0x49, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x6d, 0x91
-, 0x91, 0x91, 0x91, 0x6c, 0x91, 0x91, 0x91, 0x6c, 0x91, 0x91, 0x6d, 0x6d, 0x6d, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x69
-, 0x6d, 0x68, 0x8d, 0x8d, 0x68, 0x8d, 0x8d, 0x48, 0x20, 0x24, 0x8d, 0xb1, 0x8d, 0x64, 0x44, 0x68
-, 0x68, 0x8d, 0x8d, 0x8d, 0x88, 0x68, 0x64, 0x44, 0x68, 0x64, 0x64, 0x68, 0x68, 0x64, 0x68, 0x89
-, 0x68, 0x64, 0x68, 0x8d, 0x8d, 0x8d, 0x44, 0x20, 0x44, 0x44, 0x69, 0x68, 0x6d, 0x49, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24
-, 0x24, 0x00, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x8d, 0x91, 0x91, 0x8d, 0x91, 0x91, 0x91, 0x71, 0x6d
-, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x44, 0x6d, 0x6d, 0x68, 0x8d, 0x68, 0x68, 0x8d, 0x68, 0x44, 0x20, 0x44, 0xb1, 0x8d
-, 0x68, 0x44, 0x44, 0x64, 0x88, 0x8d, 0x8d, 0x8d, 0x88, 0x88, 0x68, 0x64, 0x44, 0x44, 0x44, 0x64
-, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88, 0x89, 0x8d, 0x8d, 0x68, 0x20, 0x20, 0x44, 0x68, 0x89, 0x68
-, 0x6d, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x48, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6c, 0x6c
-, 0x91, 0x6d, 0x48, 0x49, 0x48, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x69, 0x8d, 0x68, 0x8d, 0x8d, 0x44, 0x69, 0x8d, 0x48, 0x24
-, 0x20, 0x68, 0xb1, 0x8d, 0x44, 0x20, 0x44, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x88, 0x8d, 0x8d, 0x89
-, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x88, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0x68, 0x20, 0x20, 0x24
-, 0x44, 0x68, 0x8d, 0x69, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24
-, 0x48, 0x49, 0x49, 0x49, 0x48, 0x48, 0x49, 0x24, 0x24, 0x24, 0x24, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x6c, 0x24, 0x24, 0x24, 0x49, 0x92, 0x49, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x8d, 0x8d, 0x68, 0x8d, 0x69, 0x44
-, 0x8d, 0x69, 0x44, 0x24, 0x20, 0x8d, 0x8d, 0x68, 0x20, 0x00, 0x24, 0x48, 0x8d, 0x89, 0x8d, 0x8d
-, 0x88, 0x8d, 0x8d, 0x8d, 0x89, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0xad, 0xad, 0xad, 0x8d, 0x68
-, 0x00, 0x00, 0x20, 0x24, 0x44, 0x68, 0x8d, 0x8d, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x91, 0x91, 0x91, 0x24, 0x24, 0x24, 0x92, 0xb6, 0x49, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x69, 0x8d, 0x68
-, 0x68, 0x8d, 0x68, 0x44, 0x8d, 0x68, 0x44, 0x20, 0x44, 0x8d, 0x8d, 0x44, 0x20, 0x20, 0x20, 0x48
-, 0x8d, 0x68, 0x8d, 0x88, 0x88, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x8d, 0xad
-, 0xad, 0xad, 0x44, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x6d, 0x6d, 0x44, 0x00
-, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49
-, 0x48, 0x24, 0x48, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6c, 0x24, 0x49, 0x92
-, 0xb6, 0xb6, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x24, 0x48, 0x44
-, 0x48, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0x44, 0x44, 0x8d, 0x48, 0x24, 0x20, 0x48, 0x8d, 0x68, 0x20
-, 0x20, 0x20, 0x44, 0x68, 0x68, 0x8c, 0x8c, 0x68, 0x88, 0x8d, 0x89, 0x8d, 0xad, 0xad, 0xad, 0xad
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0x44, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x68, 0x8d, 0x8d, 0x8d
-, 0x6d, 0x69, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00
-, 0x00, 0x00, 0x24, 0x24, 0x49, 0x49, 0x48, 0x6d, 0x91, 0x91, 0x91, 0xb5, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x4d, 0xb6, 0xb7, 0x96, 0x92, 0x6d, 0x20, 0x24, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x48, 0x24, 0x24, 0x6d, 0x8d, 0x8d, 0x68, 0x8d, 0x8d, 0x44, 0x68, 0x8d, 0x44, 0x44, 0x24
-, 0x68, 0x8d, 0x44, 0x20, 0x24, 0x24, 0x24, 0x44, 0x68, 0x8d, 0x88, 0x68, 0x88, 0x89, 0x89, 0x8d
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x44
-, 0x68, 0x8d, 0x8d, 0x8d, 0x6d, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x49, 0x6c, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0xb7, 0xb6, 0x92, 0x92, 0x92, 0x6e, 0x24, 0x20, 0x24, 0x00, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0xb1, 0x8d, 0x89, 0x68, 0x8d, 0x8d, 0x44, 0x69
-, 0x8d, 0x68, 0x44, 0x44, 0x8d, 0x69, 0x24, 0x24, 0x24, 0x20, 0x24, 0x44, 0x44, 0x8d, 0x68, 0x68
-, 0x68, 0x68, 0x64, 0x68, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x24, 0x44, 0x44, 0x69, 0x8d, 0x8d, 0x69, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x24, 0x24, 0x48, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x48
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x96, 0x92, 0x92, 0x92, 0x6e, 0x6e, 0x49
-, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x48, 0x8d, 0x91, 0x8d, 0x88, 0x8d
-, 0x8d, 0x69, 0x20, 0x6d, 0x69, 0x68, 0x44, 0x44, 0x8d, 0x68, 0x24, 0x20, 0x20, 0x20, 0x44, 0x44
-, 0x68, 0x8d, 0x68, 0x68, 0x68, 0x44, 0x20, 0x24, 0x44, 0x69, 0x89, 0x8d, 0x89, 0x44, 0x20, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x8d, 0x8d, 0x8d, 0x48, 0x24, 0x24, 0x24, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x48, 0x49, 0x49, 0x49, 0x48, 0x48, 0x49, 0x49
-, 0x49, 0x49, 0x49, 0x49, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92
-, 0x6e, 0x6e, 0x6d, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x44, 0x48, 0x6d, 0xb1
-, 0x8d, 0x89, 0x8d, 0x8d, 0x8d, 0x69, 0x20, 0x8d, 0x8d, 0x68, 0x20, 0x68, 0x8d, 0x68, 0x20, 0x20
-, 0x20, 0x24, 0x44, 0x44, 0x68, 0x8d, 0x68, 0x48, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0x49
-, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x48, 0x48, 0x28, 0x24, 0x24, 0x48, 0x48, 0x48, 0x48, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x92, 0x92, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x49, 0x00, 0x00, 0x24, 0x00, 0x20, 0x24, 0x48
-, 0x48, 0x69, 0xb1, 0xb1, 0x8d, 0x8d, 0x8d, 0x68, 0xb1, 0x68, 0x44, 0x8d, 0x8d, 0x68, 0x20, 0x8d
-, 0x8d, 0x44, 0x20, 0x24, 0x20, 0x44, 0x24, 0x44, 0x68, 0x88, 0x68, 0x44, 0x44, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x44, 0x44, 0x68, 0x8d
-, 0xad, 0xb1, 0x69, 0x49, 0x49, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x69, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x69, 0x48, 0x44, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x48, 0x48, 0x49, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6e, 0x6e, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49, 0x24, 0x00, 0x00
-, 0x24, 0x24, 0x44, 0x48, 0x68, 0x8d, 0xb1, 0x8d, 0x8d, 0x8d, 0x68, 0x88, 0xb1, 0x68, 0x68, 0xb1
-, 0xb1, 0x68, 0x24, 0x91, 0x8d, 0x44, 0x20, 0x20, 0x20, 0x44, 0x24, 0x68, 0x68, 0x68, 0x68, 0x44
-, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x44
-, 0x44, 0x64, 0x68, 0x8d, 0xad, 0x8d, 0x69, 0x49, 0x49, 0x25, 0x24, 0x00, 0x00, 0x44, 0x8d, 0xb1
-, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xb1, 0x8d, 0x68, 0x24, 0x20, 0x24, 0x24, 0x24, 0x24
-, 0x44, 0x48, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6e, 0x6d, 0x6d, 0x4d, 0x49, 0x49, 0x49
-, 0x49, 0x49, 0x24, 0x20, 0x24, 0x24, 0x24, 0x48, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0x68, 0x68, 0x8d
-, 0xb1, 0x8d, 0x68, 0xad, 0xb1, 0x68, 0x68, 0xb1, 0x68, 0x24, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44
-, 0x44, 0x68, 0x48, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20
-, 0x24, 0x24, 0x44, 0x44, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x69, 0x49, 0x49, 0x25, 0x24, 0x24, 0x44
-, 0x8d, 0xb1, 0xd1, 0xd2, 0xd2, 0xd2, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd2, 0xad, 0x68
-, 0x44, 0x20, 0x20, 0x24, 0x24, 0x24, 0x48, 0x91, 0x91, 0x91, 0x91, 0xb5, 0x91, 0x6d, 0x6d, 0x6d
-, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x24, 0x24, 0x24, 0x44, 0x48, 0x69, 0x69, 0x88, 0x8d, 0x68
-, 0x68, 0x68, 0x8d, 0x68, 0x69, 0x8d, 0x68, 0x8d, 0xb1, 0x68, 0x8d, 0xb1, 0x44, 0x24, 0x20, 0x24
-, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x20, 0x24, 0x24, 0x44, 0x68, 0x68, 0x88, 0x8d, 0x8d, 0x6d, 0x49, 0x49, 0x49
-, 0x48, 0x69, 0x8d, 0xb1, 0xd2, 0xd1, 0xd1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-, 0xd2, 0xd1, 0xd1, 0xd1, 0xb1, 0x8d, 0x44, 0x20, 0x24, 0x24, 0x48, 0x91, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44
-, 0x44, 0x69, 0x68, 0x68, 0x44, 0x68, 0x68, 0x20, 0x48, 0xb1, 0x88, 0x8d, 0xb1, 0x8c, 0xb1, 0x8d
-, 0x44, 0x24, 0x24, 0x44, 0x44, 0x48, 0x20, 0x24, 0x44, 0x68, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x44, 0x44, 0x68, 0x68, 0x8c, 0x8d, 0xad, 0x6d
-, 0x44, 0x44, 0x49, 0x6d, 0x91, 0xb1, 0xd1, 0xd1, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6
-, 0xd6, 0xd6, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xb1, 0x48, 0x00, 0x24, 0x6c, 0x91
-, 0x91, 0x91, 0x91, 0xb5, 0xb5, 0x6d, 0x6d, 0x6d, 0x49, 0x49, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x20, 0x24, 0x44, 0x48, 0x68, 0x48, 0x68, 0x48, 0x24, 0x20, 0x44, 0x91, 0x8d, 0x68
-, 0x8d, 0x8d, 0xb1, 0x68, 0x44, 0x44, 0x44, 0x44, 0x68, 0x44, 0x20, 0x20, 0x44, 0x68, 0x44, 0x24
-, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x44, 0x48, 0x68, 0x68, 0x68
-, 0x8d, 0x8d, 0x69, 0x44, 0x44, 0x69, 0x91, 0xb1, 0xb1, 0xb1, 0xd1, 0xd2, 0xd6, 0xd6, 0xd6, 0xd6
-, 0xd6, 0xd6, 0xd6, 0xd1, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0x8d
-, 0x20, 0x20, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x49, 0x49, 0x49, 0x49, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x48, 0x44, 0x24, 0x24, 0x24
-, 0x44, 0x68, 0x48, 0x20, 0x68, 0xb1, 0xad, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x24
-, 0x68, 0x44, 0x44, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x44
-, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1, 0xd1, 0xd2
-, 0xd6, 0xd6, 0xd6, 0xd6, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1
-, 0xd1, 0xd1, 0xb1, 0x91, 0x6d, 0x6d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x6d, 0x6d, 0x49
-, 0x25, 0x49, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x00, 0x24, 0x24, 0x24, 0x20, 0x20
-, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x44, 0x8d, 0xb1, 0x8d, 0x64, 0x44, 0x44, 0x68, 0x68
-, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x44, 0x68, 0x68, 0x68, 0x68, 0x64, 0x88, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1
-, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x91, 0xb1, 0xb1, 0x91, 0xb1, 0xb5, 0xb1, 0x91, 0x91
-, 0x91, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x45, 0x25, 0x25, 0x24, 0x00, 0x00, 0x24
-, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x44, 0x48, 0x8d, 0x8d, 0x8d, 0x68, 0x64
-, 0x68, 0x68, 0x89, 0x88, 0x68, 0x68, 0x68, 0x64, 0x64, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x24
-, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x68, 0x8d, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xad
-, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x91, 0x91, 0x91, 0x91
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x49, 0x49, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24
-, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x68, 0x8d
-, 0x88, 0x68, 0x68, 0x68, 0x68, 0x68, 0x89, 0x88, 0x88, 0x88, 0x89, 0x68, 0x64, 0x68, 0x68, 0x44
-, 0x44, 0x68, 0x68, 0x68, 0x68, 0x69, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x68, 0x68, 0x68, 0x68
-, 0x89, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad
-, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x91, 0x91, 0x91, 0xb1, 0x91, 0x91, 0x91, 0x91, 0x91, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20
-, 0x20, 0x44, 0xb1, 0x89, 0x88, 0x68, 0x44, 0x44, 0x64, 0x88, 0x8d, 0x8d, 0x88, 0x88, 0x88, 0x88
-, 0x88, 0x8d, 0x89, 0x68, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0x44, 0x00, 0x24, 0x00, 0x24
-, 0x68, 0x69, 0x68, 0x89, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xad, 0xad
-, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x88
-, 0x88, 0x68, 0x8d, 0x91, 0xb1, 0xb1, 0x91, 0x91, 0xb5, 0xb5, 0xb1, 0x91, 0x91, 0x25, 0x25, 0x24
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00
-, 0x00, 0x20, 0x00, 0x00, 0x00, 0x69, 0xb1, 0x89, 0x68, 0x44, 0x44, 0x68, 0x8d, 0xad, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x69
-, 0x24, 0x20, 0x00, 0x00, 0x24, 0x69, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad
-, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x88, 0x88, 0x68, 0x8d, 0x8d, 0x8d, 0x8d, 0xb1, 0xb5, 0xb5, 0xb1, 0xb5, 0xb5, 0xb5, 0x91, 0x91
-, 0x91, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x24, 0x20, 0x44, 0x69, 0x69, 0x6d, 0x69, 0x8d, 0xad, 0x8d, 0x8d, 0x8d, 0xb1, 0xb1
-, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xd1
-, 0xd1, 0xb1, 0xb1, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x68, 0x8d, 0xad, 0xad, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x68, 0x68, 0x8d, 0x8d, 0x8d, 0x91, 0x8d, 0x91, 0xb1, 0xb1, 0xb1, 0xb5, 0xb1, 0x91, 0xb1
-, 0x91, 0x91, 0x91, 0x91, 0x91, 0x24, 0x24, 0x24, 0x24, 0x20, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00
-, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x69, 0xb2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1, 0xd1
-, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x8d, 0xb1, 0x91, 0x91, 0xb1, 0xb5, 0xb6, 0xd6, 0xd6, 0xb5
-, 0xb5, 0x91, 0x91, 0xb1, 0xb1, 0xb5, 0xb1, 0x91, 0xb1, 0x24, 0x24, 0x24, 0x20, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6d, 0xb1, 0xad, 0xb1, 0xb1
-, 0xad, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x69, 0x20, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x20, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d
-, 0x8d, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x68, 0x68, 0x68, 0x8d, 0x8d, 0xb2, 0xda, 0xda, 0xfa, 0xfa
-, 0xfa, 0xda, 0xfa, 0xda, 0xd6, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb5, 0x91, 0x24, 0x24, 0x24
-, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x25, 0x49, 0x24, 0x44
-, 0x89, 0x88, 0x88, 0x89, 0x89, 0x89, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8d, 0x69, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89
-, 0x8d, 0x89, 0x89, 0x89, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6d, 0xd6
-, 0xff, 0xfb, 0xff, 0xfb, 0xda, 0xda, 0xda, 0xda, 0xd6, 0xd6, 0xb6, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1
-, 0x91, 0x44, 0x44, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24
-, 0x29, 0x25, 0x24, 0x44, 0x8d, 0x8d, 0x68, 0x68, 0x68, 0x68, 0x8d, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1
-, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-, 0xad, 0x8d, 0x69, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0x68, 0x68, 0x68, 0x68
-, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x64, 0x68, 0x68, 0x44, 0x44, 0x68, 0x68, 0x68, 0x68, 0x68
-, 0x68, 0x8d, 0xda, 0xff, 0xfb, 0xfb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xb5, 0xb5, 0xb6, 0xb5
-, 0xb5, 0xb5, 0xb1, 0xb1, 0xb1, 0x48, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x24, 0x24, 0x24, 0x25, 0x29, 0x49, 0x45, 0x49, 0xb2, 0xd6, 0xd2, 0xd6, 0xd6, 0xd6, 0xd2, 0xd1
-, 0xd2, 0xd6, 0xd6, 0xb1, 0xb1, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad
-, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x44
-, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x44, 0x48, 0x68
-, 0x68, 0x68, 0x68, 0x69, 0x68, 0xb2, 0xfb, 0xfb, 0xfb, 0xfb, 0xdb, 0xda, 0xda, 0xda, 0xd6, 0xd6
-, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb1, 0xb1, 0xb1, 0x91, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x25, 0x49, 0x49, 0x45, 0x24, 0x69, 0xb1, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0x8d, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xad, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x68, 0x68, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00
-, 0x20, 0x44, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69
-, 0x68, 0x44, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x8d, 0xda, 0xdb, 0xda, 0xff, 0xfb, 0xda, 0xda
-, 0xda, 0xb6, 0xd6, 0xd6, 0xb5, 0xb1, 0xb1, 0xb5, 0xb5, 0xb5, 0xb5, 0x91, 0x8d, 0x20, 0x00, 0x00
-, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x49, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24
-, 0x24, 0x68, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xad, 0xad
-, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x89, 0x89, 0x89, 0x89, 0x68, 0x68, 0x68, 0x64, 0x44, 0x24, 0x00
-, 0x00, 0x24, 0x24, 0x44, 0x48, 0x68, 0x68, 0x68, 0x68, 0x68, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
-, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x48, 0x68, 0x68, 0x68, 0x68, 0x8d, 0xd6, 0xff, 0xda, 0xda
-, 0xfb, 0xfb, 0xda, 0xda, 0xd6, 0xb1, 0xb6, 0xb5, 0xb1, 0xb5, 0xb5, 0xb5, 0xb1, 0xb5, 0xb1, 0xb1
-, 0x91
+const uint8_t bitmap_smiley_blij[512] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+	0x00, 0x01, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x10, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11,
+	0x01, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x10,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-const char bitmap_arrow_N[1026] = {
-    0x20, 0x20,
-	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,
-	    0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01
-
+const uint8_t bitmap_smiley_boos[512] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+	0x00, 0x01, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x10, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x12, 0x11, 0x11, 0x21, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x10,
+	0x01, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10,
+	0x00, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x00,
+	0x00, 0x01, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x10, 0x00,
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-const char bitmap_arrow_W[1026]={
-		0x20, 0x20,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-	    0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01
-
+const uint8_t bitmap_michiel[6971] = {
+	0x00, 0x49, 0x83, 0x29, 0x01, 0x49, 0x49, 0x82, 0x4d, 0x09, 0x29, 0x49, 0x49, 0x6d, 0x68, 0x48,
+	0x48, 0x68, 0x89, 0x89, 0x84, 0x8d, 0x85, 0xad, 0x05, 0xd1, 0xd1, 0xb1, 0xad, 0xb1, 0xd1, 0x85,
+	0xd2, 0x8a, 0xd1, 0x09, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0x8d, 0x8d, 0x6d, 0x6d, 0x69, 0x83, 0x6d,
+	0x01, 0x4d, 0x4d, 0x82, 0x48, 0x03, 0x4c, 0x6d, 0x71, 0x71, 0x82, 0x6d, 0x04, 0x4c, 0x48, 0x28,
+	0x28, 0x4d, 0x82, 0x6d, 0x82, 0x4d, 0x08, 0x48, 0x28, 0x28, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x4d,
+	0x82, 0x29, 0x82, 0x4d, 0x0d, 0x49, 0x29, 0x49, 0x4d, 0x29, 0x49, 0x6d, 0x6d, 0x68, 0x48, 0x68,
+	0x69, 0x89, 0x89, 0x82, 0x8d, 0x85, 0xad, 0x06, 0xb1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1, 0x88,
+	0xd2, 0x8c, 0xd1, 0x01, 0xb1, 0xad, 0x83, 0x8d, 0x0b, 0x69, 0x6d, 0x8d, 0x6d, 0x49, 0x4d, 0x48,
+	0x48, 0x4d, 0x6d, 0x6d, 0x71, 0x83, 0x6d, 0x00, 0x4d, 0x82, 0x48, 0x01, 0x4d, 0x6d, 0x82, 0x4d,
+	0x82, 0x48, 0x07, 0x28, 0x49, 0x4d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x01, 0x49, 0x29, 0x83, 0x4d,
+	0x00, 0x49, 0x83, 0x29, 0x06, 0x49, 0x6d, 0x69, 0x48, 0x44, 0x69, 0x89, 0x83, 0x8d, 0x86, 0xad,
+	0x82, 0xd1, 0x84, 0xd2, 0x85, 0xd6, 0x83, 0xd2, 0x88, 0xd1, 0x83, 0xb1, 0x83, 0x8d, 0x83, 0x6d,
+	0x04, 0x49, 0x4d, 0x49, 0x28, 0x4d, 0x84, 0x6d, 0x0a, 0x6c, 0x48, 0x4c, 0x49, 0x48, 0x48, 0x4d,
+	0x6d, 0x48, 0x49, 0x4d, 0x82, 0x48, 0x07, 0x28, 0x28, 0x4d, 0x4d, 0x49, 0x4d, 0x48, 0x48, 0x03,
+	0x4d, 0x49, 0x4d, 0x4d, 0x85, 0x29, 0x07, 0x28, 0x49, 0x69, 0x48, 0x48, 0x68, 0x89, 0x89, 0x82,
+	0x8d, 0x85, 0xad, 0x03, 0xb1, 0xb1, 0xd1, 0xd1, 0x84, 0xd2, 0x87, 0xd6, 0x83, 0xd2, 0x88, 0xd1,
+	0x83, 0xb1, 0x04, 0x8d, 0x8d, 0x91, 0x8d, 0x8d, 0x82, 0x6d, 0x03, 0x4d, 0x48, 0x28, 0x4d, 0x85,
+	0x6d, 0x04, 0x48, 0x4c, 0x48, 0x48, 0x49, 0x82, 0x6d, 0x82, 0x48, 0x06, 0x49, 0x49, 0x28, 0x24,
+	0x48, 0x4d, 0x49, 0x82, 0x48, 0x0f, 0x4d, 0x49, 0x4d, 0x29, 0x4d, 0x4d, 0x29, 0x49, 0x29, 0x29,
+	0x49, 0x6d, 0x69, 0x48, 0x68, 0x69, 0x82, 0x8d, 0x85, 0xad, 0x82, 0xb1, 0x01, 0xd1, 0xd1, 0x85,
+	0xd2, 0x89, 0xd6, 0x02, 0xf6, 0xd2, 0xd2, 0x86, 0xd1, 0x85, 0xb1, 0x83, 0x8d, 0x82, 0x6d, 0x0a,
+	0x4d, 0x48, 0x49, 0x6d, 0x6d, 0x6c, 0x6d, 0x4d, 0x4d, 0x6d, 0x6d, 0x82, 0x48, 0x00, 0x4d, 0x82,
+	0x6d, 0x09, 0x49, 0x48, 0x48, 0x49, 0x48, 0x28, 0x48, 0x48, 0x49, 0x49, 0x82, 0x48, 0x83, 0x4d,
+	0x00, 0x6d, 0x83, 0x4d, 0x05, 0x49, 0x49, 0x69, 0x48, 0x44, 0x68, 0x83, 0x8d, 0x84, 0xad, 0x01,
+	0xb1, 0xb1, 0x82, 0xd1, 0x84, 0xd2, 0x88, 0xd6, 0x84, 0xf6, 0x82, 0xd2, 0x84, 0xd1, 0x85, 0xb1,
+	0x83, 0x8d, 0x82, 0x6d, 0x02, 0x4d, 0x48, 0x48, 0x82, 0x6d, 0x04, 0x4d, 0x4c, 0x48, 0x6d, 0x4d,
+	0x82, 0x48, 0x01, 0x6d, 0x49, 0x82, 0x4d, 0x08, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x4d, 0x48,
+	0x49, 0x82, 0x48, 0x82, 0x6d, 0x85, 0x4d, 0x05, 0x49, 0x49, 0x69, 0x48, 0x48, 0x69, 0x82, 0x8d,
+	0x85, 0xad, 0x84, 0xd1, 0x84, 0xd2, 0x88, 0xd6, 0x83, 0xf6, 0x03, 0xd6, 0xd6, 0xd2, 0xd2, 0x84,
+	0xd1, 0x84, 0xb1, 0x05, 0xad, 0xad, 0x8d, 0x8d, 0x91, 0x8d, 0x82, 0x6d, 0x01, 0x48, 0x49, 0x82,
+	0x6d, 0x10, 0x4c, 0x48, 0x49, 0x4d, 0x4c, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x4d,
+	0x48, 0x48, 0x49, 0x82, 0x4d, 0x83, 0x48, 0x00, 0x4d, 0x83, 0x4d, 0x83, 0x49, 0x05, 0x4d, 0x4d,
+	0x6d, 0x69, 0x48, 0x68, 0x83, 0x8d, 0x83, 0xad, 0x00, 0xb1, 0x84, 0xd1, 0x03, 0xd2, 0xd2, 0xd6,
+	0xd6, 0x82, 0xd2, 0x86, 0xd6, 0x83, 0xf6, 0x82, 0xd6, 0x82, 0xd2, 0x83, 0xd1, 0x84, 0xb1, 0x00,
+	0xad, 0x84, 0x8d, 0x82, 0x6d, 0x00, 0x4d, 0x83, 0x6d, 0x03, 0x4c, 0x48, 0x4d, 0x6d, 0x84, 0x48,
+	0x01, 0x4d, 0x4d, 0x82, 0x6d, 0x02, 0x48, 0x28, 0x48, 0x82, 0x4d, 0x82, 0x48, 0x01, 0x4d, 0x6d,
+	0x0d, 0x49, 0x49, 0x4d, 0x49, 0x29, 0x49, 0x4d, 0x29, 0x29, 0x49, 0x6d, 0x6d, 0x68, 0x69, 0x83,
+	0x8d, 0x82, 0xad, 0x00, 0xb1, 0x84, 0xd1, 0x82, 0xd2, 0x03, 0xd6, 0xd6, 0xd2, 0xd2, 0x85, 0xd6,
+	0x85, 0xf6, 0x83, 0xd6, 0x82, 0xd2, 0x83, 0xd1, 0x02, 0xb1, 0xb1, 0xad, 0x82, 0xb1, 0x84, 0x8d,
+	0x86, 0x6d, 0x05, 0x4c, 0x48, 0x4d, 0x6d, 0x48, 0x4c, 0x83, 0x4d, 0x83, 0x6d, 0x0a, 0x48, 0x28,
+	0x28, 0x48, 0x4c, 0x4c, 0x48, 0x28, 0x48, 0x6d, 0x6d, 0x01, 0x29, 0x49, 0x82, 0x29, 0x08, 0x49,
+	0x4d, 0x29, 0x29, 0x49, 0x6d, 0x6d, 0x68, 0x69, 0x83, 0x8d, 0x82, 0xad, 0x00, 0xb1, 0x84, 0xd1,
+	0x83, 0xd2, 0x02, 0xd6, 0xd2, 0xd2, 0x86, 0xd6, 0x85, 0xf6, 0x82, 0xd6, 0x82, 0xd2, 0x83, 0xd1,
+	0x86, 0xb1, 0x83, 0x8d, 0x86, 0x6d, 0x02, 0x4d, 0x48, 0x48, 0x82, 0x6d, 0x04, 0x4d, 0x6d, 0x6d,
+	0x4d, 0x4c, 0x82, 0x6d, 0x0a, 0x48, 0x28, 0x48, 0x4d, 0x4c, 0x48, 0x49, 0x48, 0x48, 0x6d, 0x6d,
+	0x01, 0x29, 0x49, 0x86, 0x29, 0x08, 0x49, 0x4d, 0x69, 0x69, 0x8d, 0x8d, 0x89, 0x8d, 0x8d, 0x83,
+	0xad, 0x84, 0xd1, 0x82, 0xd2, 0x89, 0xd6, 0x87, 0xf6, 0x82, 0xd6, 0x01, 0xd2, 0xd2, 0x82, 0xd1,
+	0x86, 0xb1, 0x08, 0xb2, 0xb1, 0x8d, 0x91, 0x8d, 0x8d, 0x6d, 0x6d, 0x4d, 0x83, 0x6d, 0x06, 0x4d,
+	0x48, 0x4d, 0x6d, 0x6d, 0x4d, 0x4c, 0x82, 0x48, 0x82, 0x6d, 0x0a, 0x48, 0x28, 0x48, 0x4d, 0x4c,
+	0x48, 0x49, 0x48, 0x28, 0x48, 0x6d, 0x83, 0x29, 0x01, 0x49, 0x4d, 0x83, 0x29, 0x02, 0x49, 0x6d,
+	0x69, 0x82, 0x89, 0x01, 0x8d, 0x8d, 0x83, 0xad, 0x84, 0xd1, 0x82, 0xd2, 0x87, 0xd6, 0x00, 0xd2,
+	0x87, 0xf6, 0x82, 0xd6, 0x83, 0xd2, 0x83, 0xd1, 0x84, 0xb1, 0x82, 0xb2, 0x0b, 0x92, 0x91, 0x8d,
+	0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x82, 0x6d, 0x83, 0x4d, 0x00, 0x4c, 0x82,
+	0x6d, 0x02, 0x48, 0x48, 0x49, 0x86, 0x48, 0x00, 0x4c, 0x82, 0x29, 0x09, 0x49, 0x4d, 0x4d, 0x29,
+	0x29, 0x49, 0x49, 0x6d, 0x69, 0x69, 0x82, 0x89, 0x82, 0x8d, 0x82, 0xad, 0x84, 0xd1, 0x01, 0xd2,
+	0xd2, 0x89, 0xd6, 0x87, 0xf6, 0x03, 0xd6, 0xf6, 0xd6, 0xd6, 0x82, 0xd2, 0x82, 0xd1, 0x85, 0xb1,
+	0x83, 0xb2, 0x0a, 0x92, 0x91, 0x8d, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x4c, 0x48, 0x48, 0x83, 0x6d,
+	0x09, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x6d, 0x4d, 0x48, 0x49, 0x4d, 0x84, 0x48, 0x82, 0x4d, 0x05,
+	0x29, 0x49, 0x49, 0x29, 0x29, 0x49, 0x82, 0x29, 0x03, 0x49, 0x6d, 0x69, 0x69, 0x82, 0x89, 0x82,
+	0x8d, 0x82, 0xad, 0x84, 0xd1, 0x00, 0xd2, 0x85, 0xd6, 0x01, 0xd2, 0xd2, 0x82, 0xd6, 0x8a, 0xf6,
+	0x00, 0xd6, 0x83, 0xd2, 0x01, 0xd1, 0xd1, 0x85, 0xb1, 0x83, 0xb2, 0x03, 0x92, 0x91, 0x8d, 0x91,
+	0x84, 0x6d, 0x00, 0x4d, 0x84, 0x6d, 0x01, 0x48, 0x48, 0x83, 0x6d, 0x0b, 0x48, 0x48, 0x4d, 0x4d,
+	0x48, 0x28, 0x48, 0x48, 0x28, 0x48, 0x4d, 0x6d, 0x00, 0x49, 0x83, 0x29, 0x01, 0x49, 0x49, 0x82,
+	0x29, 0x05, 0x4d, 0x6d, 0x69, 0x69, 0x89, 0x89, 0x82, 0x8d, 0x82, 0xad, 0x06, 0xb1, 0xd1, 0xb1,
+	0xd1, 0xd1, 0xd2, 0xd2, 0x86, 0xd6, 0x02, 0xd2, 0xd6, 0xd6, 0x87, 0xf6, 0x83, 0xd6, 0x83, 0xd2,
+	0x01, 0xd1, 0xd1, 0x84, 0xb1, 0x84, 0xb2, 0x03, 0x91, 0x92, 0x91, 0x91, 0x83, 0x6d, 0x01, 0x4c,
+	0x4c, 0x85, 0x6d, 0x10, 0x4c, 0x4c, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x4d, 0x4d, 0x48, 0x28, 0x48,
+	0x48, 0x28, 0x28, 0x48, 0x4d, 0x89, 0x29, 0x05, 0x6d, 0x6d, 0x69, 0x69, 0x89, 0x89, 0x82, 0x8d,
+	0x83, 0xad, 0x83, 0xd1, 0x01, 0xd2, 0xd2, 0x86, 0xd6, 0x01, 0xd2, 0xd6, 0x8a, 0xf6, 0x82, 0xd6,
+	0x82, 0xd2, 0x82, 0xd1, 0x82, 0xb1, 0x00, 0xd2, 0x86, 0xb2, 0x01, 0x91, 0x8d, 0x83, 0x6d, 0x02,
+	0x6c, 0x4c, 0x4d, 0x89, 0x6d, 0x02, 0x48, 0x48, 0x4c, 0x82, 0x48, 0x05, 0x49, 0x48, 0x28, 0x28,
+	0x4c, 0x4d, 0x02, 0x49, 0x29, 0x28, 0x82, 0x29, 0x08, 0x24, 0x29, 0x49, 0x49, 0x6d, 0x6d, 0x69,
+	0x69, 0x89, 0x83, 0x8d, 0x83, 0xad, 0x83, 0xd1, 0x01, 0xd2, 0xd2, 0x88, 0xd6, 0x8b, 0xf6, 0x00,
+	0xd6, 0x84, 0xd2, 0x00, 0xd1, 0x85, 0xb1, 0x0c, 0xb2, 0xb6, 0xb6, 0xb2, 0xb2, 0x92, 0x91, 0x91,
+	0x6d, 0x6d, 0x4c, 0x6d, 0x71, 0x87, 0x6d, 0x00, 0x4d, 0x82, 0x6d, 0x85, 0x48, 0x05, 0x4d, 0x49,
+	0x48, 0x49, 0x4d, 0x4d, 0x00, 0x49, 0x82, 0x29, 0x05, 0x49, 0x29, 0x24, 0x24, 0x49, 0x49, 0x82,
+	0x6d, 0x01, 0x69, 0x89, 0x83, 0x8d, 0x82, 0xad, 0x83, 0xd1, 0x02, 0xd2, 0xd6, 0xd2, 0x88, 0xd6,
+	0x8c, 0xf6, 0x00, 0xd6, 0x83, 0xd2, 0x01, 0xd1, 0xd1, 0x84, 0xb1, 0x0c, 0xb2, 0xb2, 0xb6, 0xb2,
+	0xb2, 0x92, 0x91, 0x91, 0x6d, 0x6d, 0x6c, 0x6d, 0x71, 0x83, 0x6d, 0x06, 0x6c, 0x6c, 0x6d, 0x48,
+	0x48, 0x6d, 0x4d, 0x82, 0x48, 0x09, 0x49, 0x48, 0x28, 0x48, 0x49, 0x48, 0x28, 0x48, 0x49, 0x49,
+	0x04, 0x29, 0x49, 0x29, 0x29, 0x49, 0x82, 0x29, 0x82, 0x49, 0x03, 0x6d, 0x69, 0x69, 0x89, 0x82,
+	0x8d, 0x83, 0xad, 0x83, 0xd1, 0x82, 0xd2, 0x00, 0xf6, 0x87, 0xd6, 0x8d, 0xf6, 0x0a, 0xd6, 0xd6,
+	0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xd1, 0xb1, 0xb1, 0x85, 0xb2, 0x09, 0x91, 0x91, 0x8d, 0x6d,
+	0x6d, 0x71, 0x6d, 0x6c, 0x6d, 0x6c, 0x83, 0x6d, 0x03, 0x4d, 0x48, 0x4d, 0x49, 0x82, 0x48, 0x09,
+	0x49, 0x48, 0x28, 0x28, 0x49, 0x48, 0x28, 0x28, 0x48, 0x48, 0x89, 0x49, 0x06, 0x69, 0x6d, 0x6d,
+	0x69, 0x89, 0x8d, 0x8d, 0x84, 0xad, 0x00, 0xb1, 0x82, 0xd1, 0x82, 0xd2, 0x01, 0xd6, 0xf6, 0x83,
+	0xd6, 0x02, 0xd2, 0xd2, 0xd6, 0x8d, 0xf6, 0x83, 0xd6, 0x05, 0xd2, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1,
+	0x82, 0xb1, 0x84, 0xb2, 0x05, 0x92, 0x8d, 0x6d, 0x6d, 0x6c, 0x6c, 0x86, 0x6d, 0x10, 0x4d, 0x4d,
+	0x6d, 0x4d, 0x49, 0x49, 0x28, 0x48, 0x48, 0x28, 0x28, 0x48, 0x48, 0x28, 0x28, 0x48, 0x48, 0x82,
+	0x6d, 0x02, 0x49, 0x4d, 0x6d, 0x83, 0x49, 0x00, 0x6d, 0x82, 0x8d, 0x02, 0x89, 0x8d, 0x8d, 0x84,
+	0xad, 0x02, 0xb1, 0xd1, 0xd1, 0x82, 0xd2, 0x05, 0xd6, 0xd6, 0xf6, 0xd2, 0xd6, 0xf6, 0x82, 0xd2,
+	0x01, 0xd6, 0xd6, 0x84, 0xf6, 0x00, 0xd6, 0x82, 0xd2, 0x82, 0xd6, 0x04, 0xd2, 0xd2, 0xd1, 0xd2,
+	0xd6, 0x82, 0xd2, 0x02, 0xb1, 0xb1, 0xd1, 0x83, 0xb1, 0x82, 0xb2, 0x02, 0x92, 0x92, 0x91, 0x8a,
+	0x6d, 0x10, 0x48, 0x48, 0x4d, 0x6d, 0x4d, 0x49, 0x48, 0x4d, 0x48, 0x28, 0x28, 0x49, 0x48, 0x28,
+	0x28, 0x48, 0x6d, 0x8a, 0x6d, 0x85, 0x8d, 0x85, 0xad, 0x83, 0xd1, 0x04, 0xd2, 0xd2, 0xd6, 0xd2,
+	0xd2, 0x82, 0xd6, 0x01, 0xd2, 0xd2, 0x85, 0xd6, 0x03, 0xd2, 0xb1, 0xad, 0xad, 0x88, 0xb1, 0x82,
+	0xd2, 0x02, 0xd1, 0xb1, 0xd1, 0x84, 0xb1, 0x01, 0xb2, 0xb2, 0x82, 0x91, 0x82, 0x6d, 0x03, 0x6c,
+	0x6c, 0x6d, 0x6c, 0x83, 0x6d, 0x0a, 0x48, 0x48, 0x49, 0x49, 0x48, 0x28, 0x48, 0x4d, 0x48, 0x28,
+	0x28, 0x83, 0x48, 0x01, 0x4d, 0x6d, 0x03, 0x6d, 0x6d, 0x8d, 0x8d, 0x85, 0x6d, 0x02, 0x91, 0x8d,
+	0x6d, 0x83, 0x8d, 0x85, 0xad, 0x82, 0xd1, 0x86, 0xd2, 0x01, 0xd6, 0xd6, 0x85, 0xd2, 0x08, 0xd1,
+	0xb1, 0xad, 0x8d, 0x89, 0x89, 0x69, 0x89, 0x89, 0x83, 0x8d, 0x04, 0xad, 0xad, 0xb1, 0xb1, 0xd2,
+	0x84, 0xd1, 0x83, 0xb1, 0x01, 0xb2, 0xb1, 0x82, 0x8d, 0x03, 0x6d, 0x68, 0x6c, 0x6c, 0x85, 0x6d,
+	0x00, 0x4d, 0x82, 0x49, 0x01, 0x28, 0x48, 0x82, 0x49, 0x01, 0x28, 0x28, 0x82, 0x48, 0x02, 0x4c,
+	0x6d, 0x4d, 0x0c, 0x8d, 0x8d, 0x91, 0x92, 0x91, 0x8d, 0x91, 0x8d, 0x91, 0x6d, 0x8d, 0x8d, 0x6d,
+	0x83, 0x8d, 0x85, 0xad, 0x82, 0xd1, 0x01, 0xd2, 0xd1, 0x82, 0xd2, 0x00, 0xd1, 0x83, 0xd2, 0x07,
+	0xd1, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0x8d, 0x89, 0x82, 0x68, 0x01, 0x89, 0x8d, 0x82, 0xad, 0x07,
+	0xb1, 0xad, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xd2, 0x83, 0xd1, 0x83, 0xb1, 0x01, 0xb2, 0xb1, 0x82,
+	0xad, 0x02, 0xb1, 0x6d, 0x6c, 0x82, 0x6d, 0x00, 0x4c, 0x83, 0x6d, 0x03, 0x49, 0x4d, 0x49, 0x28,
+	0x83, 0x49, 0x07, 0x28, 0x29, 0x49, 0x49, 0x48, 0x4c, 0x4d, 0x4c, 0x00, 0x92, 0x82, 0x91, 0x04,
+	0x8d, 0x91, 0x92, 0xb2, 0x92, 0x82, 0x91, 0x00, 0x6d, 0x82, 0x8d, 0x83, 0xad, 0x84, 0xb1, 0x83,
+	0xd1, 0x86, 0xd2, 0x85, 0xad, 0x82, 0x89, 0x02, 0x8d, 0xad, 0xb1, 0x86, 0xd2, 0x00, 0xb1, 0x82,
+	0xad, 0x00, 0xb1, 0x83, 0xd1, 0x01, 0xb1, 0xad, 0x83, 0xb1, 0x05, 0xad, 0xd1, 0xad, 0xa9, 0xad,
+	0x6c, 0x82, 0x6d, 0x00, 0x4c, 0x85, 0x6d, 0x01, 0x4d, 0x48, 0x83, 0x49, 0x00, 0x48, 0x82, 0x49,
+	0x03, 0x48, 0x48, 0x4c, 0x48, 0x04, 0xd6, 0xb6, 0xb6, 0xb2, 0x92, 0x82, 0xb2, 0x09, 0xb6, 0xb6,
+	0x92, 0x8d, 0x6d, 0x6d, 0x8d, 0x8d, 0xad, 0xb1, 0x86, 0xad, 0x00, 0xb1, 0x83, 0xad, 0x02, 0xd1,
+	0xd1, 0xd2, 0x82, 0xd6, 0x00, 0xd1, 0x83, 0xad, 0x82, 0x8d, 0x00, 0xad, 0x83, 0x8d, 0x02, 0xad,
+	0xb1, 0xb1, 0x82, 0xd2, 0x01, 0xd1, 0xd1, 0x82, 0xb1, 0x10, 0xd1, 0xd2, 0xd1, 0xd1, 0xb1, 0xad,
+	0xad, 0xb1, 0xad, 0xad, 0xd1, 0xd2, 0xad, 0xa9, 0xad, 0x6d, 0x6c, 0x82, 0x6d, 0x09, 0x4c, 0x4c,
+	0x6d, 0x6d, 0x4c, 0x4d, 0x4d, 0x49, 0x48, 0x48, 0x83, 0x49, 0x05, 0x28, 0x48, 0x48, 0x4d, 0x48,
+	0x48, 0x05, 0xda, 0xfb, 0xfb, 0xdb, 0xda, 0xd6, 0x82, 0xb6, 0x08, 0xb2, 0x91, 0x8d, 0x6d, 0x6d,
+	0x8d, 0x8d, 0xad, 0xad, 0x89, 0x8d, 0x83, 0xad, 0x05, 0xd1, 0xd2, 0xf6, 0xf6, 0xd6, 0xd1, 0x82,
+	0xad, 0x06, 0x8d, 0xad, 0xad, 0x8d, 0x89, 0x69, 0x69, 0x82, 0x44, 0x03, 0x64, 0x69, 0x8d, 0xad,
+	0x83, 0xd1, 0x00, 0xb1, 0x83, 0xd1, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x08, 0xb1, 0xd2, 0xd1, 0xad,
+	0xa9, 0xad, 0x8d, 0x6d, 0x6c, 0x82, 0x4c, 0x0b, 0x48, 0x48, 0x4d, 0x48, 0x48, 0x49, 0x49, 0x48,
+	0x28, 0x49, 0x49, 0x48, 0x82, 0x28, 0x03, 0x48, 0x49, 0x49, 0x48, 0x0d, 0xd6, 0xda, 0xda, 0xfb,
+	0xff, 0xff, 0xfb, 0xfb, 0xdb, 0xda, 0xb6, 0xb2, 0x6d, 0x6d, 0x84, 0x8d, 0x86, 0x68, 0x82, 0x89,
+	0x04, 0x8d, 0xad, 0xad, 0xd1, 0xd2, 0x82, 0xf6, 0x01, 0xd2, 0xd1, 0x84, 0xad, 0x0d, 0x8d, 0x89,
+	0xb1, 0x6d, 0x48, 0x69, 0x49, 0x49, 0x69, 0x89, 0x89, 0xad, 0xad, 0xb1, 0x86, 0xd1, 0x0a, 0xb1,
+	0xad, 0x8d, 0x8d, 0xd2, 0xd2, 0xd1, 0xcd, 0xa9, 0xad, 0x8d, 0x83, 0x48, 0x00, 0x4c, 0x82, 0x4d,
+	0x07, 0x48, 0x48, 0x49, 0x49, 0x48, 0x28, 0x49, 0x48, 0x83, 0x28, 0x03, 0x48, 0x49, 0x48, 0x28,
+	0x05, 0xfa, 0xda, 0xda, 0xd6, 0xda, 0xfb, 0x84, 0xff, 0x07, 0xdb, 0x8d, 0x6d, 0x8d, 0x89, 0x69,
+	0x69, 0x68, 0x86, 0x64, 0x07, 0x68, 0x68, 0x88, 0x88, 0x89, 0xad, 0xd1, 0xd2, 0x83, 0xf6, 0x02,
+	0xd2, 0xd1, 0xb1, 0x82, 0xad, 0x03, 0x8d, 0x8d, 0xd6, 0x8d, 0x82, 0x49, 0x06, 0x69, 0xb2, 0xb2,
+	0xad, 0x8d, 0xad, 0xad, 0x83, 0xd1, 0x0e, 0xd2, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0xd1, 0xb1,
+	0xd2, 0xd2, 0xad, 0xad, 0x8d, 0x48, 0x84, 0x4d, 0x01, 0x6d, 0x6d, 0x82, 0x4d, 0x03, 0x49, 0x28,
+	0x28, 0x48, 0x84, 0x28, 0x03, 0x49, 0x49, 0x28, 0x28, 0x02, 0xff, 0xff, 0xfb, 0x84, 0xda, 0x00,
+	0xfb, 0x82, 0xff, 0x02, 0x92, 0x69, 0x69, 0x83, 0x68, 0x05, 0x89, 0x8d, 0x8d, 0x89, 0x69, 0x69,
+	0x84, 0x68, 0x03, 0x88, 0x8d, 0xcd, 0xd2, 0x82, 0xf6, 0x02, 0xf2, 0xd2, 0xd2, 0x82, 0xb1, 0x82,
+	0xad, 0x0b, 0xb2, 0xb2, 0x6d, 0x69, 0x69, 0x8d, 0xd2, 0xd2, 0xb1, 0xb1, 0xd1, 0xad, 0x86, 0xd1,
+	0x84, 0xb1, 0x14, 0xd1, 0xd2, 0xd2, 0xad, 0xad, 0x8d, 0x6d, 0x6d, 0x4d, 0x48, 0x48, 0x4c, 0x48,
+	0x48, 0x4c, 0x4d, 0x49, 0x48, 0x28, 0x28, 0x49, 0x82, 0x28, 0x00, 0x24, 0x83, 0x28, 0x00, 0x24,
+	0x84, 0xff, 0x01, 0xfb, 0xdb, 0x82, 0xda, 0x02, 0xff, 0xff, 0xb6, 0x83, 0x68, 0x83, 0x8d, 0x00,
+	0x69, 0x82, 0x44, 0x0b, 0x69, 0x69, 0x89, 0x89, 0x88, 0x68, 0x89, 0xad, 0xd1, 0xf2, 0xf6, 0xf6,
+	0x82, 0xd2, 0x02, 0xd1, 0xd2, 0xd2, 0x83, 0xad, 0x04, 0xb2, 0xb1, 0xad, 0xb1, 0xb1, 0x82, 0xd1,
+	0x02, 0xd2, 0xd6, 0xd6, 0x85, 0xd2, 0x05, 0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0xb1, 0x83, 0xd1, 0x07,
+	0xad, 0x8d, 0x48, 0x4d, 0x4d, 0x48, 0x48, 0x4c, 0x84, 0x48, 0x03, 0x24, 0x24, 0x28, 0x49, 0x82,
+	0x28, 0x00, 0x24, 0x84, 0x28, 0x88, 0xff, 0x06, 0xfb, 0xfb, 0xdb, 0xb6, 0x69, 0x68, 0x68, 0x82,
+	0x8d, 0x07, 0x68, 0x44, 0x24, 0x44, 0x49, 0x48, 0x69, 0x8d, 0x82, 0x89, 0x09, 0x88, 0x89, 0xad,
+	0xd1, 0xd2, 0xf6, 0xf2, 0xd2, 0xd2, 0xd6, 0x84, 0xd2, 0x09, 0xb1, 0xb1, 0xd2, 0xd2, 0xd1, 0xd2,
+	0xd1, 0xd1, 0xd2, 0xd2, 0x84, 0xd6, 0x82, 0xd2, 0x82, 0xd1, 0x83, 0xb1, 0x01, 0xad, 0xad, 0x82,
+	0xd1, 0x0f, 0xb1, 0x48, 0x48, 0x6d, 0x6d, 0x4d, 0x4c, 0x4d, 0x4d, 0x6d, 0x4d, 0x49, 0x24, 0x24,
+	0x28, 0x49, 0x83, 0x28, 0x00, 0x24, 0x83, 0x28, 0x8a, 0xff, 0x10, 0xfb, 0xb2, 0x69, 0x68, 0x69,
+	0x8d, 0x8d, 0x64, 0x48, 0x6d, 0x44, 0x24, 0x49, 0x48, 0x49, 0xb2, 0x8d, 0x83, 0x89, 0x06, 0xad,
+	0xd1, 0xd2, 0xf6, 0xf2, 0xd2, 0xd1, 0x8d, 0xd2, 0x84, 0xf6, 0x03, 0xd6, 0xd6, 0xd2, 0xd2, 0x83,
+	0xd1, 0x82, 0xb1, 0x06, 0xad, 0xad, 0xcd, 0xcd, 0xd1, 0xd2, 0xb1, 0x82, 0x6d, 0x01, 0x6c, 0x6d,
+	0x83, 0x4d, 0x03, 0x49, 0x49, 0x24, 0x24, 0x83, 0x28, 0x82, 0x24, 0x82, 0x28, 0x00, 0x48, 0x8a,
+	0xff, 0x00, 0xd6, 0x83, 0x69, 0x05, 0x89, 0x68, 0x44, 0x8d, 0x91, 0x49, 0x82, 0x44, 0x0d, 0x69,
+	0x8d, 0x8d, 0x89, 0x8d, 0x89, 0x89, 0xad, 0xd1, 0xf2, 0xf6, 0xf6, 0xd2, 0xd1, 0x88, 0xd2, 0x83,
+	0xd6, 0x86, 0xf6, 0x00, 0xd6, 0x82, 0xd2, 0x01, 0xd1, 0xb1, 0x82, 0xad, 0x07, 0xb1, 0xd1, 0xad,
+	0xcd, 0xcd, 0xd1, 0xd2, 0xb1, 0x84, 0x6d, 0x82, 0x48, 0x03, 0x28, 0x48, 0x28, 0x24, 0x85, 0x28,
+	0x05, 0x24, 0x24, 0x28, 0x28, 0x48, 0x6d, 0x8a, 0xff, 0x0c, 0xb2, 0x69, 0x8d, 0x8d, 0x69, 0x89,
+	0x68, 0x68, 0x89, 0x8d, 0x8d, 0x69, 0x69, 0x85, 0x8d, 0x08, 0x89, 0x89, 0xad, 0xd1, 0xf2, 0xf6,
+	0xf2, 0xd1, 0xd2, 0x83, 0xf2, 0x01, 0xd6, 0xf6, 0x82, 0xd2, 0x00, 0xd6, 0x89, 0xf6, 0x00, 0xd6,
+	0x82, 0xd2, 0x00, 0xd1, 0x82, 0xad, 0x09, 0xb1, 0xb1, 0xd2, 0xcd, 0xad, 0xcd, 0xcd, 0xd2, 0xb1,
+	0x69, 0x85, 0x48, 0x07, 0x28, 0x28, 0x48, 0x28, 0x29, 0x29, 0x28, 0x24, 0x84, 0x28, 0x03, 0x48,
+	0x48, 0x4c, 0x6d, 0x02, 0xdb, 0xdb, 0xfb, 0x87, 0xff, 0x07, 0xfb, 0x69, 0x89, 0x8d, 0x69, 0x8d,
+	0x69, 0x68, 0x83, 0x89, 0x00, 0x8d, 0x83, 0xad, 0x00, 0x8d, 0x82, 0x89, 0x05, 0xad, 0xd2, 0xf6,
+	0xf6, 0xd2, 0xd2, 0x84, 0xf2, 0x83, 0xf6, 0x02, 0xd2, 0xd2, 0xd6, 0x89, 0xf6, 0x02, 0xd2, 0xd2,
+	0xd1, 0x85, 0xb1, 0x09, 0xd2, 0xd2, 0xad, 0xad, 0xcd, 0xd2, 0xb1, 0x69, 0x48, 0x49, 0x82, 0x48,
+	0x0a, 0x49, 0x48, 0x48, 0x4d, 0x48, 0x28, 0x29, 0x29, 0x28, 0x24, 0x24, 0x84, 0x48, 0x01, 0x6d,
+	0x6d, 0x82, 0xdb, 0x88, 0xff, 0x05, 0xb1, 0x69, 0x8d, 0x8d, 0x89, 0x69, 0x83, 0x89, 0x00, 0x8d,
+	0x84, 0xad, 0x09, 0x8d, 0x8d, 0x89, 0x89, 0xad, 0xd2, 0xf6, 0xf6, 0xd2, 0xd2, 0x85, 0xf2, 0x8f,
+	0xf6, 0x02, 0xd2, 0xd2, 0xd1, 0x85, 0xb1, 0x06, 0xd2, 0xd2, 0xad, 0xad, 0xd1, 0xd2, 0xb1, 0x82,
+	0x6d, 0x03, 0x4d, 0x48, 0x48, 0x49, 0x82, 0x4d, 0x0a, 0x48, 0x24, 0x28, 0x29, 0x29, 0x24, 0x28,
+	0x49, 0x49, 0x48, 0x48, 0x82, 0x6d, 0x02, 0xdb, 0xdb, 0xdf, 0x82, 0xff, 0x07, 0xfb, 0xdb, 0xff,
+	0xdf, 0xff, 0xff, 0xda, 0x69, 0x82, 0x89, 0x83, 0x8d, 0x83, 0xad, 0x0a, 0xb1, 0xad, 0xad, 0x8d,
+	0x8d, 0x89, 0x89, 0xad, 0xd2, 0xf6, 0xf6, 0x82, 0xd2, 0x82, 0xf2, 0x01, 0xd2, 0xf2, 0x86, 0xf6,
+	0x01, 0xf2, 0xf2, 0x84, 0xf6, 0x05, 0xd2, 0xf6, 0xd2, 0xd2, 0xd1, 0xd1, 0x84, 0xb1, 0x08, 0xd2,
+	0xd1, 0xad, 0xd1, 0xd1, 0xd2, 0x91, 0x49, 0x6d, 0x85, 0x48, 0x0f, 0x4c, 0x4d, 0x48, 0x28, 0x28,
+	0x49, 0x29, 0x28, 0x49, 0x49, 0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x6c, 0x05, 0xb7, 0xb7, 0xbb, 0xd7,
+	0xdb, 0xfb, 0x82, 0xff, 0x06, 0xdb, 0xdb, 0xfb, 0xff, 0xb2, 0x89, 0x89, 0x83, 0x8d, 0x88, 0xad,
+	0x06, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0x83, 0xd2, 0x03, 0xf2, 0xf2, 0xd2, 0xf2, 0x8c,
+	0xf6, 0x00, 0xf2, 0x82, 0xd2, 0x82, 0xd1, 0x01, 0xad, 0xad, 0x82, 0xb1, 0x01, 0xd1, 0xad, 0x83,
+	0xd2, 0x00, 0x8d, 0x87, 0x48, 0x0f, 0x4c, 0x6d, 0x4d, 0x4d, 0x49, 0x49, 0x28, 0x29, 0x49, 0x28,
+	0x28, 0x48, 0x4d, 0x4c, 0x4c, 0x6d, 0x03, 0xdb, 0xdb, 0xb7, 0xb7, 0x83, 0xdb, 0x06, 0xff, 0xff,
+	0xfb, 0xff, 0xff, 0xd6, 0x69, 0x84, 0x8d, 0x88, 0xad, 0x07, 0x89, 0x89, 0xad, 0xcd, 0xd2, 0xf6,
+	0xf6, 0xf2, 0x82, 0xd2, 0x03, 0xf2, 0xf2, 0xd2, 0xf2, 0x8b, 0xf6, 0x00, 0xf2, 0x83, 0xd2, 0x82,
+	0xd1, 0x0b, 0xad, 0xad, 0xb1, 0xad, 0xb1, 0xb1, 0xd1, 0xf2, 0xd2, 0xd2, 0xb2, 0x69, 0x82, 0x48,
+	0x01, 0x49, 0x4d, 0x82, 0x48, 0x04, 0x4c, 0x6d, 0x4d, 0x4d, 0x49, 0x85, 0x28, 0x04, 0x48, 0x48,
+	0x4c, 0x6d, 0x6d, 0x88, 0xdb, 0x05, 0xd7, 0xdb, 0xfb, 0xff, 0xd6, 0x6d, 0x83, 0x8d, 0x89, 0xad,
+	0x04, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0x82, 0xf6, 0x87, 0xd2, 0x8a, 0xf6, 0x00, 0xf2, 0x83, 0xd2,
+	0x01, 0xd1, 0xd1, 0x85, 0xb1, 0x05, 0xd1, 0xd2, 0xf6, 0xd6, 0xd6, 0x8d, 0x82, 0x48, 0x06, 0x49,
+	0x4d, 0x4d, 0x48, 0x48, 0x4c, 0x4c, 0x82, 0x4d, 0x00, 0x29, 0x85, 0x28, 0x04, 0x49, 0x48, 0x4d,
+	0x6d, 0x6d, 0x01, 0xd6, 0xb6, 0x82, 0xff, 0x82, 0xdb, 0x01, 0xd7, 0xb6, 0x82, 0xdb, 0x00, 0xb6,
+	0x83, 0x8d, 0x8a, 0xad, 0x04, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0x82, 0xf6, 0x82, 0xd2, 0x00, 0xf2,
+	0x83, 0xd2, 0x00, 0xd6, 0x89, 0xf6, 0x03, 0xf2, 0xf2, 0xd2, 0xd2, 0x82, 0xd1, 0x85, 0xb1, 0x00,
+	0xd1, 0x82, 0xd2, 0x05, 0xb2, 0x69, 0x49, 0x48, 0x48, 0x49, 0x82, 0x48, 0x05, 0x4d, 0x4c, 0x48,
+	0x4d, 0x6d, 0x4d, 0x87, 0x28, 0x03, 0x48, 0x48, 0x49, 0x48, 0x82, 0xb6, 0x01, 0xdb, 0xdb, 0x82,
+	0xff, 0x83, 0xdb, 0x01, 0xd7, 0xd6, 0x83, 0x8d, 0x8a, 0xad, 0x04, 0x8d, 0x89, 0xad, 0xcd, 0xd2,
+	0x82, 0xf6, 0x03, 0xf2, 0xd2, 0xf2, 0xf2, 0x84, 0xd2, 0x02, 0xf6, 0xf2, 0xf2, 0x86, 0xf6, 0x82,
+	0xf2, 0x01, 0xd2, 0xd2, 0x82, 0xd1, 0x84, 0xb1, 0x12, 0xd1, 0xd2, 0xd6, 0xb2, 0x69, 0x49, 0x49,
+	0x48, 0x48, 0x49, 0x48, 0x48, 0x4d, 0x4d, 0x48, 0x48, 0x4d, 0x6d, 0x49, 0x86, 0x28, 0x04, 0x24,
+	0x28, 0x49, 0x48, 0x48, 0x01, 0xfb, 0xdb, 0x82, 0xb6, 0x83, 0xdb, 0x05, 0xff, 0xff, 0xdb, 0xff,
+	0xff, 0xb1, 0x82, 0x8d, 0x8a, 0xad, 0x06, 0x8d, 0x89, 0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0x85, 0xf2,
+	0x85, 0xd2, 0x00, 0xf2, 0x84, 0xf6, 0x83, 0xf2, 0x82, 0xd2, 0x82, 0xd1, 0x84, 0xb1, 0x04, 0xd1,
+	0xd6, 0xd6, 0x8d, 0x48, 0x85, 0x49, 0x03, 0x48, 0x4d, 0x4d, 0x4c, 0x82, 0x6d, 0x00, 0x48, 0x83,
+	0x28, 0x07, 0x49, 0x49, 0x28, 0x24, 0x28, 0x49, 0x48, 0x28, 0x01, 0xff, 0xff, 0x82, 0xdb, 0x83,
+	0xb6, 0x82, 0xdb, 0x06, 0xff, 0xff, 0xb2, 0x69, 0x89, 0x8d, 0x8d, 0x89, 0xad, 0x07, 0x89, 0x89,
+	0xad, 0xcd, 0xd2, 0xf6, 0xf6, 0xf2, 0x86, 0xd2, 0x00, 0xd1, 0x84, 0xd2, 0x02, 0xf2, 0xf6, 0xf6,
+	0x83, 0xf2, 0x83, 0xd2, 0x82, 0xd1, 0x84, 0xb1, 0x09, 0xd1, 0xd6, 0xb2, 0x6d, 0x48, 0x48, 0x49,
+	0x69, 0x68, 0x68, 0x82, 0x6d, 0x03, 0x4d, 0x6d, 0x6d, 0x4d, 0x82, 0x48, 0x0a, 0x4d, 0x48, 0x28,
+	0x48, 0x49, 0x28, 0x24, 0x28, 0x49, 0x48, 0x28, 0x85, 0xff, 0x0a, 0xfb, 0xdb, 0xda, 0xd6, 0xd6,
+	0xdb, 0xdb, 0xff, 0xda, 0x69, 0x89, 0x82, 0x8d, 0x88, 0xad, 0x01, 0x89, 0x89, 0x82, 0xad, 0x84,
+	0xd2, 0x82, 0xad, 0x82, 0xcd, 0x85, 0xd2, 0x83, 0xf2, 0x84, 0xd2, 0x84, 0xd1, 0x02, 0xb1, 0xb1,
+	0xad, 0x82, 0xb1, 0x00, 0x8d, 0x82, 0x49, 0x04, 0x48, 0x69, 0x68, 0x68, 0x69, 0x83, 0x6d, 0x00,
+	0x4d, 0x82, 0x48, 0x0b, 0x4d, 0x4d, 0x48, 0x4d, 0x48, 0x48, 0x28, 0x48, 0x49, 0x49, 0x48, 0x28,
+	0x89, 0xff, 0x01, 0xfb, 0xfb, 0x82, 0xff, 0x04, 0x8d, 0x69, 0x89, 0x8d, 0x8d, 0x88, 0xad, 0x02,
+	0x89, 0x89, 0x8d, 0x83, 0xad, 0x08, 0xcd, 0xcd, 0xad, 0x64, 0x89, 0xa9, 0xad, 0xad, 0xd1, 0x83,
+	0xd2, 0x00, 0xd1, 0x89, 0xd2, 0x84, 0xd1, 0x84, 0xb1, 0x01, 0xb2, 0xb1, 0x82, 0x6d, 0x02, 0x49,
+	0x6d, 0x6d, 0x82, 0x69, 0x82, 0x6d, 0x03, 0x4d, 0x4d, 0x48, 0x48, 0x82, 0x4d, 0x08, 0x6d, 0x4d,
+	0x28, 0x48, 0x4d, 0x48, 0x4d, 0x48, 0x28, 0x02, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0x02, 0xb2, 0x69,
+	0x89, 0x82, 0x8d, 0x87, 0xad, 0x82, 0x89, 0x8a, 0xad, 0x01, 0xd1, 0xf2, 0x83, 0xd2, 0x01, 0xd1,
+	0xd1, 0x85, 0xd2, 0x87, 0xd1, 0x0f, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xd6, 0xd6, 0xb2, 0xb1, 0xb2,
+	0x91, 0x91, 0x8d, 0x6d, 0x6d, 0x69, 0x82, 0x6d, 0x0b, 0x4d, 0x4d, 0x48, 0x48, 0x4d, 0x4c, 0x4c,
+	0x6d, 0x4d, 0x28, 0x48, 0x49, 0x82, 0x48, 0x00, 0x28, 0x8e, 0xff, 0x05, 0xda, 0x8d, 0x89, 0x89,
+	0x8d, 0x8d, 0x88, 0xad, 0x85, 0x89, 0x0a, 0x8d, 0x8d, 0xad, 0xd2, 0xcd, 0xad, 0xd2, 0xd2, 0xf6,
+	0xd6, 0xf2, 0x82, 0xd2, 0x01, 0xd1, 0xd1, 0x84, 0xd2, 0x87, 0xd1, 0x08, 0xb1, 0xb1, 0xad, 0xad,
+	0xb1, 0xb2, 0xb2, 0xd6, 0xd6, 0x82, 0xb6, 0x02, 0xb1, 0x91, 0x91, 0x82, 0x6d, 0x82, 0x49, 0x06,
+	0x48, 0x49, 0x6d, 0x4c, 0x4c, 0x6d, 0x4d, 0x86, 0x48, 0x01, 0xba, 0xdb, 0x8d, 0xff, 0x04, 0xb2,
+	0x69, 0x89, 0x8d, 0x8d, 0x88, 0xad, 0x04, 0x89, 0x89, 0x68, 0x68, 0x89, 0x82, 0xad, 0x10, 0xd2,
+	0xad, 0x8d, 0x8d, 0xd2, 0xf6, 0xf6, 0xf2, 0xf6, 0xd2, 0x69, 0x8d, 0xd2, 0xd1, 0xd1, 0xd2, 0xd2,
+	0x89, 0xd1, 0x06, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xb6, 0xb2, 0x82, 0xb6, 0x10, 0xd6, 0xd6, 0xb6,
+	0xb6, 0xb2, 0x91, 0x6d, 0x6d, 0x69, 0x6d, 0x6d, 0x49, 0x69, 0x6d, 0x48, 0x6d, 0x4d, 0x87, 0x48,
+	0x04, 0xbb, 0xba, 0xbb, 0xdb, 0xdb, 0x8a, 0xff, 0x04, 0xda, 0x6d, 0x89, 0x8d, 0x8d, 0x87, 0xad,
+	0x03, 0x8d, 0x89, 0x89, 0x69, 0x82, 0x44, 0x02, 0x69, 0x8d, 0x44, 0x82, 0x00, 0x0e, 0x20, 0x69,
+	0xb1, 0xd6, 0xf6, 0xf6, 0xad, 0x20, 0xb2, 0xd2, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0x88, 0xd1, 0x82,
+	0xad, 0x02, 0xb1, 0xd6, 0xd6, 0x84, 0xb6, 0x08, 0xd6, 0xd6, 0xb6, 0xb6, 0xb1, 0x8d, 0x91, 0x91,
+	0x8d, 0x85, 0x6d, 0x86, 0x48, 0x00, 0x4d, 0x83, 0xbb, 0x84, 0xdb, 0x00, 0xfb, 0x86, 0xff, 0x01,
+	0xb2, 0x68, 0x82, 0x8d, 0x86, 0xad, 0x03, 0x89, 0x89, 0x68, 0x20, 0x8b, 0x00, 0x06, 0x44, 0x8d,
+	0xd6, 0x8d, 0x00, 0xb1, 0xd6, 0x82, 0xd1, 0x82, 0xd2, 0x87, 0xd1, 0x00, 0xb1, 0x82, 0xad, 0x04,
+	0xd6, 0xda, 0xda, 0xd6, 0xd6, 0x83, 0xb6, 0x01, 0xd6, 0xd6, 0x82, 0xb6, 0x04, 0xd6, 0xb6, 0xb1,
+	0x91, 0x91, 0x82, 0x6d, 0x03, 0x48, 0x4c, 0x4d, 0x4c, 0x83, 0x48, 0x01, 0x96, 0x9a, 0x82, 0xbb,
+	0x85, 0xdb, 0x82, 0xff, 0x07, 0xfb, 0xfb, 0xff, 0xfb, 0x8d, 0x89, 0x89, 0x8d, 0x82, 0xad, 0x05,
+	0x68, 0x64, 0xad, 0xad, 0x8d, 0x44, 0x8f, 0x00, 0x05, 0x20, 0x00, 0x00, 0xb2, 0xd6, 0xd2, 0x82,
+	0xd1, 0x00, 0xd2, 0x87, 0xd1, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x01, 0xda, 0xfa, 0x84, 0xda, 0x01,
+	0xd6, 0xd6, 0x84, 0xb6, 0x0c, 0xd6, 0xda, 0xd6, 0xb6, 0xb6, 0x8d, 0x6d, 0x69, 0x48, 0x6d, 0x6d,
+	0x4d, 0x4d, 0x82, 0x48, 0x00, 0x9b, 0x82, 0x96, 0x04, 0x9a, 0xba, 0xba, 0xbb, 0xbb, 0x86, 0xdb,
+	0x05, 0xfb, 0xff, 0xb1, 0x68, 0x89, 0x89, 0x82, 0xad, 0x04, 0x20, 0x48, 0xb1, 0x8d, 0x44, 0x92,
+	0x00, 0x00, 0x69, 0x82, 0xd2, 0x8a, 0xd1, 0x01, 0xb1, 0xb1, 0x83, 0xad, 0x02, 0xd6, 0xda, 0xda,
+	0x83, 0xfb, 0x82, 0xda, 0x04, 0xd6, 0xb6, 0x92, 0x91, 0xb6, 0x83, 0xd6, 0x00, 0xb1, 0x82, 0x8d,
+	0x82, 0x6d, 0x03, 0x4d, 0x48, 0x48, 0x4c, 0x00, 0xbb, 0x83, 0x9b, 0x00, 0x9a, 0x82, 0x96, 0x03,
+	0x9a, 0xbb, 0xba, 0xbb, 0x83, 0xdb, 0x04, 0xfb, 0xd6, 0x69, 0x89, 0x8d, 0x82, 0xad, 0x03, 0x24,
+	0x00, 0x69, 0x20, 0x86, 0x00, 0x04, 0x20, 0x8d, 0x89, 0x44, 0x20, 0x85, 0x00, 0x05, 0x24, 0x89,
+	0xb2, 0xb1, 0xd2, 0xd2, 0x8a, 0xd1, 0x01, 0xb1, 0xb1, 0x83, 0xad, 0x02, 0xd6, 0xfa, 0xda, 0x83,
+	0xfb, 0x06, 0xda, 0xda, 0xfa, 0xda, 0xda, 0xd6, 0xd6, 0x83, 0xb6, 0x00, 0xd6, 0x84, 0xb6, 0x05,
+	0x91, 0x6d, 0x6d, 0x48, 0x48, 0x4d, 0x03, 0x96, 0x96, 0x9b, 0x9a, 0x88, 0x96, 0x07, 0xba, 0xbb,
+	0xbb, 0xdb, 0xdb, 0xd6, 0x69, 0x89, 0x82, 0x8d, 0x01, 0xad, 0x69, 0x88, 0x00, 0x0d, 0x69, 0xad,
+	0xd1, 0xd1, 0xd2, 0xcd, 0xad, 0x8d, 0x89, 0x68, 0x69, 0x8d, 0xb2, 0xd2, 0x82, 0xb1, 0x01, 0xd1,
+	0xb1, 0x89, 0xd1, 0x85, 0xad, 0x04, 0xb2, 0xff, 0xfb, 0xfa, 0xfa, 0x82, 0xda, 0x01, 0xd6, 0xda,
+	0x83, 0xfb, 0x02, 0xda, 0xd6, 0xd6, 0x83, 0xb6, 0x83, 0xd6, 0x01, 0xb6, 0x8d, 0x82, 0x6d, 0x01,
+	0x72, 0x76, 0x83, 0x96, 0x00, 0x76, 0x85, 0x96, 0x09, 0x9a, 0x96, 0xba, 0xbb, 0xbb, 0xdb, 0x8d,
+	0x69, 0x8d, 0x8d, 0x82, 0xad, 0x01, 0x69, 0x20, 0x83, 0x00, 0x03, 0x20, 0x44, 0x69, 0xad, 0x82,
+	0xcd, 0x85, 0xad, 0x02, 0xcd, 0xd2, 0xb1, 0x84, 0xad, 0x01, 0xb1, 0xb1, 0x87, 0xd1, 0x00, 0xb1,
+	0x82, 0xad, 0x0d, 0x8d, 0xad, 0xb1, 0x69, 0x92, 0xff, 0xfb, 0xfa, 0xda, 0xda, 0xd6, 0xb6, 0xb6,
+	0xda, 0x82, 0xfa, 0x07, 0xda, 0xda, 0xfa, 0xfa, 0xda, 0xd6, 0xb6, 0xb6, 0x82, 0xd6, 0x04, 0xb6,
+	0xb6, 0xb2, 0xb2, 0x91, 0x02, 0x72, 0x72, 0x76, 0x84, 0x96, 0x02, 0x9a, 0x9b, 0x9b, 0x83, 0x9a,
+	0x07, 0x96, 0x96, 0xba, 0xbb, 0x91, 0x68, 0x89, 0x8d, 0x83, 0xad, 0x04, 0x89, 0x69, 0x68, 0x64,
+	0x69, 0x84, 0x89, 0x85, 0xa9, 0x82, 0x89, 0x03, 0x88, 0x88, 0x89, 0x8d, 0x82, 0xad, 0x00, 0xb1,
+	0x88, 0xd1, 0x83, 0xad, 0x06, 0x8d, 0xad, 0xb1, 0x69, 0x24, 0x92, 0xff, 0x82, 0xfb, 0x02, 0xfa,
+	0xda, 0xd6, 0x82, 0xda, 0x83, 0xd6, 0x01, 0xda, 0xfa, 0x84, 0xda, 0x05, 0xd6, 0xb6, 0xd6, 0xd6,
+	0xb6, 0xb6, 0x85, 0x72, 0x82, 0x76, 0x01, 0x9a, 0x9b, 0x85, 0xbb, 0x08, 0x9a, 0xba, 0x92, 0x68,
+	0x89, 0x89, 0x8d, 0xad, 0xad, 0x83, 0x8d, 0x82, 0x89, 0x01, 0x65, 0x84, 0x82, 0x89, 0x82, 0xa9,
+	0x83, 0x89, 0x08, 0xa9, 0xa9, 0xad, 0xad, 0xd1, 0xd1, 0xb1, 0xad, 0xb1, 0x87, 0xd1, 0x00, 0xb1,
+	0x83, 0xad, 0x06, 0x8d, 0xad, 0xb1, 0x6d, 0x24, 0x24, 0xb6, 0x84, 0xff, 0x0e, 0xfb, 0xfb, 0xda,
+	0xda, 0xd6, 0xd6, 0xb6, 0xb6, 0xb5, 0xb6, 0xd6, 0xda, 0xfa, 0xfb, 0xfb, 0x82, 0xda, 0x02, 0xd6,
+	0xb6, 0xb6, 0x82, 0x96, 0x83, 0x72, 0x07, 0x52, 0x52, 0x72, 0x76, 0x76, 0x9a, 0x9b, 0x9b, 0x83,
+	0xbb, 0x0b, 0xb6, 0x69, 0x68, 0x89, 0x8d, 0x8d, 0xad, 0x8d, 0x89, 0x8d, 0x89, 0x68, 0x84, 0x64,
+	0x06, 0x84, 0x84, 0x85, 0x89, 0xa9, 0xad, 0xcd, 0x87, 0xd2, 0x88, 0xd1, 0x01, 0xb1, 0xb1, 0x83,
+	0xad, 0x0a, 0x8d, 0xad, 0xad, 0xb1, 0x8d, 0x24, 0x24, 0x49, 0x92, 0xb6, 0xdb, 0x83, 0xff, 0x04,
+	0xfb, 0xda, 0xda, 0xd6, 0xd6, 0x84, 0xb6, 0x02, 0xd6, 0xda, 0xda, 0x82, 0xfb, 0x02, 0xda, 0xda,
+	0xd6, 0x06, 0x97, 0xbb, 0x96, 0x96, 0x9b, 0x96, 0x96, 0x85, 0x76, 0x03, 0x96, 0x9a, 0x9a, 0x9b,
+	0x82, 0xbb, 0x06, 0x8d, 0x68, 0x89, 0x89, 0x8d, 0xad, 0xad, 0x82, 0x8d, 0x01, 0x89, 0x68, 0x82,
+	0x64, 0x05, 0x89, 0x89, 0xa9, 0xcd, 0xce, 0xce, 0x88, 0xd2, 0x85, 0xd1, 0x84, 0xb1, 0x84, 0xad,
+	0x11, 0x8d, 0xad, 0xad, 0xb1, 0x8d, 0x24, 0x25, 0x25, 0x29, 0x49, 0x49, 0x6d, 0x92, 0xfb, 0xff,
+	0xff, 0xfb, 0xfa, 0x82, 0xda, 0x82, 0xd6, 0x01, 0xb6, 0xb6, 0x82, 0xd6, 0x00, 0xda, 0x83, 0xfb,
+	0x00, 0x76, 0x89, 0x96, 0x0f, 0x76, 0x76, 0x96, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0xbb, 0xb6, 0x68,
+	0x89, 0x89, 0x8d, 0xad, 0xad, 0x82, 0x8d, 0x85, 0x89, 0x02, 0xa9, 0xad, 0xce, 0x86, 0xd2, 0x88,
+	0xd1, 0x85, 0xb1, 0x83, 0xad, 0x0f, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xad, 0x45, 0x24, 0x25, 0x25,
+	0x49, 0x49, 0x29, 0x25, 0x49, 0xb6, 0x82, 0xff, 0x82, 0xfb, 0x00, 0xfa, 0x85, 0xda, 0x02, 0xd6,
+	0xda, 0xda, 0x82, 0xfb, 0x02, 0x72, 0x72, 0x76, 0x82, 0x72, 0x00, 0x76, 0x82, 0x96, 0x84, 0x76,
+	0x0b, 0x96, 0x9a, 0x9b, 0x9b, 0xbb, 0xbb, 0x6d, 0x68, 0x89, 0x89, 0x8d, 0xad, 0x82, 0x8d, 0x85,
+	0x89, 0x02, 0xa9, 0xad, 0xce, 0x84, 0xd2, 0x89, 0xd1, 0x01, 0xb1, 0xd1, 0x83, 0xb1, 0x83, 0xad,
+	0x01, 0x8d, 0x8d, 0x82, 0xad, 0x03, 0xb1, 0xb1, 0x49, 0x20, 0x82, 0x25, 0x06, 0x49, 0x49, 0x29,
+	0x25, 0x25, 0x6d, 0xdb, 0x85, 0xff, 0x0a, 0xfb, 0xfb, 0xfa, 0xfa, 0xda, 0xda, 0xfa, 0xd6, 0xda,
+	0xda, 0xd6, 0x8c, 0x96, 0x84, 0x76, 0x06, 0x96, 0x9a, 0xbb, 0x92, 0x68, 0x68, 0x89, 0x84, 0x8d,
+	0x84, 0x89, 0x00, 0xa9, 0x82, 0xad, 0x01, 0xd2, 0xd2, 0x85, 0xcd, 0x88, 0xd1, 0x82, 0xb1, 0x83,
+	0xad, 0x82, 0x8d, 0x01, 0xad, 0xad, 0x82, 0xb1, 0x01, 0x69, 0x20, 0x82, 0x25, 0x02, 0x29, 0x49,
+	0x29, 0x82, 0x25, 0x02, 0x29, 0x6d, 0xb6, 0x86, 0xff, 0x03, 0xfb, 0xfa, 0xda, 0xda, 0x83, 0xd6,
+	0x02, 0x76, 0x72, 0x72, 0x83, 0x76, 0x02, 0x96, 0x97, 0x97, 0x84, 0x9b, 0x82, 0x96, 0x07, 0x76,
+	0x96, 0x96, 0x49, 0x44, 0x68, 0x88, 0x89, 0x82, 0x8d, 0x87, 0x89, 0x01, 0xad, 0xa9, 0x87, 0xad,
+	0x88, 0xd1, 0x01, 0xb1, 0xb1, 0x83, 0xad, 0x82, 0x8d, 0x01, 0xad, 0xad, 0x83, 0xb1, 0x01, 0x8d,
+	0x20, 0x83, 0x25, 0x84, 0x29, 0x82, 0x25, 0x01, 0x6d, 0xb6, 0x85, 0xff, 0x84, 0xfb, 0x01, 0xfa,
+	0xfa, 0x82, 0x96, 0x84, 0x72, 0x82, 0x76, 0x01, 0x96, 0x96, 0x86, 0x9b, 0x0a, 0x6e, 0x00, 0x44,
+	0x68, 0x68, 0x88, 0x89, 0x8d, 0x8d, 0x89, 0x88, 0x82, 0x89, 0x00, 0x88, 0x87, 0x89, 0x82, 0xad,
+	0x89, 0xd1, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x83, 0x8d, 0x08, 0xad, 0xb1, 0xb1, 0xd1, 0xb1, 0xad,
+	0x8d, 0x24, 0x24, 0x83, 0x25, 0x83, 0x29, 0x84, 0x25, 0x01, 0x49, 0xb6, 0x89, 0xff, 0x00, 0xfb,
+	0x00, 0x97, 0x82, 0x9b, 0x82, 0x96, 0x8a, 0x76, 0x04, 0x96, 0x96, 0x04, 0x00, 0x24, 0x82, 0x68,
+	0x00, 0x88, 0x82, 0x89, 0x01, 0x88, 0x88, 0x85, 0x89, 0x82, 0x8d, 0x82, 0xad, 0x82, 0xd1, 0x84,
+	0xd2, 0x82, 0xd1, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x83, 0x8d, 0x00, 0xad, 0x82, 0xb1, 0x05, 0xd1,
+	0xb1, 0xad, 0x8d, 0x24, 0x24, 0x83, 0x25, 0x83, 0x29, 0x85, 0x25, 0x02, 0x24, 0x49, 0xb6, 0x86,
+	0xff, 0x01, 0xfb, 0xfb, 0x82, 0x96, 0x06, 0x9b, 0x9b, 0x96, 0x96, 0x9b, 0x96, 0x76, 0x82, 0x96,
+	0x01, 0x76, 0x76, 0x82, 0x96, 0x05, 0x72, 0x29, 0x00, 0x00, 0x24, 0x69, 0x82, 0x68, 0x03, 0x88,
+	0x89, 0x89, 0x88, 0x83, 0x89, 0x02, 0x8d, 0xad, 0x8d, 0x82, 0xad, 0x01, 0xb1, 0xd1, 0x88, 0xd2,
+	0x01, 0xd1, 0xd1, 0x82, 0xb1, 0x10, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0xad, 0xb1, 0xb1,
+	0xd1, 0xd1, 0xb1, 0xb1, 0xad, 0x44, 0x20, 0x90, 0x25, 0x01, 0x6d, 0xb6, 0x85, 0xff, 0x00, 0xfa,
+	0x03, 0x76, 0x96, 0x96, 0x76, 0x85, 0x96, 0x00, 0x76, 0x84, 0x96, 0x07, 0x97, 0x72, 0x29, 0x04,
+	0x00, 0x00, 0x20, 0x69, 0x83, 0x68, 0x05, 0x88, 0x89, 0x88, 0x89, 0x89, 0x8d, 0x86, 0xad, 0x00,
+	0xd1, 0x89, 0xd2, 0x00, 0xd1, 0x82, 0xb1, 0x07, 0xad, 0xad, 0x8d, 0x8d, 0x89, 0x8d, 0x8d, 0xad,
+	0x83, 0xb1, 0x00, 0xd1, 0x82, 0xb1, 0x01, 0x44, 0x20, 0x92, 0x25, 0x02, 0x6d, 0x96, 0xdb, 0x83,
+	0xff, 0x83, 0x96, 0x00, 0x76, 0x85, 0x96, 0x07, 0x76, 0x72, 0x96, 0x96, 0x72, 0x29, 0x25, 0x24,
+	0x82, 0x00, 0x01, 0x20, 0x69, 0x84, 0x68, 0x03, 0x88, 0x88, 0x89, 0x8d, 0x82, 0xad, 0x01, 0xa9,
+	0x89, 0x82, 0xad, 0x8a, 0xd2, 0x03, 0xd1, 0xb1, 0xad, 0xad, 0x82, 0x8d, 0x03, 0x89, 0x8d, 0x8d,
+	0xad, 0x83, 0xb1, 0x01, 0xd1, 0xd1, 0x82, 0xb1, 0x01, 0x49, 0x00, 0x94, 0x25, 0x04, 0x49, 0x92,
+	0xb6, 0xff, 0xff, 0x8a, 0x96, 0x06, 0x97, 0x97, 0x92, 0x4d, 0x05, 0x25, 0x25, 0x83, 0x00, 0x03,
+	0x20, 0x68, 0x89, 0x88, 0x83, 0x68, 0x00, 0x88, 0x82, 0x89, 0x02, 0xad, 0xad, 0x89, 0x82, 0xad,
+	0x01, 0xd1, 0xd1, 0x87, 0xd2, 0x82, 0xd1, 0x09, 0xb1, 0xad, 0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d,
+	0xad, 0xad, 0x83, 0xb1, 0x01, 0xd1, 0xd1, 0x82, 0xb1, 0x01, 0x49, 0x00, 0x90, 0x25, 0x01, 0x05,
+	0x05, 0x82, 0x25, 0x03, 0x29, 0x49, 0x6e, 0x96, 0x8b, 0x96, 0x05, 0x4e, 0x25, 0x05, 0x25, 0x29,
+	0x24, 0x83, 0x00, 0x08, 0x24, 0x68, 0x89, 0x89, 0x68, 0x68, 0x64, 0x68, 0x68, 0x82, 0x89, 0x02,
+	0x8d, 0x89, 0x89, 0x82, 0xad, 0x01, 0xd1, 0xd1, 0x86, 0xd2, 0x0a, 0xd1, 0xd1, 0xb1, 0xb1, 0xad,
+	0x8d, 0x8d, 0x89, 0x89, 0x8d, 0x8d, 0x83, 0xad, 0x82, 0xb1, 0x01, 0xd1, 0xd1, 0x82, 0xb1, 0x02,
+	0x49, 0x00, 0x24, 0x95, 0x25, 0x02, 0x29, 0x29, 0x49, 0x86, 0x96, 0x06, 0x76, 0x96, 0x96, 0x4d,
+	0x25, 0x04, 0x04, 0x82, 0x25, 0x00, 0x04, 0x83, 0x00, 0x01, 0x24, 0x68, 0x82, 0x89, 0x04, 0x88,
+	0x64, 0x64, 0x68, 0x88, 0x84, 0x89, 0x82, 0xad, 0x01, 0xd1, 0xd1, 0x85, 0xd2, 0x08, 0xd1, 0xd1,
+	0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x89, 0x89, 0x83, 0x8d, 0x82, 0xad, 0x01, 0xb1, 0xb1, 0x82, 0xd1,
+	0x82, 0xb1, 0x02, 0x49, 0x20, 0x24, 0x90, 0x25, 0x00, 0x05, 0x82, 0x25, 0x03, 0x05, 0x05, 0x25,
+	0x29, 0x87, 0x96, 0x02, 0x4e, 0x25, 0x00, 0x83, 0x04, 0x01, 0x25, 0x24, 0x84, 0x00, 0x01, 0x24,
+	0x68, 0x83, 0x89, 0x04, 0x88, 0x64, 0x64, 0x68, 0x88, 0x83, 0x89, 0x83, 0xad, 0x0d, 0xb1, 0xd1,
+	0xd2, 0xd2, 0xd1, 0xb1, 0xd1, 0xb1, 0xad, 0xb1, 0xad, 0x8d, 0x89, 0x89, 0x82, 0x8d, 0x85, 0xad,
+	0x04, 0xb1, 0xb1, 0xd1, 0xb1, 0xad, 0x82, 0xb1, 0x02, 0x49, 0x20, 0x24, 0x91, 0x25, 0x00, 0x05,
+	0x82, 0x25, 0x02, 0x05, 0x05, 0x25, 0x85, 0x96, 0x0a, 0x92, 0x29, 0x00, 0x00, 0x25, 0x04, 0x04,
+	0x24, 0x04, 0x24, 0x04, 0x84, 0x00, 0x0c, 0x24, 0x68, 0x89, 0x89, 0x8d, 0x89, 0x89, 0x68, 0x64,
+	0x64, 0x68, 0x88, 0x89, 0x82, 0x8d, 0x83, 0xad, 0x82, 0xb1, 0x02, 0xad, 0xad, 0xb1, 0x82, 0xad,
+	0x02, 0x8d, 0x89, 0x89, 0x82, 0x8d, 0x85, 0xad, 0x82, 0xb1, 0x00, 0xd1, 0x84, 0xb1, 0x02, 0x44,
+	0x20, 0x24, 0x8f, 0x25, 0x03, 0x05, 0x29, 0x25, 0x05, 0x84, 0x25, 0x84, 0x96, 0x05, 0x4e, 0x25,
+	0x00, 0x00, 0x25, 0x24, 0x85, 0x04, 0x84, 0x00, 0x01, 0x24, 0x68, 0x85, 0x89, 0x05, 0x68, 0x68,
+	0x64, 0x68, 0x89, 0x89, 0x83, 0x8d, 0x88, 0xad, 0x00, 0x8d, 0x82, 0x89, 0x82, 0x8d, 0x84, 0xad,
+	0x84, 0xb1, 0x00, 0xd1, 0x83, 0xb1, 0x03, 0xad, 0x44, 0x20, 0x24, 0x89, 0x25, 0x00, 0x05, 0x84,
+	0x25, 0x04, 0x05, 0x25, 0x29, 0x05, 0x05, 0x82, 0x25, 0x00, 0x05, 0x08, 0x97, 0x96, 0x72, 0x4d,
+	0x29, 0x00, 0x00, 0x04, 0x05, 0x86, 0x04, 0x85, 0x00, 0x02, 0x44, 0x64, 0x69, 0x85, 0x89, 0x83,
+	0x68, 0x00, 0x89, 0x84, 0x8d, 0x84, 0xad, 0x82, 0x8d, 0x82, 0x89, 0x82, 0x8d, 0x87, 0xad, 0x82,
+	0xb1, 0x00, 0xd1, 0x82, 0xb1, 0x04, 0xad, 0x8d, 0x24, 0x20, 0x24, 0x87, 0x25, 0x00, 0x05, 0x86,
+	0x25, 0x04, 0x05, 0x05, 0x29, 0x25, 0x04, 0x83, 0x25, 0x0a, 0x4e, 0x29, 0x05, 0x05, 0x00, 0x00,
+	0x04, 0x05, 0x04, 0x00, 0x00, 0x83, 0x04, 0x86, 0x00, 0x02, 0x44, 0x64, 0x68, 0x82, 0x89, 0x03,
+	0x8d, 0x8d, 0x89, 0x89, 0x83, 0x68, 0x82, 0x89, 0x86, 0x8d, 0x83, 0x89, 0x01, 0x8d, 0x8d, 0x82,
+	0xad, 0x82, 0xb1, 0x06, 0xad, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0xd1, 0x84, 0xb1, 0x04, 0xad, 0x8d,
+	0x24, 0x20, 0x24, 0x84, 0x25, 0x83, 0x05, 0x85, 0x25, 0x04, 0x05, 0x05, 0x25, 0x29, 0x25, 0x84,
+	0x05, 0x82, 0x05, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x8b, 0x00, 0x04, 0x44, 0x64,
+	0x68, 0x89, 0x89, 0x83, 0x8d, 0x01, 0x89, 0x89, 0x84, 0x68, 0x01, 0x69, 0x69, 0x83, 0x89, 0x00,
+	0x69, 0x82, 0x89, 0x01, 0x8d, 0x8d, 0x82, 0xad, 0x86, 0xb1, 0x04, 0xad, 0xad, 0xb1, 0xad, 0xd1,
+	0x83, 0xb1, 0x05, 0xad, 0xad, 0x8d, 0x24, 0x20, 0x24, 0x84, 0x25, 0x82, 0x05, 0x83, 0x25, 0x08,
+	0x05, 0x05, 0x25, 0x05, 0x05, 0x25, 0x25, 0x05, 0x04, 0x83, 0x05, 0x03, 0x05, 0x05, 0x00, 0x00,
+	0x84, 0x04, 0x8c, 0x00, 0x04, 0x44, 0x64, 0x68, 0x89, 0x89, 0x84, 0x8d, 0x01, 0x89, 0x69, 0x82,
+	0x68, 0x82, 0x69, 0x82, 0x68, 0x82, 0x89, 0x82, 0x8d, 0x00, 0xad, 0x85, 0xb1, 0x01, 0xad, 0xb1,
+	0x84, 0xad, 0x85, 0xb1, 0x06, 0xad, 0xad, 0x8d, 0x24, 0x20, 0x24, 0x05, 0x83, 0x25, 0x82, 0x05,
+	0x84, 0x25, 0x82, 0x05, 0x05, 0x25, 0x25, 0x04, 0x00, 0x04, 0x04, 0x82, 0x05, 0x02, 0x05, 0x00,
+	0x00, 0x85, 0x04, 0x02, 0x00, 0x00, 0x04, 0x89, 0x00, 0x05, 0x44, 0x64, 0x64, 0x69, 0x89, 0x89,
+	0x82, 0x8d, 0x82, 0x89, 0x82, 0x68, 0x04, 0x69, 0x69, 0x8d, 0x89, 0x89, 0x83, 0x8d, 0x01, 0xad,
+	0xad, 0x88, 0xb1, 0x84, 0xad, 0x05, 0xb1, 0xd1, 0xad, 0xad, 0xb1, 0xb1, 0x82, 0xad, 0x04, 0x8d,
+	0x24, 0x00, 0x04, 0x05, 0x84, 0x25, 0x01, 0x05, 0x05, 0x82, 0x25, 0x06, 0x05, 0x25, 0x25, 0x05,
+	0x25, 0x25, 0x04, 0x82, 0x00, 0x03, 0x04, 0x04, 0x05, 0x04, 0x01, 0x04, 0x00, 0x83, 0x04, 0x03,
+	0x00, 0x00, 0x04, 0x04, 0x8b, 0x00, 0x05, 0x24, 0x68, 0x64, 0x68, 0x89, 0x89, 0x84, 0x8d, 0x05,
+	0x89, 0x89, 0x68, 0x68, 0x69, 0x69, 0x84, 0x8d, 0x00, 0xad, 0x8b, 0xb1, 0x88, 0xad, 0x00, 0xb1,
+	0x83, 0xad, 0x04, 0x69, 0x24, 0x00, 0x24, 0x05, 0x84, 0x25, 0x82, 0x05, 0x07, 0x25, 0x05, 0x05,
+	0x25, 0x05, 0x05, 0x25, 0x05, 0x83, 0x00, 0x83, 0x04, 0x82, 0x04, 0x83, 0x00, 0x82, 0x04, 0x8b,
+	0x00, 0x03, 0x20, 0x69, 0x44, 0x68, 0x82, 0x89, 0x84, 0x8d, 0x05, 0x89, 0x89, 0x68, 0x68, 0x69,
+	0x89, 0x82, 0x8d, 0x01, 0xad, 0xad, 0x8b, 0xb1, 0x87, 0xad, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x06,
+	0x8d, 0x69, 0x24, 0x20, 0x04, 0x05, 0x05, 0x85, 0x25, 0x00, 0x05, 0x82, 0x25, 0x82, 0x05, 0x00,
+	0x25, 0x84, 0x00, 0x83, 0x04, 0x00, 0x04, 0x86, 0x00, 0x01, 0x04, 0x04, 0x8b, 0x00, 0x06, 0x20,
+	0x49, 0x64, 0x64, 0x69, 0x89, 0x89, 0x85, 0x8d, 0x04, 0x89, 0x69, 0x69, 0x68, 0x69, 0x82, 0x8d,
+	0x01, 0xad, 0xad, 0x82, 0xb1, 0x01, 0xb2, 0xb2, 0x85, 0xb1, 0x86, 0xad, 0x83, 0xb1, 0x82, 0xad,
+	0x05, 0x8d, 0x69, 0x24, 0x20, 0x04, 0x05, 0x86, 0x25, 0x02, 0x05, 0x25, 0x25, 0x82, 0x05, 0x03,
+	0x25, 0x04, 0x00, 0x04, 0x83, 0x00, 0x82, 0x04, 0x87, 0x00, 0x01, 0x04, 0x04, 0x8c, 0x00, 0x03,
+	0x44, 0x68, 0x44, 0x68, 0x83, 0x89, 0x83, 0x8d, 0x0b, 0x89, 0x89, 0x69, 0x68, 0x68, 0x89, 0x8d,
+	0x8d, 0xad, 0xad, 0xb1, 0xb1, 0x82, 0xb2, 0x85, 0xb1, 0x87, 0xad, 0x82, 0xb1, 0x82, 0xad, 0x05,
+	0x8d, 0x68, 0x24, 0x00, 0x04, 0x05, 0x82, 0x25, 0x03, 0x05, 0x25, 0x25, 0x05, 0x82, 0x25, 0x83,
+	0x05, 0x03, 0x00, 0x00, 0x04, 0x04, 0x82, 0x00, 0x82, 0x04, 0x87, 0x00, 0x00, 0x04, 0x8d, 0x00,
+	0x03, 0x44, 0x69, 0x64, 0x68, 0x82, 0x89, 0x85, 0x8d, 0x07, 0x89, 0x89, 0x69, 0x68, 0x69, 0x8d,
+	0x8d, 0xad, 0x83, 0xb1, 0x01, 0xb2, 0xb2, 0x84, 0xb1, 0x87, 0xad, 0x01, 0xb1, 0xb1, 0x84, 0xad,
+	0x06, 0x89, 0x69, 0x44, 0x20, 0x04, 0x05, 0x05, 0x84, 0x25, 0x02, 0x05, 0x25, 0x25, 0x82, 0x05,
+	0x00, 0x25, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x01, 0x04, 0x04, 0x87, 0x00, 0x01, 0x04, 0x04,
+	0x8c, 0x00, 0x06, 0x24, 0x69, 0x68, 0x68, 0x69, 0x89, 0x89, 0x86, 0x8d, 0x07, 0x89, 0x69, 0x68,
+	0x68, 0x89, 0x8d, 0xad, 0xad, 0x82, 0xb1, 0x00, 0xd2, 0x84, 0xb1, 0x86, 0xad, 0x84, 0xb1, 0x82,
+	0xad, 0x06, 0x8d, 0x89, 0x69, 0x24, 0x00, 0x04, 0x05, 0x87, 0x25, 0x83, 0x05, 0x00, 0x04, 0x83,
+	0x00, 0x00, 0x04, 0x83, 0x00, 0x01, 0x04, 0x04, 0x87, 0x00, 0x00, 0x04, 0x8d, 0x00, 0x06, 0x20,
+	0x69, 0x69, 0x68, 0x69, 0x89, 0x89, 0x87, 0x8d, 0x06, 0x89, 0x69, 0x68, 0x68, 0x89, 0xad, 0xad,
+	0x86, 0xb1, 0x86, 0xad, 0x01, 0xb1, 0xad, 0x83, 0xb1, 0x83, 0xad, 0x06, 0x8d, 0x89, 0x69, 0x24,
+	0x00, 0x24, 0x05, 0x87, 0x25, 0x03, 0x05, 0x05, 0x25, 0x05, 0x84, 0x00, 0x01, 0x04, 0x04, 0x82,
+	0x00, 0x01, 0x04, 0x04, 0x97, 0x00, 0x03, 0x44, 0x69, 0x68, 0x69, 0x82, 0x89, 0x87, 0x8d, 0x05,
+	0x89, 0x89, 0x68, 0x68, 0x8d, 0xad, 0x86, 0xb1, 0x86, 0xad, 0x84, 0xb1, 0x84, 0xad, 0x06, 0x8d,
+	0x89, 0x69, 0x24, 0x00, 0x24, 0x05, 0x85, 0x25, 0x82, 0x05, 0x02, 0x25, 0x25, 0x04, 0x84, 0x00,
+	0x82, 0x04, 0x82, 0x00, 0x00, 0x04, 0x00, 0x04, 0x86, 0x00, 0x82, 0x04, 0x8c, 0x00, 0x00, 0x44,
+	0x83, 0x69, 0x82, 0x89, 0x87, 0x8d, 0x05, 0x89, 0x89, 0x68, 0x68, 0x8d, 0xad, 0x83, 0xb1, 0x87,
+	0xad, 0x84, 0xb1, 0x84, 0xad, 0x09, 0x8d, 0x8d, 0x89, 0x49, 0x24, 0x00, 0x24, 0x25, 0x25, 0x05,
+	0x84, 0x25, 0x02, 0x05, 0x25, 0x25, 0x86, 0x00, 0x02, 0x04, 0x05, 0x05, 0x82, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x86, 0x00, 0x01, 0x04, 0x04, 0x8d, 0x00, 0x00, 0x24, 0x84, 0x69, 0x01, 0x89, 0x89,
+	0x88, 0x8d, 0x06, 0x89, 0x89, 0x68, 0x89, 0x8d, 0xad, 0xb1, 0x89, 0xad, 0x83, 0xb1, 0x85, 0xad,
+	0x06, 0x8d, 0x89, 0x69, 0x44, 0x20, 0x00, 0x04, 0x83, 0x05, 0x85, 0x25, 0x87, 0x00, 0x02, 0x04,
+	0x05, 0x05, 0x83, 0x00, 0x87, 0x00, 0x82, 0x04, 0x8c, 0x00, 0x03, 0x20, 0x49, 0x69, 0x69, 0x84,
+	0x89, 0x88, 0x8d, 0x03, 0x89, 0x89, 0x68, 0x89, 0x83, 0x8d, 0x87, 0xad, 0x03, 0xb1, 0xb1, 0xad,
+	0xb1, 0x85, 0xad, 0x07, 0x8d, 0x89, 0x69, 0x44, 0x20, 0x00, 0x00, 0x05, 0x86, 0x25, 0x00, 0x05,
+	0x88, 0x00, 0x06, 0x04, 0x04, 0x05, 0x04, 0x04, 0x00, 0x00, 0x87, 0x00, 0x83, 0x04, 0x8c, 0x00,
+	0x02, 0x44, 0x69, 0x69, 0x85, 0x89, 0x88, 0x8d, 0x84, 0x89, 0x82, 0x8d, 0x87, 0xad, 0x00, 0xb1,
+	0x87, 0xad, 0x07, 0x8d, 0x89, 0x69, 0x45, 0x24, 0x04, 0x00, 0x05, 0x85, 0x25, 0x85, 0x00, 0x00,
+	0x04, 0x84, 0x00, 0x01, 0x04, 0x05, 0x82, 0x04, 0x00, 0x00, 0x87, 0x00, 0x03, 0x04, 0x00, 0x04,
+	0x04, 0x8c, 0x00, 0x02, 0x24, 0x69, 0x69, 0x86, 0x89, 0x89, 0x8d, 0x01, 0x89, 0x89, 0x82, 0x8d,
+	0x87, 0xad, 0x01, 0xb1, 0xb1, 0x87, 0xad, 0x07, 0x89, 0x89, 0x69, 0x24, 0x00, 0x25, 0x04, 0x05,
+	0x83, 0x25, 0x00, 0x04, 0x86, 0x00, 0x00, 0x04, 0x84, 0x00, 0x05, 0x04, 0x05, 0x04, 0x00, 0x04,
+	0x00, 0x87, 0x00, 0x03, 0x04, 0x00, 0x04, 0x04, 0x8c, 0x00, 0x02, 0x20, 0x69, 0x69, 0x87, 0x89,
+	0x8f, 0x8d, 0x85, 0xad, 0x00, 0xb1, 0x87, 0xad, 0x07, 0x8d, 0x8d, 0x89, 0x69, 0x24, 0x00, 0x25,
+	0x25, 0x82, 0x05, 0x89, 0x00, 0x01, 0x05, 0x04, 0x83, 0x00, 0x02, 0x04, 0x05, 0x05, 0x82, 0x00,
+	0x89, 0x00, 0x82, 0x04, 0x8c, 0x00, 0x00, 0x45, 0x8a, 0x89, 0x8f, 0x8d, 0x8d, 0xad, 0x07, 0x8d,
+	0x8d, 0x69, 0x20, 0x00, 0x04, 0x25, 0x25, 0x83, 0x00, 0x00, 0x04, 0x86, 0x00, 0x01, 0x05, 0x05,
+	0x84, 0x00, 0x01, 0x05, 0x05, 0x82, 0x00, 0x87, 0x00, 0x02, 0x04, 0x00, 0x00, 0x82, 0x04, 0x8b,
+	0x00, 0x01, 0x44, 0x69, 0x8a, 0x89, 0x8f, 0x8d, 0x8b, 0xad, 0x0d, 0xa9, 0x89, 0x8d, 0x45, 0x20,
+	0x00, 0x00, 0x04, 0x25, 0x25, 0x00, 0x00, 0x04, 0x04, 0x85, 0x00, 0x04, 0x04, 0x04, 0x05, 0x00,
+	0x04, 0x82, 0x00, 0x01, 0x04, 0x04, 0x82, 0x00, 0x87, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04,
+	0x8b, 0x00, 0x05, 0x20, 0x69, 0x8d, 0x89, 0x89, 0x8d, 0x87, 0x89, 0x8e, 0x8d, 0x8c, 0xad, 0x01,
+	0x89, 0x69, 0x82, 0x24, 0x01, 0x00, 0x04, 0x82, 0x25, 0x82, 0x05, 0x85, 0x00, 0x04, 0x04, 0x04,
+	0x05, 0x00, 0x04, 0x83, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x96, 0x00, 0x05, 0x04, 0x00, 0x00,
+	0x20, 0x20, 0x69, 0x82, 0x8d, 0x86, 0x89, 0x90, 0x8d, 0x8c, 0xad, 0x02, 0x49, 0x00, 0x00, 0x83,
+	0x04, 0x82, 0x25, 0x02, 0x05, 0x05, 0x04, 0x85, 0x00, 0x02, 0x04, 0x05, 0x04, 0x84, 0x00, 0x82,
+	0x04, 0x00, 0x00, 0x8b, 0x00, 0x01, 0x04, 0x04, 0x87, 0x00, 0x06, 0x04, 0x04, 0x00, 0x00, 0x20,
+	0x20, 0x44, 0x84, 0x8d, 0x85, 0x89, 0x8f, 0x8d, 0x86, 0xad, 0x01, 0xb1, 0xb1, 0x82, 0xad, 0x01,
+	0x8d, 0x44, 0x83, 0x00, 0x02, 0x04, 0x05, 0x05, 0x82, 0x25, 0x03, 0x05, 0x05, 0x04, 0x04, 0x84,
+	0x00, 0x01, 0x05, 0x05, 0x84, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00
 };
 
-const char bitmap_arrow_S[1026] = {
-    0x20, 0x20,
-	   0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,
-	    0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01
-
+const uint8_t bitmap_franc[6955] = {
+	0x09, 0x49, 0x49, 0xb6, 0xb6, 0x49, 0x24, 0x24, 0x25, 0x49, 0x24, 0x85, 0x00, 0x00, 0x24, 0x82,
+	0x69, 0x01, 0x49, 0x49, 0x82, 0x6d, 0x00, 0x8d, 0x83, 0x6d, 0x00, 0x49, 0x83, 0x48, 0x02, 0x91,
+	0xb6, 0xb6, 0x82, 0xd6, 0x04, 0xb6, 0xb2, 0xb6, 0xb6, 0xb2, 0x82, 0xb6, 0x82, 0x92, 0x87, 0xb2,
+	0x95, 0xb6, 0x88, 0x92, 0x02, 0x91, 0x6d, 0x6d, 0x85, 0x92, 0x05, 0x6d, 0x6d, 0x92, 0xb6, 0x49,
+	0x24, 0x82, 0x49, 0x00, 0x24, 0x85, 0x00, 0x00, 0x49, 0x82, 0x6d, 0x03, 0x24, 0x24, 0x28, 0x49,
+	0x82, 0x6d, 0x08, 0x49, 0x49, 0x4d, 0x49, 0x29, 0x28, 0x24, 0x6d, 0xd6, 0x82, 0xdb, 0x01, 0xd6,
+	0xb6, 0x83, 0x92, 0x01, 0x91, 0x91, 0x82, 0xb6, 0x85, 0xb2, 0x83, 0x92, 0x87, 0xb2, 0x83, 0x92,
+	0x89, 0xb6, 0x88, 0x92, 0x02, 0x91, 0x6d, 0x71, 0x85, 0x92, 0x0b, 0xb6, 0x92, 0x92, 0xb6, 0x49,
+	0x24, 0x49, 0x28, 0x24, 0x24, 0x00, 0x00, 0x82, 0x20, 0x04, 0x24, 0x49, 0x71, 0x91, 0x49, 0x88,
+	0x24, 0x82, 0x28, 0x06, 0x24, 0x28, 0x71, 0x92, 0x92, 0x72, 0x6d, 0x85, 0x49, 0x04, 0x6d, 0x91,
+	0xb6, 0xb6, 0xb2, 0x89, 0x92, 0x83, 0xb2, 0x03, 0x92, 0x92, 0xb2, 0xb2, 0x83, 0x92, 0x89, 0xb6,
+	0x88, 0x92, 0x02, 0x91, 0x6d, 0x72, 0x85, 0x92, 0x05, 0xb6, 0xb6, 0x92, 0xb6, 0x49, 0x00, 0x85,
+	0x24, 0x82, 0x44, 0x04, 0x24, 0x48, 0x6d, 0x6d, 0x49, 0x82, 0x48, 0x82, 0x24, 0x06, 0x04, 0x04,
+	0x24, 0x48, 0x48, 0x24, 0x24, 0x82, 0x49, 0x87, 0x24, 0x01, 0x48, 0x49, 0x87, 0x6d, 0x00, 0x91,
+	0x92, 0x92, 0x01, 0xb2, 0xb2, 0x85, 0xb6, 0x88, 0x92, 0x02, 0x71, 0x6d, 0x72, 0x85, 0x92, 0x83,
+	0xb6, 0x05, 0x6d, 0x24, 0x24, 0x48, 0x69, 0x69, 0x85, 0x49, 0x03, 0x4d, 0x6d, 0x91, 0x71, 0x82,
+	0x6d, 0x84, 0x49, 0x09, 0x6d, 0x8d, 0x6d, 0x6d, 0x8d, 0x8d, 0x91, 0x91, 0x8d, 0x6d, 0x89, 0x8d,
+	0x06, 0x6d, 0x24, 0x00, 0x04, 0x24, 0x24, 0x6d, 0x90, 0x92, 0x83, 0xb2, 0x83, 0x92, 0x01, 0xb2,
+	0xb2, 0x88, 0x92, 0x02, 0x71, 0x6d, 0x72, 0x85, 0x92, 0x0a, 0xdb, 0xb6, 0x91, 0xb6, 0x6d, 0x49,
+	0x49, 0x6d, 0x91, 0x6d, 0x6d, 0x82, 0x49, 0x82, 0x48, 0x01, 0x49, 0x4d, 0x82, 0x49, 0x85, 0x24,
+	0x02, 0x92, 0x92, 0x91, 0x85, 0x92, 0x82, 0x91, 0x88, 0x6d, 0x05, 0x49, 0x24, 0x24, 0x49, 0x6d,
+	0x91, 0x96, 0x92, 0x01, 0xb2, 0xb2, 0x8a, 0x92, 0x01, 0x71, 0x6d, 0x84, 0x92, 0x01, 0x96, 0x96,
+	0x03, 0x6d, 0x49, 0x24, 0x48, 0x85, 0x24, 0x91, 0x00, 0x01, 0x72, 0x92, 0x90, 0x6d, 0x01, 0x6e,
+	0x72, 0x83, 0x6d, 0xa5, 0x92, 0x01, 0x71, 0x6d, 0x84, 0x92, 0x01, 0xb6, 0xb7, 0x88, 0x00, 0x00,
+	0x04, 0x8f, 0x24, 0x05, 0x00, 0x24, 0x6e, 0x92, 0x6d, 0x6e, 0x83, 0x6d, 0x88, 0x6e, 0x04, 0x6d,
+	0x6e, 0x6e, 0x72, 0x71, 0x82, 0x6d, 0x00, 0x91, 0x8a, 0x92, 0x01, 0x91, 0x91, 0x85, 0x92, 0x00,
+	0x6e, 0x85, 0x6d, 0x8a, 0x92, 0x01, 0x6d, 0x6d, 0x84, 0x92, 0x01, 0xb6, 0xb7, 0x00, 0x48, 0x85,
+	0x49, 0x89, 0x6d, 0x00, 0x4d, 0x85, 0x49, 0x00, 0x28, 0x82, 0x24, 0x04, 0x6e, 0x92, 0x6d, 0x92,
+	0x92, 0x87, 0x6e, 0x00, 0x72, 0x84, 0x6e, 0x02, 0x92, 0x92, 0x71, 0x82, 0x6d, 0x82, 0x92, 0x01,
+	0x91, 0x91, 0x84, 0x92, 0x01, 0x91, 0x91, 0x86, 0x6d, 0x01, 0x4d, 0x4d, 0x84, 0x49, 0x00, 0x6d,
+	0x8a, 0x92, 0x01, 0x6d, 0x6d, 0x84, 0x92, 0x01, 0xb6, 0xb7, 0x93, 0x6d, 0x00, 0x4d, 0x84, 0x49,
+	0x02, 0x28, 0x24, 0x6d, 0x84, 0x92, 0x04, 0x72, 0x4d, 0x49, 0x49, 0x6e, 0x82, 0x92, 0x06, 0x72,
+	0x49, 0x25, 0x29, 0x6d, 0x72, 0x72, 0x83, 0x91, 0x00, 0x8d, 0x84, 0x6d, 0x08, 0x69, 0x6d, 0x8d,
+	0x92, 0x92, 0x6d, 0x49, 0x49, 0x6d, 0x8a, 0x49, 0x00, 0x4d, 0x8a, 0x92, 0x01, 0x6d, 0x6d, 0x84,
+	0x92, 0x01, 0xb6, 0xb7, 0x92, 0x6d, 0x00, 0x4d, 0x83, 0x49, 0x04, 0x48, 0x48, 0x24, 0x24, 0x6d,
+	0x84, 0x92, 0x05, 0x72, 0x49, 0x04, 0x24, 0x6e, 0x92, 0x82, 0x72, 0x0c, 0x49, 0x24, 0x29, 0x6d,
+	0x6e, 0x72, 0x92, 0x91, 0x8d, 0x69, 0x49, 0x48, 0x69, 0x82, 0x8d, 0x08, 0x6d, 0x6d, 0x69, 0x6d,
+	0x8d, 0x6d, 0x49, 0x49, 0x6d, 0x8a, 0x49, 0x00, 0x6d, 0x8a, 0x92, 0x01, 0x6d, 0x6d, 0x84, 0x92,
+	0x01, 0xb6, 0xb7, 0x8b, 0x6d, 0x00, 0x4d, 0x85, 0x49, 0x87, 0x24, 0x01, 0x00, 0x4d, 0x84, 0x92,
+	0x05, 0x72, 0x6e, 0x4d, 0x4d, 0x72, 0x92, 0x82, 0x72, 0x00, 0x6e, 0x83, 0x6d, 0x01, 0x92, 0x6d,
+	0x82, 0x48, 0x0e, 0x69, 0x68, 0x68, 0x69, 0x6d, 0x68, 0x6d, 0x91, 0x8d, 0x8d, 0x69, 0x48, 0x49,
+	0x4d, 0x6d, 0x87, 0x4d, 0x03, 0x6d, 0x6d, 0x49, 0x6d, 0x8a, 0x92, 0x01, 0x6d, 0x6d, 0x84, 0x92,
+	0x01, 0xb6, 0xb7, 0x02, 0x49, 0x49, 0x28, 0x8f, 0x24, 0x01, 0x00, 0x00, 0x85, 0x24, 0x01, 0x00,
+	0x49, 0x90, 0x92, 0x0b, 0x72, 0x6d, 0x6d, 0x48, 0x69, 0x69, 0x44, 0x69, 0x68, 0x6d, 0x48, 0x69,
+	0x85, 0x8d, 0x02, 0x69, 0x48, 0x69, 0x8a, 0x6d, 0x01, 0x4d, 0x6d, 0x8a, 0x92, 0x01, 0x6d, 0x6d,
+	0x84, 0x92, 0x01, 0xb6, 0xb7, 0x89, 0x00, 0x82, 0x24, 0x02, 0x44, 0x44, 0x24, 0x83, 0x48, 0x02,
+	0x49, 0x6d, 0x6d, 0x83, 0x24, 0x01, 0x00, 0x49, 0x85, 0x92, 0x82, 0x72, 0x85, 0x92, 0x02, 0x72,
+	0x6e, 0x6d, 0x83, 0x8d, 0x0b, 0x6d, 0x68, 0x6d, 0x68, 0x69, 0x69, 0x68, 0x6d, 0x6d, 0x8d, 0x8d,
+	0x68, 0x82, 0x8d, 0x8b, 0x6d, 0x01, 0x4d, 0x6d, 0x89, 0x92, 0x02, 0x91, 0x6d, 0x6d, 0x84, 0x92,
+	0x01, 0xb6, 0xb7, 0x00, 0x00, 0x82, 0x24, 0x05, 0x20, 0x00, 0x24, 0x20, 0x00, 0x24, 0x8a, 0x49,
+	0x02, 0x6d, 0x6d, 0x28, 0x82, 0x24, 0x01, 0x04, 0x49, 0x84, 0x92, 0x05, 0x72, 0x4d, 0x29, 0x25,
+	0x6d, 0x92, 0x82, 0x72, 0x0b, 0x6e, 0x49, 0x25, 0x91, 0xb1, 0x91, 0xb1, 0x8d, 0x6d, 0x8d, 0x6d,
+	0x68, 0x82, 0x8d, 0x01, 0x6d, 0x6d, 0x83, 0x8d, 0x02, 0x68, 0x68, 0x69, 0x8a, 0x6d, 0x01, 0x49,
+	0x6d, 0x89, 0x92, 0x02, 0x91, 0x6d, 0x6d, 0x84, 0x92, 0x01, 0xb7, 0xb7, 0x03, 0x24, 0x6d, 0x91,
+	0x49, 0x85, 0x24, 0x88, 0x49, 0x09, 0x28, 0x28, 0x49, 0x49, 0x28, 0x28, 0x24, 0x24, 0x04, 0x29,
+	0x84, 0x92, 0x13, 0x72, 0x4d, 0x24, 0x25, 0x6d, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x25, 0x4d, 0xdb,
+	0xb6, 0xb6, 0xb2, 0x91, 0x91, 0xb2, 0x91, 0x86, 0x8d, 0x07, 0xad, 0xb1, 0x8d, 0x68, 0x68, 0x44,
+	0x48, 0x8d, 0x88, 0x6d, 0x01, 0x49, 0x6d, 0x89, 0x92, 0x02, 0x71, 0x6d, 0x6d, 0x84, 0x92, 0x01,
+	0xb7, 0xb7, 0x00, 0x04, 0x82, 0x49, 0x85, 0x24, 0x88, 0x49, 0x01, 0x24, 0x24, 0x82, 0x49, 0x00,
+	0x28, 0x83, 0x24, 0x82, 0x72, 0x05, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x82, 0x92, 0x03, 0x72,
+	0x72, 0x6e, 0x6d, 0x82, 0xb6, 0x01, 0xb2, 0xb6, 0x82, 0xd6, 0x02, 0xb6, 0xb2, 0xb2, 0x86, 0xb1,
+	0x82, 0xad, 0x03, 0x8d, 0x44, 0x48, 0x8d, 0x87, 0x6d, 0x01, 0x49, 0x6d, 0x89, 0x92, 0x02, 0x6d,
+	0x6d, 0x71, 0x84, 0x92, 0x01, 0xb7, 0xb7, 0x01, 0x00, 0x48, 0x82, 0x49, 0x04, 0x6d, 0x6d, 0x49,
+	0x24, 0x24, 0x84, 0x49, 0x05, 0x4d, 0x6d, 0x6d, 0x49, 0x28, 0x24, 0x82, 0x49, 0x06, 0x6d, 0x49,
+	0x24, 0x69, 0x69, 0x8d, 0x72, 0x8d, 0x92, 0x09, 0x8d, 0x8d, 0xb6, 0xd6, 0xdb, 0xfb, 0xdb, 0xd6,
+	0xda, 0xb6, 0x82, 0xd6, 0x0a, 0xd2, 0xd2, 0xd6, 0xb1, 0xd1, 0xd1, 0xb1, 0xd1, 0xb1, 0x69, 0x44,
+	0x87, 0x6d, 0x02, 0x4d, 0x49, 0x6d, 0x88, 0x92, 0x03, 0x91, 0x6d, 0x6d, 0x71, 0x83, 0x92, 0x02,
+	0x96, 0xb7, 0xb7, 0x03, 0x00, 0x48, 0x49, 0x49, 0x82, 0x6d, 0x05, 0x49, 0x24, 0x24, 0x49, 0x4d,
+	0x4d, 0x83, 0x6d, 0x0d, 0x4d, 0x49, 0x29, 0x24, 0x49, 0x49, 0x6e, 0xb6, 0x92, 0x69, 0x8d, 0x89,
+	0x6d, 0x6d, 0x8c, 0x92, 0x04, 0x72, 0x6d, 0xd6, 0xdb, 0xfb, 0x82, 0xff, 0x82, 0xfb, 0x03, 0xfa,
+	0xda, 0xfa, 0xfa, 0x83, 0xd6, 0x06, 0xd2, 0xd1, 0xb1, 0xb1, 0x8d, 0x44, 0x48, 0x86, 0x6d, 0x05,
+	0x4d, 0x49, 0x6d, 0x92, 0x92, 0x91, 0x85, 0x92, 0x03, 0x91, 0x6d, 0x6d, 0x71, 0x83, 0x92, 0x02,
+	0xb6, 0xb7, 0xb7, 0x00, 0x00, 0x88, 0x24, 0x01, 0x49, 0x4d, 0x84, 0x6d, 0x0d, 0x49, 0x49, 0x29,
+	0x29, 0x49, 0x4e, 0x72, 0xbb, 0xb6, 0x24, 0x04, 0x00, 0x00, 0x49, 0x88, 0x92, 0x08, 0x72, 0x92,
+	0x92, 0x6e, 0x6d, 0x92, 0xdb, 0xdb, 0xfb, 0x83, 0xff, 0x86, 0xfb, 0x09, 0xfa, 0xd6, 0xd6, 0xd2,
+	0xd2, 0xb1, 0xb1, 0x8d, 0x44, 0x44, 0x86, 0x6d, 0x05, 0x49, 0x49, 0x6d, 0x92, 0x92, 0x91, 0x84,
+	0x92, 0x01, 0x91, 0x91, 0x82, 0x6d, 0x83, 0x92, 0x02, 0x96, 0xb7, 0xb7, 0x00, 0x00, 0x88, 0x24,
+	0x00, 0x48, 0x83, 0x49, 0x04, 0x6d, 0x4d, 0x49, 0x49, 0x28, 0x82, 0x49, 0x07, 0x6e, 0xbb, 0xb6,
+	0x04, 0x24, 0x6d, 0x24, 0x49, 0x89, 0x92, 0x07, 0x72, 0x72, 0x6e, 0x6d, 0x92, 0xdb, 0xdb, 0xfb,
+	0x83, 0xff, 0x86, 0xfb, 0x09, 0xfa, 0xd6, 0xd6, 0xd2, 0xd2, 0xd1, 0xb1, 0x8d, 0x44, 0x44, 0x86,
+	0x6d, 0x02, 0x49, 0x49, 0x6d, 0x89, 0x91, 0x82, 0x6d, 0x00, 0x91, 0x85, 0x92, 0x00, 0x4d, 0x83,
+	0x49, 0x84, 0x24, 0x00, 0x28, 0x8b, 0x49, 0x07, 0x4d, 0xbb, 0xb6, 0x04, 0x4d, 0xbb, 0x49, 0x49,
+	0x89, 0x92, 0x82, 0x72, 0x05, 0x6d, 0x92, 0xdb, 0xdb, 0xfb, 0xfb, 0x82, 0xff, 0x86, 0xfb, 0x09,
+	0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xd1, 0xb1, 0x8d, 0x48, 0x48, 0x86, 0x6d, 0x02, 0x49, 0x49, 0x6d,
+	0x89, 0x91, 0x82, 0x6d, 0x02, 0x71, 0x72, 0x92, 0x83, 0x72, 0x05, 0x91, 0x91, 0x6d, 0x91, 0x91,
+	0x49, 0x83, 0x24, 0x00, 0x49, 0x82, 0x6d, 0x89, 0x49, 0x07, 0x96, 0xb6, 0x04, 0x25, 0x49, 0x04,
+	0x4d, 0x92, 0x82, 0xb6, 0x86, 0x92, 0x07, 0x72, 0x92, 0x6d, 0x8d, 0xdb, 0xdb, 0xfb, 0xfb, 0x82,
+	0xff, 0x86, 0xfb, 0x00, 0xfa, 0x83, 0xd6, 0x05, 0xd1, 0xb1, 0x8d, 0x48, 0x48, 0x69, 0x83, 0x6d,
+	0x00, 0x69, 0x82, 0x49, 0x00, 0x6d, 0x88, 0x91, 0x00, 0x71, 0x82, 0x6d, 0x02, 0x71, 0x72, 0x92,
+	0x83, 0x72, 0x84, 0x91, 0x00, 0x6d, 0x83, 0x24, 0x86, 0x49, 0x00, 0x48, 0x82, 0x49, 0x82, 0x4d,
+	0x0a, 0x96, 0xbb, 0x4d, 0x49, 0x6d, 0x6d, 0xb6, 0xb6, 0xd6, 0xdb, 0xb6, 0x89, 0x92, 0x01, 0x6d,
+	0xd7, 0x82, 0xfb, 0x83, 0xff, 0x84, 0xfb, 0x00, 0xfa, 0x84, 0xd6, 0x03, 0xd2, 0xb1, 0xad, 0x68,
+	0x83, 0x69, 0x83, 0x49, 0x84, 0x6d, 0x00, 0x8d, 0x85, 0x91, 0x83, 0x6d, 0x01, 0x71, 0x71, 0x84,
+	0x72, 0x05, 0xb5, 0x91, 0x91, 0x92, 0x92, 0x91, 0x88, 0x6d, 0x00, 0x91, 0x82, 0x6d, 0x84, 0x92,
+	0x82, 0xb6, 0x00, 0xdb, 0x85, 0xda, 0x00, 0xd6, 0x89, 0x92, 0x03, 0x6d, 0xd6, 0xdb, 0xfb, 0x83,
+	0xff, 0x83, 0xfb, 0x00, 0xdb, 0x86, 0xd6, 0x07, 0xd2, 0xb1, 0xb1, 0x8d, 0x68, 0x69, 0x6d, 0x69,
+	0x84, 0x6d, 0x05, 0x92, 0x6d, 0x6d, 0x4d, 0x6d, 0x6d, 0x84, 0x91, 0x85, 0x6d, 0x00, 0x71, 0x83,
+	0x72, 0x05, 0xb6, 0x91, 0x6d, 0x6e, 0x72, 0x96, 0x8d, 0xb6, 0x00, 0xda, 0x84, 0xb6, 0x0d, 0xda,
+	0xfb, 0xda, 0xda, 0xd6, 0xda, 0xda, 0xb6, 0xb6, 0x92, 0x6d, 0x6d, 0x6e, 0x6e, 0x82, 0x72, 0x04,
+	0x6e, 0x6d, 0x6d, 0xb6, 0xdb, 0x84, 0xff, 0x01, 0xfb, 0xfb, 0x85, 0xd6, 0x0a, 0xb2, 0xb2, 0xd6,
+	0xd6, 0xb1, 0xad, 0xb1, 0x8d, 0x68, 0xad, 0x8d, 0x83, 0x6d, 0x03, 0x49, 0x6d, 0x6d, 0x69, 0x82,
+	0x49, 0x8c, 0x6d, 0x83, 0x72, 0x0c, 0x6d, 0x4d, 0x4d, 0x4e, 0x4d, 0x72, 0xb6, 0xd6, 0xb6, 0xb6,
+	0xd6, 0xb6, 0xb6, 0x82, 0xd6, 0x05, 0xb6, 0xd6, 0xd6, 0xb6, 0xda, 0xfb, 0x8a, 0xda, 0x82, 0xb6,
+	0x01, 0x8d, 0x6d, 0x82, 0x6e, 0x84, 0x6d, 0x04, 0xb6, 0xdb, 0xfb, 0xdb, 0xdb, 0x86, 0xd6, 0x05,
+	0xb2, 0xad, 0xad, 0x8d, 0x8d, 0x91, 0x83, 0xb1, 0x12, 0x8d, 0x8d, 0xa9, 0x89, 0x6d, 0x49, 0x49,
+	0x24, 0x04, 0x00, 0x24, 0x24, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x24, 0x49, 0x8a, 0x6d, 0x01, 0x72,
+	0x72, 0x07, 0x4d, 0x6e, 0x4e, 0x4d, 0x4d, 0x4e, 0xb6, 0xdb, 0x89, 0xda, 0x03, 0xfa, 0xda, 0xd6,
+	0xfb, 0x88, 0xda, 0x84, 0xb6, 0x84, 0x6d, 0x00, 0x6e, 0x83, 0x92, 0x05, 0xb6, 0xdb, 0xdb, 0xfb,
+	0xdb, 0xb6, 0x82, 0xb1, 0x0a, 0xb2, 0xfb, 0xfa, 0xb1, 0xad, 0xad, 0x8d, 0x8e, 0x6d, 0x8d, 0x8d,
+	0x82, 0xb1, 0x06, 0x8d, 0xad, 0xa9, 0x69, 0x48, 0x24, 0x24, 0x82, 0x00, 0x07, 0x24, 0x49, 0x69,
+	0x6d, 0x6d, 0x49, 0x24, 0x48, 0x82, 0x6d, 0x03, 0x49, 0x49, 0x4d, 0x4d, 0x83, 0x6d, 0x01, 0x71,
+	0x71, 0x83, 0x4d, 0x04, 0x4e, 0x4e, 0x72, 0xdb, 0xfb, 0x86, 0xda, 0x0b, 0xd6, 0xb6, 0xd6, 0xd6,
+	0xb6, 0xda, 0xdb, 0xda, 0xda, 0xb6, 0xb6, 0xd6, 0x82, 0xda, 0x84, 0xb6, 0x00, 0x92, 0x83, 0x6d,
+	0x82, 0x92, 0x82, 0xb6, 0x0f, 0xdb, 0xd6, 0xb6, 0x8e, 0x6d, 0x8d, 0xad, 0xb2, 0xd6, 0xff, 0xfb,
+	0xb1, 0xb1, 0xb2, 0xb2, 0xb6, 0x82, 0xb2, 0x09, 0xd2, 0xd2, 0xb1, 0x8d, 0xcd, 0xad, 0x69, 0x49,
+	0x49, 0x24, 0x82, 0x00, 0x02, 0x24, 0x24, 0x49, 0x82, 0x6d, 0x03, 0x49, 0x6d, 0x6d, 0x49, 0x84,
+	0x24, 0x82, 0x49, 0x02, 0x4d, 0x6d, 0x6d, 0x83, 0x4d, 0x04, 0x6d, 0x6e, 0x6e, 0xb6, 0xdb, 0x84,
+	0xda, 0x86, 0xb6, 0x01, 0xd6, 0xd6, 0x83, 0xb6, 0x82, 0xd6, 0x00, 0xda, 0x84, 0xb6, 0x19, 0x92,
+	0x6d, 0x6d, 0x49, 0x49, 0x4d, 0x49, 0x49, 0x8d, 0xd6, 0xb6, 0xdb, 0xb6, 0xb2, 0xb6, 0x92, 0xb2,
+	0xb2, 0xd6, 0xdb, 0xfb, 0xfb, 0xd2, 0xb2, 0xd6, 0xb6, 0x82, 0xb2, 0x03, 0xd6, 0xd6, 0xd2, 0xb1,
+	0x82, 0xad, 0x00, 0x69, 0x82, 0x49, 0x83, 0x00, 0x01, 0x24, 0x49, 0x83, 0x6d, 0x0d, 0x8d, 0x91,
+	0x6d, 0x49, 0x24, 0x24, 0x00, 0x00, 0x04, 0x24, 0x24, 0x49, 0x49, 0x6d, 0x01, 0x4d, 0x4d, 0x83,
+	0x72, 0x06, 0x4e, 0x92, 0xbb, 0xdb, 0xdb, 0xda, 0xda, 0x8b, 0xb6, 0x83, 0xda, 0x01, 0xb6, 0xd6,
+	0x84, 0xb6, 0x0a, 0x91, 0x49, 0x6d, 0x6d, 0x49, 0x25, 0x05, 0x00, 0x69, 0xd2, 0xb6, 0x83, 0xdb,
+	0x02, 0xb6, 0xb2, 0xd6, 0x83, 0xfb, 0x01, 0xd2, 0xd1, 0x86, 0xd6, 0x0a, 0xd2, 0xb1, 0xb1, 0xad,
+	0xad, 0x69, 0x6d, 0x6d, 0x49, 0x24, 0x24, 0x82, 0x00, 0x02, 0x24, 0x49, 0x69, 0x82, 0x6d, 0x83,
+	0x92, 0x05, 0x6d, 0x69, 0x49, 0x24, 0x49, 0x69, 0x82, 0x6d, 0x0a, 0x4d, 0x4d, 0x6e, 0x6d, 0x4d,
+	0x6d, 0x6e, 0x6e, 0xb6, 0xdb, 0xda, 0x86, 0xb6, 0x03, 0xd6, 0xb6, 0xb6, 0xb2, 0x83, 0xb6, 0x01,
+	0xda, 0xda, 0x84, 0xb6, 0x82, 0x92, 0x0d, 0x6d, 0x49, 0x49, 0x6d, 0x6d, 0x49, 0x29, 0x00, 0x44,
+	0xd6, 0xb6, 0xdb, 0xfb, 0xfb, 0x82, 0xdb, 0x01, 0xff, 0xff, 0x82, 0xfb, 0x04, 0xd2, 0xd1, 0xd2,
+	0xd6, 0xf6, 0x82, 0xd6, 0x02, 0xd2, 0xd2, 0xb1, 0x82, 0xad, 0x83, 0x6d, 0x13, 0x49, 0x48, 0x24,
+	0x00, 0x00, 0x24, 0x24, 0x48, 0x49, 0x49, 0x6d, 0x6d, 0x6e, 0x8e, 0x8e, 0x92, 0x92, 0x6e, 0x6d,
+	0x6d, 0x83, 0x92, 0x00, 0x49, 0x83, 0x4d, 0x03, 0x4e, 0x6e, 0x6e, 0x92, 0x82, 0xb6, 0x05, 0x96,
+	0x96, 0x92, 0x92, 0xb6, 0xb6, 0x85, 0x92, 0x83, 0xb6, 0x02, 0x92, 0x92, 0x91, 0x82, 0x6d, 0x02,
+	0x92, 0x92, 0x6d, 0x82, 0x49, 0x83, 0x6d, 0x03, 0x44, 0xb2, 0xd6, 0xdb, 0x84, 0xfb, 0x00, 0xff,
+	0x83, 0xfb, 0x02, 0xd6, 0xd1, 0xb1, 0x82, 0xd6, 0x0f, 0xf6, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0xd1,
+	0xad, 0x6d, 0x8d, 0x6d, 0x49, 0x49, 0x24, 0x24, 0x00, 0x82, 0x24, 0x82, 0x49, 0x82, 0x6d, 0x02,
+	0x49, 0x45, 0x49, 0x82, 0x6d, 0x84, 0x92, 0x03, 0x24, 0x92, 0x6e, 0x6d, 0x83, 0x6e, 0x03, 0x92,
+	0xb6, 0xb6, 0x96, 0x82, 0x92, 0x02, 0xb6, 0x92, 0x92, 0x82, 0x6d, 0x03, 0x71, 0x91, 0x92, 0x91,
+	0x88, 0x6d, 0x0e, 0x91, 0x92, 0x6d, 0x49, 0x49, 0x00, 0x00, 0x25, 0x49, 0x69, 0x69, 0xb2, 0xd7,
+	0xd7, 0xdb, 0x82, 0xfb, 0x09, 0xff, 0xfb, 0xdb, 0xdb, 0xfb, 0xfb, 0xd6, 0xd1, 0xb1, 0xd2, 0x84,
+	0xd6, 0x08, 0xb1, 0xad, 0xad, 0xd2, 0xb1, 0xb2, 0x91, 0x6d, 0x49, 0x84, 0x24, 0x87, 0x49, 0x00,
+	0x44, 0x82, 0x24, 0x02, 0x49, 0x6d, 0x6d, 0x82, 0x92, 0x00, 0x91, 0x10, 0x24, 0x49, 0x29, 0x29,
+	0x49, 0x4e, 0x6e, 0x6e, 0x72, 0xb6, 0xb6, 0x92, 0x92, 0x6d, 0x71, 0x96, 0x92, 0x91, 0x6d, 0x0d,
+	0x91, 0x6d, 0x24, 0x24, 0x00, 0x00, 0x25, 0x04, 0x24, 0x44, 0x8d, 0xd7, 0xd7, 0xdb, 0x83, 0xfb,
+	0x09, 0xd6, 0xd6, 0xd7, 0xd7, 0xd6, 0xb1, 0xad, 0xb1, 0xb1, 0xd2, 0x82, 0xd6, 0x0c, 0xd2, 0xb1,
+	0xb1, 0xad, 0x8d, 0xb2, 0xb2, 0x8d, 0x69, 0x49, 0x44, 0x24, 0x48, 0x84, 0x24, 0x85, 0x49, 0x05,
+	0x6d, 0x6d, 0x49, 0x49, 0x69, 0x6d, 0x82, 0x92, 0x00, 0x91, 0x00, 0x49, 0x82, 0x29, 0x06, 0x49,
+	0x4e, 0x6e, 0x6e, 0x6d, 0x92, 0x92, 0x83, 0x6d, 0x00, 0x92, 0x93, 0x6d, 0x03, 0x49, 0x24, 0x24,
+	0x04, 0x83, 0x29, 0x04, 0x24, 0x24, 0xd6, 0xdb, 0xdb, 0x82, 0xfb, 0x16, 0xd6, 0xd6, 0xfb, 0xad,
+	0x8d, 0xb2, 0x89, 0x88, 0xad, 0xd1, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xb1, 0xb1, 0x8d, 0x69, 0x6d,
+	0x6d, 0x49, 0x44, 0x88, 0x24, 0x00, 0x49, 0x83, 0x6d, 0x84, 0x91, 0x05, 0x8d, 0x91, 0x92, 0xb2,
+	0x92, 0x92, 0x83, 0x49, 0x09, 0x4d, 0x4e, 0x4e, 0x6e, 0x4d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6e, 0x91,
+	0x6d, 0x07, 0x4d, 0x6d, 0x6d, 0x69, 0x48, 0x44, 0x48, 0x25, 0x84, 0x29, 0x14, 0x04, 0x6d, 0xfb,
+	0xd7, 0xfb, 0xfb, 0xdb, 0xd6, 0xdb, 0xfb, 0xd7, 0xd7, 0xd6, 0xb2, 0xb1, 0xb2, 0xd2, 0xd2, 0xd6,
+	0xd2, 0xd2, 0x82, 0xb1, 0x02, 0xad, 0x6d, 0x48, 0x87, 0x24, 0x01, 0x49, 0x49, 0x82, 0x6d, 0x00,
+	0x91, 0x89, 0x92, 0x00, 0xb2, 0x82, 0x92, 0x00, 0x6d, 0x82, 0x49, 0x04, 0x4d, 0x4d, 0x6e, 0x6e,
+	0x49, 0x93, 0x6d, 0x0d, 0x4d, 0x4d, 0x49, 0x49, 0x6d, 0x49, 0x48, 0x49, 0x25, 0x49, 0x49, 0x25,
+	0x24, 0x24, 0x82, 0x29, 0x0c, 0x49, 0xb6, 0xd7, 0xdb, 0xdb, 0xd6, 0xd6, 0xfb, 0xdb, 0xfb, 0xfb,
+	0xdb, 0xdb, 0x83, 0xd6, 0x82, 0xb2, 0x82, 0xb1, 0x01, 0xad, 0x8d, 0x82, 0x24, 0x00, 0x48, 0x82,
+	0x49, 0x04, 0x4d, 0x6d, 0x6d, 0x91, 0x91, 0x82, 0x92, 0x8a, 0xb2, 0x82, 0x92, 0x08, 0xb6, 0x6d,
+	0x49, 0x4d, 0x4d, 0x4e, 0x6e, 0x4d, 0x49, 0x89, 0x6d, 0x04, 0x4d, 0x4d, 0x49, 0x4d, 0x4d, 0x87,
+	0x49, 0x15, 0x6d, 0x6d, 0x49, 0x69, 0x8d, 0x49, 0x49, 0x6d, 0x49, 0x24, 0x24, 0x49, 0x4d, 0x6e,
+	0x4d, 0x6d, 0xb6, 0xdb, 0xd6, 0xd6, 0xdb, 0xdb, 0x82, 0xfb, 0x08, 0xdb, 0xfb, 0xd6, 0xd2, 0xd2,
+	0xad, 0xad, 0xb1, 0xd6, 0x82, 0xb1, 0x06, 0x8d, 0x8d, 0x29, 0x24, 0x24, 0x49, 0x91, 0x84, 0x92,
+	0x01, 0xb2, 0xb2, 0x85, 0xb6, 0x83, 0xb2, 0x02, 0xb6, 0xb2, 0xb6, 0x82, 0xb2, 0x00, 0x92, 0x0b,
+	0xb6, 0x6d, 0x49, 0x4d, 0x4d, 0x6e, 0x6e, 0x49, 0x29, 0x6d, 0x6e, 0x72, 0x82, 0x6d, 0x8f, 0x49,
+	0x84, 0x6d, 0x08, 0x92, 0x49, 0x29, 0x6d, 0x49, 0x49, 0x6d, 0x8d, 0x6d, 0x82, 0x4d, 0x04, 0x92,
+	0xd7, 0xd6, 0xda, 0xda, 0x83, 0xb2, 0x12, 0xae, 0xad, 0xad, 0x89, 0x89, 0x8d, 0xb1, 0xb2, 0xd2,
+	0xb1, 0xb1, 0xad, 0x8d, 0x92, 0x6d, 0x4d, 0x49, 0x6d, 0xb2, 0x95, 0xb6, 0x01, 0xb2, 0xb2, 0x0a,
+	0x6d, 0x24, 0x29, 0x4d, 0x4d, 0x4e, 0x4d, 0x49, 0x4d, 0x6e, 0x6e, 0x88, 0x6d, 0x00, 0x4d, 0x87,
+	0x49, 0x01, 0x4d, 0x49, 0x82, 0x6d, 0x15, 0x69, 0x6d, 0x91, 0x49, 0x24, 0x6d, 0x6d, 0x24, 0x29,
+	0x49, 0x29, 0x25, 0x49, 0x6e, 0x72, 0xb6, 0xd6, 0xdb, 0xd6, 0xb6, 0xd6, 0xb2, 0x83, 0xd2, 0x04,
+	0xad, 0xad, 0xd2, 0xb2, 0xb2, 0x82, 0xb1, 0x05, 0x8d, 0xad, 0xb2, 0xb6, 0x96, 0xb2, 0x85, 0xb6,
+	0x03, 0x92, 0x6d, 0x6d, 0xb2, 0x8f, 0xb6, 0x02, 0x24, 0x24, 0x49, 0x82, 0x4d, 0x04, 0x49, 0x6d,
+	0x71, 0x6d, 0x4d, 0x87, 0x6d, 0x84, 0x4d, 0x83, 0x49, 0x0e, 0x4d, 0x6d, 0x49, 0x4d, 0x49, 0x49,
+	0x6d, 0x6d, 0x91, 0x49, 0x24, 0x6d, 0x91, 0x49, 0x49, 0x82, 0x6d, 0x82, 0x92, 0x01, 0xb6, 0xd7,
+	0x82, 0xdb, 0x06, 0xfb, 0xd6, 0xd2, 0xb2, 0xb2, 0xad, 0xad, 0x82, 0xb1, 0x06, 0xb2, 0xb1, 0xb1,
+	0xad, 0x8d, 0xad, 0xb1, 0x84, 0xb6, 0x07, 0x92, 0x6d, 0x4d, 0x48, 0x24, 0x24, 0x6d, 0xb2, 0x8f,
+	0xb6, 0x02, 0x6d, 0x6e, 0x6d, 0x83, 0x49, 0x03, 0x6d, 0x6d, 0x49, 0x49, 0x86, 0x6d, 0x82, 0x4d,
+	0x04, 0x6d, 0x6d, 0x49, 0x49, 0x6d, 0x82, 0x49, 0x01, 0x6d, 0x6d, 0x84, 0x49, 0x03, 0x6d, 0x69,
+	0x48, 0x6d, 0x83, 0x91, 0x18, 0x92, 0x92, 0xb2, 0xb2, 0x92, 0x92, 0xb6, 0xd6, 0xd6, 0xdb, 0xdb,
+	0xda, 0xd6, 0xd6, 0xb2, 0xd2, 0xd2, 0xd6, 0xd2, 0xd2, 0xb2, 0xb1, 0xb1, 0x8d, 0xad, 0x82, 0xb1,
+	0x0a, 0x91, 0x6d, 0x49, 0x24, 0x04, 0x00, 0x24, 0x00, 0x24, 0x91, 0x92, 0x90, 0xb6, 0x06, 0x6d,
+	0x91, 0x6d, 0x69, 0x49, 0x49, 0x6d, 0x82, 0x69, 0x01, 0x49, 0x69, 0x84, 0x6d, 0x18, 0x4d, 0x4d,
+	0x6d, 0x49, 0x24, 0x49, 0x24, 0x04, 0x49, 0x25, 0x25, 0x49, 0x49, 0x6d, 0x49, 0x49, 0x25, 0x29,
+	0x69, 0x91, 0x91, 0x8d, 0x8d, 0x92, 0x91, 0x82, 0x6d, 0x00, 0x8d, 0x84, 0x92, 0x03, 0xd6, 0xd6,
+	0xdb, 0xdb, 0x83, 0xfb, 0x83, 0xd6, 0x04, 0xd2, 0xb1, 0xb1, 0x8d, 0x8d, 0x82, 0xb1, 0x09, 0xd1,
+	0x8d, 0x24, 0x00, 0x24, 0x24, 0x49, 0x6d, 0x49, 0x49, 0x8a, 0xb6, 0x03, 0xd6, 0xb6, 0xb6, 0x91,
+	0x83, 0x6d, 0x03, 0x49, 0x6d, 0x91, 0x91, 0x84, 0x6d, 0x1b, 0x49, 0x49, 0x6d, 0x69, 0x6d, 0x49,
+	0x49, 0x6d, 0x4d, 0x6d, 0x6d, 0x24, 0x00, 0x24, 0x24, 0x00, 0x29, 0x49, 0x25, 0x49, 0x6d, 0x49,
+	0x4d, 0x29, 0x29, 0x6d, 0x72, 0x92, 0x83, 0x91, 0x00, 0x92, 0x82, 0x6d, 0x0c, 0x8d, 0x6d, 0x4d,
+	0x71, 0x92, 0x6e, 0x92, 0xd6, 0xdb, 0xdb, 0xfb, 0xfb, 0xdb, 0x82, 0xd6, 0x06, 0xd2, 0xd2, 0xb2,
+	0xad, 0x8d, 0x8d, 0xad, 0x83, 0xb1, 0x09, 0xd2, 0xd1, 0x69, 0x45, 0x69, 0x6d, 0x92, 0x4d, 0x49,
+	0xb2, 0x85, 0xb6, 0x82, 0xd6, 0x03, 0xb6, 0xb6, 0xb2, 0x49, 0x83, 0x00, 0x00, 0x24, 0x02, 0x6d,
+	0x6d, 0x49, 0x8a, 0x6d, 0x02, 0x49, 0x00, 0x49, 0x82, 0x4d, 0x05, 0x29, 0x00, 0x24, 0x29, 0x24,
+	0x24, 0x82, 0x49, 0x21, 0x6d, 0x49, 0x6d, 0x49, 0x49, 0x6d, 0x72, 0x72, 0x91, 0x6d, 0x6d, 0x91,
+	0xb2, 0x6d, 0x6d, 0x91, 0xb6, 0x92, 0x6d, 0x6d, 0x72, 0x72, 0x92, 0xb6, 0xb6, 0xd6, 0xdb, 0xdb,
+	0xd6, 0xb6, 0xd6, 0xb6, 0xb2, 0xb2, 0x82, 0x8d, 0x85, 0xb1, 0x08, 0xd2, 0xf6, 0x8d, 0x20, 0x45,
+	0x49, 0x8e, 0x69, 0x6d, 0x84, 0xb6, 0x82, 0xd6, 0x04, 0xb6, 0xb6, 0x91, 0x6d, 0x48, 0x85, 0x00,
+	0x05, 0x6d, 0x6d, 0x49, 0x69, 0x49, 0x49, 0x87, 0x6d, 0x08, 0x49, 0x00, 0x48, 0x49, 0x49, 0x4e,
+	0x4e, 0x29, 0x24, 0x83, 0x49, 0x00, 0x6d, 0x82, 0x49, 0x10, 0x6d, 0x49, 0x4d, 0x6d, 0x72, 0x6e,
+	0x91, 0x91, 0x8d, 0x91, 0xb6, 0x92, 0x91, 0xb6, 0xb6, 0x92, 0x6d, 0x82, 0x92, 0x02, 0xb2, 0x8e,
+	0x92, 0x82, 0xb6, 0x02, 0xb2, 0xb1, 0xb2, 0x84, 0x8d, 0x86, 0xb1, 0x0a, 0xd6, 0xd6, 0x24, 0x25,
+	0x65, 0x45, 0x45, 0x69, 0x8d, 0xd6, 0xda, 0x83, 0xd6, 0x04, 0xb6, 0x92, 0x6d, 0x48, 0x24, 0x87,
+	0x00, 0x03, 0x89, 0x89, 0x6d, 0x8d, 0x8a, 0x6d, 0x14, 0x24, 0x49, 0x24, 0x29, 0x4d, 0x4e, 0x4e,
+	0x49, 0x49, 0x6d, 0x4d, 0x49, 0x6d, 0x6d, 0x49, 0x49, 0x4d, 0x49, 0x6d, 0x8d, 0x6e, 0x82, 0x92,
+	0x01, 0x91, 0x91, 0x83, 0xb6, 0x84, 0x92, 0x05, 0x6e, 0x6a, 0x4a, 0x8e, 0xd7, 0x92, 0x82, 0x8d,
+	0x05, 0x6d, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0x84, 0xb2, 0x04, 0xb1, 0xd2, 0xd6, 0x6d, 0x00, 0x82,
+	0x45, 0x0a, 0x65, 0x45, 0x45, 0x69, 0xb2, 0xd6, 0xb6, 0xb1, 0x91, 0x49, 0x24, 0x8a, 0x00, 0x82,
+	0x8d, 0x01, 0x92, 0x92, 0x89, 0x6d, 0x05, 0x49, 0x49, 0x24, 0x49, 0x4d, 0x4d, 0x82, 0x4e, 0x0d,
+	0x6d, 0x4d, 0x49, 0x4d, 0x4e, 0x4d, 0x49, 0x4d, 0x4d, 0x49, 0x91, 0x8d, 0x91, 0x92, 0x84, 0xb6,
+	0x0d, 0x92, 0x6d, 0x49, 0x6e, 0x6e, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x6a, 0xb7, 0xd7, 0x92, 0x84,
+	0x8d, 0x82, 0xb2, 0x00, 0xd2, 0x84, 0xb2, 0x08, 0xd6, 0xd6, 0x20, 0x25, 0x45, 0x45, 0x65, 0x69,
+	0x69, 0x82, 0x65, 0x03, 0x69, 0x8d, 0x49, 0x24, 0x8c, 0x00, 0x04, 0x8d, 0x6d, 0x69, 0x6d, 0x6d,
+	0x82, 0x49, 0x84, 0x6d, 0x10, 0x92, 0x6d, 0x49, 0x49, 0x29, 0x49, 0x49, 0x6d, 0x4d, 0x4d, 0x6e,
+	0x72, 0x72, 0x6d, 0x4d, 0x4e, 0x6e, 0x82, 0x4d, 0x01, 0x6d, 0x91, 0x82, 0x92, 0x14, 0xb6, 0x92,
+	0x6d, 0x91, 0x92, 0x25, 0x45, 0x6a, 0x6a, 0x4a, 0x6a, 0x45, 0x46, 0x6a, 0x6a, 0x4a, 0x92, 0xdb,
+	0xdb, 0xd6, 0xb6, 0x85, 0xb2, 0x82, 0xd2, 0x82, 0xb2, 0x08, 0xd6, 0x6d, 0x20, 0x45, 0x45, 0x65,
+	0x65, 0x45, 0x65, 0x85, 0x69, 0x01, 0x49, 0x20, 0x8b, 0x00, 0x04, 0x6e, 0x4d, 0x6d, 0x8e, 0x92,
+	0x82, 0x6e, 0x82, 0x72, 0x82, 0x92, 0x03, 0x6d, 0x29, 0x25, 0x24, 0x82, 0x49, 0x09, 0x6d, 0x49,
+	0x4d, 0x4e, 0x4e, 0x72, 0x6e, 0x49, 0x4e, 0x6e, 0x82, 0x6d, 0x08, 0x91, 0x6d, 0x92, 0x6d, 0x6d,
+	0x29, 0x00, 0x49, 0x8e, 0x85, 0x6a, 0x0a, 0x45, 0x46, 0x6a, 0x6a, 0x4a, 0x49, 0xdb, 0xb7, 0xdb,
+	0xd6, 0xb6, 0x83, 0xb2, 0x00, 0xb6, 0x82, 0xd6, 0x04, 0xb2, 0xb2, 0xd6, 0xb6, 0x20, 0x85, 0x45,
+	0x02, 0x69, 0x69, 0x65, 0x84, 0x6a, 0x01, 0x69, 0x24, 0x8a, 0x00, 0x00, 0x72, 0x83, 0x92, 0x00,
+	0x96, 0x87, 0x92, 0x01, 0x6d, 0x29, 0x83, 0x49, 0x10, 0x4d, 0x6d, 0x49, 0x49, 0x4d, 0x4e, 0x4e,
+	0x6e, 0x4e, 0x4e, 0x6e, 0x4d, 0x49, 0x24, 0x00, 0x00, 0x6d, 0x82, 0x49, 0x00, 0x25, 0x82, 0x6a,
+	0x05, 0x4a, 0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x82, 0x6a, 0x0a, 0x4a, 0x25, 0xd7, 0xd7, 0xb6, 0xb6,
+	0xb2, 0xb6, 0xb6, 0xb2, 0xb6, 0x82, 0xd6, 0x04, 0xb6, 0xb2, 0xb2, 0xd6, 0x69, 0x84, 0x45, 0x06,
+	0x69, 0x45, 0x45, 0x49, 0x6a, 0x6a, 0x69, 0x82, 0x6a, 0x02, 0x69, 0x69, 0x45, 0x89, 0x00, 0x83,
+	0x92, 0x84, 0x96, 0x84, 0x92, 0x00, 0x72, 0x84, 0x49, 0x00, 0x4d, 0x83, 0x6d, 0x07, 0x49, 0x49,
+	0x2a, 0x4e, 0x2e, 0x2a, 0x29, 0x24, 0x82, 0x00, 0x05, 0x6d, 0x72, 0x6d, 0x6e, 0x6a, 0x4a, 0x83,
+	0x6a, 0x03, 0x4a, 0x45, 0x4a, 0x45, 0x82, 0x6a, 0x09, 0x4a, 0x25, 0xb7, 0xdb, 0xb6, 0xb6, 0xb2,
+	0xb2, 0xb6, 0xb6, 0x82, 0xd6, 0x04, 0xb6, 0xb6, 0xb2, 0xd6, 0x8d, 0x83, 0x45, 0x07, 0x6a, 0x45,
+	0x49, 0x45, 0x49, 0x6a, 0x6a, 0x69, 0x83, 0x6a, 0x83, 0x69, 0x00, 0x20, 0x87, 0x00, 0x00, 0x96,
+	0x85, 0x92, 0x83, 0x96, 0x05, 0x92, 0x72, 0x72, 0x6e, 0x49, 0x49, 0x84, 0x6d, 0x08, 0x49, 0x24,
+	0x24, 0x00, 0x00, 0x25, 0x2a, 0x4e, 0x4e, 0x84, 0x49, 0x0a, 0x6d, 0x92, 0x6e, 0x6e, 0x6a, 0x45,
+	0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x82, 0x45, 0x0a, 0x6a, 0x4a, 0x6a, 0x4a, 0x45, 0xb7, 0xdb, 0xdb,
+	0xd6, 0xb6, 0xb6, 0x84, 0xd6, 0x03, 0xb6, 0xb6, 0xd6, 0xb2, 0x83, 0x45, 0x01, 0x6a, 0x6a, 0x82,
+	0x45, 0x89, 0x6a, 0x82, 0x69, 0x00, 0x24, 0x86, 0x00, 0x00, 0xb6, 0x83, 0x96, 0x85, 0x92, 0x82,
+	0x96, 0x08, 0x72, 0x6d, 0x6d, 0x49, 0x49, 0x24, 0x00, 0x24, 0x24, 0x83, 0x00, 0x06, 0x25, 0x29,
+	0x4e, 0x4f, 0x4d, 0x49, 0x4d, 0x82, 0x6d, 0x0b, 0x8e, 0x6e, 0x6a, 0x6a, 0x45, 0x6a, 0x45, 0x6a,
+	0x6a, 0x4a, 0x46, 0x45, 0x83, 0x6a, 0x02, 0x4a, 0x49, 0xd7, 0x83, 0xdb, 0x09, 0xd6, 0xd6, 0xda,
+	0xdb, 0xd6, 0xb6, 0xb6, 0xd6, 0xb2, 0x49, 0x82, 0x45, 0x82, 0x6a, 0x01, 0x45, 0x45, 0x8b, 0x6a,
+	0x03, 0x69, 0x65, 0x69, 0x24, 0x85, 0x00, 0x89, 0xb6, 0x04, 0x96, 0x92, 0x6e, 0x4d, 0x24, 0x85,
+	0x00, 0x02, 0x25, 0x49, 0x25, 0x84, 0x49, 0x03, 0x4a, 0x4e, 0x4e, 0x4d, 0x82, 0x6d, 0x00, 0x6e,
+	0x83, 0x6a, 0x09, 0x45, 0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x46, 0x45, 0x6a, 0x4a, 0x82, 0x6a, 0x01,
+	0x69, 0xd7, 0x83, 0xdb, 0x00, 0xd6, 0x82, 0xdb, 0x03, 0xd6, 0xd6, 0xd7, 0x92, 0x83, 0x45, 0x05,
+	0x4a, 0x6a, 0x6a, 0x49, 0x45, 0x45, 0x8b, 0x6a, 0x04, 0x69, 0x45, 0x65, 0x69, 0x24, 0x84, 0x00,
+	0x85, 0xb6, 0x04, 0x92, 0x6d, 0x6d, 0x49, 0x24, 0x85, 0x00, 0x01, 0x24, 0x25, 0x82, 0x49, 0x00,
+	0x6d, 0x82, 0x4d, 0x83, 0x49, 0x82, 0x4e, 0x02, 0x6d, 0x69, 0x49, 0x84, 0x6a, 0x09, 0x45, 0x6a,
+	0x46, 0x6a, 0x4a, 0x46, 0x46, 0x4a, 0x6a, 0x4a, 0x83, 0x6a, 0x00, 0xb6, 0x86, 0xdb, 0x0d, 0xfb,
+	0xdb, 0xb6, 0x6a, 0x45, 0x45, 0x49, 0x4a, 0x45, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x85, 0x6a, 0x00,
+	0x4a, 0x86, 0x6a, 0x04, 0x65, 0x45, 0x45, 0x49, 0x20, 0x83, 0x00, 0x05, 0xb6, 0x92, 0x92, 0x6d,
+	0x49, 0x24, 0x85, 0x00, 0x01, 0x24, 0x24, 0x82, 0x49, 0x03, 0x4d, 0x6d, 0x6d, 0x4d, 0x86, 0x6d,
+	0x00, 0x49, 0x83, 0x4e, 0x04, 0x24, 0x00, 0x45, 0x6a, 0x4a, 0x82, 0x6a, 0x09, 0x45, 0x4a, 0x45,
+	0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x6a, 0x4a, 0x83, 0x6a, 0x01, 0x8e, 0xb6, 0x83, 0xdb, 0x03, 0xff,
+	0xff, 0xdb, 0x8e, 0x82, 0x45, 0x08, 0x4a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x84,
+	0x6a, 0x00, 0x45, 0x87, 0x6a, 0x01, 0x69, 0x65, 0x82, 0x45, 0x83, 0x00, 0x00, 0x24, 0x86, 0x00,
+	0x03, 0x24, 0x28, 0x49, 0x49, 0x8c, 0x6d, 0x82, 0x49, 0x06, 0x25, 0x4a, 0x4a, 0x2a, 0x4e, 0x05,
+	0x00, 0x82, 0x6a, 0x02, 0x4a, 0x6a, 0x6a, 0x82, 0x45, 0x06, 0x6a, 0x45, 0x45, 0x4a, 0x6a, 0x46,
+	0x4a, 0x84, 0x6a, 0x07, 0x24, 0x00, 0x24, 0x49, 0x49, 0x6d, 0x8e, 0x49, 0x82, 0x45, 0x03, 0x4a,
+	0x6a, 0x45, 0x45, 0x82, 0x6a, 0x01, 0x45, 0x45, 0x84, 0x6a, 0x00, 0x45, 0x88, 0x6a, 0x05, 0x69,
+	0x65, 0x45, 0x45, 0x65, 0x20, 0x82, 0x00, 0x82, 0x00, 0x04, 0x24, 0x24, 0x49, 0x49, 0x4d, 0x8c,
+	0x6d, 0x03, 0x4d, 0x4d, 0x49, 0x24, 0x82, 0x00, 0x15, 0x05, 0x6f, 0x4a, 0x29, 0x4e, 0x25, 0x25,
+	0x6e, 0x46, 0x6a, 0x46, 0x6a, 0x6a, 0x46, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x45, 0x85,
+	0x6a, 0x00, 0x20, 0x84, 0x00, 0x00, 0x25, 0x82, 0x45, 0x03, 0x4a, 0x6a, 0x6a, 0x45, 0x83, 0x6a,
+	0x01, 0x45, 0x4a, 0x83, 0x6a, 0x00, 0x45, 0x85, 0x6a, 0x03, 0x45, 0x49, 0x6a, 0x69, 0x84, 0x45,
+	0x00, 0x44, 0x82, 0x00, 0x02, 0x28, 0x49, 0x49, 0x8e, 0x6d, 0x04, 0x49, 0x49, 0x24, 0x04, 0x25,
+	0x84, 0x00, 0x15, 0x25, 0x73, 0x2a, 0x25, 0x4a, 0x2a, 0x4a, 0x6a, 0x46, 0x4a, 0x46, 0x6a, 0x6a,
+	0x46, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x6a, 0x46, 0x45, 0x85, 0x6a, 0x00, 0x25, 0x83, 0x00, 0x00,
+	0x20, 0x82, 0x45, 0x02, 0x4a, 0x4a, 0x6a, 0x83, 0x4a, 0x02, 0x6a, 0x6a, 0x45, 0x83, 0x6a, 0x02,
+	0x4a, 0x45, 0x6e, 0x82, 0x6a, 0x82, 0x45, 0x00, 0x6a, 0x87, 0x45, 0x82, 0x00, 0x8d, 0x6d, 0x03,
+	0x49, 0x49, 0x24, 0x24, 0x83, 0x00, 0x00, 0x25, 0x84, 0x00, 0x18, 0x05, 0x2a, 0x05, 0x25, 0x29,
+	0x2a, 0x4a, 0x6a, 0x6a, 0x4a, 0x46, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x6a, 0x25, 0x46, 0x4a, 0x45,
+	0x4a, 0x6a, 0x6a, 0x4a, 0x82, 0x6a, 0x01, 0x4a, 0x20, 0x82, 0x00, 0x83, 0x45, 0x09, 0x4a, 0x6a,
+	0x6a, 0x46, 0x4a, 0x46, 0x6a, 0x6a, 0x46, 0x46, 0x83, 0x6a, 0x00, 0x45, 0x82, 0x6a, 0x04, 0x49,
+	0x25, 0x45, 0x6a, 0x6a, 0x88, 0x45, 0x82, 0x00, 0x88, 0x6d, 0x05, 0x4d, 0x49, 0x49, 0x24, 0x24,
+	0x04, 0x86, 0x00, 0x00, 0x25, 0x84, 0x00, 0x15, 0x25, 0x2a, 0x25, 0x25, 0x29, 0x4a, 0x6a, 0x4a,
+	0x6a, 0x4a, 0x4a, 0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x4a, 0x25, 0x6a, 0x45, 0x45, 0x4a, 0x85, 0x6a,
+	0x02, 0x4a, 0x49, 0x49, 0x85, 0x45, 0x04, 0x4a, 0x6a, 0x4a, 0x45, 0x45, 0x82, 0x6a, 0x00, 0x46,
+	0x83, 0x6a, 0x0b, 0x49, 0x45, 0x6a, 0x6a, 0x45, 0x21, 0x46, 0x6a, 0x6a, 0x45, 0x45, 0x49, 0x86,
+	0x45, 0x02, 0x20, 0x00, 0x00, 0x84, 0x6d, 0x82, 0x49, 0x82, 0x24, 0x82, 0x04, 0x87, 0x00, 0x01,
+	0x25, 0x04, 0x83, 0x00, 0x14, 0x29, 0x2a, 0x05, 0x29, 0x29, 0x4a, 0x6a, 0x46, 0x6a, 0x4a, 0x46,
+	0x6a, 0x4a, 0x4a, 0x6a, 0x45, 0x45, 0x25, 0x6a, 0x45, 0x45, 0x82, 0x6a, 0x00, 0x4a, 0x82, 0x6a,
+	0x00, 0x25, 0x83, 0x00, 0x82, 0x45, 0x05, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x4a, 0x82, 0x6a, 0x01,
+	0x4a, 0x4a, 0x82, 0x6a, 0x0b, 0x45, 0x6a, 0x6a, 0x45, 0x21, 0x4a, 0x6a, 0x6a, 0x45, 0x4a, 0x6a,
+	0x49, 0x86, 0x45, 0x02, 0x20, 0x00, 0x00, 0x03, 0x4d, 0x49, 0x49, 0x28, 0x89, 0x24, 0x00, 0x04,
+	0x86, 0x00, 0x01, 0x25, 0x04, 0x82, 0x00, 0x0f, 0x04, 0x4e, 0x29, 0x05, 0x29, 0x29, 0x6e, 0x6a,
+	0x45, 0x6a, 0x6a, 0x45, 0x6a, 0x4a, 0x46, 0x6a, 0x82, 0x45, 0x02, 0x6a, 0x45, 0x46, 0x82, 0x6a,
+	0x00, 0x4a, 0x82, 0x6a, 0x00, 0x20, 0x83, 0x00, 0x82, 0x45, 0x04, 0x6a, 0x6a, 0x4a, 0x45, 0x46,
+	0x83, 0x6a, 0x0b, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x6a, 0x6e, 0x45, 0x21, 0x6a, 0x6a, 0x4a, 0x83,
+	0x6a, 0x87, 0x45, 0x02, 0x20, 0x00, 0x00, 0x8c, 0x24, 0x01, 0x04, 0x04, 0x86, 0x00, 0x01, 0x25,
+	0x04, 0x82, 0x00, 0x01, 0x29, 0x4e, 0x82, 0x25, 0x0a, 0x4a, 0x6e, 0x6a, 0x45, 0x4a, 0x6a, 0x45,
+	0x6a, 0x6a, 0x45, 0x4a, 0x82, 0x45, 0x02, 0x6a, 0x45, 0x4a, 0x82, 0x6a, 0x03, 0x4a, 0x4a, 0x6a,
+	0x6a, 0x84, 0x00, 0x82, 0x45, 0x03, 0x6a, 0x6a, 0x45, 0x45, 0x84, 0x6a, 0x0a, 0x46, 0x4a, 0x6a,
+	0x6a, 0x4a, 0x6a, 0x6a, 0x21, 0x49, 0x4a, 0x4a, 0x84, 0x6a, 0x87, 0x45, 0x02, 0x20, 0x00, 0x00,
+	0x8d, 0x24, 0x01, 0x04, 0x04, 0x85, 0x00, 0x19, 0x25, 0x04, 0x00, 0x00, 0x04, 0x4e, 0x29, 0x04,
+	0x25, 0x05, 0x4a, 0x6e, 0x6a, 0x4a, 0x45, 0x4a, 0x45, 0x46, 0x6a, 0x45, 0x4a, 0x45, 0x45, 0x4a,
+	0x4a, 0x45, 0x84, 0x6a, 0x02, 0x4a, 0x6a, 0x4a, 0x84, 0x00, 0x06, 0x45, 0x45, 0x4a, 0x6a, 0x45,
+	0x45, 0x4a, 0x83, 0x6a, 0x0a, 0x4a, 0x46, 0x6a, 0x6a, 0x4a, 0x6a, 0x6a, 0x25, 0x45, 0x4a, 0x46,
+	0x85, 0x6a, 0x87, 0x45, 0x82, 0x00, 0x8e, 0x24, 0x00, 0x04, 0x85, 0x00, 0x19, 0x25, 0x04, 0x00,
+	0x00, 0x25, 0x4e, 0x05, 0x24, 0x25, 0x25, 0x6e, 0x6e, 0x4a, 0x6a, 0x45, 0x45, 0x4a, 0x45, 0x4a,
+	0x45, 0x4a, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x84, 0x6a, 0x02, 0x4a, 0x6a, 0x45, 0x84, 0x00, 0x05,
+	0x45, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x84, 0x6a, 0x00, 0x46, 0x82, 0x6a, 0x05, 0x4a, 0x6e, 0x45,
+	0x45, 0x4a, 0x45, 0x85, 0x6a, 0x88, 0x45, 0x82, 0x00, 0x8e, 0x24, 0x83, 0x04, 0x82, 0x00, 0x19,
+	0x25, 0x04, 0x00, 0x00, 0x2a, 0x2a, 0x00, 0x24, 0x25, 0x25, 0x6e, 0x6a, 0x6a, 0x4a, 0x4a, 0x45,
+	0x45, 0x46, 0x45, 0x45, 0x4a, 0x45, 0x45, 0x6a, 0x45, 0x45, 0x84, 0x6a, 0x02, 0x4a, 0x6a, 0x45,
+	0x84, 0x00, 0x04, 0x45, 0x46, 0x6a, 0x46, 0x45, 0x85, 0x6a, 0x00, 0x46, 0x84, 0x6a, 0x02, 0x45,
+	0x4a, 0x45, 0x86, 0x6a, 0x00, 0x49, 0x87, 0x45, 0x02, 0x20, 0x00, 0x00, 0x8f, 0x24, 0x00, 0x04,
+	0x84, 0x00, 0x0c, 0x25, 0x24, 0x00, 0x25, 0x4e, 0x25, 0x00, 0x24, 0x25, 0x25, 0x6e, 0x6a, 0x6a,
+	0x82, 0x4a, 0x86, 0x45, 0x02, 0x6a, 0x45, 0x4a, 0x84, 0x6a, 0x02, 0x4a, 0x6a, 0x25, 0x84, 0x00,
+	0x04, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x85, 0x6a, 0x00, 0x4a, 0x83, 0x6a, 0x02, 0x45, 0x4a, 0x45,
+	0x87, 0x6a, 0x02, 0x49, 0x45, 0x49, 0x85, 0x45, 0x02, 0x20, 0x00, 0x00, 0x8d, 0x24, 0x00, 0x04,
+	0x86, 0x00, 0x09, 0x25, 0x24, 0x04, 0x4e, 0x29, 0x00, 0x04, 0x24, 0x25, 0x45, 0x82, 0x6a, 0x00,
+	0x46, 0x82, 0x4a, 0x07, 0x45, 0x25, 0x45, 0x45, 0x25, 0x46, 0x6a, 0x45, 0x85, 0x6a, 0x02, 0x4a,
+	0x6a, 0x20, 0x84, 0x00, 0x03, 0x45, 0x6a, 0x4a, 0x45, 0x85, 0x6a, 0x00, 0x4a, 0x83, 0x6a, 0x82,
+	0x45, 0x00, 0x46, 0x87, 0x6a, 0x02, 0x45, 0x45, 0x49, 0x85, 0x45, 0x82, 0x00, 0x8a, 0x24, 0x00,
+	0x04, 0x89, 0x00, 0x03, 0x25, 0x04, 0x29, 0x4e, 0x82, 0x04, 0x02, 0x24, 0x25, 0x49, 0x82, 0x6a,
+	0x0b, 0x4a, 0x46, 0x6a, 0x4a, 0x4a, 0x45, 0x21, 0x45, 0x25, 0x45, 0x4a, 0x45, 0x85, 0x6a, 0x01,
+	0x4a, 0x4a, 0x84, 0x00, 0x04, 0x20, 0x45, 0x6a, 0x45, 0x45, 0x85, 0x6a, 0x00, 0x4a, 0x82, 0x6a,
+	0x03, 0x4a, 0x25, 0x4a, 0x45, 0x87, 0x6a, 0x00, 0x4a, 0x88, 0x45, 0x82, 0x00, 0x87, 0x24, 0x8d,
+	0x00, 0x04, 0x24, 0x25, 0x4e, 0x25, 0x00, 0x82, 0x04, 0x00, 0x25, 0x84, 0x6a, 0x0a, 0x45, 0x4a,
+	0x4a, 0x46, 0x45, 0x25, 0x45, 0x25, 0x45, 0x6a, 0x46, 0x86, 0x6a, 0x00, 0x45, 0x82, 0x00, 0x05,
+	0x4a, 0x45, 0x21, 0x4a, 0x4a, 0x45, 0x86, 0x6a, 0x03, 0x4a, 0x6a, 0x4a, 0x6a, 0x82, 0x45, 0x02,
+	0x4a, 0x6a, 0x4a, 0x85, 0x6a, 0x02, 0x46, 0x46, 0x49, 0x85, 0x45, 0x00, 0x44, 0x82, 0x00, 0x84,
+	0x24, 0x90, 0x00, 0x0a, 0x25, 0x4e, 0x29, 0x04, 0x04, 0x24, 0x04, 0x04, 0x49, 0x6a, 0x4a, 0x82,
+	0x6a, 0x0b, 0x46, 0x45, 0x46, 0x4a, 0x45, 0x25, 0x45, 0x25, 0x45, 0x6a, 0x4a, 0x4a, 0x85, 0x6a,
+	0x00, 0x45, 0x84, 0x00, 0x03, 0x21, 0x6a, 0x45, 0x45, 0x88, 0x6a, 0x01, 0x4a, 0x6a, 0x82, 0x45,
+	0x01, 0x6a, 0x4a, 0x85, 0x6a, 0x02, 0x4a, 0x45, 0x4a, 0x86, 0x45, 0x00, 0x24, 0x82, 0x00, 0x01,
+	0x24, 0x04, 0x93, 0x00, 0x04, 0x4a, 0x4e, 0x04, 0x04, 0x24, 0x82, 0x04, 0x0a, 0x4a, 0x6a, 0x6a,
+	0x4a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x4a, 0x46, 0x82, 0x25, 0x83, 0x4a, 0x85, 0x6a, 0x00, 0x25,
+	0x84, 0x00, 0x02, 0x21, 0x6a, 0x45, 0x88, 0x6a, 0x82, 0x4a, 0x03, 0x45, 0x25, 0x4a, 0x4a, 0x82,
+	0x6a, 0x00, 0x4a, 0x82, 0x6a, 0x02, 0x4a, 0x4a, 0x6a, 0x86, 0x45, 0x00, 0x20, 0x82, 0x00, 0x84,
+	0x00, 0x01, 0x04, 0x04, 0x87, 0x00, 0x01, 0x04, 0x04, 0x82, 0x24, 0x04, 0x00, 0x25, 0x4e, 0x25,
+	0x00, 0x83, 0x04, 0x00, 0x24, 0x82, 0x6a, 0x01, 0x46, 0x6a, 0x82, 0x4a, 0x02, 0x45, 0x45, 0x46,
+	0x82, 0x25, 0x82, 0x4a, 0x86, 0x6a, 0x00, 0x21, 0x84, 0x00, 0x02, 0x45, 0x46, 0x45, 0x88, 0x6a,
+	0x01, 0x45, 0x6a, 0x82, 0x45, 0x03, 0x4a, 0x6a, 0x6a, 0x4a, 0x83, 0x6a, 0x03, 0x4a, 0x6a, 0x6a,
+	0x49, 0x86, 0x45, 0x00, 0x20, 0x82, 0x00, 0x00, 0x04, 0x83, 0x24, 0x82, 0x04, 0x02, 0x00, 0x04,
+	0x04, 0x88, 0x24, 0x02, 0x25, 0x4e, 0x29, 0x85, 0x04, 0x01, 0x25, 0x6e, 0x82, 0x6a, 0x0c, 0x46,
+	0x4a, 0x46, 0x4a, 0x45, 0x25, 0x45, 0x45, 0x21, 0x25, 0x6a, 0x6a, 0x4a, 0x86, 0x6a, 0x85, 0x00,
+	0x02, 0x45, 0x45, 0x4a, 0x88, 0x6a, 0x07, 0x45, 0x6a, 0x45, 0x25, 0x45, 0x6a, 0x6a, 0x4a, 0x82,
+	0x6a, 0x01, 0x4a, 0x4a, 0x82, 0x6a, 0x87, 0x45, 0x83, 0x00, 0x93, 0x24, 0x02, 0x2a, 0x2a, 0x25,
+	0x82, 0x04, 0x03, 0x00, 0x00, 0x05, 0x2a, 0x83, 0x6a, 0x00, 0x4a, 0x82, 0x46, 0x08, 0x4a, 0x45,
+	0x25, 0x45, 0x21, 0x25, 0x6a, 0x6a, 0x4a, 0x86, 0x6a, 0x85, 0x00, 0x01, 0x25, 0x45, 0x88, 0x6a,
+	0x07, 0x46, 0x46, 0x6a, 0x45, 0x25, 0x4a, 0x6a, 0x4a, 0x86, 0x6a, 0x01, 0x4a, 0x4a, 0x87, 0x45,
+	0x83, 0x00, 0x92, 0x24, 0x04, 0x29, 0x2a, 0x05, 0x24, 0x04, 0x82, 0x00, 0x02, 0x05, 0x29, 0x25,
+	0x84, 0x6a, 0x08, 0x46, 0x45, 0x45, 0x46, 0x45, 0x45, 0x25, 0x21, 0x25, 0x89, 0x6a, 0x00, 0x45,
+	0x84, 0x00, 0x01, 0x45, 0x45, 0x88, 0x6a, 0x07, 0x45, 0x6a, 0x6a, 0x45, 0x21, 0x6a, 0x4a, 0x4a,
+	0x84, 0x6a, 0x02, 0x4a, 0x4a, 0x6a, 0x87, 0x45, 0x00, 0x24, 0x83, 0x00, 0x83, 0x24, 0x85, 0x28,
+	0x87, 0x24, 0x0b, 0x29, 0x2a, 0x05, 0x04, 0x25, 0x04, 0x00, 0x00, 0x05, 0x29, 0x25, 0x05, 0x84,
+	0x6a, 0x00, 0x4a, 0x84, 0x45, 0x02, 0x25, 0x21, 0x45, 0x88, 0x6a, 0x08, 0x4a, 0x6a, 0x25, 0x00,
+	0x00, 0x20, 0x6a, 0x45, 0x4a, 0x87, 0x6a, 0x07, 0x46, 0x45, 0x6a, 0x6a, 0x45, 0x25, 0x6a, 0x4a,
+	0x84, 0x6a, 0x02, 0x4a, 0x6a, 0x6a, 0x88, 0x45, 0x00, 0x24, 0x83, 0x00, 0x00, 0x24, 0x83, 0x28,
+	0x05, 0x48, 0x28, 0x28, 0x29, 0x29, 0x28, 0x85, 0x24, 0x0f, 0x05, 0x2a, 0x25, 0x00, 0x04, 0x24,
+	0x00, 0x00, 0x05, 0x29, 0x25, 0x00, 0x25, 0x6a, 0x4a, 0x6a, 0x82, 0x4a, 0x84, 0x45, 0x05, 0x25,
+	0x20, 0x25, 0x6a, 0x6a, 0x4a, 0x85, 0x6a, 0x07, 0x4a, 0x4a, 0x6a, 0x25, 0x21, 0x6a, 0x6a, 0x45,
+	0x88, 0x6a, 0x05, 0x45, 0x4a, 0x6a, 0x4a, 0x25, 0x25, 0x88, 0x6a, 0x89, 0x45, 0x00, 0x20, 0x83,
+	0x00, 0x82, 0x28, 0x84, 0x49, 0x01, 0x29, 0x28, 0x85, 0x24, 0x0f, 0x05, 0x2a, 0x29, 0x04, 0x00,
+	0x24, 0x24, 0x00, 0x05, 0x2a, 0x25, 0x04, 0x00, 0x49, 0x6a, 0x46, 0x83, 0x4a, 0x85, 0x45, 0x01,
+	0x20, 0x25, 0x84, 0x6a, 0x84, 0x4a, 0x83, 0x46, 0x02, 0x6a, 0x45, 0x45, 0x87, 0x6a, 0x06, 0x4a,
+	0x45, 0x4a, 0x6a, 0x46, 0x25, 0x45, 0x86, 0x6a, 0x00, 0x46, 0x83, 0x45, 0x00, 0x6a, 0x85, 0x45,
+	0x00, 0x20, 0x83, 0x00, 0x01, 0x29, 0x29, 0x83, 0x49, 0x01, 0x29, 0x29, 0x86, 0x24, 0x03, 0x04,
+	0x29, 0x29, 0x04, 0x82, 0x00, 0x0e, 0x25, 0x25, 0x2a, 0x25, 0x00, 0x00, 0x20, 0x6a, 0x6a, 0x4a,
+	0x46, 0x4a, 0x45, 0x46, 0x4a, 0x83, 0x45, 0x02, 0x25, 0x20, 0x25, 0x83, 0x6a, 0x84, 0x4a, 0x00,
+	0x46, 0x83, 0x45, 0x02, 0x6a, 0x45, 0x45, 0x84, 0x6a, 0x09, 0x4a, 0x6a, 0x6a, 0x46, 0x46, 0x6a,
+	0x6a, 0x25, 0x25, 0x46, 0x85, 0x6a, 0x02, 0x45, 0x45, 0x4a, 0x82, 0x6a, 0x86, 0x45, 0x00, 0x20,
+	0x83, 0x00, 0x82, 0x49, 0x02, 0x29, 0x29, 0x25, 0x87, 0x24, 0x03, 0x04, 0x25, 0x29, 0x04, 0x82,
+	0x00, 0x03, 0x05, 0x29, 0x29, 0x05, 0x82, 0x00, 0x03, 0x49, 0x6e, 0x6a, 0x6a, 0x82, 0x46, 0x01,
+	0x45, 0x46, 0x83, 0x45, 0x06, 0x25, 0x20, 0x00, 0x6a, 0x6a, 0x4a, 0x46, 0x83, 0x4a, 0x00, 0x46,
+	0x82, 0x45, 0x04, 0x25, 0x4a, 0x4a, 0x45, 0x46, 0x83, 0x6a, 0x0a, 0x4a, 0x4a, 0x6a, 0x6a, 0x45,
+	0x4a, 0x6a, 0x46, 0x25, 0x25, 0x4a, 0x84, 0x6a, 0x01, 0x45, 0x4a, 0x83, 0x6a, 0x86, 0x45, 0x01,
+	0x44, 0x20, 0x83, 0x00, 0x00, 0x29, 0x8b, 0x24, 0x03, 0x04, 0x04, 0x25, 0x05, 0x82, 0x00, 0x02,
+	0x05, 0x29, 0x29, 0x84, 0x00, 0x00, 0x49, 0x82, 0x6a, 0x00, 0x4a, 0x82, 0x46, 0x84, 0x45, 0x0a,
+	0x25, 0x00, 0x00, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x46, 0x4a, 0x46, 0x84, 0x45, 0x03, 0x6a, 0x46,
+	0x45, 0x4a, 0x83, 0x6a, 0x09, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x4a, 0x6a, 0x45, 0x21, 0x25, 0x84,
+	0x6a, 0x00, 0x4a, 0x84, 0x6a, 0x87, 0x45, 0x00, 0x24, 0x83, 0x20, 0x00, 0x00, 0x8a, 0x24, 0x04,
+	0x04, 0x00, 0x00, 0x04, 0x05, 0x82, 0x00, 0x82, 0x25, 0x00, 0x04, 0x84, 0x00, 0x07, 0x4a, 0x6a,
+	0x45, 0x4a, 0x6a, 0x4a, 0x46, 0x46, 0x84, 0x45, 0x05, 0x24, 0x00, 0x20, 0x4a, 0x6a, 0x4a, 0x88,
+	0x45, 0x04, 0x46, 0x6a, 0x45, 0x45, 0x4a, 0x82, 0x6a, 0x0a, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x45,
+	0x4a, 0x46, 0x25, 0x00, 0x45, 0x89, 0x6a, 0x00, 0x4a, 0x87, 0x45, 0x00, 0x24, 0x84, 0x20, 0x88,
+	0x24, 0x84, 0x00, 0x08, 0x04, 0x05, 0x00, 0x05, 0x25, 0x05, 0x00, 0x00, 0x24, 0x83, 0x00, 0x08,
+	0x24, 0x6a, 0x6a, 0x4a, 0x45, 0x46, 0x4a, 0x46, 0x46, 0x83, 0x45, 0x06, 0x25, 0x20, 0x24, 0x6e,
+	0x6e, 0x6a, 0x6a, 0x85, 0x45, 0x06, 0x46, 0x46, 0x45, 0x6a, 0x4a, 0x45, 0x45, 0x83, 0x6a, 0x0a,
+	0x4a, 0x4a, 0x6a, 0x6a, 0x46, 0x45, 0x4a, 0x45, 0x25, 0x00, 0x4a, 0x88, 0x6a, 0x00, 0x4a, 0x88,
+	0x45, 0x01, 0x24, 0x20, 0x83, 0x24, 0x84, 0x24, 0x01, 0x04, 0x04, 0x87, 0x00, 0x02, 0x04, 0x04,
+	0x05, 0x83, 0x00, 0x00, 0x24, 0x83, 0x00, 0x08, 0x25, 0x6a, 0x6a, 0x4a, 0x4a, 0x45, 0x45, 0x4a,
+	0x46, 0x82, 0x45, 0x08, 0x25, 0x25, 0x24, 0x8d, 0xd6, 0xb6, 0x6e, 0x4a, 0x4a, 0x86, 0x45, 0x04,
+	0x46, 0x6a, 0x45, 0x45, 0x46, 0x83, 0x6a, 0x08, 0x4a, 0x4a, 0x6a, 0x6a, 0x45, 0x45, 0x46, 0x25,
+	0x21, 0x80, 0x01, 0x87, 0x6a, 0x00, 0x4a, 0x8a, 0x45, 0x85, 0x24, 0x82, 0x24, 0x92, 0x00, 0x00,
+	0x24, 0x83, 0x00, 0x05, 0x45, 0x6a, 0x6a, 0x4a, 0x46, 0x46, 0x86, 0x45, 0x08, 0x20, 0x6d, 0xda,
+	0xd7, 0xb6, 0xb2, 0x69, 0x4a, 0x46, 0x85, 0x45, 0x04, 0x4a, 0x6a, 0x45, 0x45, 0x46, 0x82, 0x6a,
+	0x0a, 0x4a, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x46, 0x45, 0x25, 0x00, 0x25, 0x86, 0x6a, 0x82, 0x45,
+	0x04, 0x6a, 0x6a, 0x45, 0x45, 0x25, 0x83, 0x45, 0x00, 0x44, 0x85, 0x24, 0x00, 0x20, 0x94, 0x00,
+	0x00, 0x24, 0x83, 0x00, 0x04, 0x49, 0x4a, 0x45, 0x46, 0x46, 0x86, 0x45, 0x02, 0x21, 0x45, 0xd7,
+	0x83, 0xdb, 0x01, 0xb2, 0x69, 0x83, 0x45, 0x82, 0x46, 0x04, 0x6a, 0x4a, 0x45, 0x45, 0x4a, 0x82,
+	0x6a, 0x04, 0x4a, 0x4a, 0x6a, 0x6a, 0x46, 0x82, 0x45, 0x02, 0x25, 0x00, 0x25, 0x83, 0x6a, 0x09,
+	0x4a, 0x45, 0x25, 0x45, 0x4a, 0x6a, 0x45, 0x45, 0x25, 0x25, 0x84, 0x45, 0x00, 0x44, 0x85, 0x24,
+	0x9a, 0x00, 0x03, 0x4a, 0x4a, 0x46, 0x46, 0x87, 0x45, 0x03, 0x20, 0x6e, 0xfb, 0xdb, 0x82, 0xff,
+	0x09, 0xfb, 0xd6, 0x6d, 0x20, 0x21, 0x25, 0x45, 0x46, 0x46, 0x6a, 0x82, 0x45, 0x02, 0x4a, 0x6a,
+	0x6a, 0x82, 0x4a, 0x10, 0x6a, 0x4a, 0x46, 0x45, 0x45, 0x25, 0x25, 0x00, 0x25, 0x6a, 0x4a, 0x46,
+	0x46, 0x45, 0x45, 0x4a, 0x6a, 0x8a, 0x45, 0x86, 0x24, 0x96, 0x00, 0x12, 0x04, 0x00, 0x00, 0x49,
+	0x6a, 0x6a, 0x4a, 0x4a, 0x46, 0x45, 0x45, 0x25, 0x45, 0x45, 0x25, 0x45, 0x25, 0xb7, 0xdb, 0x84,
+	0xff, 0x08, 0xfb, 0xdb, 0x8e, 0x24, 0x20, 0x25, 0x25, 0x4a, 0x4a, 0x82, 0x45, 0x09, 0x4a, 0x6a,
+	0x6a, 0x4a, 0x46, 0x4a, 0x4a, 0x46, 0x45, 0x45, 0x82, 0x25, 0x02, 0x21, 0x4a, 0x4a, 0x82, 0x45,
+	0x02, 0x4a, 0x6a, 0x4a, 0x8b, 0x45, 0x03, 0x24, 0x24, 0x44, 0x44, 0x82, 0x24, 0x96, 0x00, 0x06,
+	0x04, 0x00, 0x25, 0x6a, 0x4a, 0x4a, 0x46, 0x87, 0x45, 0x03, 0x21, 0x49, 0xdb, 0xdb, 0x85, 0xff,
+	0x05, 0xfb, 0xdb, 0xb6, 0x6d, 0x25, 0x21, 0x84, 0x45, 0x01, 0x4a, 0x6a, 0x84, 0x4a, 0x01, 0x45,
+	0x45, 0x84, 0x25, 0x06, 0x4a, 0x4a, 0x46, 0x4a, 0x6a, 0x6a, 0x4a, 0x8b, 0x45, 0x84, 0x24, 0x02,
+	0x44, 0x24, 0x24, 0x96, 0x00, 0x04, 0x24, 0x00, 0x25, 0x4a, 0x4a, 0x82, 0x46, 0x03, 0x4a, 0x6a,
+	0x4a, 0x49, 0x82, 0x45, 0x03, 0x21, 0x69, 0xdb, 0xdb, 0x87, 0xff, 0x05, 0xfb, 0xfb, 0xd6, 0x6e,
+	0x45, 0x20, 0x82, 0x25, 0x0f, 0x46, 0x4a, 0x46, 0x46, 0x4a, 0x4a, 0x46, 0x46, 0x45, 0x45, 0x25,
+	0x25, 0x21, 0x25, 0x4a, 0x4a, 0x82, 0x6a, 0x8d, 0x45, 0x87, 0x24, 0x97, 0x00, 0x07, 0x24, 0x6a,
+	0x6a, 0x4a, 0x6a, 0x6a, 0x4a, 0x4a, 0x85, 0x45, 0x03, 0x20, 0x49, 0xdb, 0xdb, 0x88, 0xff, 0x08,
+	0xfb, 0xfb, 0xdb, 0xd6, 0x8e, 0x45, 0x20, 0x21, 0x45, 0x83, 0x46, 0x83, 0x45, 0x0e, 0x25, 0x25,
+	0x20, 0x00, 0x25, 0x4a, 0x6a, 0x6a, 0x4a, 0x45, 0x45, 0x4a, 0x6a, 0x4a, 0x46, 0x87, 0x45, 0x02,
+	0x44, 0x24, 0x20, 0x85, 0x24, 0x97, 0x00, 0x04, 0x25, 0x46, 0x4a, 0x6a, 0x6a, 0x87, 0x45, 0x82,
+	0x49, 0x00, 0xdb, 0x8b, 0xff, 0x0a, 0xfb, 0xfb, 0xdb, 0xd6, 0x92, 0x49, 0x25, 0x21, 0x21, 0x45,
+	0x45, 0x84, 0x25, 0x0c, 0x20, 0x20, 0x21, 0x45, 0x6a, 0x6a, 0x45, 0x45, 0x6a, 0x6a, 0x4a, 0x4a,
+	0x46, 0x88, 0x45, 0x01, 0x24, 0x20, 0x86, 0x24, 0x97, 0x00, 0x04, 0x25, 0x4a, 0x4a, 0x45, 0x25,
+	0x85, 0x45, 0x05, 0x6e, 0xd7, 0xfb, 0xfb, 0xd6, 0xd6, 0x8d, 0xff, 0x00, 0xfb, 0x82, 0xdb, 0x06,
+	0xb2, 0x8e, 0x49, 0x25, 0x21, 0x00, 0x21, 0x82, 0x25, 0x0c, 0x00, 0x25, 0x21, 0x45, 0x4a, 0x46,
+	0x4a, 0x6a, 0x6a, 0x4a, 0x4a, 0x6a, 0x4a, 0x88, 0x45, 0x03, 0x24, 0x20, 0x24, 0x24, 0x84, 0x44,
+	0x8c, 0x00, 0x00, 0x20, 0x88, 0x00, 0x00, 0x05, 0x82, 0x25, 0x09, 0x45, 0x46, 0x4a, 0x45, 0x25,
+	0x25, 0x6a, 0xd7, 0xff, 0xff, 0x82, 0xfb, 0x05, 0xdb, 0xd6, 0xdb, 0xfb, 0xdb, 0xfb, 0x89, 0xff,
+	0x00, 0xfb, 0x82, 0xdb, 0x07, 0xda, 0xda, 0xb6, 0xb2, 0x6d, 0x45, 0x21, 0x21, 0x82, 0x00, 0x03,
+	0x25, 0x4a, 0x46, 0x4a, 0x82, 0x6a, 0x83, 0x4a, 0x87, 0x45, 0x00, 0x44, 0x82, 0x24, 0x83, 0x44,
+	0x01, 0x48, 0x48, 0x95, 0x00, 0x83, 0x25, 0x09, 0x4a, 0x46, 0x46, 0x25, 0x25, 0x45, 0x6e, 0xdb,
+	0xff, 0xff, 0x84, 0xfb, 0x05, 0xda, 0xb6, 0xd6, 0xdb, 0xfb, 0xdb, 0x89, 0xff, 0x82, 0xfb, 0x07,
+	0xdb, 0xdb, 0xfb, 0xb6, 0x8e, 0x6a, 0x4a, 0x45, 0x82, 0x25, 0x02, 0x92, 0x49, 0x4a, 0x84, 0x6a,
+	0x02, 0x4a, 0x4a, 0x46, 0x87, 0x45, 0x83, 0x24, 0x01, 0x44, 0x44, 0x83, 0x48, 0x93, 0x00, 0x0b,
+	0x20, 0x25, 0x25, 0x05, 0x00, 0x49, 0x46, 0x45, 0x25, 0x25, 0x45, 0x6e, 0x84, 0xdb, 0x07, 0xfb,
+	0xdb, 0xdb, 0xfb, 0xdb, 0xda, 0xb6, 0xb6, 0x82, 0xdb, 0x00, 0xfb, 0x8c, 0xff, 0x00, 0xb6, 0x83,
+	0x4a, 0x0d, 0x6a, 0x6a, 0x4a, 0x49, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x6a, 0x4a, 0x4a,
+	0x88, 0x45, 0x83, 0x24, 0x05, 0x44, 0x44, 0x48, 0x44, 0x44, 0x48
 };
-const char bitmap_arrow_E[1026]={
-		0x20, 0x20,
-		 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,
-		    0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x43,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01
-};
-
-const char bitmap_smiley_blij[1026]={
-	0x20,0x20,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,
-	    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-	    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-	    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-	    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-	    0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-	    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-
 
+const uint8_t bitmap_xander[5352] = {
+	0x93, 0xdb, 0x16, 0xda, 0xff, 0xdb, 0xdb, 0xdf, 0x8d, 0x8d, 0xd6, 0xb6, 0x69, 0x44, 0x48, 0x69,
+	0x24, 0x24, 0x44, 0x24, 0x44, 0x48, 0x69, 0x48, 0x48, 0x44, 0x85, 0x24, 0x02, 0x20, 0x00, 0x00,
+	0x82, 0x24, 0x01, 0x20, 0x24, 0x86, 0x00, 0x85, 0x24, 0x06, 0x48, 0x24, 0x48, 0x69, 0x44, 0x44,
+	0x91, 0x87, 0xdb, 0x01, 0xda, 0xda, 0x84, 0xdb, 0x07, 0xd6, 0x8d, 0xdb, 0xb6, 0xb6, 0xba, 0xda,
+	0xda, 0x93, 0xdb, 0x01, 0xda, 0xff, 0x82, 0xdb, 0x08, 0x69, 0xb2, 0xd6, 0xb2, 0x69, 0x24, 0x44,
+	0x69, 0x49, 0x83, 0x24, 0x04, 0x48, 0x49, 0x49, 0x44, 0x44, 0x86, 0x24, 0x01, 0x00, 0x00, 0x82,
+	0x24, 0x07, 0x20, 0x24, 0x20, 0x00, 0x00, 0x20, 0x24, 0x00, 0x86, 0x24, 0x09, 0x48, 0x48, 0x44,
+	0x69, 0x69, 0x24, 0x6d, 0xb6, 0xdb, 0xba, 0x84, 0xdb, 0x00, 0xda, 0x85, 0xdb, 0x07, 0xda, 0x8d,
+	0xdb, 0xba, 0xb6, 0xba, 0xdb, 0xdb, 0x93, 0xdb, 0x0d, 0xda, 0xff, 0xdb, 0xdb, 0xb6, 0x69, 0xd6,
+	0xd6, 0xb2, 0x6d, 0x44, 0x24, 0x24, 0x6d, 0x82, 0x24, 0x05, 0x00, 0x24, 0x48, 0x49, 0x44, 0x44,
+	0x86, 0x24, 0x01, 0x00, 0x00, 0x82, 0x24, 0x04, 0x00, 0x24, 0x24, 0x20, 0x20, 0x83, 0x24, 0x01,
+	0x00, 0x00, 0x82, 0x24, 0x09, 0x20, 0x24, 0x48, 0x49, 0x48, 0x69, 0x44, 0x48, 0xb6, 0xb6, 0x8d,
+	0xdb, 0x06, 0x8d, 0xba, 0xba, 0xb6, 0xba, 0xdb, 0xdb, 0x93, 0xdb, 0x09, 0xda, 0xff, 0xdb, 0xdb,
+	0xb6, 0x91, 0xda, 0xda, 0xb6, 0x69, 0x82, 0x24, 0x01, 0x69, 0x49, 0x83, 0x24, 0x02, 0x44, 0x48,
+	0x44, 0x87, 0x24, 0x09, 0x00, 0x00, 0x20, 0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x20, 0x83, 0x00,
+	0x00, 0x20, 0x84, 0x24, 0x00, 0x44, 0x82, 0x48, 0x04, 0x69, 0x48, 0x44, 0x6d, 0xb6, 0x8d, 0xdb,
+	0x06, 0x8d, 0xb6, 0xda, 0xb6, 0xba, 0xdb, 0xda, 0x92, 0xdb, 0x09, 0xda, 0xdb, 0xff, 0xdb, 0xdb,
+	0xb6, 0xb2, 0xff, 0xff, 0xb6, 0x83, 0x24, 0x01, 0x48, 0x49, 0x84, 0x24, 0x01, 0x44, 0x44, 0x90,
+	0x24, 0x01, 0x20, 0x20, 0x82, 0x00, 0x86, 0x24, 0x07, 0x48, 0x69, 0x69, 0x49, 0x48, 0x44, 0x48,
+	0xb6, 0x8d, 0xdb, 0x06, 0x8d, 0xb6, 0xdb, 0xb6, 0xba, 0xdb, 0xda, 0x92, 0xdb, 0x0a, 0xda, 0xdb,
+	0xff, 0xdb, 0xdb, 0xb6, 0xb2, 0xff, 0xff, 0x6d, 0x44, 0x83, 0x24, 0x00, 0x49, 0x94, 0x24, 0x00,
+	0x44, 0x84, 0x24, 0x01, 0x20, 0x20, 0x84, 0x00, 0x82, 0x24, 0x00, 0x44, 0x82, 0x69, 0x03, 0x48,
+	0x44, 0x92, 0xba, 0x8c, 0xdb, 0x06, 0x91, 0xb6, 0xdb, 0xb6, 0xba, 0xdb, 0xdb, 0x92, 0xdb, 0x0a,
+	0xda, 0xdb, 0xff, 0xdb, 0xdb, 0xb6, 0x91, 0xff, 0xd6, 0x69, 0x44, 0x83, 0x24, 0x04, 0x44, 0x44,
+	0x24, 0x24, 0x20, 0x8d, 0x24, 0x86, 0x44, 0x82, 0x24, 0x04, 0x00, 0x00, 0x24, 0x20, 0x20, 0x84,
+	0x24, 0x07, 0x44, 0x49, 0x6d, 0x48, 0x44, 0x6d, 0xda, 0xda, 0x8b, 0xdb, 0x06, 0x91, 0xb6, 0xdb,
+	0xb6, 0xba, 0xdb, 0xdb, 0x92, 0xdb, 0x09, 0xda, 0xdb, 0xdf, 0xdb, 0xdb, 0xb6, 0xb2, 0xff, 0x92,
+	0x49, 0x82, 0x24, 0x03, 0x6d, 0x24, 0x24, 0x44, 0x83, 0x24, 0x00, 0x00, 0x87, 0x24, 0x82, 0x44,
+	0x84, 0x48, 0x83, 0x44, 0x82, 0x24, 0x02, 0x20, 0x00, 0x20, 0x86, 0x24, 0x06, 0x48, 0x6d, 0x69,
+	0x44, 0x69, 0xba, 0xda, 0x8b, 0xdb, 0x06, 0x91, 0x92, 0xdb, 0xb6, 0xba, 0xda, 0xdb, 0x92, 0xdb,
+	0x0d, 0xb6, 0xdb, 0xdf, 0xdb, 0xdb, 0xb6, 0xb6, 0x92, 0x91, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x87,
+	0x24, 0x00, 0x44, 0x84, 0x24, 0x01, 0x44, 0x48, 0x82, 0x68, 0x84, 0x69, 0x00, 0x68, 0x82, 0x48,
+	0x01, 0x44, 0x44, 0x8a, 0x24, 0x07, 0x44, 0x48, 0x69, 0x69, 0x44, 0x92, 0xdb, 0xda, 0x8a, 0xdb,
+	0x06, 0xb2, 0xb6, 0xdb, 0xb6, 0xba, 0xda, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x83, 0xdb, 0x08, 0xb6,
+	0xb6, 0x91, 0x8d, 0x91, 0x69, 0x24, 0x49, 0x49, 0x84, 0x24, 0x08, 0x44, 0x48, 0x69, 0x69, 0x44,
+	0x24, 0x24, 0x44, 0x48, 0x8a, 0x69, 0x04, 0x68, 0x69, 0x69, 0x48, 0x44, 0x85, 0x24, 0x01, 0x20,
+	0x20, 0x82, 0x24, 0x05, 0x44, 0x48, 0x69, 0x48, 0x44, 0x49, 0x8c, 0xdb, 0x06, 0xb2, 0x92, 0xdb,
+	0xb6, 0xba, 0xda, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x83, 0xdb, 0x05, 0x91, 0xb6, 0x8d, 0x69, 0x91,
+	0x44, 0x82, 0x24, 0x00, 0x20, 0x83, 0x24, 0x07, 0x48, 0x49, 0x6d, 0x49, 0x24, 0x24, 0x44, 0x69,
+	0x82, 0x8d, 0x04, 0x69, 0x8d, 0x8d, 0x69, 0x69, 0x82, 0x8d, 0x85, 0x69, 0x00, 0x44, 0x83, 0x24,
+	0x00, 0x00, 0x85, 0x24, 0x00, 0x44, 0x83, 0x48, 0x00, 0x92, 0x84, 0xdb, 0x00, 0xda, 0x85, 0xdb,
+	0x06, 0xb2, 0x91, 0xdb, 0xb6, 0xba, 0xda, 0xda, 0x92, 0xdb, 0x00, 0xb6, 0x82, 0xdb, 0x06, 0xb6,
+	0x91, 0xda, 0x6d, 0x6d, 0x8d, 0x44, 0x86, 0x24, 0x07, 0x44, 0x44, 0x6d, 0x6d, 0x44, 0x24, 0x44,
+	0x48, 0x86, 0x8d, 0x01, 0x89, 0x89, 0x83, 0x8d, 0x00, 0x6d, 0x83, 0x69, 0x05, 0x48, 0x44, 0x24,
+	0x24, 0x20, 0x20, 0x85, 0x24, 0x00, 0x44, 0x82, 0x48, 0x01, 0x69, 0x6d, 0x8b, 0xdb, 0x06, 0xb2,
+	0x91, 0xdb, 0xba, 0xba, 0xda, 0xdb, 0x92, 0xdb, 0x0a, 0xb6, 0xfb, 0xdb, 0xdb, 0xb6, 0x91, 0xd6,
+	0x69, 0x6d, 0x91, 0x48, 0x86, 0x24, 0x08, 0x44, 0x69, 0x8d, 0x44, 0x24, 0x44, 0x48, 0x6d, 0x91,
+	0x90, 0x8d, 0x02, 0x69, 0x48, 0x44, 0x83, 0x24, 0x82, 0x00, 0x08, 0x24, 0x24, 0x44, 0x48, 0x48,
+	0x44, 0x6d, 0x49, 0x92, 0x83, 0xdb, 0x00, 0xda, 0x85, 0xdb, 0x06, 0xb6, 0x91, 0xdb, 0xba, 0xba,
+	0xdb, 0xdb, 0x92, 0xdb, 0x0c, 0xb6, 0xfb, 0xdb, 0xdb, 0x92, 0xb6, 0xb6, 0x44, 0x6d, 0x92, 0x6d,
+	0x48, 0x44, 0x84, 0x24, 0x08, 0x48, 0x69, 0x48, 0x24, 0x44, 0x68, 0x8d, 0x91, 0xb2, 0x84, 0xb1,
+	0x89, 0x8d, 0x07, 0xb1, 0x8d, 0x8d, 0x69, 0x48, 0x44, 0x24, 0x24, 0x82, 0x20, 0x83, 0x24, 0x00,
+	0x44, 0x82, 0x48, 0x01, 0x6d, 0x69, 0x83, 0xdb, 0x00, 0xda, 0x85, 0xdb, 0x06, 0xb6, 0x6d, 0xbb,
+	0xba, 0xba, 0xda, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x82, 0xdb, 0x06, 0xb2, 0xb6, 0x92, 0x48, 0xb6,
+	0x69, 0x48, 0x86, 0x24, 0x11, 0x48, 0x48, 0x44, 0x44, 0x68, 0x69, 0x8d, 0xb2, 0xb2, 0xb6, 0xd6,
+	0xb2, 0xb2, 0xb1, 0xb1, 0x91, 0x8d, 0x8d, 0x84, 0xb1, 0x06, 0x8d, 0xb1, 0xb2, 0xb1, 0x8d, 0x69,
+	0x44, 0x88, 0x24, 0x83, 0x48, 0x02, 0x69, 0x49, 0xb6, 0x89, 0xdb, 0x06, 0xb6, 0x6d, 0xbb, 0xba,
+	0xba, 0xda, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x82, 0xdb, 0x08, 0xb6, 0xd6, 0x92, 0x6d, 0xdb, 0x6d,
+	0x24, 0x00, 0x00, 0x84, 0x24, 0x08, 0x48, 0x44, 0x44, 0x68, 0x69, 0x8d, 0xb1, 0xb2, 0xb6, 0x82,
+	0xd6, 0x00, 0xb2, 0x88, 0xb1, 0x09, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0x6d, 0x48, 0x44, 0x44,
+	0x84, 0x24, 0x00, 0x44, 0x83, 0x48, 0x03, 0x69, 0x6d, 0x49, 0x91, 0x89, 0xdb, 0x06, 0xd6, 0x8d,
+	0xb6, 0xda, 0xba, 0xda, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x82, 0xdb, 0x05, 0xb6, 0xb6, 0x92, 0x6d,
+	0xdb, 0x8d, 0x83, 0x00, 0x82, 0x24, 0x82, 0x44, 0x05, 0x69, 0x69, 0x8d, 0x8d, 0xb2, 0xb6, 0x82,
+	0xd6, 0x01, 0xb2, 0xb2, 0x86, 0xb1, 0x82, 0xb2, 0x09, 0xd6, 0xd6, 0xb2, 0xb2, 0xb1, 0x8d, 0x69,
+	0x48, 0x44, 0x48, 0x83, 0x24, 0x01, 0x44, 0x44, 0x83, 0x48, 0x82, 0x6d, 0x82, 0xdb, 0x00, 0xda,
+	0x85, 0xdb, 0x06, 0xda, 0x8d, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0x92, 0xdb, 0x00, 0xb6, 0x82, 0xdb,
+	0x82, 0xb6, 0x05, 0x69, 0xdb, 0x92, 0x20, 0x00, 0x24, 0x83, 0x00, 0x02, 0x24, 0x24, 0x69, 0x82,
+	0x8d, 0x02, 0xb1, 0xb2, 0xb6, 0x82, 0xd6, 0x0a, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0xb2, 0xb2,
+	0xb1, 0xb1, 0xb2, 0x83, 0xd6, 0x03, 0xb2, 0xb2, 0xb1, 0x8d, 0x83, 0x48, 0x84, 0x44, 0x82, 0x48,
+	0x07, 0x69, 0x48, 0x92, 0x6d, 0xb6, 0xdb, 0xdb, 0xba, 0x85, 0xdb, 0x06, 0xda, 0x8d, 0xb6, 0xdb,
+	0xba, 0xdb, 0xdb, 0x92, 0xdb, 0x09, 0xb6, 0xdb, 0xda, 0xdb, 0xb6, 0x92, 0xb6, 0x49, 0xda, 0x92,
+	0x82, 0x24, 0x84, 0x00, 0x06, 0x44, 0x8d, 0x8d, 0xb1, 0xb1, 0xb2, 0xb6, 0x84, 0xd6, 0x85, 0xb2,
+	0x82, 0xd2, 0x85, 0xd6, 0x07, 0xb2, 0xb1, 0x8d, 0x69, 0x48, 0x49, 0x69, 0x48, 0x83, 0x44, 0x82,
+	0x48, 0x04, 0x49, 0x48, 0x92, 0x6d, 0xb6, 0x89, 0xdb, 0x05, 0x91, 0xb6, 0xdb, 0xba, 0xdb, 0xdb,
+	0x92, 0xdb, 0x0c, 0xb6, 0xff, 0xda, 0xdb, 0xda, 0x92, 0xb6, 0x69, 0xb6, 0x92, 0x20, 0x24, 0x24,
+	0x84, 0x00, 0x07, 0x69, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xb6, 0xb2, 0x85, 0xd6, 0x84, 0xd2, 0x88,
+	0xd6, 0x06, 0xb1, 0xb1, 0x6d, 0x48, 0x49, 0x69, 0x69, 0x82, 0x48, 0x08, 0x24, 0x24, 0x44, 0x44,
+	0x69, 0x49, 0x6d, 0x8d, 0x92, 0x89, 0xdb, 0x05, 0x91, 0xb6, 0xdb, 0xba, 0xdb, 0xdb, 0x92, 0xdb,
+	0x09, 0xb6, 0xff, 0xda, 0xdb, 0xdb, 0xb2, 0xb6, 0x6d, 0x92, 0xb2, 0x82, 0x24, 0x84, 0x00, 0x03,
+	0x8d, 0xb1, 0xb1, 0xb2, 0x97, 0xd6, 0x06, 0xb2, 0xb1, 0x8d, 0x69, 0x48, 0x69, 0x6d, 0x82, 0x48,
+	0x82, 0x24, 0x05, 0x44, 0x48, 0x8d, 0x49, 0x6d, 0xb6, 0x89, 0xdb, 0x05, 0x8d, 0x92, 0xdb, 0xba,
+	0xda, 0xdb, 0x92, 0xdb, 0x09, 0xd6, 0xff, 0xda, 0xdb, 0xdb, 0xb2, 0xb2, 0x92, 0x6d, 0xb6, 0x82,
+	0x24, 0x83, 0x00, 0x00, 0x24, 0x82, 0xb1, 0x99, 0xd6, 0x09, 0xb1, 0x8d, 0x69, 0x44, 0x44, 0x6d,
+	0x69, 0x48, 0x69, 0x44, 0x83, 0x24, 0x03, 0x91, 0x6d, 0x91, 0xb6, 0x89, 0xdb, 0x05, 0x91, 0x92,
+	0xdb, 0xba, 0xdb, 0xdb, 0x00, 0xda, 0x91, 0xdb, 0x09, 0xd6, 0xff, 0xda, 0xdb, 0xdb, 0xb6, 0xb2,
+	0x92, 0x6d, 0x92, 0x83, 0x24, 0x82, 0x00, 0x03, 0x44, 0xb2, 0xb1, 0xb2, 0x8e, 0xd6, 0x01, 0xd2,
+	0xd2, 0x88, 0xd6, 0x09, 0xb1, 0x8d, 0x69, 0x44, 0x24, 0x44, 0x8d, 0x48, 0x49, 0x48, 0x83, 0x24,
+	0x05, 0x91, 0x6d, 0x6d, 0xdb, 0xdb, 0xdf, 0x87, 0xdb, 0x05, 0x91, 0x92, 0xdb, 0xba, 0xda, 0xdb,
+	0x91, 0xdb, 0x02, 0xda, 0xd6, 0xff, 0x82, 0xdb, 0x08, 0xb6, 0xb6, 0x92, 0x8d, 0x92, 0x48, 0x44,
+	0x24, 0x24, 0x82, 0x00, 0x02, 0x69, 0xd6, 0xb1, 0x86, 0xd6, 0x00, 0xda, 0x92, 0xd6, 0x0a, 0xb2,
+	0x8d, 0x69, 0x44, 0x24, 0x24, 0x69, 0x69, 0x48, 0x69, 0x44, 0x82, 0x24, 0x02, 0x6d, 0x6d, 0x92,
+	0x82, 0xff, 0x87, 0xdb, 0x05, 0x91, 0x91, 0xdb, 0xba, 0xda, 0xdb, 0x91, 0xdb, 0x01, 0xda, 0xda,
+	0x83, 0xdb, 0x82, 0xb6, 0x05, 0x92, 0x8d, 0x49, 0x24, 0x44, 0x24, 0x82, 0x00, 0x05, 0x8d, 0xd6,
+	0xb2, 0xd6, 0xd6, 0xda, 0x91, 0xd6, 0x00, 0xd2, 0x85, 0xd6, 0x09, 0xb1, 0x69, 0x44, 0x24, 0x20,
+	0x48, 0x69, 0x48, 0x69, 0x48, 0x82, 0x24, 0x04, 0x48, 0x69, 0xb6, 0xff, 0xdf, 0x88, 0xdb, 0x05,
+	0x91, 0x8d, 0xdb, 0xda, 0xda, 0xdb, 0x91, 0xdb, 0x02, 0xb6, 0xdb, 0xff, 0x82, 0xdb, 0x08, 0xb6,
+	0xd6, 0xb6, 0x92, 0x6d, 0x49, 0x24, 0x44, 0x24, 0x82, 0x00, 0x05, 0xb1, 0xd6, 0xb2, 0xd6, 0xda,
+	0xda, 0x85, 0xd6, 0x02, 0xd2, 0xb2, 0xb2, 0x8f, 0xd6, 0x09, 0xb1, 0x69, 0x44, 0x24, 0x20, 0x24,
+	0x69, 0x48, 0x49, 0x48, 0x83, 0x24, 0x00, 0x49, 0x8b, 0xdb, 0x05, 0xb2, 0x91, 0xbb, 0xda, 0xda,
+	0xdb, 0x91, 0xdb, 0x02, 0xb6, 0xdb, 0xff, 0x82, 0xdb, 0x06, 0xda, 0xdb, 0xd6, 0xb6, 0x92, 0x48,
+	0x44, 0x82, 0x24, 0x06, 0x00, 0x24, 0xb2, 0xb2, 0xd6, 0xd6, 0xfa, 0x82, 0xd6, 0x02, 0xda, 0xd6,
+	0xd6, 0x87, 0xb2, 0x8b, 0xd6, 0x06, 0xb2, 0x8d, 0x44, 0x24, 0x20, 0x24, 0x68, 0x82, 0x48, 0x00,
+	0x44, 0x82, 0x24, 0x00, 0x6d, 0x8b, 0xdb, 0x05, 0xb6, 0x92, 0x92, 0xdb, 0xda, 0xdb, 0x91, 0xdb,
+	0x01, 0xb6, 0xda, 0x86, 0xdb, 0x08, 0xb6, 0xdb, 0x48, 0x24, 0x44, 0x24, 0x24, 0x00, 0x44, 0x8a,
+	0xd6, 0x8c, 0xb2, 0x85, 0xd6, 0x06, 0xd2, 0xd2, 0x8d, 0x68, 0x24, 0x00, 0x00, 0x83, 0x48, 0x00,
+	0x44, 0x82, 0x24, 0x01, 0x92, 0xdf, 0x83, 0xdb, 0x0c, 0xbb, 0xb6, 0x96, 0x92, 0x72, 0x6d, 0x4d,
+	0x49, 0x6d, 0xb6, 0xdb, 0xda, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x83, 0xdb, 0x00, 0xda, 0x82, 0xdb,
+	0x02, 0xb6, 0xdb, 0x8d, 0x83, 0x24, 0x01, 0x00, 0x49, 0x89, 0xd6, 0x82, 0xb2, 0x00, 0xb1, 0x82,
+	0x91, 0x83, 0x8d, 0x00, 0x91, 0x82, 0xb1, 0x01, 0xb2, 0xb2, 0x83, 0xd6, 0x13, 0xd2, 0x8d, 0x69,
+	0x44, 0x20, 0x00, 0x44, 0x48, 0x44, 0x48, 0x48, 0x24, 0x24, 0x44, 0x6d, 0xb6, 0x92, 0x92, 0x6d,
+	0x6d, 0x86, 0x49, 0x05, 0x4d, 0xb6, 0xdb, 0xba, 0xda, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x83, 0xdb,
+	0x0c, 0xda, 0xdb, 0xdb, 0xff, 0xb6, 0xdb, 0xdb, 0x48, 0x44, 0x44, 0x24, 0x00, 0x69, 0x87, 0xd6,
+	0x03, 0xb2, 0xb2, 0xb1, 0xb1, 0x82, 0x8d, 0x85, 0x69, 0x00, 0x6d, 0x83, 0x8d, 0x14, 0xb1, 0xb1,
+	0xb2, 0xb2, 0xd6, 0xd6, 0xb1, 0x69, 0x44, 0x20, 0x00, 0x24, 0x48, 0x44, 0x44, 0x48, 0x24, 0x44,
+	0x48, 0x48, 0x4d, 0x83, 0x49, 0x0c, 0x4d, 0x6d, 0x6d, 0x72, 0x72, 0x92, 0x92, 0x96, 0xdb, 0xba,
+	0xda, 0xda, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x85, 0xdb, 0x0a, 0xda, 0xdb, 0xb6, 0xda, 0xff, 0x92,
+	0x24, 0x69, 0x24, 0x00, 0x8d, 0x85, 0xd6, 0x82, 0xb2, 0x04, 0xb1, 0x8d, 0x8d, 0x69, 0x68, 0x85,
+	0x44, 0x01, 0x48, 0x48, 0x83, 0x69, 0x82, 0x8d, 0x08, 0xb1, 0xb1, 0xd6, 0xb1, 0x69, 0x44, 0x24,
+	0x00, 0x24, 0x82, 0x44, 0x06, 0x48, 0x44, 0x44, 0x48, 0x49, 0x6d, 0x72, 0x89, 0x92, 0x00, 0xb6,
+	0x82, 0xba, 0x01, 0xda, 0xdb, 0x91, 0xdb, 0x03, 0xb6, 0xdb, 0xdb, 0xda, 0x82, 0xdb, 0x0a, 0xda,
+	0xdb, 0xdb, 0xb6, 0xdb, 0xdb, 0x49, 0x49, 0x44, 0x00, 0x91, 0x83, 0xd6, 0x04, 0xb2, 0xb1, 0xb2,
+	0xb2, 0xb1, 0x82, 0x8d, 0x01, 0x69, 0x44, 0x84, 0x24, 0x83, 0x44, 0x00, 0x48, 0x82, 0x68, 0x0a,
+	0x69, 0x8d, 0x8d, 0xb1, 0xb2, 0xb1, 0x69, 0x68, 0x24, 0x00, 0x24, 0x82, 0x44, 0x04, 0x48, 0x44,
+	0x48, 0x48, 0x6d, 0x88, 0x92, 0x02, 0x96, 0xb6, 0xb6, 0x85, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x88,
+	0xdb, 0x08, 0xb6, 0xdb, 0xff, 0xb6, 0x24, 0x49, 0x20, 0xb2, 0xd6, 0x83, 0xb2, 0x0f, 0xb1, 0xb1,
+	0xb2, 0xb1, 0x8d, 0x69, 0x68, 0x68, 0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x48, 0x83, 0x68,
+	0x83, 0x69, 0x00, 0x8d, 0x82, 0xb1, 0x05, 0x8d, 0x68, 0x24, 0x00, 0x24, 0x24, 0x84, 0x44, 0x04,
+	0x48, 0x6d, 0x92, 0x96, 0x96, 0x82, 0xb6, 0x00, 0xba, 0x8a, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x8b,
+	0xdb, 0x05, 0xff, 0x6d, 0x48, 0x24, 0xb2, 0xb2, 0x82, 0x8d, 0x07, 0xb1, 0x8d, 0xb1, 0xb1, 0x8d,
+	0x8d, 0x69, 0x48, 0x84, 0x44, 0x01, 0x48, 0x68, 0x88, 0x69, 0x82, 0x8d, 0x05, 0xb1, 0xb2, 0x8d,
+	0x69, 0x24, 0x00, 0x82, 0x24, 0x05, 0x44, 0x44, 0x48, 0x24, 0x44, 0x92, 0x91, 0xdb, 0x91, 0xdb,
+	0x00, 0xb6, 0x8d, 0xdb, 0x06, 0x49, 0x69, 0xb2, 0x8d, 0x44, 0x44, 0x69, 0x82, 0x8d, 0x04, 0xb1,
+	0x8d, 0x8d, 0x68, 0x68, 0x82, 0x48, 0x01, 0x68, 0x68, 0x85, 0x69, 0x01, 0x68, 0x68, 0x83, 0x69,
+	0x07, 0x8d, 0x8d, 0xb1, 0xd6, 0x8d, 0x69, 0x44, 0x00, 0x82, 0x24, 0x82, 0x44, 0x03, 0x24, 0x24,
+	0x92, 0xdf, 0x90, 0xdb, 0x91, 0xdb, 0x00, 0xb6, 0x8a, 0xdb, 0x0b, 0xff, 0xdb, 0xff, 0xdb, 0x6d,
+	0x8d, 0x48, 0x24, 0x24, 0x44, 0x68, 0x69, 0x83, 0x8d, 0x08, 0x69, 0x68, 0x68, 0x44, 0x44, 0x68,
+	0x68, 0x44, 0x68, 0x85, 0x69, 0x0b, 0x48, 0x44, 0x69, 0x69, 0x8d, 0x8d, 0xb1, 0xd6, 0x8d, 0x69,
+	0x44, 0x00, 0x83, 0x24, 0x04, 0x44, 0x44, 0x24, 0x24, 0x91, 0x91, 0xdb, 0x91, 0xdb, 0x00, 0xb2,
+	0x84, 0xdb, 0x00, 0xfb, 0x83, 0xdb, 0x82, 0xb6, 0x09, 0x92, 0x92, 0x6d, 0x69, 0x44, 0x24, 0x24,
+	0x44, 0x48, 0x69, 0x82, 0x8d, 0x0b, 0x89, 0x69, 0x68, 0x68, 0x44, 0x44, 0x68, 0x44, 0x44, 0x48,
+	0x44, 0x48, 0x82, 0x69, 0x0d, 0x8d, 0x8d, 0x68, 0x44, 0x69, 0x8d, 0x8d, 0xb1, 0xb2, 0xb1, 0x69,
+	0x44, 0x20, 0x20, 0x82, 0x24, 0x04, 0x44, 0x44, 0x24, 0x24, 0xb6, 0x91, 0xdb, 0x91, 0xdb, 0x01,
+	0xb2, 0xff, 0x82, 0xdb, 0x03, 0xb6, 0xb6, 0x92, 0x92, 0x85, 0x6d, 0x01, 0x92, 0x6d, 0x82, 0x48,
+	0x00, 0x68, 0x83, 0x69, 0x06, 0x8d, 0x8d, 0x89, 0x69, 0x69, 0x68, 0x48, 0x84, 0x44, 0x82, 0x24,
+	0x0d, 0x44, 0x48, 0x69, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0x8d, 0x91, 0xb2, 0xb1, 0x8d, 0x48, 0x84,
+	0x24, 0x04, 0x44, 0x48, 0x24, 0x48, 0xb6, 0x91, 0xdb, 0x91, 0xdb, 0x02, 0x92, 0x92, 0x71, 0x86,
+	0x6d, 0x00, 0x72, 0x83, 0x92, 0x06, 0x96, 0x6d, 0x69, 0x6d, 0x69, 0x68, 0x48, 0x82, 0x68, 0x82,
+	0x8d, 0x0f, 0x69, 0x69, 0x68, 0x48, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x20, 0x24, 0x44, 0x48,
+	0x44, 0x48, 0x82, 0x69, 0x01, 0x8d, 0x8d, 0x82, 0xb1, 0x03, 0x8d, 0x68, 0x24, 0x20, 0x82, 0x24,
+	0x03, 0x44, 0x48, 0x24, 0x49, 0x92, 0xdb, 0x92, 0xdb, 0x83, 0x6d, 0x00, 0x72, 0x85, 0x92, 0x00,
+	0x96, 0x83, 0xb6, 0x02, 0x91, 0x6d, 0x48, 0x83, 0x44, 0x01, 0x68, 0x69, 0x82, 0x8d, 0x0a, 0x69,
+	0x69, 0x48, 0x44, 0x44, 0x24, 0x24, 0x48, 0x24, 0x24, 0x44, 0x82, 0x69, 0x04, 0x68, 0x68, 0x69,
+	0x69, 0x8d, 0x83, 0xb1, 0x01, 0x8d, 0x69, 0x84, 0x24, 0x03, 0x44, 0x49, 0x48, 0x6d, 0x92, 0xdb,
+	0x92, 0xdb, 0x01, 0xb6, 0x72, 0x82, 0x92, 0x00, 0x96, 0x82, 0xb6, 0x00, 0xda, 0x85, 0xdb, 0x04,
+	0xda, 0x6d, 0x48, 0x24, 0x24, 0x83, 0x44, 0x0c, 0xb1, 0xb2, 0x8d, 0x89, 0x69, 0x48, 0x48, 0x44,
+	0x24, 0x24, 0x48, 0x49, 0x48, 0x83, 0x69, 0x00, 0x89, 0x82, 0x8d, 0x01, 0xb1, 0xb1, 0x82, 0xb2,
+	0x01, 0x8d, 0x69, 0x84, 0x24, 0x03, 0x48, 0x48, 0x49, 0xb6, 0x92, 0xdb, 0x93, 0xdb, 0x00, 0xba,
+	0x8e, 0xdb, 0x00, 0x92, 0x82, 0x24, 0x0a, 0x49, 0x69, 0x44, 0x44, 0xd6, 0xd6, 0xb2, 0x8d, 0x69,
+	0x68, 0x68, 0x86, 0x44, 0x03, 0x68, 0x69, 0x69, 0x8d, 0x82, 0xb1, 0x06, 0xb2, 0xb2, 0xb6, 0xd6,
+	0xd6, 0xb1, 0x69, 0x83, 0x24, 0x03, 0x44, 0x48, 0x24, 0x6d, 0x93, 0xdb, 0xa3, 0xdb, 0x0e, 0xb6,
+	0x49, 0x44, 0x49, 0x6d, 0x69, 0x24, 0x8d, 0xfa, 0xd6, 0xd6, 0xb1, 0x8d, 0x69, 0x68, 0x83, 0x44,
+	0x08, 0x68, 0x44, 0x44, 0x68, 0x69, 0x69, 0x8d, 0xb1, 0xb1, 0x82, 0xb2, 0x82, 0xd6, 0x02, 0xb2,
+	0x8d, 0x44, 0x82, 0x24, 0x02, 0x48, 0x44, 0x6d, 0x94, 0xdb, 0xa3, 0xdb, 0x08, 0xda, 0x92, 0x69,
+	0x69, 0x68, 0x44, 0x44, 0xd6, 0xfa, 0x82, 0xd6, 0x03, 0xb1, 0x8d, 0x69, 0x68, 0x82, 0x44, 0x82,
+	0x68, 0x06, 0x69, 0x69, 0x89, 0x8d, 0xb1, 0xb1, 0xb2, 0x85, 0xd6, 0x07, 0x8d, 0x44, 0x24, 0x24,
+	0x48, 0x8d, 0x69, 0xba, 0x94, 0xdb, 0xa5, 0xdb, 0x06, 0x6d, 0x68, 0x68, 0x44, 0x69, 0xfa, 0xfa,
+	0x83, 0xd6, 0x03, 0xb1, 0x89, 0x69, 0x68, 0x82, 0x48, 0x07, 0x68, 0x68, 0x69, 0x69, 0x8d, 0xb1,
+	0xb2, 0xb2, 0x86, 0xd6, 0x06, 0xb1, 0x48, 0x44, 0x24, 0x48, 0x8d, 0xb2, 0x95, 0xdb, 0xa5, 0xdb,
+	0x06, 0xb2, 0x6d, 0x69, 0x48, 0xb1, 0xfa, 0xda, 0x84, 0xd6, 0x05, 0xad, 0x8d, 0x69, 0x69, 0x68,
+	0x68, 0x82, 0x69, 0x04, 0x8d, 0xb1, 0xb2, 0xb2, 0xb6, 0x86, 0xd6, 0x06, 0xb2, 0x69, 0x44, 0x24,
+	0x44, 0x89, 0xd6, 0x95, 0xdb, 0xa5, 0xdb, 0x05, 0xb6, 0x8d, 0x69, 0x69, 0xd6, 0xfa, 0x85, 0xd6,
+	0x00, 0xb2, 0x82, 0x8d, 0x84, 0x69, 0x03, 0x8d, 0x8d, 0xb1, 0xb2, 0x87, 0xd6, 0x05, 0xb2, 0x69,
+	0x48, 0x24, 0x44, 0x89, 0x96, 0xdb, 0xa5, 0xdb, 0x05, 0xd6, 0x91, 0x8d, 0x8d, 0xd6, 0xfa, 0x86,
+	0xd6, 0x00, 0xb1, 0x87, 0x8d, 0x01, 0xb1, 0xb2, 0x86, 0xd6, 0x07, 0xd2, 0xd6, 0xb1, 0x69, 0x48,
+	0x24, 0x64, 0xad, 0x96, 0xdb, 0xa5, 0xdb, 0x04, 0xd6, 0xb1, 0x8d, 0xb1, 0xfa, 0x87, 0xd6, 0x00,
+	0xb2, 0x84, 0xb1, 0x02, 0xad, 0xb1, 0xb1, 0x83, 0xb2, 0x83, 0xd2, 0x09, 0xb2, 0xb2, 0xd2, 0xb1,
+	0x69, 0x44, 0x44, 0xb1, 0xb2, 0xda, 0x95, 0xdb, 0xa5, 0xdb, 0x04, 0xd6, 0xb2, 0xb1, 0xd6, 0xfa,
+	0x85, 0xd6, 0x03, 0xd2, 0xd2, 0xb2, 0xb2, 0x8a, 0xb1, 0x84, 0xb2, 0x09, 0xb1, 0xb2, 0xb1, 0x69,
+	0x24, 0x8d, 0xd6, 0xb2, 0xb6, 0xb6, 0x94, 0xdb, 0xa5, 0xdb, 0x04, 0xd6, 0xb2, 0xb2, 0xd6, 0xfa,
+	0x84, 0xd6, 0x01, 0xd2, 0xb1, 0x82, 0xb2, 0x82, 0xb1, 0x01, 0xb2, 0xb2, 0x89, 0xb1, 0x82, 0xb2,
+	0x08, 0xb1, 0x68, 0x48, 0xd6, 0xd6, 0x6d, 0x6d, 0x91, 0xb6, 0x93, 0xdb, 0xa5, 0xdb, 0x04, 0xb6,
+	0xb2, 0xd2, 0xd6, 0xf6, 0x84, 0xd6, 0x86, 0xb1, 0x83, 0xb2, 0x89, 0xb1, 0x0a, 0xb2, 0xb2, 0xb1,
+	0x44, 0x6d, 0xd6, 0xb2, 0x20, 0x24, 0x6d, 0xb6, 0x93, 0xdb, 0xa5, 0xdb, 0x01, 0xd6, 0xb2, 0x87,
+	0xd6, 0x03, 0xb2, 0xb1, 0xad, 0xad, 0x87, 0xb1, 0x01, 0xad, 0xad, 0x87, 0xb1, 0x09, 0xb2, 0x91,
+	0x8d, 0xb1, 0x8d, 0x24, 0x24, 0x49, 0x92, 0xba, 0x93, 0xdb, 0x82, 0xda, 0xa2, 0xdb, 0x03, 0xd6,
+	0xb2, 0xd6, 0xfa, 0x82, 0xd6, 0x01, 0xda, 0xd6, 0x82, 0xd2, 0x03, 0xb1, 0x8d, 0x8d, 0xad, 0x88,
+	0xb1, 0x02, 0xad, 0xb1, 0xad, 0x85, 0xb1, 0x07, 0x8d, 0x8d, 0x48, 0x20, 0x24, 0x49, 0x92, 0xb6,
+	0x93, 0xdb, 0x02, 0xb6, 0xda, 0xda, 0xa3, 0xdb, 0x00, 0xb2, 0x84, 0xd6, 0x02, 0xda, 0xd6, 0xd6,
+	0x82, 0xd2, 0x03, 0x8d, 0x89, 0x8d, 0xad, 0x86, 0xb1, 0x04, 0xad, 0xad, 0xb1, 0xad, 0xad, 0x84,
+	0xb1, 0x01, 0x24, 0x24, 0x82, 0x6d, 0x02, 0x92, 0x92, 0xba, 0x93, 0xdb, 0x82, 0xb6, 0x00, 0xda,
+	0xa2, 0xdb, 0x00, 0xb6, 0x85, 0xd6, 0x01, 0xd2, 0xd6, 0x82, 0xd2, 0x01, 0xad, 0x89, 0x82, 0x8d,
+	0x00, 0xad, 0x83, 0xb1, 0x82, 0xad, 0x02, 0xb1, 0xad, 0xad, 0x83, 0xb1, 0x03, 0x8d, 0x20, 0x24,
+	0x8d, 0x83, 0xb6, 0x94, 0xdb, 0x82, 0xb6, 0x00, 0xda, 0x87, 0xdb, 0x00, 0xda, 0x99, 0xdb, 0x82,
+	0xd6, 0x00, 0xd2, 0x84, 0xb1, 0x82, 0xd2, 0x05, 0xb1, 0x8d, 0x8d, 0x89, 0x8d, 0xad, 0x84, 0xb1,
+	0x84, 0x8d, 0x83, 0xb1, 0x07, 0x8d, 0x24, 0x24, 0x48, 0x91, 0xb6, 0x92, 0xb6, 0x94, 0xdb, 0x82,
+	0xb6, 0x00, 0xda, 0x87, 0xdb, 0x00, 0xda, 0x99, 0xdb, 0x01, 0xda, 0xb2, 0x82, 0xb1, 0x82, 0x8d,
+	0x08, 0xad, 0xb1, 0xd2, 0xd2, 0xb1, 0x8d, 0xad, 0x8d, 0x8d, 0x82, 0xad, 0x82, 0xb1, 0x00, 0xad,
+	0x82, 0x8d, 0x01, 0xad, 0xad, 0x82, 0xb1, 0x06, 0x6d, 0x48, 0x44, 0x49, 0x6d, 0x91, 0xb6, 0x95,
+	0xdb, 0x02, 0x92, 0xb6, 0xb6, 0x87, 0xdb, 0x01, 0xda, 0xda, 0x9a, 0xdb, 0x00, 0xb1, 0x83, 0x8d,
+	0x05, 0x69, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0x83, 0xad, 0x0a, 0x8d, 0x8d, 0xb1, 0xad, 0xad, 0xb1,
+	0xb1, 0xad, 0x8d, 0x8d, 0xad, 0x82, 0xb1, 0x02, 0x8d, 0xb1, 0x69, 0x82, 0x6d, 0x98, 0xdb, 0x03,
+	0x92, 0x96, 0xb6, 0xda, 0x86, 0xdb, 0x03, 0xda, 0xda, 0xdb, 0xda, 0x98, 0xdb, 0x0b, 0xb6, 0x69,
+	0x68, 0x69, 0x69, 0x44, 0x24, 0x44, 0x64, 0x68, 0x89, 0xad, 0x82, 0xb1, 0x14, 0xad, 0xad, 0xb1,
+	0xb1, 0xad, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0xb1, 0xb1, 0x69, 0x91, 0x92,
+	0x6d, 0xb6, 0x97, 0xdb, 0x02, 0x92, 0x96, 0xb6, 0x87, 0xdb, 0x04, 0xda, 0xda, 0xdb, 0xda, 0xda,
+	0x97, 0xdb, 0x04, 0xd6, 0xb1, 0x69, 0x68, 0x68, 0x84, 0x44, 0x00, 0x69, 0x87, 0xb1, 0x10, 0xad,
+	0xb1, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0xad, 0xad, 0xb1, 0x91, 0x6d, 0x92, 0x91, 0x92, 0xb6,
+	0x97, 0xdb, 0x02, 0x92, 0x96, 0xb6, 0x86, 0xdb, 0x82, 0xda, 0x01, 0xdb, 0xda, 0x98, 0xdb, 0x82,
+	0xd6, 0x01, 0x69, 0x68, 0x83, 0x44, 0x00, 0x69, 0x88, 0xb1, 0x03, 0xad, 0xb1, 0xb1, 0xad, 0x83,
+	0x8d, 0x06, 0xb1, 0x8d, 0x8d, 0x91, 0xb2, 0xb6, 0xb6, 0x99, 0xdb, 0x02, 0x92, 0x96, 0xb6, 0x86,
+	0xdb, 0x01, 0xda, 0xba, 0x82, 0xda, 0x99, 0xdb, 0x02, 0xd6, 0xb2, 0x6d, 0x83, 0x44, 0x01, 0x48,
+	0x8d, 0x8b, 0xb1, 0x00, 0xad, 0x83, 0x8d, 0x04, 0xad, 0x8d, 0x8d, 0x91, 0xb6, 0x9b, 0xdb, 0x02,
+	0x92, 0x96, 0xb6, 0x86, 0xdb, 0x01, 0xda, 0xba, 0x83, 0xda, 0x98, 0xdb, 0x02, 0xb2, 0xb1, 0x8d,
+	0x82, 0x44, 0x01, 0x48, 0x68, 0x82, 0x8d, 0x88, 0xb1, 0x01, 0xad, 0xad, 0x85, 0x8d, 0x02, 0xb1,
+	0x8d, 0xda, 0x9b, 0xdb, 0x02, 0x92, 0x92, 0xb6, 0x86, 0xdb, 0x01, 0xda, 0xb6, 0x83, 0xda, 0x98,
+	0xdb, 0x08, 0xb1, 0xb1, 0x8d, 0x68, 0x44, 0x44, 0x68, 0x69, 0x69, 0x85, 0x8d, 0x85, 0xb1, 0x00,
+	0xad, 0x86, 0x8d, 0x01, 0x91, 0xda, 0x96, 0xdb, 0x84, 0xda, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x85,
+	0xdb, 0x01, 0xda, 0xb6, 0x83, 0xda, 0x98, 0xdb, 0x09, 0xb2, 0x91, 0x8d, 0x69, 0x44, 0x44, 0x69,
+	0x8d, 0x89, 0x8d, 0x82, 0x89, 0x82, 0x8d, 0x84, 0xb1, 0x87, 0x8d, 0x01, 0x91, 0xda, 0x95, 0xdb,
+	0x05, 0xda, 0xdb, 0xda, 0xda, 0xdb, 0xda, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x84, 0xdb, 0x02, 0xda,
+	0xba, 0xb6, 0x83, 0xda, 0x98, 0xdb, 0x07, 0xb6, 0xb1, 0xb2, 0xb1, 0x89, 0x69, 0x8d, 0xad, 0x84,
+	0x8d, 0x03, 0x69, 0x69, 0x8d, 0xad, 0x82, 0xb1, 0x00, 0xad, 0x87, 0x8d, 0x01, 0xb1, 0xda, 0x94,
+	0xdb, 0x85, 0xda, 0x00, 0xba, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x84, 0xdb, 0x02, 0xda, 0xb6, 0xb6,
+	0x82, 0xda, 0x99, 0xdb, 0x07, 0xda, 0x91, 0xb1, 0xd2, 0xd6, 0xb2, 0xad, 0xad, 0x82, 0xb1, 0x09,
+	0x8d, 0x8d, 0x69, 0x68, 0x69, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0x87, 0x8d, 0x06, 0xb1, 0x6d, 0x24,
+	0x49, 0x49, 0x6d, 0xb6, 0x91, 0xdb, 0x04, 0xda, 0xda, 0xdb, 0xdb, 0xba, 0x03, 0x92, 0x92, 0xb6,
+	0xda, 0x84, 0xdb, 0x02, 0xda, 0xb6, 0xb6, 0x83, 0xda, 0x99, 0xdb, 0x06, 0xb2, 0x89, 0x8d, 0xb1,
+	0x8d, 0x68, 0x68, 0x82, 0x89, 0x04, 0x69, 0x68, 0x44, 0x44, 0x68, 0x82, 0x8d, 0x82, 0xad, 0x84,
+	0x8d, 0x03, 0x69, 0x8d, 0xd2, 0x6d, 0x83, 0x00, 0x01, 0x24, 0xb6, 0x8f, 0xdb, 0x05, 0xda, 0xdb,
+	0xdb, 0xda, 0xdb, 0xba, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x83, 0xdb, 0x04, 0xda, 0xda, 0xb6, 0xb6,
+	0xba, 0x83, 0xda, 0x99, 0xdb, 0x04, 0x8d, 0x64, 0x64, 0x44, 0x44, 0x82, 0x40, 0x85, 0x44, 0x00,
+	0x69, 0x88, 0x8d, 0x0a, 0x69, 0x69, 0x8d, 0xb1, 0xb2, 0x24, 0x00, 0x00, 0x24, 0x04, 0x49, 0x8e,
+	0xdb, 0x84, 0xda, 0x01, 0xb6, 0xb6, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x83, 0xdb, 0x04, 0xda, 0xda,
+	0xb6, 0xb6, 0xba, 0x82, 0xda, 0x9a, 0xdb, 0x02, 0xb6, 0x89, 0x64, 0x82, 0x44, 0x09, 0x64, 0x69,
+	0x89, 0x89, 0x8d, 0x89, 0x68, 0x44, 0x68, 0x89, 0x86, 0x8d, 0x08, 0x69, 0x68, 0x8d, 0xad, 0xb1,
+	0xd6, 0x8d, 0x00, 0x00, 0x82, 0x24, 0x00, 0xb6, 0x8c, 0xdb, 0x83, 0xda, 0x03, 0xba, 0xda, 0xba,
+	0xba, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x83, 0xdb, 0x04, 0xda, 0xba, 0xb6, 0xb6, 0xba, 0x82, 0xda,
+	0x9a, 0xdb, 0x02, 0xb6, 0x8d, 0x89, 0x82, 0x64, 0x82, 0x89, 0x82, 0x8d, 0x03, 0x69, 0x68, 0x68,
+	0x69, 0x86, 0x8d, 0x12, 0x69, 0x69, 0x8d, 0xad, 0xb1, 0xb1, 0xd6, 0x69, 0x00, 0x24, 0x24, 0x00,
+	0x92, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0x82, 0xdb, 0x04, 0xda, 0xda, 0xba, 0xb6, 0xba, 0x83,
+	0xda, 0x02, 0xba, 0xba, 0xb6, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x83, 0xdb, 0x03, 0xda, 0xba, 0xb6,
+	0xb6, 0x83, 0xda, 0x9b, 0xdb, 0x0f, 0x91, 0x89, 0x89, 0x69, 0x69, 0x64, 0x89, 0x89, 0x69, 0x68,
+	0x69, 0x69, 0x68, 0x69, 0x69, 0x89, 0x84, 0x8d, 0x03, 0x69, 0x69, 0x8d, 0xad, 0x83, 0xb1, 0x00,
+	0x8d, 0x82, 0x24, 0x04, 0x00, 0x49, 0xb6, 0xdb, 0xdb, 0x84, 0xda, 0x00, 0xdb, 0x83, 0xda, 0x84,
+	0xba, 0x02, 0xda, 0xba, 0xb6, 0x03, 0x92, 0x92, 0xb6, 0xda, 0x82, 0xdb, 0x01, 0xda, 0xda, 0x82,
+	0xb6, 0x83, 0xda, 0x9b, 0xdb, 0x02, 0xb6, 0x8d, 0x69, 0x8a, 0x68, 0x00, 0x69, 0x84, 0x8d, 0x04,
+	0x69, 0x68, 0x89, 0x8d, 0xad, 0x83, 0xb1, 0x01, 0x69, 0x00, 0x84, 0x24, 0x03, 0x49, 0xb6, 0xdb,
+	0xdb, 0x88, 0xda, 0x82, 0xba, 0x00, 0xda, 0x82, 0xb6, 0x02, 0x92, 0xb6, 0xb6, 0x83, 0xdb, 0x01,
+	0xda, 0xda, 0x82, 0xb6, 0x83, 0xda, 0x9b, 0xdb, 0x08, 0xb6, 0xb1, 0x8d, 0x69, 0x68, 0x68, 0x48,
+	0x48, 0x68, 0x82, 0x48, 0x82, 0x68, 0x83, 0x8d, 0x05, 0x69, 0x68, 0x68, 0x8d, 0x8d, 0xad, 0x82,
+	0xb1, 0x02, 0xad, 0x24, 0x00, 0x84, 0x24, 0x09, 0x00, 0x24, 0xb6, 0xb6, 0xdb, 0xdb, 0xb6, 0xb6,
+	0xba, 0xb6, 0x83, 0xba, 0x02, 0xb6, 0xb6, 0xba, 0x82, 0xb6, 0x05, 0x92, 0xb6, 0xb6, 0xda, 0xdb,
+	0xdb, 0x82, 0xda, 0x82, 0xb6, 0x83, 0xda, 0x96, 0xdb, 0x0b, 0xda, 0xdb, 0xdb, 0xda, 0xdb, 0xb6,
+	0xb2, 0xb2, 0x69, 0x68, 0x48, 0x48, 0x86, 0x68, 0x00, 0x69, 0x82, 0x8d, 0x02, 0x69, 0x68, 0x68,
+	0x82, 0x8d, 0x00, 0xad, 0x82, 0xb1, 0x00, 0x48, 0x83, 0x00, 0x86, 0x24, 0x05, 0x49, 0x92, 0xdb,
+	0xdb, 0xda, 0xba, 0x89, 0xb6, 0x04, 0x92, 0xb6, 0xb6, 0xda, 0xdb, 0x83, 0xda, 0x82, 0xb6, 0x83,
+	0xda, 0x96, 0xdb, 0x82, 0xda, 0x05, 0xba, 0xda, 0xba, 0xb2, 0xb2, 0x8d, 0x82, 0x68, 0x00, 0x69,
+	0x82, 0x8d, 0x83, 0x69, 0x82, 0x8d, 0x02, 0x68, 0x68, 0x89, 0x82, 0x8d, 0x03, 0xad, 0xb1, 0xb1,
+	0x69, 0x84, 0x00, 0x86, 0x24, 0x08, 0x04, 0x24, 0x6d, 0x91, 0xb6, 0xb6, 0xdb, 0xdb, 0xba, 0x86,
+	0xb6, 0x04, 0x92, 0xb6, 0xb6, 0xdb, 0xdb, 0x82, 0xda, 0x00, 0xba, 0x82, 0xb6, 0x83, 0xda, 0x93,
+	0xdb, 0x84, 0xda, 0x0a, 0xba, 0xb6, 0xda, 0xb6, 0x6d, 0xd6, 0xb1, 0x69, 0x68, 0x69, 0x8d, 0x82,
+	0xb1, 0x84, 0x8d, 0x03, 0x69, 0x68, 0x68, 0x89, 0x83, 0x8d, 0x03, 0xad, 0xb1, 0x8d, 0x20, 0x84,
+	0x00, 0x8b, 0x24, 0x04, 0x49, 0x49, 0x92, 0xb6, 0xda, 0x85, 0xb6, 0x02, 0x92, 0xb6, 0xb6, 0x84,
+	0xda, 0x83, 0xb6, 0x00, 0xba, 0x83, 0xda, 0x92, 0xdb, 0x83, 0xda, 0x0f, 0xba, 0xba, 0xb6, 0xdb,
+	0x6d, 0x44, 0xb1, 0xb1, 0x69, 0x68, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0xad, 0x82, 0x8d, 0x03, 0x69,
+	0x68, 0x68, 0x89, 0x84, 0x8d, 0x02, 0xad, 0x8d, 0x20, 0x85, 0x00, 0x8f, 0x24, 0x01, 0x6d, 0xda,
+	0x84, 0xb6, 0x02, 0x92, 0xb6, 0xb6, 0x84, 0xda, 0x84, 0xb6, 0x02, 0xba, 0xda, 0xda, 0x92, 0xdb,
+	0x83, 0xda, 0x0e, 0xba, 0xba, 0xb6, 0xb6, 0xda, 0x49, 0x24, 0x8d, 0x8d, 0x69, 0x48, 0x69, 0x8d,
+	0x8d, 0xad, 0x84, 0x8d, 0x03, 0x48, 0x48, 0x69, 0x89, 0x84, 0x8d, 0x01, 0x69, 0x20, 0x85, 0x00,
+	0x90, 0x24, 0x02, 0x04, 0x6d, 0xda, 0x83, 0xb6, 0x00, 0x92, 0x82, 0xb6, 0x05, 0xda, 0xda, 0xba,
+	0xb6, 0xba, 0xba, 0x82, 0xb6, 0x00, 0xba, 0x82, 0xda, 0x8f, 0xdb, 0x83, 0xda, 0x0e, 0xba, 0xda,
+	0xba, 0xb6, 0xb6, 0xda, 0x92, 0x24, 0x24, 0x49, 0x69, 0x44, 0x48, 0x68, 0x69, 0x84, 0x8d, 0x05,
+	0x69, 0x48, 0x44, 0x69, 0x69, 0x89, 0x83, 0x8d, 0x00, 0x68, 0x87, 0x00, 0x83, 0x24, 0x00, 0x04,
+	0x8c, 0x24, 0x02, 0x00, 0x71, 0xda, 0x82, 0xb6, 0x01, 0x92, 0x96, 0x83, 0xb6, 0x03, 0xda, 0xdb,
+	0xb6, 0x6d, 0x82, 0xb6, 0x00, 0xba, 0x82, 0xda, 0x90, 0xdb, 0x04, 0xda, 0xda, 0xb6, 0xba, 0xba,
+	0x82, 0xb6, 0x01, 0xdb, 0x6d, 0x82, 0x24, 0x02, 0x48, 0x48, 0x44, 0x82, 0x69, 0x00, 0x8d, 0x82,
+	0x69, 0x01, 0x44, 0x44, 0x83, 0x69, 0x03, 0x89, 0x8d, 0x8d, 0x44, 0x86, 0x00, 0x88, 0x24, 0x01,
+	0x00, 0x04, 0x8a, 0x24, 0x00, 0x92, 0x82, 0xb6, 0x00, 0x92, 0x83, 0xb6, 0x0b, 0xda, 0xb6, 0x6d,
+	0x00, 0x00, 0x92, 0xba, 0xb6, 0xba, 0xba, 0xda, 0xda, 0x8f, 0xdb, 0x84, 0xda, 0x83, 0xb6, 0x01,
+	0xba, 0x49, 0x83, 0x24, 0x03, 0x44, 0x44, 0x48, 0x48, 0x82, 0x68, 0x82, 0x44, 0x00, 0x68, 0x83,
+	0x69, 0x02, 0x89, 0x89, 0x44, 0x87, 0x00, 0x88, 0x24, 0x00, 0x00, 0x8c, 0x24, 0x82, 0xb6, 0x0a,
+	0x71, 0x6d, 0x49, 0x49, 0x4d, 0x91, 0x24, 0x24, 0x00, 0x49, 0x92, 0x82, 0xb6, 0x00, 0xba, 0x82,
+	0xda, 0x8b, 0xdb, 0x02, 0xda, 0xdb, 0xdb, 0x82, 0xda, 0x82, 0xba, 0x03, 0xb6, 0xb6, 0xda, 0xb6,
+	0x84, 0x24, 0x04, 0x00, 0x00, 0x24, 0x48, 0x48, 0x82, 0x44, 0x00, 0x48, 0x85, 0x69, 0x01, 0x68,
+	0x24, 0x85, 0x00, 0x8b, 0x24, 0x03, 0x00, 0x04, 0x24, 0x04, 0x89, 0x24, 0x02, 0x28, 0x92, 0xb6,
+	0x00, 0x25, 0x82, 0x29, 0x06, 0x49, 0x29, 0x24, 0x24, 0x49, 0x6d, 0x92, 0x83, 0xb6, 0x82, 0xda,
+	0x8a, 0xdb, 0x02, 0xda, 0xda, 0xdb, 0x82, 0xda, 0x01, 0xba, 0xba, 0x83, 0xb6, 0x01, 0xdb, 0x92,
+	0x84, 0x24, 0x82, 0x00, 0x05, 0x24, 0x49, 0x24, 0x69, 0x8d, 0x8d, 0x83, 0x69, 0x02, 0x68, 0x44,
+	0x24, 0x8b, 0x00, 0x01, 0x24, 0x00, 0x82, 0x04, 0x03, 0x24, 0x24, 0x00, 0x00, 0x8e, 0x24, 0x0a,
+	0x4d, 0x6d, 0x92, 0x6d, 0x49, 0x49, 0x24, 0x24, 0x6d, 0x6d, 0x92, 0x83, 0xb6, 0x82, 0xda, 0x89,
+	0xdb, 0x85, 0xda, 0x00, 0xba, 0x85, 0xb6, 0x01, 0xda, 0x49, 0x84, 0x24, 0x83, 0x00, 0x09, 0x48,
+	0x24, 0x24, 0xb1, 0x8d, 0x69, 0x68, 0x48, 0x44, 0x20, 0x90, 0x00, 0x09, 0x04, 0x04, 0x24, 0x24,
+	0x00, 0x00, 0x04, 0x04, 0x24, 0x04, 0x8a, 0x24, 0x0a, 0x72, 0x6d, 0x6d, 0x24, 0x24, 0x28, 0x24,
+	0x24, 0x49, 0x6d, 0x91, 0x84, 0xb6, 0x82, 0xda, 0x88, 0xdb, 0x86, 0xda, 0x86, 0xb6, 0x86, 0x24,
+	0x83, 0x00, 0x03, 0x49, 0x00, 0x24, 0x69, 0x83, 0x48, 0x83, 0x24, 0x8d, 0x00, 0x00, 0x04, 0x82,
+	0x24, 0x00, 0x00, 0x83, 0x04, 0x01, 0x00, 0x04, 0x89, 0x24, 0x00, 0x29, 0x84, 0x24, 0x04, 0x00,
+	0x24, 0x49, 0x6d, 0x6d, 0x85, 0xb6, 0x85, 0xda, 0x83, 0xdb, 0x86, 0xda, 0x00, 0xba, 0x84, 0xb6,
+	0x01, 0xda, 0x92, 0x86, 0x24, 0x83, 0x00, 0x04, 0x24, 0x24, 0x00, 0x48, 0x69, 0x82, 0x49, 0x01,
+	0x48, 0x48, 0x83, 0x49, 0x01, 0x24, 0x24, 0x89, 0x00, 0x07, 0x04, 0x24, 0x24, 0x04, 0x00, 0x00,
+	0x04, 0x24, 0x83, 0x04, 0x88, 0x24, 0x84, 0x24, 0x05, 0x49, 0x24, 0x24, 0x4d, 0x6d, 0x6d, 0x85,
+	0xb6, 0x00, 0xba, 0x8f, 0xda, 0x85, 0xb6, 0x02, 0xda, 0x6d, 0x00, 0x85, 0x24, 0x83, 0x00, 0x00,
+	0x24, 0x82, 0x49, 0x88, 0x00, 0x04, 0x24, 0x48, 0x49, 0x49, 0x24, 0x88, 0x00, 0x01, 0x24, 0x24,
+	0x82, 0x00, 0x82, 0x04, 0x02, 0x00, 0x00, 0x04, 0x88, 0x24, 0x83, 0x24, 0x06, 0x49, 0x6d, 0x24,
+	0x24, 0x4d, 0x4d, 0x6d, 0x86, 0xb6, 0x8b, 0xda, 0x03, 0xba, 0xda, 0xda, 0xba, 0x86, 0xb6, 0x00,
+	0x49, 0x86, 0x24, 0x83, 0x00, 0x02, 0x24, 0x92, 0x8d, 0x8c, 0x00, 0x04, 0x24, 0x49, 0x49, 0x48,
+	0x24, 0x85, 0x00, 0x04, 0x04, 0x24, 0x00, 0x00, 0x04, 0x85, 0x00, 0x82, 0x24, 0x00, 0x04, 0x84,
+	0x24, 0x82, 0x24, 0x02, 0x49, 0x91, 0x6d, 0x82, 0x49, 0x02, 0x4d, 0x6d, 0x92, 0x86, 0xb6, 0x01,
+	0xba, 0xba, 0x84, 0xda, 0x03, 0xba, 0xda, 0xda, 0xba, 0x89, 0xb6, 0x00, 0x92, 0x87, 0x24, 0x83,
+	0x00, 0x02, 0x49, 0x91, 0x49, 0x8e, 0x00, 0x00, 0x24, 0x82, 0x49, 0x00, 0x24, 0x83, 0x00, 0x01,
+	0x24, 0x24, 0x86, 0x00, 0x05, 0x04, 0x00, 0x24, 0x24, 0x04, 0x04, 0x84, 0x24, 0x0b, 0x24, 0x49,
+	0x6d, 0x91, 0x91, 0x6d, 0x49, 0x6d, 0x49, 0x49, 0x6d, 0x92, 0x89, 0xb6, 0x02, 0xba, 0xda, 0xba,
+	0x82, 0xda, 0x00, 0xba, 0x89, 0xb6, 0x01, 0xba, 0x6d, 0x87, 0x24, 0x83, 0x00, 0x02, 0x6d, 0x92,
+	0x24, 0x91, 0x00, 0x08, 0x48, 0x49, 0x49, 0x48, 0x24, 0x00, 0x00, 0x24, 0x04, 0x86, 0x00, 0x01,
+	0x04, 0x24, 0x82, 0x00, 0x00, 0x04, 0x82, 0x24, 0x00, 0x04, 0x0b, 0xb6, 0xb6, 0x8d, 0x8d, 0x91,
+	0x6d, 0xb6, 0xda, 0xb6, 0x71, 0x6d, 0x92, 0x8c, 0xb6, 0x01, 0xba, 0xda, 0x8c, 0xb6, 0x00, 0x49,
+	0x87, 0x24, 0x83, 0x00, 0x02, 0x6d, 0x92, 0x24, 0x93, 0x00, 0x06, 0x24, 0x49, 0x6d, 0x6d, 0x24,
+	0x00, 0x04, 0x86, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x82, 0x00, 0x82, 0x04, 0x05, 0xda, 0xb6,
+	0x6d, 0x91, 0x91, 0xb6, 0x83, 0xdb, 0x9d, 0xb6, 0x88, 0x24, 0x82, 0x00, 0x03, 0x24, 0x49, 0x49,
+	0x24, 0x95, 0x00, 0x04, 0x24, 0x48, 0x00, 0x00, 0x24, 0x86, 0x00, 0x82, 0x04, 0x06, 0x00, 0x04,
+	0x00, 0x00, 0x24, 0x00, 0x04, 0x0c, 0xda, 0xb6, 0x8d, 0x91, 0x91, 0xda, 0xdb, 0xda, 0xb6, 0xb6,
+	0xda, 0xda, 0xdb, 0x99, 0xb6, 0x00, 0x92, 0x88, 0x24, 0x83, 0x00, 0x01, 0x6d, 0x6d, 0xa3, 0x00,
+	0x05, 0x24, 0x04, 0x00, 0x04, 0x00, 0x00, 0x82, 0x04, 0x04, 0xda, 0xb6, 0x8d, 0x91, 0x91, 0x85,
+	0xb6, 0x06, 0xdb, 0xdb, 0xb6, 0xd6, 0xda, 0x91, 0xb2, 0x94, 0xb6, 0x01, 0x6d, 0x00, 0x87, 0x24,
+	0x82, 0x00, 0x02, 0x24, 0x6d, 0x6d, 0xaa, 0x00, 0x01, 0x04, 0x24, 0x01, 0xda, 0xb6, 0x82, 0x91,
+	0x00, 0x92, 0x83, 0xb6, 0x0c, 0xda, 0xdb, 0xb2, 0xb1, 0xd6, 0xb6, 0x71, 0x6d, 0xb6, 0xd6, 0xd6,
+	0xb2, 0xb2, 0x8f, 0xb6, 0x01, 0x49, 0x00, 0x87, 0x24, 0x82, 0x00, 0x02, 0x24, 0x6d, 0x4d, 0xaa,
+	0x00, 0x01, 0x04, 0x00, 0x04, 0xda, 0xb6, 0x91, 0x91, 0x6d, 0x83, 0xb6, 0x0d, 0xda, 0xb6, 0xb6,
+	0xad, 0x91, 0x92, 0xb6, 0x92, 0x71, 0x6d, 0xb6, 0xd6, 0xb1, 0x91, 0x8f, 0xb6, 0x89, 0x24, 0x82,
+	0x00, 0x02, 0x24, 0x91, 0x49, 0xaa, 0x00, 0x01, 0x04, 0x00, 0x04, 0xda, 0xb6, 0x91, 0x6d, 0x91,
+	0x82, 0xb6, 0x05, 0xda, 0xb6, 0xd6, 0xd6, 0x92, 0x71, 0x83, 0x92, 0x03, 0x71, 0x6d, 0x91, 0x91,
+	0x8f, 0xb6, 0x01, 0x6d, 0x00, 0x88, 0x24, 0x82, 0x00, 0x02, 0x24, 0x49, 0x49, 0xa7, 0x00, 0x04,
+	0x04, 0x00, 0x00, 0x24, 0x04, 0x18, 0xda, 0xb6, 0x91, 0x6d, 0xb6, 0xb6, 0xd6, 0xdb, 0xb6, 0xd6,
+	0xd6, 0xb2, 0x91, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x6d, 0x71, 0x6d, 0xb6, 0xff, 0xdb, 0xda, 0x8c,
+	0xb6, 0x01, 0x49, 0x00, 0x88, 0x24, 0x82, 0x00, 0x02, 0x49, 0x04, 0x24, 0xa0, 0x00, 0x00, 0x04,
+	0x85, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x24
+};
 
+const uint8_t bitmap_piotr[4893] = {
+	0x82, 0x00, 0x00, 0x49, 0x8e, 0x4d, 0x82, 0x6d, 0x04, 0x71, 0x6d, 0x6d, 0x4d, 0x71, 0x85, 0x72,
+	0x00, 0x49, 0x83, 0x24, 0x00, 0x44, 0x88, 0x48, 0x00, 0x44, 0x84, 0x24, 0x05, 0x48, 0x48, 0x49,
+	0x6d, 0x4d, 0x49, 0x84, 0x48, 0x00, 0x49, 0x8e, 0x6d, 0x00, 0x4d, 0x87, 0x6d, 0x84, 0x4d, 0x00,
+	0x24, 0x83, 0x00, 0x01, 0x00, 0x00, 0x90, 0x4d, 0x82, 0x6d, 0x04, 0x71, 0x6d, 0x6d, 0x4d, 0x72,
+	0x83, 0x71, 0x02, 0x72, 0x71, 0x49, 0x84, 0x24, 0x02, 0x48, 0x48, 0x44, 0x85, 0x48, 0x00, 0x44,
+	0x84, 0x24, 0x00, 0x44, 0x8c, 0x48, 0x00, 0x49, 0x8b, 0x6d, 0x00, 0x4d, 0x87, 0x6d, 0x85, 0x4d,
+	0x00, 0x24, 0x82, 0x00, 0x00, 0x00, 0x91, 0x4d, 0x82, 0x6d, 0x04, 0x72, 0x71, 0x6d, 0x4d, 0x72,
+	0x83, 0x71, 0x02, 0x72, 0x71, 0x4d, 0x84, 0x24, 0x88, 0x48, 0x00, 0x44, 0x84, 0x24, 0x00, 0x44,
+	0x8e, 0x48, 0x00, 0x4d, 0x89, 0x6d, 0x00, 0x4d, 0x86, 0x6d, 0x87, 0x4d, 0x02, 0x28, 0x00, 0x00,
+	0x93, 0x4d, 0x05, 0x6d, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x82, 0x71, 0x83, 0x72, 0x05, 0x4d, 0x44,
+	0x24, 0x44, 0x24, 0x24, 0x88, 0x48, 0x00, 0x44, 0x84, 0x24, 0x00, 0x44, 0x8f, 0x48, 0x00, 0x49,
+	0x88, 0x6d, 0x00, 0x4d, 0x87, 0x6d, 0x85, 0x4d, 0x03, 0x49, 0x4d, 0x28, 0x00, 0x93, 0x4d, 0x05,
+	0x6d, 0x4d, 0x72, 0x71, 0x71, 0x6d, 0x84, 0x71, 0x0a, 0x72, 0x71, 0x49, 0x24, 0x24, 0x44, 0x24,
+	0x24, 0x48, 0x48, 0x44, 0x85, 0x48, 0x00, 0x44, 0x84, 0x24, 0x02, 0x44, 0x48, 0x44, 0x8f, 0x48,
+	0x8e, 0x6d, 0x8a, 0x4d, 0x00, 0x24, 0x93, 0x4d, 0x05, 0x6d, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x84,
+	0x71, 0x03, 0x72, 0x71, 0x48, 0x44, 0x83, 0x24, 0x02, 0x48, 0x48, 0x44, 0x85, 0x48, 0x00, 0x44,
+	0x84, 0x24, 0x00, 0x44, 0x92, 0x48, 0x00, 0x4d, 0x85, 0x6d, 0x01, 0x49, 0x24, 0x84, 0x6d, 0x01,
+	0x4d, 0x6d, 0x86, 0x4d, 0x82, 0x49, 0x93, 0x4d, 0x07, 0x6d, 0x6d, 0x72, 0x71, 0x71, 0x6d, 0x71,
+	0x72, 0x83, 0x71, 0x01, 0x6d, 0x48, 0x84, 0x44, 0x02, 0x48, 0x48, 0x44, 0x85, 0x48, 0x00, 0x44,
+	0x84, 0x24, 0x00, 0x44, 0x8a, 0x48, 0x00, 0x44, 0x87, 0x48, 0x00, 0x49, 0x83, 0x6d, 0x03, 0x71,
+	0x24, 0x00, 0x4d, 0x82, 0x6d, 0x82, 0x4d, 0x00, 0x6d, 0x84, 0x4d, 0x83, 0x49, 0x93, 0x4d, 0x07,
+	0x6d, 0x4d, 0x72, 0x71, 0x71, 0x6d, 0x71, 0x72, 0x82, 0x71, 0x04, 0x6d, 0x48, 0x48, 0x44, 0x24,
+	0x8d, 0x44, 0x83, 0x24, 0x00, 0x44, 0x8a, 0x48, 0x01, 0x44, 0x44, 0x87, 0x48, 0x00, 0x4d, 0x83,
+	0x6d, 0x02, 0x24, 0x00, 0x4d, 0x85, 0x6d, 0x85, 0x4d, 0x83, 0x49, 0x93, 0x4d, 0x01, 0x6d, 0x4d,
+	0x82, 0x71, 0x02, 0x6d, 0x6d, 0x71, 0x82, 0x6d, 0x06, 0x49, 0x48, 0x44, 0x44, 0x48, 0x68, 0x48,
+	0x8c, 0x44, 0x82, 0x24, 0x02, 0x44, 0x48, 0x44, 0x93, 0x48, 0x0b, 0x00, 0x49, 0x6d, 0x71, 0x24,
+	0x00, 0x4d, 0x6d, 0x4d, 0x24, 0x24, 0x6d, 0x85, 0x4d, 0x84, 0x49, 0x93, 0x4d, 0x01, 0x6d, 0x4d,
+	0x82, 0x71, 0x05, 0x6d, 0x6d, 0x71, 0x71, 0x6d, 0x6d, 0x82, 0x48, 0x01, 0x6d, 0x68, 0x93, 0x44,
+	0x86, 0x48, 0x01, 0x44, 0x44, 0x8a, 0x48, 0x0b, 0x44, 0x00, 0x00, 0x04, 0x4d, 0x24, 0x00, 0x4d,
+	0x28, 0x00, 0x00, 0x24, 0x87, 0x4d, 0x83, 0x49, 0x93, 0x4d, 0x01, 0x6d, 0x6d, 0x82, 0x71, 0x09,
+	0x6d, 0x6d, 0x71, 0x71, 0x6d, 0x48, 0x48, 0x69, 0x8d, 0x68, 0x85, 0x44, 0x83, 0x48, 0x87, 0x44,
+	0x82, 0x48, 0x83, 0x44, 0x02, 0x48, 0x69, 0x6d, 0x8e, 0x48, 0x00, 0x24, 0x86, 0x00, 0x02, 0x49,
+	0x6d, 0x6d, 0x85, 0x4d, 0x84, 0x49, 0x8f, 0x4d, 0x00, 0x49, 0x82, 0x4d, 0x01, 0x6d, 0x4d, 0x82,
+	0x71, 0x08, 0x4d, 0x6d, 0x71, 0x71, 0x6d, 0x48, 0x6d, 0x91, 0x68, 0x82, 0x44, 0x04, 0x48, 0x44,
+	0x48, 0x44, 0x48, 0x82, 0x69, 0x00, 0x68, 0x84, 0x44, 0x02, 0x48, 0x6d, 0x48, 0x87, 0x44, 0x90,
+	0x48, 0x00, 0x4d, 0x83, 0x00, 0x04, 0x28, 0x6d, 0x6d, 0x4d, 0x6d, 0x83, 0x4d, 0x86, 0x49, 0x93,
+	0x4d, 0x01, 0x6d, 0x4d, 0x82, 0x71, 0x1f, 0x4d, 0x6d, 0x71, 0x71, 0x6d, 0x6d, 0x91, 0x68, 0x44,
+	0x44, 0x48, 0x69, 0x6d, 0x8d, 0x8d, 0x6d, 0x68, 0x48, 0x69, 0x69, 0x6d, 0x69, 0x68, 0x44, 0x44,
+	0x48, 0x6d, 0x6d, 0x48, 0x48, 0x44, 0x48, 0x86, 0x44, 0x8e, 0x48, 0x00, 0x24, 0x84, 0x00, 0x02,
+	0x49, 0x6d, 0x6d, 0x84, 0x4d, 0x86, 0x49, 0x91, 0x4d, 0x05, 0x49, 0x4d, 0x6d, 0x4d, 0x6d, 0x71,
+	0x82, 0x6d, 0x09, 0x71, 0x6d, 0x6d, 0x8d, 0x68, 0x44, 0x48, 0x6d, 0x8d, 0x91, 0x82, 0x8d, 0x12,
+	0x6d, 0x8d, 0x6d, 0x68, 0x48, 0x91, 0x91, 0x6d, 0x68, 0x48, 0x48, 0x69, 0x6d, 0x6d, 0x48, 0x68,
+	0x68, 0x48, 0x48, 0x87, 0x44, 0x88, 0x48, 0x01, 0x44, 0x24, 0x84, 0x00, 0x04, 0x24, 0x00, 0x00,
+	0x24, 0x49, 0x85, 0x4d, 0x85, 0x49, 0x91, 0x4d, 0x01, 0x49, 0x49, 0x82, 0x6d, 0x04, 0x71, 0x6d,
+	0x4d, 0x4d, 0x6d, 0x82, 0x68, 0x13, 0x48, 0x68, 0x8d, 0x91, 0x91, 0x8d, 0x69, 0x68, 0x68, 0x48,
+	0x69, 0x91, 0x8d, 0x48, 0x6d, 0x92, 0x8d, 0x91, 0x6d, 0x68, 0x84, 0x6d, 0x00, 0x68, 0x84, 0x48,
+	0x85, 0x44, 0x87, 0x48, 0x0b, 0x24, 0x00, 0x00, 0x24, 0x48, 0x24, 0x00, 0x4d, 0x6d, 0x24, 0x00,
+	0x00, 0x85, 0x4d, 0x84, 0x49, 0x00, 0x48, 0x8c, 0x4d, 0x01, 0x49, 0x4d, 0x84, 0x49, 0x82, 0x6d,
+	0x04, 0x71, 0x6d, 0x49, 0x49, 0x68, 0x82, 0x48, 0x00, 0x69, 0x82, 0x8d, 0x02, 0x69, 0x68, 0x68,
+	0x83, 0x48, 0x13, 0x68, 0x8d, 0x68, 0x68, 0x6d, 0x8d, 0x8d, 0x6d, 0x69, 0x48, 0x6d, 0x6d, 0x68,
+	0x68, 0x69, 0x68, 0x69, 0x68, 0x48, 0x48, 0x87, 0x44, 0x85, 0x48, 0x0b, 0x44, 0x24, 0x44, 0x48,
+	0x48, 0x24, 0x00, 0x49, 0x6d, 0x6d, 0x4d, 0x49, 0x84, 0x4d, 0x84, 0x49, 0x01, 0x48, 0x49, 0x90,
+	0x4d, 0x02, 0x49, 0x4d, 0x49, 0x82, 0x6d, 0x0d, 0x71, 0x6d, 0x49, 0x48, 0x48, 0x44, 0x48, 0x69,
+	0x8d, 0x91, 0x8d, 0x8d, 0x69, 0x48, 0x84, 0x44, 0x84, 0x68, 0x04, 0x8d, 0x6d, 0x6d, 0x68, 0x48,
+	0x83, 0x68, 0x03, 0x69, 0x6d, 0x6d, 0x69, 0x84, 0x48, 0x84, 0x44, 0x88, 0x48, 0x04, 0x44, 0x48,
+	0x24, 0x00, 0x49, 0x83, 0x6d, 0x82, 0x4d, 0x86, 0x49, 0x01, 0x48, 0x49, 0x8d, 0x4d, 0x01, 0x49,
+	0x4d, 0x83, 0x49, 0x82, 0x6d, 0x0c, 0x71, 0x6d, 0x48, 0x44, 0x44, 0x48, 0x8d, 0x8d, 0x91, 0x8d,
+	0x8d, 0x6d, 0x48, 0x83, 0x44, 0x83, 0x68, 0x00, 0x69, 0x84, 0x8d, 0x83, 0x68, 0x05, 0x48, 0x44,
+	0x48, 0x69, 0x6d, 0x69, 0x82, 0x48, 0x01, 0x68, 0x48, 0x86, 0x44, 0x05, 0x48, 0x48, 0x44, 0x48,
+	0x48, 0x44, 0x82, 0x48, 0x05, 0x24, 0x00, 0x49, 0x72, 0x6d, 0x6d, 0x84, 0x4d, 0x86, 0x49, 0x00,
+	0x48, 0x8d, 0x4d, 0x85, 0x49, 0x82, 0x6d, 0x0b, 0x72, 0x6d, 0x44, 0x44, 0x48, 0x8d, 0x91, 0x91,
+	0xb1, 0x8d, 0x6d, 0x68, 0x82, 0x44, 0x00, 0x48, 0x82, 0x68, 0x01, 0x88, 0x8d, 0x82, 0xb1, 0x0b,
+	0xb2, 0xb1, 0xb1, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x48, 0x44, 0x44, 0x68, 0x82, 0x6d, 0x00, 0x68,
+	0x83, 0x48, 0x84, 0x44, 0x02, 0x48, 0x48, 0x44, 0x85, 0x48, 0x01, 0x44, 0x48, 0x82, 0x72, 0x00,
+	0x6d, 0x85, 0x4d, 0x85, 0x49, 0x00, 0x48, 0x8d, 0x4d, 0x85, 0x49, 0x82, 0x6d, 0x0a, 0x72, 0x6d,
+	0x44, 0x44, 0x6d, 0x91, 0x91, 0xb2, 0x91, 0x8d, 0x8d, 0x84, 0x68, 0x04, 0x88, 0x8d, 0xb1, 0xb1,
+	0xd2, 0x85, 0xd6, 0x04, 0xd2, 0xb2, 0xb1, 0xb1, 0x8d, 0x83, 0x68, 0x83, 0x6d, 0x03, 0x69, 0x68,
+	0x48, 0x48, 0x85, 0x44, 0x88, 0x48, 0x04, 0x4d, 0x96, 0x97, 0x72, 0x72, 0x83, 0x4d, 0x87, 0x49,
+	0x00, 0x48, 0x8c, 0x4d, 0x86, 0x49, 0x13, 0x4d, 0x6d, 0x6d, 0x72, 0x6d, 0x48, 0x44, 0x6d, 0xb2,
+	0x91, 0xb2, 0x91, 0x91, 0x6d, 0x68, 0x68, 0x89, 0x8d, 0xad, 0xb1, 0x8c, 0xd6, 0x00, 0xd2, 0x83,
+	0xb1, 0x82, 0x8d, 0x05, 0x6d, 0x68, 0x69, 0x68, 0x68, 0x48, 0x88, 0x44, 0x85, 0x48, 0x04, 0x71,
+	0xdb, 0xdf, 0x97, 0x72, 0x84, 0x4d, 0x85, 0x49, 0x01, 0x48, 0x48, 0x8a, 0x4d, 0x88, 0x49, 0x16,
+	0x4d, 0x6d, 0x6d, 0x92, 0x6d, 0x48, 0x48, 0x91, 0xb6, 0x8d, 0x8d, 0x91, 0x8d, 0x6d, 0x8d, 0x8d,
+	0xb1, 0xb1, 0xd6, 0xd2, 0xd6, 0xfa, 0xda, 0x83, 0xfa, 0x04, 0xd6, 0xf6, 0xf6, 0xd6, 0xf6, 0x83,
+	0xd6, 0x06, 0xb2, 0xb2, 0xb1, 0x8d, 0x69, 0x8d, 0x68, 0x82, 0x48, 0x01, 0x68, 0x48, 0x87, 0x44,
+	0x84, 0x48, 0x05, 0x49, 0xb6, 0xff, 0xff, 0xbb, 0x72, 0x83, 0x4d, 0x86, 0x49, 0x01, 0x48, 0x48,
+	0x8b, 0x4d, 0x87, 0x49, 0x0e, 0x4d, 0x6d, 0x72, 0x92, 0x6d, 0x44, 0x6d, 0xb2, 0xb1, 0x68, 0x8d,
+	0x8d, 0x91, 0x91, 0xb2, 0x82, 0xb1, 0x82, 0xd6, 0x02, 0xfa, 0xfa, 0xfb, 0x88, 0xfa, 0x83, 0xd6,
+	0x02, 0xd2, 0xb1, 0xb1, 0x82, 0x68, 0x00, 0x44, 0x82, 0x68, 0x01, 0x48, 0x48, 0x88, 0x44, 0x08,
+	0x48, 0x44, 0x48, 0x6d, 0xb6, 0xff, 0xff, 0xbb, 0x72, 0x84, 0x4d, 0x83, 0x49, 0x83, 0x48, 0x8a,
+	0x4d, 0x87, 0x49, 0x14, 0x48, 0x49, 0x72, 0x92, 0x96, 0x6d, 0x48, 0x6d, 0x91, 0x8d, 0x68, 0x68,
+	0x8d, 0xb2, 0xb2, 0xb1, 0xad, 0xb1, 0xd2, 0xd6, 0xf6, 0x82, 0xfa, 0x87, 0xfb, 0x82, 0xfa, 0x00,
+	0xf6, 0x82, 0xd6, 0x03, 0xd2, 0xb1, 0xb1, 0x8d, 0x83, 0x68, 0x03, 0x48, 0x44, 0x48, 0x48, 0x89,
+	0x44, 0x06, 0x48, 0x48, 0xb6, 0xff, 0xff, 0xbb, 0x72, 0x82, 0x4d, 0x01, 0x49, 0x4d, 0x83, 0x49,
+	0x83, 0x48, 0x8a, 0x4d, 0x87, 0x49, 0x01, 0x48, 0x49, 0x82, 0x71, 0x10, 0x6d, 0x6d, 0x68, 0x6d,
+	0x68, 0x44, 0x68, 0x8d, 0x91, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xf6, 0xfa, 0xfa, 0x8b, 0xfb, 0x82,
+	0xfa, 0x82, 0xd6, 0x0c, 0xb1, 0xb1, 0xd2, 0xd2, 0xb1, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x68, 0x68,
+	0x48, 0x85, 0x44, 0x83, 0x48, 0x04, 0x92, 0xdf, 0xdf, 0x97, 0x72, 0x82, 0x4d, 0x84, 0x49, 0x84,
+	0x48, 0x8a, 0x4d, 0x87, 0x49, 0x83, 0x48, 0x00, 0x6d, 0x82, 0x48, 0x0c, 0x68, 0x44, 0x44, 0x68,
+	0x69, 0x8d, 0xb1, 0xd6, 0xb1, 0xd2, 0xf6, 0xfa, 0xfa, 0x8f, 0xfb, 0x00, 0xfa, 0x82, 0xd6, 0x00,
+	0xd2, 0x82, 0xb1, 0x82, 0xad, 0x05, 0x8d, 0x6d, 0x68, 0x68, 0x48, 0x48, 0x85, 0x44, 0x82, 0x48,
+	0x05, 0x6d, 0xb6, 0xbb, 0x92, 0x6e, 0x4d, 0x87, 0x49, 0x83, 0x48, 0x88, 0x4d, 0x89, 0x49, 0x05,
+	0x48, 0x44, 0x48, 0x6d, 0x6d, 0x48, 0x84, 0x44, 0x07, 0x68, 0x68, 0x8d, 0xd1, 0xb1, 0xd2, 0xf6,
+	0xfa, 0x85, 0xfb, 0x85, 0xff, 0x85, 0xfb, 0x06, 0xfa, 0xfa, 0xf6, 0xd6, 0xd6, 0xd2, 0xd1, 0x83,
+	0xb1, 0x05, 0x91, 0x6d, 0x68, 0x68, 0x44, 0x48, 0x85, 0x44, 0x83, 0x48, 0x04, 0x6d, 0x72, 0x72,
+	0x6d, 0x4d, 0x85, 0x49, 0x85, 0x48, 0x88, 0x4d, 0x8a, 0x49, 0x02, 0x44, 0x48, 0x48, 0x86, 0x44,
+	0x06, 0x68, 0x68, 0xb1, 0xd2, 0xb2, 0xd6, 0xfa, 0x84, 0xfb, 0x88, 0xff, 0x85, 0xfb, 0x01, 0xfa,
+	0xfa, 0x82, 0xd6, 0x01, 0xd2, 0xd2, 0x82, 0xb1, 0x04, 0x8d, 0x8d, 0x69, 0x68, 0x48, 0x86, 0x44,
+	0x07, 0x48, 0x48, 0x44, 0x48, 0x6d, 0x72, 0x6d, 0x6d, 0x85, 0x49, 0x86, 0x48, 0x88, 0x4d, 0x8a,
+	0x49, 0x00, 0x48, 0x88, 0x44, 0x06, 0x68, 0x8d, 0xb2, 0xd6, 0xd6, 0xfa, 0xfa, 0x83, 0xfb, 0x87,
+	0xff, 0x87, 0xfb, 0x02, 0xfa, 0xf6, 0xf6, 0x82, 0xd6, 0x08, 0xd2, 0xb1, 0xb1, 0xb2, 0xb1, 0x8d,
+	0x6d, 0x6d, 0x48, 0x86, 0x44, 0x03, 0x48, 0x48, 0x44, 0x48, 0x83, 0x6d, 0x84, 0x49, 0x87, 0x48,
+	0x87, 0x4d, 0x01, 0x49, 0x4d, 0x89, 0x49, 0x00, 0x48, 0x87, 0x44, 0x02, 0x48, 0x8d, 0xad, 0x82,
+	0xd6, 0x01, 0xfa, 0xfa, 0x82, 0xfb, 0x86, 0xff, 0x87, 0xfb, 0x03, 0xfa, 0xfa, 0xf6, 0xf6, 0x83,
+	0xd6, 0x00, 0xd2, 0x82, 0xb1, 0x04, 0xb2, 0x8d, 0x6d, 0x8d, 0x68, 0x86, 0x44, 0x03, 0x48, 0x48,
+	0x44, 0x48, 0x83, 0x6d, 0x84, 0x49, 0x87, 0x48, 0x85, 0x4d, 0x8d, 0x49, 0x00, 0x48, 0x87, 0x44,
+	0x02, 0x68, 0x8d, 0xd2, 0x82, 0xd6, 0x01, 0xfa, 0xfa, 0x8f, 0xfb, 0x82, 0xfa, 0x01, 0xf6, 0xf6,
+	0x85, 0xd6, 0x82, 0xb1, 0x04, 0xb2, 0x8d, 0x6d, 0x6d, 0x69, 0x85, 0x44, 0x82, 0x48, 0x05, 0x44,
+	0x48, 0x6d, 0x6d, 0x4d, 0x4d, 0x84, 0x49, 0x87, 0x48, 0x84, 0x4d, 0x02, 0x49, 0x49, 0x4d, 0x8b,
+	0x49, 0x00, 0x48, 0x86, 0x44, 0x02, 0x48, 0x68, 0xb1, 0x82, 0xd6, 0x02, 0xf6, 0xfa, 0xfa, 0x8f,
+	0xfb, 0x84, 0xfa, 0x84, 0xd6, 0x00, 0xd2, 0x84, 0xb1, 0x03, 0x91, 0x6d, 0x48, 0x48, 0x85, 0x44,
+	0x83, 0x48, 0x00, 0x6d, 0x82, 0x4d, 0x83, 0x49, 0x88, 0x48, 0x83, 0x4d, 0x8f, 0x49, 0x01, 0x48,
+	0x48, 0x84, 0x44, 0x02, 0x68, 0x68, 0x69, 0x84, 0xd6, 0x82, 0xfa, 0x93, 0xfb, 0x01, 0xfa, 0xfa,
+	0x82, 0xd6, 0x00, 0xd2, 0x84, 0xb1, 0x03, 0x8d, 0x6d, 0x48, 0x48, 0x84, 0x44, 0x84, 0x48, 0x03,
+	0x6d, 0x4d, 0x49, 0x4d, 0x82, 0x49, 0x89, 0x48, 0x83, 0x4d, 0x02, 0x49, 0x49, 0x4d, 0x8e, 0x49,
+	0x00, 0x48, 0x83, 0x44, 0x02, 0x69, 0x6d, 0x6d, 0x83, 0xd6, 0x00, 0xda, 0x82, 0xfa, 0x93, 0xfb,
+	0x01, 0xfa, 0xfa, 0x82, 0xd6, 0x08, 0xd2, 0xb1, 0xb1, 0xad, 0xad, 0xb1, 0x8d, 0x68, 0x48, 0x87,
+	0x44, 0x02, 0x48, 0x44, 0x48, 0x84, 0x49, 0x8b, 0x48, 0x07, 0x4d, 0x4d, 0x49, 0x4d, 0x4d, 0x49,
+	0x49, 0x4d, 0x8c, 0x49, 0x08, 0x6d, 0x49, 0x48, 0x48, 0x44, 0x44, 0x69, 0x91, 0x6d, 0x83, 0xd6,
+	0x02, 0xda, 0xda, 0xfa, 0x94, 0xfb, 0x00, 0xda, 0x82, 0xd6, 0x02, 0xd2, 0xd2, 0xb1, 0x83, 0xad,
+	0x02, 0x8d, 0x44, 0x48, 0x89, 0x44, 0x03, 0x48, 0x48, 0x49, 0x49, 0x8d, 0x48, 0x82, 0x4d, 0x01,
+	0x49, 0x4d, 0x8f, 0x49, 0x09, 0x6d, 0x6d, 0x48, 0x48, 0x44, 0x44, 0x68, 0x91, 0xb2, 0xb2, 0x83,
+	0xd6, 0x00, 0xda, 0x83, 0xfb, 0x02, 0xff, 0xff, 0xfb, 0x83, 0xff, 0x00, 0xfb, 0x84, 0xff, 0x82,
+	0xfb, 0x82, 0xd6, 0x00, 0xb2, 0x83, 0xb1, 0x05, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0x68, 0x89, 0x44,
+	0x01, 0x48, 0x44, 0x82, 0x48, 0x82, 0x49, 0x8b, 0x48, 0x94, 0x49, 0x02, 0x4d, 0x69, 0x48, 0x83,
+	0x44, 0x03, 0x8d, 0xb6, 0xd6, 0xb2, 0x82, 0xd6, 0x01, 0xfa, 0xfa, 0x82, 0xfb, 0x8b, 0xff, 0x03,
+	0xfb, 0xfb, 0xd6, 0xb2, 0x87, 0x8d, 0x05, 0x89, 0x68, 0x88, 0xad, 0x8d, 0x68, 0x8b, 0x44, 0x91,
+	0x48, 0x00, 0x4d, 0x90, 0x49, 0x00, 0x48, 0x82, 0x49, 0x00, 0x48, 0x84, 0x44, 0x04, 0x69, 0x92,
+	0xb2, 0xb1, 0xb2, 0x82, 0xd6, 0x00, 0xb2, 0x82, 0xd6, 0x02, 0xdb, 0xfb, 0xfb, 0x88, 0xff, 0x03,
+	0xfb, 0xd6, 0xb2, 0x91, 0x83, 0x8d, 0x0a, 0xb2, 0xb2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x8d, 0x8d,
+	0x89, 0x48, 0x8a, 0x44, 0x91, 0x48, 0x95, 0x49, 0x00, 0x48, 0x84, 0x44, 0x0f, 0x48, 0x69, 0xad,
+	0xb1, 0xb6, 0xd6, 0xd6, 0xad, 0x8d, 0xb1, 0xb2, 0x91, 0x8d, 0xb2, 0xd6, 0xdb, 0x87, 0xff, 0x12,
+	0xfb, 0xd6, 0xb2, 0xb1, 0xb1, 0xb2, 0xd6, 0xfb, 0xfb, 0xdb, 0xfb, 0xd6, 0xd6, 0xb1, 0x69, 0x68,
+	0x8d, 0x8d, 0x68, 0x8a, 0x44, 0x91, 0x48, 0x95, 0x49, 0x82, 0x48, 0x83, 0x44, 0x00, 0x68, 0x82,
+	0x8d, 0x03, 0xb1, 0xb2, 0xd2, 0xb2, 0x83, 0x8d, 0x03, 0xb1, 0xb1, 0xd6, 0xfb, 0x86, 0xff, 0x00,
+	0xfb, 0x82, 0xd6, 0x00, 0xda, 0x85, 0xfb, 0x82, 0xd6, 0x04, 0xb1, 0x68, 0x88, 0x68, 0x68, 0x8a,
+	0x44, 0x91, 0x48, 0x93, 0x49, 0x02, 0x48, 0x49, 0x49, 0x84, 0x44, 0x01, 0x48, 0x6d, 0x82, 0x8d,
+	0x04, 0xb1, 0xd6, 0xda, 0xdb, 0xda, 0x85, 0xd6, 0x01, 0xfb, 0xfb, 0x84, 0xff, 0x05, 0xfb, 0xfb,
+	0xdb, 0xfb, 0xda, 0xd6, 0x82, 0xfb, 0x00, 0xda, 0x84, 0xd6, 0x01, 0xb1, 0x8d, 0x82, 0x68, 0x83,
+	0x44, 0x01, 0x48, 0x68, 0x83, 0x44, 0x92, 0x48, 0x90, 0x49, 0x06, 0x48, 0x49, 0x49, 0x48, 0x49,
+	0x6d, 0x48, 0x83, 0x44, 0x07, 0x48, 0x69, 0x8d, 0x8d, 0xb2, 0xd6, 0xfb, 0xfb, 0x83, 0xff, 0x83,
+	0xfb, 0x01, 0xdb, 0xfb, 0x83, 0xff, 0x03, 0xfb, 0xfb, 0xdb, 0xda, 0x82, 0xd6, 0x0d, 0xb2, 0xb2,
+	0x8d, 0x8d, 0xb1, 0xb2, 0xd2, 0xd6, 0xd6, 0xb2, 0xad, 0x88, 0x68, 0x68, 0x82, 0x44, 0x06, 0x48,
+	0x8d, 0x8d, 0x68, 0x44, 0x48, 0x44, 0x91, 0x48, 0x00, 0x44, 0x8f, 0x49, 0x08, 0x48, 0x49, 0x49,
+	0x48, 0x48, 0x49, 0x6d, 0x48, 0x48, 0x83, 0x44, 0x04, 0x68, 0x8d, 0x8d, 0xd6, 0xda, 0x88, 0xfb,
+	0x82, 0xda, 0x84, 0xfb, 0x83, 0xd6, 0x0f, 0xda, 0xdb, 0x92, 0x6d, 0x69, 0x6d, 0xb2, 0x89, 0x8d,
+	0xb1, 0xd2, 0xb2, 0xb1, 0x8d, 0x68, 0x68, 0x82, 0x44, 0x06, 0x69, 0xad, 0xd6, 0x6d, 0x44, 0x48,
+	0x44, 0x8c, 0x48, 0x00, 0x44, 0x82, 0x24, 0x01, 0x44, 0x44, 0x8e, 0x49, 0x01, 0x48, 0x48, 0x82,
+	0x49, 0x04, 0x48, 0x49, 0x6d, 0x49, 0x49, 0x83, 0x44, 0x15, 0x68, 0x6d, 0xb1, 0xd6, 0xda, 0xfb,
+	0xfb, 0xd6, 0xb2, 0xb2, 0x8d, 0xb2, 0xdb, 0xfb, 0xfb, 0xda, 0xd6, 0xd6, 0xfb, 0xfb, 0xfa, 0xfa,
+	0x82, 0xd6, 0x18, 0xfb, 0xd6, 0xff, 0xdb, 0x8d, 0x6d, 0x92, 0xd6, 0xb2, 0xb1, 0xad, 0xd1, 0xb1,
+	0xb1, 0x8d, 0x68, 0x68, 0x48, 0x24, 0x68, 0xb1, 0xad, 0xd6, 0x6d, 0x44, 0x8d, 0x48, 0x86, 0x44,
+	0x8e, 0x49, 0x85, 0x48, 0x17, 0x49, 0x6d, 0x49, 0x6d, 0x48, 0x68, 0x68, 0x44, 0x6d, 0x6d, 0xb1,
+	0xd6, 0xda, 0xfa, 0xd6, 0x8d, 0xb6, 0x6d, 0x8d, 0x92, 0xdb, 0xfb, 0xfa, 0xfa, 0x82, 0xd6, 0x01,
+	0xf6, 0xf6, 0x8d, 0xd6, 0x0f, 0xd2, 0xd2, 0xb1, 0xb1, 0xad, 0x88, 0x68, 0x68, 0x48, 0x8d, 0xb1,
+	0xad, 0xd6, 0x6d, 0x44, 0x44, 0x8c, 0x48, 0x01, 0x44, 0x48, 0x84, 0x44, 0x8e, 0x49, 0x86, 0x48,
+	0x16, 0x6d, 0x49, 0x6d, 0x6d, 0xb2, 0x89, 0x44, 0x6d, 0x8d, 0xb2, 0xd6, 0xd6, 0xd2, 0x8d, 0xb2,
+	0xd7, 0xb2, 0x8d, 0xb6, 0xdb, 0xfa, 0xd6, 0xf6, 0x82, 0xd6, 0x06, 0xf6, 0xf6, 0xd6, 0xd2, 0xd2,
+	0xd6, 0xfa, 0x85, 0xfb, 0x00, 0xf6, 0x83, 0xd6, 0x0d, 0xb1, 0xb1, 0xad, 0x89, 0x68, 0x68, 0x69,
+	0xb1, 0xb1, 0x8d, 0xd2, 0x69, 0x44, 0x44, 0x8c, 0x48, 0x01, 0x44, 0x48, 0x84, 0x44, 0x8c, 0x49,
+	0x03, 0x48, 0x49, 0x48, 0x49, 0x84, 0x48, 0x09, 0x4d, 0x49, 0x6d, 0x6d, 0xd6, 0xd2, 0x44, 0x6d,
+	0x8d, 0xb2, 0x83, 0xd6, 0x02, 0xfb, 0xd6, 0xdb, 0x84, 0xfb, 0x06, 0xda, 0xd6, 0xd2, 0xd6, 0xf6,
+	0xf6, 0xd6, 0x82, 0xd2, 0x04, 0xd6, 0xd6, 0xfa, 0xda, 0xf6, 0x86, 0xd6, 0x0c, 0xd2, 0xb1, 0xad,
+	0x8d, 0x68, 0x68, 0x8d, 0xd6, 0xd6, 0xad, 0xb1, 0x68, 0x44, 0x8d, 0x48, 0x86, 0x44, 0x8b, 0x49,
+	0x04, 0x48, 0x49, 0x48, 0x49, 0x49, 0x84, 0x48, 0x08, 0x4d, 0x49, 0x6d, 0x6d, 0xd6, 0xf6, 0x8d,
+	0x6d, 0x91, 0x84, 0xd6, 0x86, 0xfb, 0x82, 0xd6, 0x05, 0xd2, 0xd6, 0xfa, 0xf6, 0xf6, 0xd6, 0x82,
+	0xd2, 0x83, 0xd6, 0x00, 0xf6, 0x85, 0xd6, 0x0c, 0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb2, 0xd6,
+	0xd6, 0xb2, 0x8d, 0x48, 0x44, 0x8d, 0x48, 0x86, 0x44, 0x89, 0x49, 0x01, 0x48, 0x49, 0x89, 0x48,
+	0x08, 0x4d, 0x49, 0x6d, 0x6d, 0xb2, 0xd6, 0x8d, 0x6d, 0x92, 0x82, 0xd6, 0x03, 0xdb, 0xfa, 0xf6,
+	0xfa, 0x83, 0xfb, 0x83, 0xd6, 0x07, 0xd2, 0xd6, 0xf6, 0xf6, 0xd6, 0xd6, 0xd2, 0xd2, 0x84, 0xd6,
+	0x00, 0xf6, 0x85, 0xd6, 0x0b, 0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x8d, 0xd6, 0xd6, 0xb2, 0x69,
+	0x44, 0x8e, 0x48, 0x86, 0x44, 0x8a, 0x49, 0x8a, 0x48, 0x0b, 0x49, 0x48, 0x6d, 0x6d, 0x92, 0xd6,
+	0xb1, 0x8d, 0x91, 0xb2, 0xd6, 0xda, 0x86, 0xfb, 0x0a, 0xd6, 0xf6, 0xfa, 0xd6, 0xd6, 0xd2, 0xd6,
+	0xf6, 0xf6, 0xd6, 0xd6, 0x82, 0xd2, 0x03, 0xd6, 0xf6, 0xd6, 0xd6, 0x84, 0xf6, 0x0b, 0xd6, 0xd6,
+	0xd2, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xad, 0xd2, 0x8d, 0x90, 0x48, 0x86, 0x44, 0x8a, 0x49,
+	0x8a, 0x48, 0x0c, 0x49, 0x48, 0x6d, 0x6d, 0x8d, 0xd6, 0xfa, 0xd6, 0x8d, 0xd2, 0xd6, 0xd6, 0xfa,
+	0x83, 0xfb, 0x0b, 0xfa, 0xd6, 0xfa, 0xfb, 0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xf6, 0xfa, 0xd6, 0x83,
+	0xd2, 0x03, 0xd6, 0xf6, 0xf6, 0xfa, 0x84, 0xf6, 0x08, 0xd6, 0xd6, 0xd2, 0xb1, 0xad, 0x8d, 0x68,
+	0x69, 0xb2, 0x82, 0x8d, 0x00, 0x44, 0x90, 0x48, 0x85, 0x44, 0x88, 0x49, 0x8c, 0x48, 0x08, 0x49,
+	0x48, 0x69, 0x6d, 0x6d, 0xd6, 0xfb, 0xd6, 0x8d, 0x82, 0xd6, 0x00, 0xfa, 0x82, 0xfb, 0x82, 0xf6,
+	0x12, 0xfb, 0xfb, 0xf6, 0xd6, 0xd6, 0xd2, 0xd6, 0xfa, 0xfa, 0xf6, 0xd2, 0xb1, 0xd2, 0xd2, 0xd6,
+	0xd6, 0xf6, 0xfa, 0xfa, 0x82, 0xf6, 0x83, 0xd6, 0x09, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xb2,
+	0x8d, 0x68, 0x44, 0x90, 0x48, 0x85, 0x44, 0x87, 0x49, 0x8d, 0x48, 0x0b, 0x49, 0x48, 0x49, 0x6d,
+	0x69, 0xb2, 0xfb, 0xfb, 0xb1, 0xd2, 0xd6, 0xd6, 0x82, 0xfb, 0x01, 0xfa, 0xfa, 0x83, 0xfb, 0x0f,
+	0xfa, 0xd6, 0xd6, 0xd2, 0xd6, 0xfa, 0xfa, 0xf6, 0xd2, 0xb1, 0xd2, 0xd2, 0xd6, 0xf6, 0xfa, 0xfa,
+	0x84, 0xf6, 0x82, 0xd6, 0x09, 0xb2, 0xad, 0x8d, 0x68, 0x68, 0xb1, 0xb2, 0x69, 0x48, 0x44, 0x8f,
+	0x48, 0x86, 0x44, 0x84, 0x49, 0x01, 0x48, 0x49, 0x8e, 0x48, 0x0b, 0x49, 0x48, 0x49, 0x6d, 0x49,
+	0x6d, 0xd6, 0xd6, 0xb1, 0xb2, 0xd2, 0xd6, 0x88, 0xfb, 0x11, 0xfa, 0xd6, 0xd6, 0xd2, 0xf6, 0xfb,
+	0xfb, 0xfa, 0xd6, 0xb1, 0xad, 0xb1, 0xb1, 0xd6, 0xfa, 0xfa, 0xfb, 0xfa, 0x82, 0xf6, 0x82, 0xd6,
+	0x08, 0xb2, 0x8d, 0x8d, 0x68, 0x68, 0xb1, 0x8d, 0x48, 0x44, 0x8f, 0x48, 0x87, 0x44, 0x83, 0x49,
+	0x82, 0x48, 0x00, 0x49, 0x8d, 0x48, 0x0b, 0x49, 0x48, 0x49, 0x6d, 0x4d, 0x49, 0xb2, 0xd6, 0xb2,
+	0xb2, 0xd6, 0xd6, 0x88, 0xfb, 0x09, 0xfa, 0xd2, 0xd2, 0xd6, 0xfb, 0xfb, 0xff, 0xfb, 0xfa, 0xd2,
+	0x82, 0xb1, 0x01, 0xd2, 0xfa, 0x82, 0xfb, 0x01, 0xfa, 0xf6, 0x83, 0xd6, 0x06, 0xb1, 0x8d, 0x6d,
+	0x68, 0x68, 0x8d, 0x8d, 0x82, 0x44, 0x8d, 0x48, 0x88, 0x44, 0x84, 0x49, 0x92, 0x48, 0x09, 0x49,
+	0x6d, 0x49, 0x48, 0x6d, 0xd6, 0xb6, 0xb2, 0xd6, 0xd6, 0x88, 0xfb, 0x0e, 0xd6, 0xd2, 0xd2, 0xd6,
+	0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xd6, 0xd6, 0xd2, 0xd1, 0xd2, 0xfa, 0x83, 0xfb, 0x00, 0xf6, 0x82,
+	0xd6, 0x02, 0xd2, 0xb1, 0x8d, 0x82, 0x68, 0x03, 0xad, 0x8d, 0x48, 0x44, 0x8e, 0x48, 0x88, 0x44,
+	0x82, 0x49, 0x94, 0x48, 0x09, 0x49, 0x4d, 0x49, 0x48, 0x49, 0x8d, 0xb2, 0xb2, 0xd6, 0xd6, 0x88,
+	0xfb, 0x83, 0xd6, 0x00, 0xdb, 0x82, 0xfb, 0x83, 0xd6, 0x01, 0xd2, 0xd2, 0x82, 0xd6, 0x01, 0xf6,
+	0xf6, 0x82, 0xd6, 0x03, 0xd2, 0xb1, 0xad, 0x8d, 0x82, 0x68, 0x03, 0xad, 0x68, 0x44, 0x44, 0x85,
+	0x48, 0x00, 0x44, 0x87, 0x48, 0x88, 0x44, 0x82, 0x49, 0x95, 0x48, 0x82, 0x49, 0x05, 0x48, 0x6d,
+	0xb1, 0xb1, 0xd6, 0xd6, 0x88, 0xfb, 0x85, 0xd6, 0x06, 0xdb, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2,
+	0x87, 0xd6, 0x06, 0xd2, 0xb1, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x84, 0x44, 0x85, 0x48, 0x00, 0x44,
+	0x84, 0x48, 0x8b, 0x44, 0x02, 0x48, 0x48, 0x49, 0x95, 0x48, 0x82, 0x49, 0x06, 0x48, 0x8d, 0xd2,
+	0xad, 0xb2, 0xd6, 0xfa, 0x84, 0xfb, 0x03, 0xfa, 0xfb, 0xfa, 0xda, 0x8d, 0xd6, 0x03, 0xd2, 0xd2,
+	0xd6, 0xd6, 0x82, 0xd2, 0x00, 0xad, 0x82, 0x8d, 0x01, 0x88, 0x68, 0x83, 0x44, 0x86, 0x48, 0x00,
+	0x44, 0x83, 0x48, 0x8c, 0x44, 0x00, 0x49, 0x97, 0x48, 0x0b, 0x49, 0x49, 0x48, 0x48, 0x6d, 0xb2,
+	0xb1, 0xb1, 0xd6, 0xd6, 0xfa, 0xfb, 0x83, 0xfa, 0x82, 0xf6, 0x82, 0xd6, 0x06, 0xf6, 0xfb, 0xd6,
+	0xd6, 0xfa, 0xf6, 0xf6, 0x82, 0xd6, 0x0d, 0xd2, 0xd2, 0xd1, 0xd2, 0xd2, 0xb2, 0xb2, 0xd2, 0x8d,
+	0x88, 0x8d, 0xb1, 0x89, 0x48, 0x83, 0x44, 0x86, 0x48, 0x00, 0x44, 0x83, 0x48, 0x8c, 0x44, 0x98,
+	0x48, 0x07, 0x49, 0x49, 0x48, 0x48, 0x49, 0x69, 0x8d, 0xb2, 0x8d, 0xd6, 0x00, 0xfa, 0x84, 0xfb,
+	0x01, 0xd6, 0xd6, 0x82, 0xd2, 0x0c, 0xb1, 0xad, 0xb1, 0xb1, 0xb2, 0xb2, 0xd6, 0xad, 0x88, 0x8d,
+	0xb1, 0x89, 0x48, 0x83, 0x44, 0x86, 0x48, 0x00, 0x44, 0x83, 0x48, 0x8c, 0x44, 0x98, 0x48, 0x07,
+	0x49, 0x49, 0x48, 0x48, 0x49, 0x48, 0x6d, 0xb2, 0x8e, 0xd6, 0x01, 0xfb, 0xfb, 0x82, 0xdb, 0x82,
+	0xd6, 0x02, 0xd2, 0xd2, 0xb1, 0x82, 0xad, 0x07, 0xb1, 0xd2, 0xd6, 0xad, 0x68, 0xad, 0xb1, 0x68,
+	0x84, 0x44, 0x84, 0x48, 0x83, 0x44, 0x01, 0x48, 0x48, 0x8d, 0x44, 0x98, 0x48, 0x00, 0x49, 0x84,
+	0x48, 0x01, 0x6d, 0xb2, 0x8e, 0xd6, 0x04, 0xfb, 0xfb, 0xd6, 0xda, 0xfb, 0x82, 0xd6, 0x0d, 0xd2,
+	0xd2, 0xb1, 0xad, 0x8d, 0xad, 0xb1, 0xd2, 0xd6, 0x8d, 0x68, 0xad, 0xad, 0x68, 0x84, 0x44, 0x01,
+	0x48, 0x48, 0x96, 0x44, 0x9e, 0x48, 0x01, 0x49, 0xb1, 0x82, 0xd6, 0x06, 0xf6, 0xd6, 0xd6, 0xb2,
+	0xb1, 0xd2, 0xd2, 0x85, 0xd6, 0x14, 0xf6, 0xfb, 0xd7, 0xd6, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0x89,
+	0x88, 0xad, 0xb1, 0xd1, 0xd6, 0xd6, 0x8d, 0x68, 0xad, 0x8d, 0x68, 0x84, 0x44, 0x01, 0x48, 0x48,
+	0x96, 0x44, 0x9f, 0x48, 0x00, 0x8d, 0x82, 0xd6, 0x04, 0xfa, 0xfa, 0xd6, 0xd2, 0xd1, 0x84, 0xad,
+	0x01, 0xcd, 0xd1, 0x83, 0xd2, 0x11, 0xcd, 0xad, 0xad, 0xa9, 0xad, 0xa9, 0x88, 0x8d, 0xad, 0xd1,
+	0xd2, 0xd6, 0xb1, 0x89, 0x88, 0x8d, 0x68, 0x48, 0x84, 0x44, 0x01, 0x48, 0x48, 0x96, 0x44, 0x9b,
+	0x48, 0x00, 0x44, 0x82, 0x48, 0x01, 0x69, 0xb2, 0x82, 0xd6, 0x08, 0xfa, 0xf6, 0xd6, 0xd6, 0xd1,
+	0xad, 0xa9, 0xad, 0xad, 0x83, 0xcd, 0x01, 0xd2, 0xd2, 0x83, 0xcd, 0x82, 0xad, 0x09, 0x8d, 0xad,
+	0xd1, 0xd2, 0xd6, 0xb1, 0x68, 0x89, 0x8d, 0x68, 0x85, 0x44, 0x01, 0x48, 0x48, 0x96, 0x44, 0x9b,
+	0x48, 0x00, 0x44, 0x83, 0x48, 0x0b, 0x8d, 0xd6, 0xb2, 0xd6, 0xfa, 0xfa, 0xd6, 0xd6, 0xd2, 0xb1,
+	0xad, 0xad, 0x82, 0xcd, 0x14, 0xd2, 0xd2, 0xd6, 0xf7, 0xd6, 0xd2, 0xcd, 0xcd, 0xad, 0xad, 0x8d,
+	0x8d, 0xad, 0xb1, 0xd2, 0xb2, 0x8d, 0x68, 0x8d, 0x68, 0x48, 0x9e, 0x44, 0x9b, 0x48, 0x00, 0x44,
+	0x83, 0x48, 0x1e, 0x69, 0xb1, 0xb2, 0xb1, 0xd6, 0xfa, 0xf6, 0xd6, 0xd2, 0xd1, 0xb1, 0xb1, 0xd1,
+	0xcd, 0xd2, 0xd2, 0xd6, 0xfb, 0xfb, 0xd6, 0xd6, 0xd2, 0xd2, 0xb2, 0xad, 0x8d, 0x8d, 0xad, 0xb1,
+	0xd2, 0xb1, 0x83, 0x68, 0x00, 0x48, 0x9e, 0x44, 0x9b, 0x48, 0x00, 0x44, 0x84, 0x48, 0x03, 0x8d,
+	0xb1, 0xb1, 0xb2, 0x82, 0xd6, 0x03, 0xd2, 0xd2, 0xb1, 0xb1, 0x82, 0xd2, 0x85, 0xd6, 0x09, 0xd2,
+	0xd2, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0xb1, 0xb1, 0x8d, 0x82, 0x68, 0x00, 0x48, 0x8a, 0x44, 0x00,
+	0x24, 0x93, 0x44, 0xa1, 0x48, 0x04, 0x68, 0x8d, 0xb1, 0xb1, 0xb2, 0x82, 0xd6, 0x00, 0xd2, 0x82,
+	0xb1, 0x09, 0xb2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xb2, 0x82, 0xad, 0x04, 0x8d,
+	0xad, 0xb1, 0xb1, 0x89, 0x82, 0x68, 0x8c, 0x44, 0x00, 0x24, 0x92, 0x44, 0x95, 0x48, 0x00, 0x44,
+	0x8b, 0x48, 0x07, 0x68, 0x8d, 0xb1, 0xb1, 0xd2, 0xd6, 0xd6, 0xd2, 0x82, 0xb1, 0x00, 0xb2, 0x87,
+	0xd2, 0x07, 0xb2, 0xb1, 0xad, 0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x82, 0x68, 0x02, 0x44, 0x44, 0x48,
+	0x9e, 0x44, 0x8f, 0x48, 0x06, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x8c, 0x48, 0x06, 0x69,
+	0x8d, 0xb1, 0x8d, 0xd6, 0xd6, 0xd2, 0x82, 0xb1, 0x00, 0xb2, 0x87, 0xd2, 0x01, 0xd1, 0xb1, 0x83,
+	0xad, 0x06, 0x8d, 0x8d, 0x68, 0x68, 0x48, 0x44, 0x68, 0x9f, 0x44, 0x8f, 0x48, 0x85, 0x44, 0x8d,
+	0x48, 0x00, 0x68, 0x82, 0x8d, 0x02, 0xad, 0xd6, 0xd6, 0x82, 0xb1, 0x00, 0xb2, 0x87, 0xd2, 0x00,
+	0xb1, 0x82, 0xad, 0x82, 0x8d, 0x82, 0x68, 0x02, 0x44, 0x68, 0x68, 0x9f, 0x44, 0x8a, 0x48, 0x00,
+	0x44, 0x83, 0x48, 0x86, 0x44, 0x8c, 0x48, 0x00, 0x69, 0x83, 0x8d, 0x02, 0xb1, 0xd6, 0xb2, 0x82,
+	0xb1, 0x00, 0xd1, 0x85, 0xd2, 0x82, 0xb1, 0x00, 0xad, 0x83, 0x8d, 0x05, 0x68, 0x48, 0x44, 0x44,
+	0x68, 0x68, 0x89, 0x44, 0x82, 0x24, 0x92, 0x44, 0x8e, 0x48, 0x87, 0x44, 0x8b, 0x48, 0x02, 0x44,
+	0x68, 0xad, 0x83, 0x8d, 0x01, 0xb2, 0xb2, 0x83, 0xb1, 0x01, 0xd1, 0xd1, 0x83, 0xd2, 0x03, 0xb1,
+	0xb1, 0xad, 0xad, 0x82, 0x8d, 0x06, 0x68, 0x68, 0x44, 0x44, 0x68, 0x68, 0x48, 0x89, 0x44, 0x82,
+	0x24, 0x92, 0x44, 0x87, 0x48, 0x00, 0x44, 0x82, 0x48, 0x00, 0x44, 0x82, 0x48, 0x86, 0x44, 0x88,
+	0x48, 0x83, 0x44, 0x03, 0x68, 0x8d, 0xad, 0xad, 0x82, 0x8d, 0x85, 0xb1, 0x84, 0xd2, 0x02, 0xb1,
+	0xb1, 0xad, 0x82, 0x8d, 0x07, 0x68, 0x68, 0x48, 0x44, 0x48, 0x68, 0x68, 0x48, 0x9f, 0x44, 0x8a,
+	0x48, 0x8c, 0x44, 0x84, 0x48, 0x86, 0x44, 0x07, 0x68, 0x8d, 0xad, 0xb1, 0x8d, 0x69, 0x69, 0x8d,
+	0x84, 0xb1, 0x0d, 0xb2, 0xd2, 0xd2, 0xb2, 0xb2, 0xb1, 0xb1, 0xad, 0x8d, 0x8d, 0x68, 0x68, 0x48,
+	0x44, 0x83, 0x68, 0x00, 0x48, 0x9f, 0x44, 0x89, 0x48, 0x8c, 0x44, 0x02, 0x48, 0x48, 0x44, 0x82,
+	0x48, 0x85, 0x44, 0x08, 0x24, 0x68, 0x8d, 0xad, 0xb1, 0xb1, 0x8d, 0x68, 0x69, 0x82, 0x8d, 0x01,
+	0xb1, 0xb1, 0x84, 0xb2, 0x08, 0xb1, 0xad, 0x8d, 0x8d, 0x69, 0x68, 0x68, 0x44, 0x44, 0x83, 0x68,
+	0xa0, 0x44, 0x87, 0x48, 0x01, 0x44, 0x48, 0x8f, 0x44, 0x00, 0x48, 0x87, 0x44, 0x02, 0x6d, 0x6d,
+	0x8d, 0x82, 0xad, 0x03, 0xb1, 0x8d, 0x68, 0x69, 0x82, 0x8d, 0x00, 0xad, 0x82, 0xb1, 0x01, 0xb2,
+	0xb1, 0x82, 0x8d, 0x04, 0x69, 0x68, 0x48, 0x44, 0x48, 0x83, 0x68, 0x00, 0x48, 0x82, 0x44, 0x00,
+	0x48, 0x9c, 0x44, 0x87, 0x48, 0x8f, 0x44, 0x00, 0x48, 0x86, 0x44, 0x0e, 0x24, 0x48, 0x91, 0x92,
+	0x68, 0x8d, 0x8d, 0xad, 0xad, 0xb1, 0xad, 0x8d, 0x68, 0x68, 0x69, 0x88, 0x8d, 0x01, 0x69, 0x68,
+	0x83, 0x48, 0x82, 0x68, 0x00, 0x48, 0x83, 0x44, 0x83, 0x48, 0x99, 0x44, 0x86, 0x48, 0x91, 0x44,
+	0x01, 0x24, 0x24, 0x82, 0x44, 0x08, 0x24, 0x44, 0x69, 0x92, 0xb6, 0x68, 0x68, 0x8d, 0x8d, 0x84,
+	0xad, 0x00, 0x8d, 0x83, 0x68, 0x06, 0x8d, 0x69, 0x6d, 0x8d, 0x69, 0x69, 0x68, 0x82, 0x48, 0x06,
+	0x68, 0x48, 0x44, 0x48, 0x48, 0x68, 0x48, 0x84, 0x44, 0x84, 0x48, 0x97, 0x44, 0x83, 0x48, 0x03,
+	0x44, 0x44, 0x48, 0x48, 0x93, 0x44, 0x05, 0x24, 0x44, 0x48, 0x71, 0x92, 0xb6, 0x82, 0x68, 0x84,
+	0x8d, 0x01, 0xad, 0xad, 0x82, 0x8d, 0x8c, 0x68, 0x00, 0x48, 0x82, 0x44, 0x01, 0x48, 0x48, 0x84,
+	0x44, 0x85, 0x48, 0x96, 0x44, 0x01, 0x44, 0x44, 0x83, 0x48, 0x94, 0x44, 0x06, 0x48, 0x49, 0x6d,
+	0x92, 0x92, 0xb6, 0x6d, 0x82, 0x68, 0x93, 0x8d, 0x02, 0x69, 0x68, 0x68, 0x82, 0x44, 0x01, 0x48,
+	0x48, 0x86, 0x44, 0x04, 0x48, 0x44, 0x44, 0x48, 0x48, 0x96, 0x44, 0x00, 0x48, 0x82, 0x44, 0x00,
+	0x48, 0x92, 0x44, 0x08, 0x24, 0x44, 0x6d, 0x91, 0x72, 0x92, 0x96, 0xb6, 0x8d, 0x83, 0x68, 0x05,
+	0x8d, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0x82, 0x8d, 0x00, 0x89, 0x89, 0x8d, 0x02, 0x68, 0x68, 0x48,
+	0x8b, 0x44, 0x00, 0x48, 0x99, 0x44, 0x00, 0x24, 0x03, 0x44, 0x44, 0x48, 0x48, 0x92, 0x44, 0x02,
+	0x24, 0x48, 0x6d, 0x82, 0x92, 0x02, 0xb6, 0xb6, 0xb2, 0x83, 0x68, 0x00, 0x88, 0x82, 0x8d, 0x08,
+	0xad, 0x8d, 0xad, 0x8d, 0x8d, 0x89, 0x69, 0x89, 0x89, 0x85, 0x8d, 0x00, 0x6d, 0x82, 0x68, 0xa8,
+	0x44, 0x02, 0x44, 0x48, 0x48, 0x93, 0x44, 0x01, 0x6d, 0x92, 0x82, 0x96, 0x82, 0xb6, 0x05, 0x92,
+	0x68, 0x88, 0x68, 0x68, 0x89, 0x87, 0x8d, 0x00, 0x89, 0x84, 0x68, 0x03, 0x89, 0x8d, 0x8d, 0x89,
+	0x82, 0x68, 0x00, 0x48, 0xa6, 0x44, 0x01, 0x24, 0x44, 0x01, 0x48, 0x48, 0x91, 0x44, 0x03, 0x24,
+	0x48, 0x6d, 0x96, 0x82, 0xb6, 0x00, 0x96, 0x82, 0xb6, 0x05, 0xb2, 0x88, 0x89, 0x68, 0x68, 0x89,
+	0x88, 0x8d, 0x00, 0x69, 0x85, 0x68, 0x00, 0x69, 0x82, 0x68, 0x00, 0x48, 0xa9, 0x44, 0x00, 0x48,
+	0x82, 0x44, 0x00, 0x24, 0x8c, 0x44, 0x03, 0x24, 0x24, 0x4d, 0x92, 0x88, 0xb6, 0x05, 0xb2, 0x8d,
+	0x8d, 0x88, 0x68, 0x89, 0x88, 0x8d, 0x00, 0x69, 0x88, 0x68, 0x00, 0x48, 0xaa, 0x44, 0x02, 0x48,
+	0x44, 0x24, 0x8a, 0x44, 0x06, 0x24, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x96, 0x8a, 0xb6, 0x04, 0x8d,
+	0x8d, 0x89, 0x68, 0x89, 0x88, 0x8d, 0x87, 0x68, 0x82, 0x48, 0xaa, 0x44, 0x02, 0x44, 0x44, 0x24,
+	0x8b, 0x44, 0x03, 0x24, 0x24, 0x49, 0x92, 0x8c, 0xb6, 0x04, 0x91, 0x8d, 0x89, 0x68, 0x69, 0x87,
+	0x8d, 0x01, 0x89, 0x69, 0x86, 0x68, 0x83, 0x48, 0xa9, 0x44, 0x03, 0x44, 0x44, 0x24, 0x24, 0x89,
+	0x44, 0x03, 0x24, 0x48, 0x6d, 0x92, 0x8d, 0xb6, 0x06, 0xb2, 0x8d, 0x89, 0x68, 0x69, 0x8d, 0x8d,
+	0x82, 0x89, 0x82, 0x8d, 0x00, 0x69, 0x88, 0x68, 0x01, 0x48, 0x48, 0xaa, 0x44, 0x02, 0x44, 0x44,
+	0x24, 0x88, 0x44, 0x04, 0x24, 0x24, 0x49, 0x92, 0x96, 0x8f, 0xb6, 0x00, 0x8d, 0x82, 0x69, 0x02,
+	0x89, 0x89, 0x8d, 0x83, 0x69, 0x89, 0x68, 0x82, 0x48, 0xaa, 0x44, 0x01, 0x44, 0x24, 0x84, 0x44,
+	0x07, 0x24, 0x24, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x91, 0xb6, 0x01, 0xb2, 0x6d, 0x85, 0x69,
+	0x8b, 0x68, 0x82, 0x48, 0xab, 0x44, 0x8a, 0x44, 0x01, 0x49, 0x71, 0x83, 0x96, 0x87, 0xb6, 0x01,
+	0x96, 0x96, 0x86, 0xb6, 0x02, 0x91, 0x69, 0x6d, 0x82, 0x69, 0x89, 0x68, 0x82, 0x48, 0xae, 0x44,
+	0x87, 0x44, 0x03, 0x24, 0x48, 0x6d, 0x92, 0x84, 0x96, 0x82, 0xb6, 0x00, 0x96, 0x87, 0xb6, 0x00,
+	0x96, 0x82, 0xb6, 0x02, 0x92, 0xb2, 0x8d, 0x84, 0x69, 0x88, 0x68, 0x82, 0x48, 0xae, 0x44, 0x83,
+	0x44, 0x05, 0x24, 0x44, 0x24, 0x24, 0x48, 0x71, 0x86, 0x96, 0x82, 0xb6, 0x03, 0x96, 0x96, 0xb6,
+	0xb6, 0x85, 0x96, 0x01, 0x92, 0xb6, 0x83, 0x92, 0x00, 0x8d, 0x83, 0x69, 0x88, 0x68, 0x00, 0x48,
+	0xb0, 0x44, 0x09, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x48, 0x6d, 0x92, 0x92, 0x85, 0x96, 0x82,
+	0xb6, 0x06, 0x96, 0x96, 0xb6, 0x96, 0x96, 0x92, 0x96, 0x8a, 0x92, 0x00, 0x8d, 0x83, 0x69, 0x86,
+	0x68, 0x00, 0x48, 0xb1, 0x44, 0x82, 0x44, 0x03, 0x24, 0x24, 0x49, 0x71, 0x8a, 0x96, 0x00, 0xb6,
+	0x83, 0x96, 0x8e, 0x92, 0x01, 0x8d, 0x69, 0x88, 0x68, 0x01, 0x48, 0x48, 0xb0, 0x44, 0x06, 0x44,
+	0x44, 0x24, 0x48, 0x6d, 0x92, 0x92, 0x87, 0x96, 0x00, 0xb6, 0x85, 0x96, 0x90, 0x92, 0x01, 0x91,
+	0x6d, 0x88, 0x68, 0x00, 0x48, 0xb0, 0x44, 0x02, 0x24, 0x24, 0x49, 0x82, 0x92, 0x8d, 0x96, 0x92,
+	0x92, 0x03, 0x91, 0x91, 0x8d, 0x6d, 0x85, 0x68, 0x01, 0x48, 0x48, 0xb0, 0x44
+};
 
+const uint8_t bitmap_daniel[6477] = {
+	0x01, 0x6d, 0x6d, 0x84, 0x48, 0x00, 0x6c, 0x82, 0x6d, 0x06, 0x4c, 0x4c, 0x6d, 0x4c, 0x48, 0x6c,
+	0x48, 0x83, 0x68, 0x84, 0x48, 0x03, 0x4c, 0x6c, 0x6c, 0x4c, 0x85, 0x48, 0x00, 0x6c, 0x84, 0x6d,
+	0x07, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x4c, 0x82, 0x48, 0x00, 0x6c, 0x8c, 0x48, 0x00,
+	0x4c, 0x82, 0x6d, 0x00, 0x4c, 0x86, 0x48, 0x85, 0x6d, 0x08, 0x4d, 0x48, 0x4d, 0x6d, 0x6d, 0x68,
+	0x48, 0x48, 0x4c, 0x83, 0x6d, 0x00, 0x48, 0x00, 0x6d, 0x84, 0x48, 0x83, 0x6d, 0x04, 0x4c, 0x6c,
+	0x6d, 0x48, 0x48, 0x82, 0x68, 0x87, 0x48, 0x82, 0x4c, 0x82, 0x48, 0x00, 0x6c, 0x86, 0x6d, 0x02,
+	0x48, 0x48, 0x24, 0x83, 0x48, 0x07, 0x44, 0x48, 0x6d, 0x28, 0x24, 0x24, 0x48, 0x4c, 0x86, 0x6d,
+	0x00, 0x6c, 0x88, 0x48, 0x00, 0x4c, 0x87, 0x48, 0x85, 0x6d, 0x01, 0x4c, 0x48, 0x82, 0x6d, 0x02,
+	0x68, 0x48, 0x48, 0x83, 0x6d, 0x00, 0x48, 0x00, 0x4c, 0x82, 0x48, 0x00, 0x6c, 0x83, 0x6d, 0x05,
+	0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x89, 0x48, 0x01, 0x4c, 0x4c, 0x82, 0x48, 0x84, 0x6d, 0x01,
+	0x4c, 0x48, 0x84, 0x24, 0x09, 0x48, 0x24, 0x24, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x82,
+	0x24, 0x03, 0x48, 0x6d, 0x48, 0x48, 0x86, 0x6d, 0x00, 0x6c, 0x8e, 0x48, 0x85, 0x6d, 0x07, 0x48,
+	0x48, 0x6d, 0x6d, 0x6c, 0x68, 0x48, 0x48, 0x83, 0x6d, 0x82, 0x48, 0x84, 0x6d, 0x05, 0x4c, 0x6d,
+	0x6d, 0x48, 0x48, 0x68, 0x88, 0x48, 0x00, 0x4c, 0x82, 0x48, 0x00, 0x6c, 0x84, 0x6d, 0x03, 0x48,
+	0x48, 0x24, 0x20, 0x86, 0x24, 0x02, 0x00, 0x00, 0x20, 0x83, 0x00, 0x04, 0x24, 0x24, 0x00, 0x24,
+	0x24, 0x82, 0x48, 0x82, 0x6d, 0x02, 0x48, 0x48, 0x68, 0x83, 0x6d, 0x00, 0x68, 0x8c, 0x48, 0x85,
+	0x6d, 0x0a, 0x48, 0x48, 0x6d, 0x6d, 0x68, 0x48, 0x48, 0x4c, 0x6d, 0x4d, 0x6d, 0x00, 0x48, 0x85,
+	0x6d, 0x02, 0x4c, 0x6d, 0x6c, 0x8b, 0x48, 0x03, 0x4c, 0x48, 0x48, 0x6c, 0x85, 0x6d, 0x00, 0x4c,
+	0x82, 0x24, 0x00, 0x48, 0x82, 0x24, 0x05, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x85, 0x00, 0x06,
+	0x20, 0x20, 0x24, 0x00, 0x24, 0x48, 0x48, 0x82, 0x6d, 0x84, 0x48, 0x05, 0x68, 0x6c, 0x6d, 0x6d,
+	0x6c, 0x68, 0x8a, 0x48, 0x85, 0x6d, 0x06, 0x48, 0x48, 0x6d, 0x4c, 0x68, 0x48, 0x48, 0x82, 0x6d,
+	0x82, 0x6d, 0x04, 0x69, 0x6d, 0x6d, 0x4c, 0x6d, 0x8c, 0x48, 0x02, 0x6d, 0x48, 0x48, 0x86, 0x6d,
+	0x05, 0x48, 0x24, 0x48, 0x48, 0x4c, 0x48, 0x82, 0x24, 0x05, 0x20, 0x24, 0x20, 0x00, 0x00, 0x20,
+	0x83, 0x00, 0x00, 0x20, 0x82, 0x00, 0x84, 0x20, 0x02, 0x24, 0x48, 0x6d, 0x87, 0x48, 0x00, 0x68,
+	0x82, 0x6d, 0x00, 0x68, 0x89, 0x48, 0x85, 0x6d, 0x08, 0x48, 0x4c, 0x6d, 0x4c, 0x68, 0x48, 0x48,
+	0x6d, 0x4c, 0x09, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6c, 0x83, 0x48, 0x00,
+	0x4c, 0x84, 0x48, 0x01, 0x6c, 0x48, 0x86, 0x6d, 0x0a, 0x48, 0x68, 0x48, 0x24, 0x6d, 0x4c, 0x24,
+	0x00, 0x00, 0x20, 0x20, 0x82, 0x24, 0x01, 0x20, 0x00, 0x82, 0x20, 0x86, 0x00, 0x02, 0x20, 0x20,
+	0x24, 0x82, 0x00, 0x02, 0x44, 0x4d, 0x4d, 0x87, 0x48, 0x03, 0x68, 0x6d, 0x6d, 0x6c, 0x89, 0x48,
+	0x84, 0x6d, 0x03, 0x4d, 0x48, 0x6d, 0x6d, 0x82, 0x48, 0x01, 0x6d, 0x6d, 0x08, 0x6d, 0x48, 0x6d,
+	0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x85, 0x48, 0x00, 0x6c, 0x86, 0x6d,
+	0x0e, 0x48, 0x48, 0x6d, 0x24, 0x6d, 0x48, 0x24, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x24,
+	0x82, 0x20, 0x02, 0x24, 0x20, 0x20, 0x87, 0x00, 0x84, 0x20, 0x03, 0x24, 0x48, 0x48, 0x4c, 0x87,
+	0x48, 0x82, 0x6d, 0x89, 0x48, 0x84, 0x6d, 0x07, 0x48, 0x48, 0x6d, 0x4c, 0x68, 0x48, 0x48, 0x6d,
+	0x07, 0x48, 0x69, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x8a, 0x48, 0x87, 0x6d, 0x00, 0x6c, 0x82,
+	0x6d, 0x07, 0x24, 0x48, 0x20, 0x00, 0x20, 0x24, 0x24, 0x20, 0x82, 0x00, 0x00, 0x20, 0x83, 0x00,
+	0x84, 0x20, 0x84, 0x00, 0x0a, 0x20, 0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x48, 0x48, 0x6d, 0x4c,
+	0x86, 0x48, 0x04, 0x68, 0x6d, 0x6d, 0x4c, 0x68, 0x86, 0x48, 0x00, 0x6c, 0x84, 0x6d, 0x02, 0x48,
+	0x48, 0x6d, 0x83, 0x48, 0x07, 0x48, 0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x68, 0x89, 0x48, 0x8c,
+	0x6d, 0x00, 0x24, 0x84, 0x00, 0x06, 0x24, 0x24, 0x20, 0x20, 0x00, 0x20, 0x20, 0x8b, 0x00, 0x00,
+	0x20, 0x82, 0x24, 0x00, 0x20, 0x84, 0x24, 0x03, 0x48, 0x4d, 0x6d, 0x4c, 0x86, 0x48, 0x03, 0x6d,
+	0x6d, 0x4d, 0x6d, 0x86, 0x48, 0x84, 0x6d, 0x03, 0x4d, 0x48, 0x6d, 0x6d, 0x82, 0x48, 0x06, 0x6d,
+	0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6c, 0x88, 0x48, 0x00, 0x68, 0x8b, 0x6d, 0x01, 0x4c, 0x24, 0x86,
+	0x00, 0x07, 0x24, 0x24, 0x00, 0x00, 0x20, 0x24, 0x24, 0x20, 0x84, 0x00, 0x84, 0x20, 0x03, 0x00,
+	0x00, 0x20, 0x20, 0x83, 0x00, 0x02, 0x20, 0x44, 0x24, 0x83, 0x48, 0x00, 0x4c, 0x85, 0x48, 0x83,
+	0x6d, 0x85, 0x48, 0x00, 0x4c, 0x84, 0x6d, 0x05, 0x48, 0x48, 0x6d, 0x4c, 0x68, 0x48, 0x05, 0x4d,
+	0x4c, 0x6c, 0x48, 0x6d, 0x6d, 0x88, 0x48, 0x00, 0x68, 0x8a, 0x6d, 0x02, 0x4c, 0x48, 0x24, 0x88,
+	0x00, 0x84, 0x20, 0x84, 0x00, 0x82, 0x20, 0x82, 0x24, 0x01, 0x20, 0x20, 0x83, 0x00, 0x00, 0x20,
+	0x82, 0x00, 0x02, 0x24, 0x48, 0x24, 0x8b, 0x48, 0x82, 0x6d, 0x85, 0x48, 0x85, 0x6d, 0x04, 0x48,
+	0x4c, 0x6d, 0x48, 0x48, 0x04, 0x48, 0x6d, 0x48, 0x4c, 0x6d, 0x88, 0x48, 0x00, 0x68, 0x8a, 0x6d,
+	0x82, 0x48, 0x00, 0x20, 0x83, 0x00, 0x00, 0x20, 0x85, 0x00, 0x07, 0x20, 0x20, 0x00, 0x00, 0x20,
+	0x20, 0x00, 0x00, 0x82, 0x20, 0x11, 0x24, 0x20, 0x20, 0x24, 0x20, 0x20, 0x00, 0x00, 0x20, 0x24,
+	0x24, 0x00, 0x00, 0x20, 0x48, 0x24, 0x48, 0x6d, 0x8a, 0x48, 0x82, 0x6d, 0x84, 0x48, 0x85, 0x6d,
+	0x04, 0x4c, 0x48, 0x6d, 0x4c, 0x48, 0x03, 0x6d, 0x48, 0x48, 0x6d, 0x88, 0x48, 0x00, 0x68, 0x8a,
+	0x6d, 0x0a, 0x4c, 0x48, 0x48, 0x24, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x20, 0x84, 0x00, 0x05,
+	0x24, 0x00, 0x00, 0x20, 0x00, 0x20, 0x83, 0x00, 0x05, 0x20, 0x44, 0x20, 0x00, 0x20, 0x20, 0x83,
+	0x00, 0x04, 0x20, 0x20, 0x00, 0x00, 0x20, 0x82, 0x24, 0x01, 0x68, 0x6d, 0x8a, 0x48, 0x82, 0x6d,
+	0x84, 0x48, 0x85, 0x6d, 0x03, 0x48, 0x48, 0x6d, 0x48, 0x03, 0x48, 0x48, 0x6d, 0x4c, 0x88, 0x48,
+	0x8a, 0x6d, 0x83, 0x48, 0x03, 0x20, 0x00, 0x00, 0x20, 0x82, 0x00, 0x01, 0x20, 0x20, 0x82, 0x00,
+	0x07, 0x24, 0x24, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x83, 0x00, 0x05, 0x20, 0x24, 0x00, 0x20,
+	0x00, 0x20, 0x82, 0x00, 0x07, 0x20, 0x24, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x82, 0x48, 0x00,
+	0x6d, 0x85, 0x48, 0x00, 0x4c, 0x83, 0x48, 0x01, 0x6d, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x84, 0x6d,
+	0x03, 0x4c, 0x48, 0x6d, 0x48, 0x02, 0x48, 0x4d, 0x6d, 0x88, 0x48, 0x8a, 0x6d, 0x84, 0x48, 0x82,
+	0x00, 0x02, 0x20, 0x00, 0x00, 0x85, 0x20, 0x02, 0x24, 0x20, 0x00, 0x82, 0x20, 0x84, 0x00, 0x87,
+	0x20, 0x15, 0x00, 0x24, 0x00, 0x20, 0x24, 0x24, 0x20, 0x20, 0x00, 0x20, 0x4c, 0x6d, 0x4c, 0x48,
+	0x6d, 0x4c, 0x48, 0x48, 0x4c, 0x4c, 0x48, 0x4c, 0x89, 0x48, 0x85, 0x6d, 0x02, 0x48, 0x4c, 0x6d,
+	0x01, 0x48, 0x6d, 0x88, 0x48, 0x89, 0x6d, 0x86, 0x48, 0x02, 0x00, 0x20, 0x20, 0x85, 0x00, 0x05,
+	0x20, 0x44, 0x64, 0x24, 0x00, 0x00, 0x83, 0x20, 0x04, 0x00, 0x20, 0x00, 0x00, 0x20, 0x83, 0x24,
+	0x82, 0x44, 0x01, 0x20, 0x20, 0x82, 0x00, 0x01, 0x20, 0x20, 0x82, 0x00, 0x00, 0x48, 0x83, 0x6d,
+	0x01, 0x6c, 0x4c, 0x82, 0x48, 0x02, 0x4c, 0x48, 0x4c, 0x88, 0x48, 0x00, 0x4c, 0x84, 0x6d, 0x02,
+	0x48, 0x48, 0x6d, 0x00, 0x6d, 0x88, 0x48, 0x89, 0x6d, 0x85, 0x48, 0x01, 0x6d, 0x48, 0x84, 0x00,
+	0x00, 0x20, 0x83, 0x00, 0x00, 0x24, 0x82, 0x44, 0x06, 0x00, 0x20, 0x24, 0x24, 0x44, 0x44, 0x24,
+	0x82, 0x20, 0x07, 0x44, 0x64, 0x68, 0x64, 0x89, 0x89, 0x8d, 0x68, 0x83, 0x20, 0x05, 0x00, 0x20,
+	0x00, 0x24, 0x00, 0x24, 0x84, 0x6d, 0x01, 0x6c, 0x6d, 0x84, 0x48, 0x00, 0x4c, 0x88, 0x48, 0x84,
+	0x6d, 0x02, 0x48, 0x48, 0x6d, 0x00, 0x4d, 0x87, 0x48, 0x00, 0x68, 0x88, 0x6d, 0x84, 0x48, 0x03,
+	0x4c, 0x6d, 0x6d, 0x48, 0x85, 0x00, 0x12, 0x20, 0x00, 0x20, 0x24, 0x20, 0x44, 0x68, 0x68, 0x24,
+	0x00, 0x20, 0x20, 0x44, 0x64, 0x64, 0x44, 0x44, 0x64, 0x68, 0x82, 0x89, 0x0d, 0x8d, 0xad, 0x89,
+	0x68, 0x89, 0x68, 0x44, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x24, 0x83, 0x6d, 0x03, 0x4d, 0x6d,
+	0x6c, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x88, 0x48, 0x00, 0x4d, 0x84, 0x6d, 0x01, 0x48, 0x6d, 0x88,
+	0x48, 0x88, 0x6d, 0x00, 0x4c, 0x82, 0x48, 0x05, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x24, 0x83, 0x00,
+	0x1e, 0x20, 0x20, 0x24, 0x44, 0x24, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x89, 0x44, 0x20, 0x24, 0x64,
+	0x68, 0x68, 0x64, 0x64, 0x68, 0x69, 0x68, 0x89, 0xb1, 0xad, 0xad, 0x89, 0xad, 0xad, 0x89, 0x44,
+	0x84, 0x20, 0x01, 0x00, 0x48, 0x84, 0x6d, 0x08, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x4c, 0x48,
+	0x4c, 0x88, 0x48, 0x84, 0x6d, 0x01, 0x48, 0x48, 0x87, 0x48, 0x00, 0x6c, 0x87, 0x6d, 0x00, 0x4c,
+	0x82, 0x48, 0x02, 0x4c, 0x6d, 0x4c, 0x82, 0x48, 0x84, 0x00, 0x10, 0x20, 0x24, 0x64, 0x68, 0x44,
+	0x68, 0x89, 0xad, 0xad, 0xb1, 0xad, 0x89, 0x68, 0x68, 0x89, 0x68, 0x68, 0x83, 0x89, 0x12, 0xad,
+	0xb1, 0xd2, 0xd1, 0xb1, 0xb1, 0xad, 0xad, 0x89, 0x44, 0x20, 0x44, 0x24, 0x20, 0x00, 0x00, 0x48,
+	0x48, 0x6c, 0x83, 0x6d, 0x03, 0x48, 0x48, 0x6c, 0x6d, 0x84, 0x48, 0x01, 0x4c, 0x6d, 0x85, 0x48,
+	0x85, 0x6d, 0x00, 0x48, 0x87, 0x48, 0x88, 0x6d, 0x01, 0x48, 0x48, 0x83, 0x4c, 0x03, 0x48, 0x48,
+	0x6d, 0x48, 0x82, 0x00, 0x82, 0x20, 0x00, 0x44, 0x82, 0x68, 0x02, 0x89, 0xad, 0xad, 0x82, 0xb1,
+	0x83, 0xad, 0x04, 0x8d, 0xad, 0xad, 0xd1, 0xd1, 0x84, 0xd2, 0x00, 0xd1, 0x83, 0xad, 0x0a, 0x89,
+	0x68, 0x44, 0x24, 0x20, 0x00, 0x00, 0x24, 0x6d, 0x48, 0x6c, 0x83, 0x6d, 0x03, 0x48, 0x48, 0x68,
+	0x6d, 0x84, 0x48, 0x82, 0x6d, 0x83, 0x48, 0x85, 0x6d, 0x00, 0x48, 0x86, 0x48, 0x00, 0x6c, 0x87,
+	0x6d, 0x0a, 0x48, 0x48, 0x4c, 0x6c, 0x4c, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x44, 0x82, 0x00, 0x05,
+	0x24, 0x20, 0x44, 0x68, 0x68, 0x89, 0x82, 0xad, 0x83, 0xd1, 0x03, 0xd2, 0xb1, 0xad, 0xb1, 0x82,
+	0xd1, 0x85, 0xd2, 0x83, 0xd1, 0x0d, 0xb1, 0xb1, 0xad, 0x64, 0x24, 0x24, 0x20, 0x00, 0x00, 0x24,
+	0x6d, 0x4c, 0x48, 0x6c, 0x83, 0x6d, 0x03, 0x48, 0x48, 0x68, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x82,
+	0x6d, 0x83, 0x48, 0x84, 0x6d, 0x00, 0x48, 0x86, 0x48, 0x87, 0x6d, 0x08, 0x48, 0x48, 0x4c, 0x6d,
+	0x6d, 0x4c, 0x48, 0x68, 0x6d, 0x82, 0x48, 0x82, 0x00, 0x08, 0x20, 0x20, 0x44, 0x89, 0x8d, 0xad,
+	0xad, 0xb1, 0xd1, 0x82, 0xd2, 0x00, 0xd1, 0x8b, 0xd2, 0x00, 0xd1, 0x82, 0xd2, 0x06, 0xd1, 0xd1,
+	0xb1, 0xad, 0x68, 0x44, 0x44, 0x82, 0x00, 0x05, 0x24, 0x6d, 0x6d, 0x4c, 0x48, 0x6c, 0x83, 0x6d,
+	0x03, 0x48, 0x48, 0x68, 0x6d, 0x83, 0x48, 0x83, 0x6d, 0x82, 0x48, 0x85, 0x6d, 0x86, 0x48, 0x86,
+	0x6d, 0x0c, 0x4c, 0x48, 0x4d, 0x6d, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x84,
+	0x00, 0x01, 0x44, 0x89, 0x82, 0xad, 0x07, 0xb1, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd2, 0xd6, 0x8c,
+	0xd2, 0x0b, 0xd6, 0xd2, 0xd2, 0xd1, 0xad, 0xad, 0x8d, 0x44, 0x20, 0x00, 0x00, 0x24, 0x82, 0x6d,
+	0x02, 0x48, 0x48, 0x6c, 0x83, 0x6d, 0x03, 0x48, 0x48, 0x6c, 0x6d, 0x83, 0x48, 0x83, 0x6d, 0x01,
+	0x48, 0x48, 0x85, 0x6d, 0x85, 0x48, 0x00, 0x6c, 0x85, 0x6d, 0x82, 0x4c, 0x0a, 0x6d, 0x6d, 0x48,
+	0x48, 0x68, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x84, 0x00, 0x01, 0x24, 0x89, 0x82, 0xad, 0x06,
+	0x8d, 0x8d, 0xad, 0xb2, 0xd2, 0xd6, 0xd6, 0x82, 0xd2, 0x06, 0xb2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd2,
+	0xd2, 0x83, 0xd6, 0x03, 0xd2, 0xb1, 0x8d, 0x8d, 0x82, 0xad, 0x00, 0x44, 0x82, 0x00, 0x01, 0x24,
+	0x4c, 0x82, 0x6d, 0x01, 0x48, 0x48, 0x84, 0x6d, 0x03, 0x48, 0x48, 0x6c, 0x6d, 0x82, 0x48, 0x8b,
+	0x6d, 0x85, 0x48, 0x86, 0x6d, 0x0d, 0x4c, 0x4d, 0x6d, 0x6d, 0x4c, 0x48, 0x68, 0x6d, 0x48, 0x48,
+	0x6d, 0x6d, 0x68, 0x48, 0x84, 0x00, 0x04, 0x24, 0x89, 0xad, 0xad, 0x89, 0x83, 0x44, 0x07, 0x69,
+	0xad, 0xd2, 0xd6, 0xd2, 0xd2, 0xd6, 0xd6, 0x85, 0xd2, 0x02, 0xd6, 0xd2, 0x89, 0x83, 0x44, 0x03,
+	0x89, 0xad, 0xad, 0x64, 0x82, 0x00, 0x07, 0x48, 0x4c, 0x48, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x83,
+	0x6d, 0x04, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x82, 0x48, 0x01, 0x6d, 0x48, 0x88, 0x6d, 0x85, 0x48,
+	0x85, 0x6d, 0x0f, 0x4c, 0x4c, 0x6d, 0x6d, 0x4c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x68,
+	0x48, 0x68, 0x24, 0x83, 0x00, 0x0c, 0x44, 0xad, 0xad, 0x8d, 0x68, 0x69, 0x8d, 0x89, 0x69, 0x44,
+	0x44, 0x69, 0xad, 0x88, 0xd2, 0x04, 0xad, 0x89, 0x44, 0x44, 0x68, 0x82, 0x8d, 0x03, 0x89, 0x89,
+	0xad, 0x89, 0x82, 0x00, 0x05, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x82, 0x48, 0x83, 0x6d, 0x04,
+	0x48, 0x48, 0x68, 0x4c, 0x6d, 0x84, 0x48, 0x87, 0x6d, 0x85, 0x48, 0x84, 0x6d, 0x10, 0x6c, 0x4c,
+	0x6d, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x6c, 0x68, 0x68, 0x48, 0x68, 0x24, 0x83,
+	0x00, 0x19, 0x68, 0xad, 0x8d, 0x69, 0x8d, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x69, 0x44, 0x64, 0x8d,
+	0xad, 0xd1, 0xd1, 0xad, 0xad, 0xd1, 0xd2, 0xad, 0x89, 0x44, 0x64, 0x69, 0x83, 0x8d, 0x0a, 0x89,
+	0x69, 0x8d, 0x8d, 0x20, 0x00, 0x00, 0x48, 0x48, 0x6c, 0x4c, 0x84, 0x48, 0x00, 0x4c, 0x82, 0x6d,
+	0x07, 0x6c, 0x48, 0x68, 0x48, 0x48, 0x6d, 0x48, 0x6c, 0x89, 0x6d, 0x84, 0x48, 0x85, 0x6d, 0x09,
+	0x4c, 0x6d, 0x6c, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x82, 0x68, 0x03, 0x48, 0x48, 0x6d,
+	0x48, 0x82, 0x00, 0x07, 0x20, 0x8d, 0xad, 0x8d, 0x89, 0x8d, 0x89, 0x64, 0x83, 0x44, 0x02, 0x69,
+	0x69, 0x89, 0x86, 0xad, 0x04, 0x89, 0x69, 0x69, 0x68, 0x49, 0x85, 0x69, 0x09, 0x49, 0x49, 0x24,
+	0x00, 0x24, 0x4d, 0x6d, 0x48, 0x6d, 0x4c, 0x84, 0x48, 0x83, 0x6d, 0x08, 0x48, 0x48, 0x68, 0x48,
+	0x6d, 0x48, 0x6d, 0x6c, 0x68, 0x87, 0x6d, 0x84, 0x48, 0x85, 0x6d, 0x10, 0x4c, 0x6c, 0x68, 0x48,
+	0x48, 0x6d, 0x6d, 0x48, 0x6c, 0x48, 0x68, 0x68, 0x48, 0x68, 0x68, 0x48, 0x48, 0x82, 0x00, 0x04,
+	0x44, 0x69, 0x49, 0x49, 0x45, 0x84, 0x69, 0x0e, 0x6d, 0x69, 0x48, 0x49, 0x69, 0x69, 0x8d, 0xad,
+	0xb1, 0xad, 0x8d, 0x69, 0x49, 0x69, 0x44, 0x82, 0x69, 0x0e, 0x8d, 0x69, 0x89, 0xad, 0x89, 0x68,
+	0x49, 0x24, 0x24, 0x89, 0x69, 0x6d, 0x6d, 0x48, 0x6d, 0x85, 0x48, 0x83, 0x6d, 0x82, 0x48, 0x82,
+	0x6d, 0x02, 0x48, 0x48, 0x6c, 0x86, 0x6d, 0x84, 0x48, 0x85, 0x6d, 0x08, 0x6c, 0x48, 0x4c, 0x48,
+	0x48, 0x6d, 0x48, 0x6c, 0x48, 0x82, 0x68, 0x33, 0x48, 0x68, 0x48, 0x68, 0x89, 0x68, 0x00, 0x00,
+	0x44, 0x48, 0x24, 0x24, 0x69, 0x8d, 0x68, 0x44, 0xb2, 0x91, 0x4d, 0x91, 0x91, 0x44, 0x68, 0x69,
+	0x49, 0x45, 0x44, 0x49, 0x24, 0x49, 0x69, 0x44, 0x69, 0x6d, 0x6c, 0x6c, 0x8d, 0x8d, 0x44, 0x68,
+	0x89, 0x8d, 0x69, 0x44, 0x44, 0x89, 0x88, 0x6d, 0x4d, 0x48, 0x48, 0x6d, 0x84, 0x48, 0x83, 0x6d,
+	0x05, 0x4c, 0x6d, 0x48, 0x48, 0x6c, 0x6d, 0x82, 0x48, 0x86, 0x6d, 0x84, 0x48, 0x85, 0x6d, 0x00,
+	0x4c, 0x82, 0x48, 0x02, 0x6d, 0x48, 0x48, 0x85, 0x68, 0x34, 0x48, 0x4c, 0x88, 0x88, 0x89, 0x24,
+	0x00, 0x68, 0xad, 0x8d, 0x69, 0x89, 0x68, 0x44, 0x89, 0xb1, 0x4c, 0x48, 0x4c, 0x91, 0x89, 0x44,
+	0x89, 0x69, 0x69, 0xd2, 0xd2, 0x69, 0x69, 0x68, 0x64, 0x8d, 0x8c, 0x68, 0x8c, 0x8c, 0xad, 0x64,
+	0x68, 0x8d, 0xad, 0xad, 0x69, 0x44, 0xad, 0x88, 0x69, 0x48, 0x6d, 0x48, 0x48, 0x4d, 0x6d, 0x83,
+	0x48, 0x84, 0x6d, 0x00, 0x6c, 0x85, 0x48, 0x00, 0x68, 0x85, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x85,
+	0x6d, 0x06, 0x48, 0x4c, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x82, 0x68, 0x38, 0x48, 0x68, 0x48, 0x48,
+	0x6d, 0x88, 0xad, 0x89, 0x20, 0x20, 0x69, 0xad, 0xad, 0xb1, 0xad, 0x8d, 0x89, 0x89, 0xad, 0x4c,
+	0x2c, 0x28, 0x8d, 0x89, 0x64, 0x8d, 0x48, 0x8d, 0xf6, 0xf6, 0xad, 0x69, 0x8d, 0x64, 0x89, 0x8d,
+	0x8c, 0x8c, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xb1, 0xad, 0x69, 0x44, 0xd1, 0xa9, 0x8d, 0x48, 0x6d,
+	0x6d, 0x48, 0x48, 0x6d, 0x4d, 0x83, 0x48, 0x84, 0x6d, 0x86, 0x48, 0x00, 0x68, 0x84, 0x6d, 0x83,
+	0x48, 0x00, 0x4c, 0x84, 0x6d, 0x83, 0x48, 0x02, 0x6d, 0x48, 0x48, 0x82, 0x68, 0x0d, 0x48, 0x68,
+	0x48, 0x48, 0x6d, 0x6d, 0x89, 0xa9, 0xad, 0x44, 0x20, 0x89, 0xad, 0xad, 0x82, 0xb1, 0x82, 0xad,
+	0x15, 0x8d, 0x6d, 0x8d, 0xad, 0x89, 0x8d, 0x69, 0x24, 0xad, 0xd6, 0xd6, 0xb1, 0x44, 0x8d, 0x8d,
+	0x89, 0x8d, 0x89, 0x8d, 0x8d, 0xad, 0xad, 0x82, 0xb1, 0x0c, 0xad, 0x89, 0x68, 0xb1, 0xa9, 0x8d,
+	0x48, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x83, 0x48, 0x00, 0x4c, 0x85, 0x6d, 0x00, 0x68, 0x84,
+	0x48, 0x84, 0x6d, 0x82, 0x48, 0x01, 0x4c, 0x4c, 0x84, 0x6d, 0x06, 0x48, 0x6c, 0x48, 0x4c, 0x6d,
+	0x48, 0x48, 0x84, 0x68, 0x1a, 0x48, 0x4d, 0x6d, 0x6d, 0x89, 0xa9, 0xd1, 0x64, 0x00, 0x89, 0xad,
+	0xad, 0xb1, 0xd2, 0xd2, 0xd1, 0xb1, 0xad, 0xad, 0xa9, 0x89, 0x89, 0x8d, 0x8d, 0x69, 0x64, 0xd1,
+	0x82, 0xd2, 0x08, 0x89, 0x89, 0xad, 0x8d, 0x89, 0x8d, 0x8d, 0xad, 0xb1, 0x82, 0xd2, 0x09, 0xb1,
+	0xad, 0x89, 0x89, 0xd1, 0xad, 0x6d, 0x4c, 0x48, 0x6d, 0x82, 0x48, 0x01, 0x6d, 0x4c, 0x83, 0x48,
+	0x86, 0x6d, 0x84, 0x48, 0x00, 0x6c, 0x83, 0x6d, 0x82, 0x48, 0x02, 0x4c, 0x48, 0x6c, 0x82, 0x6d,
+	0x0d, 0x4c, 0x48, 0x4c, 0x48, 0x6d, 0x6c, 0x48, 0x48, 0x68, 0x6c, 0x68, 0x68, 0x48, 0x48, 0x82,
+	0x6d, 0x08, 0x89, 0xad, 0xad, 0x64, 0x44, 0x89, 0xad, 0xad, 0xd1, 0x84, 0xd2, 0x00, 0xd1, 0x84,
+	0xad, 0x02, 0x89, 0xad, 0xd1, 0x82, 0xd2, 0x82, 0xad, 0x00, 0xcd, 0x82, 0xd1, 0x84, 0xd2, 0x0a,
+	0xb1, 0xad, 0x8d, 0x89, 0xd1, 0xad, 0x68, 0x4c, 0x6c, 0x4c, 0x4c, 0x82, 0x48, 0x00, 0x6d, 0x84,
+	0x48, 0x86, 0x6d, 0x84, 0x48, 0x83, 0x6d, 0x85, 0x48, 0x82, 0x6d, 0x04, 0x48, 0x6d, 0x48, 0x48,
+	0x6d, 0x82, 0x48, 0x04, 0x6d, 0x6d, 0x48, 0x68, 0x48, 0x83, 0x6d, 0x08, 0x8d, 0xad, 0x88, 0x88,
+	0x8d, 0x8d, 0xad, 0xad, 0xd1, 0x86, 0xd2, 0x01, 0xd1, 0xb1, 0x82, 0xad, 0x05, 0xb1, 0xd1, 0xd2,
+	0xf6, 0xd2, 0xd1, 0x82, 0xad, 0x01, 0xb1, 0xd1, 0x85, 0xd2, 0x0a, 0xb1, 0xad, 0xad, 0x89, 0xad,
+	0xad, 0x68, 0x48, 0x6d, 0x48, 0x6d, 0x88, 0x48, 0x86, 0x6d, 0x84, 0x48, 0x83, 0x6d, 0x02, 0x48,
+	0x48, 0x6c, 0x82, 0x48, 0x82, 0x6d, 0x0c, 0x48, 0x6d, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x6d,
+	0x68, 0x68, 0x48, 0x48, 0x83, 0x6d, 0x08, 0x8d, 0xad, 0x84, 0xad, 0xad, 0x8d, 0xad, 0xb1, 0xb1,
+	0x82, 0xd2, 0x01, 0xd1, 0xad, 0x82, 0xb1, 0x83, 0xad, 0x06, 0xd1, 0xd1, 0xd2, 0xf6, 0xd2, 0xd2,
+	0xd1, 0x85, 0xad, 0x82, 0xd2, 0x01, 0xd1, 0xb1, 0x84, 0xad, 0x07, 0x69, 0x48, 0x6d, 0x68, 0x6d,
+	0x48, 0x48, 0x68, 0x86, 0x48, 0x85, 0x6d, 0x04, 0x6c, 0x48, 0x68, 0x48, 0x48, 0x83, 0x6d, 0x02,
+	0x48, 0x48, 0x6d, 0x83, 0x48, 0x05, 0x6d, 0x48, 0x6d, 0x4c, 0x48, 0x6d, 0x82, 0x48, 0x05, 0x6d,
+	0x6d, 0x68, 0x68, 0x48, 0x4d, 0x83, 0x6d, 0x05, 0x8d, 0xad, 0x88, 0xad, 0xad, 0x8d, 0x82, 0xad,
+	0x83, 0xd2, 0x00, 0xd1, 0x84, 0xad, 0x0a, 0xd1, 0xd1, 0xb1, 0xd2, 0xd2, 0xf6, 0xd2, 0xd2, 0xd1,
+	0xd2, 0xd1, 0x83, 0xad, 0x03, 0xcd, 0xad, 0xd2, 0xd1, 0x85, 0xad, 0x08, 0x69, 0x48, 0x48, 0x6d,
+	0x6c, 0x4c, 0x48, 0x48, 0x68, 0x85, 0x48, 0x86, 0x6d, 0x83, 0x48, 0x00, 0x68, 0x82, 0x6d, 0x02,
+	0x48, 0x48, 0x6d, 0x83, 0x48, 0x05, 0x6d, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x82, 0x48, 0x04, 0x6d,
+	0x6d, 0x68, 0x48, 0x48, 0x84, 0x6d, 0x00, 0x8d, 0x82, 0xad, 0x01, 0x8d, 0x8d, 0x83, 0xad, 0x04,
+	0xd1, 0xad, 0xad, 0x89, 0x88, 0x83, 0xad, 0x82, 0xd1, 0x06, 0xd2, 0xd2, 0xd6, 0xd6, 0xd2, 0xd1,
+	0xd1, 0x82, 0xad, 0x03, 0x89, 0x84, 0x84, 0xa9, 0x84, 0xad, 0x08, 0xb1, 0xd1, 0xad, 0x69, 0x48,
+	0x48, 0x6d, 0x68, 0x6d, 0x82, 0x48, 0x00, 0x68, 0x84, 0x48, 0x84, 0x6d, 0x01, 0x6c, 0x68, 0x83,
+	0x48, 0x00, 0x68, 0x82, 0x6d, 0x14, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x48, 0x68, 0x6d,
+	0x48, 0x48, 0x6d, 0x48, 0x48, 0x4c, 0x6d, 0x4c, 0x68, 0x48, 0x48, 0x85, 0x6d, 0x04, 0xad, 0xb1,
+	0xb1, 0xad, 0x8d, 0x83, 0xad, 0x04, 0x89, 0x68, 0x44, 0x64, 0x89, 0x83, 0xad, 0x03, 0x88, 0x89,
+	0xad, 0xb1, 0x82, 0xd2, 0x02, 0xad, 0x89, 0x68, 0x83, 0xad, 0x03, 0x89, 0x64, 0x44, 0x68, 0x83,
+	0xad, 0x02, 0xd1, 0xd2, 0xb1, 0x82, 0x48, 0x02, 0x6d, 0x68, 0x6d, 0x82, 0x48, 0x00, 0x68, 0x84,
+	0x48, 0x00, 0x4c, 0x82, 0x6d, 0x00, 0x68, 0x86, 0x48, 0x82, 0x6d, 0x02, 0x48, 0x68, 0x6c, 0x83,
+	0x6d, 0x0d, 0x48, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x6c, 0x4c, 0x4c, 0x68, 0x48, 0x4c,
+	0x83, 0x6d, 0x0e, 0x48, 0x4c, 0x8d, 0xd1, 0xb1, 0xad, 0x8d, 0xad, 0xad, 0x8d, 0x8d, 0x88, 0x44,
+	0x68, 0x8d, 0x84, 0xad, 0x00, 0x8d, 0x87, 0x89, 0x00, 0x8d, 0x83, 0xad, 0x04, 0x8d, 0x8d, 0x44,
+	0x44, 0x89, 0x82, 0xad, 0x09, 0xd1, 0xb1, 0x8d, 0x4c, 0x48, 0x48, 0x6d, 0x68, 0x6d, 0x6d, 0x88,
+	0x48, 0x06, 0x6d, 0x68, 0x6d, 0x48, 0x6d, 0x6d, 0x68, 0x83, 0x48, 0x82, 0x6d, 0x02, 0x48, 0x68,
+	0x48, 0x83, 0x6d, 0x0d, 0x4c, 0x6d, 0x48, 0x48, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x4c, 0x4c, 0x68,
+	0x48, 0x4c, 0x82, 0x6d, 0x10, 0x6c, 0x48, 0x6d, 0x48, 0x8d, 0xad, 0x89, 0x89, 0xad, 0xad, 0x8d,
+	0x8d, 0x89, 0x68, 0x68, 0x8d, 0xad, 0x84, 0xb1, 0x15, 0xad, 0x8d, 0x89, 0x69, 0x68, 0x89, 0xad,
+	0xb1, 0xb1, 0xad, 0xb1, 0xb1, 0xad, 0x8d, 0x69, 0x64, 0x89, 0xad, 0x8d, 0xad, 0x8d, 0x68, 0x82,
+	0x6d, 0x06, 0x48, 0x48, 0x4d, 0x68, 0x6d, 0x6c, 0x4c, 0x87, 0x48, 0x86, 0x6d, 0x83, 0x48, 0x82,
+	0x6d, 0x03, 0x48, 0x68, 0x4c, 0x48, 0x82, 0x6d, 0x0c, 0x6c, 0x6d, 0x48, 0x48, 0x4c, 0x6c, 0x48,
+	0x48, 0x4d, 0x4c, 0x4c, 0x68, 0x48, 0x83, 0x6d, 0x02, 0x48, 0x48, 0x4c, 0x82, 0x48, 0x02, 0x44,
+	0x69, 0xad, 0x82, 0x8d, 0x06, 0xad, 0xad, 0x64, 0x44, 0x44, 0x68, 0x89, 0x85, 0xad, 0x00, 0xd1,
+	0x83, 0xd2, 0x07, 0xad, 0xad, 0x89, 0x69, 0x44, 0x20, 0x64, 0x8d, 0x83, 0xad, 0x01, 0x6d, 0x48,
+	0x82, 0x6d, 0x05, 0x4c, 0x48, 0x6d, 0x68, 0x6d, 0x6c, 0x88, 0x48, 0x86, 0x6d, 0x83, 0x48, 0x02,
+	0x68, 0x6d, 0x6d, 0x04, 0x48, 0x68, 0x6d, 0x48, 0x6c, 0x83, 0x6d, 0x04, 0x48, 0x48, 0x6d, 0x68,
+	0x48, 0x83, 0x4c, 0x01, 0x48, 0x48, 0x83, 0x6d, 0x08, 0x48, 0x48, 0x4c, 0x48, 0x48, 0x68, 0x24,
+	0x48, 0xad, 0x82, 0x8d, 0x06, 0xb1, 0xb1, 0x8d, 0x44, 0x00, 0x00, 0x68, 0x86, 0x89, 0x01, 0xa9,
+	0xa9, 0x84, 0x89, 0x03, 0x24, 0x00, 0x64, 0x8d, 0x84, 0xad, 0x09, 0x69, 0x48, 0x6d, 0x48, 0x6d,
+	0x6d, 0x48, 0x6d, 0x48, 0x6d, 0x86, 0x48, 0x02, 0x68, 0x48, 0x48, 0x84, 0x6d, 0x01, 0x4c, 0x6d,
+	0x83, 0x48, 0x02, 0x68, 0x6d, 0x6d, 0x04, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x82, 0x6d, 0x05, 0x6c,
+	0x48, 0x48, 0x6d, 0x48, 0x48, 0x83, 0x4c, 0x01, 0x48, 0x48, 0x83, 0x6d, 0x13, 0x48, 0x48, 0x6d,
+	0x48, 0x48, 0x68, 0x28, 0x44, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0xd1, 0xad, 0xad, 0x44, 0x00, 0x20,
+	0x69, 0x82, 0x8d, 0x1b, 0xad, 0xb1, 0xb1, 0x8d, 0xb2, 0xb2, 0x8d, 0x8d, 0x6d, 0x44, 0x00, 0x64,
+	0xb1, 0xad, 0xb1, 0xad, 0xad, 0x8d, 0x8d, 0x48, 0x48, 0x6c, 0x48, 0x6d, 0x6d, 0x68, 0x6d, 0x48,
+	0x82, 0x6d, 0x84, 0x48, 0x02, 0x6c, 0x48, 0x48, 0x84, 0x6d, 0x01, 0x48, 0x4d, 0x83, 0x48, 0x02,
+	0x68, 0x6d, 0x6d, 0x04, 0x48, 0x48, 0x6d, 0x48, 0x48, 0x82, 0x6d, 0x82, 0x48, 0x03, 0x6d, 0x48,
+	0x48, 0x6d, 0x82, 0x4c, 0x0d, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x6c, 0x48, 0x68,
+	0x48, 0x24, 0x44, 0x84, 0x8d, 0x00, 0xd1, 0x82, 0xb1, 0x12, 0x44, 0x00, 0x20, 0x44, 0x45, 0x69,
+	0x69, 0xb2, 0x91, 0x8d, 0xb2, 0x8d, 0x69, 0x69, 0x44, 0x00, 0x64, 0xb1, 0xb1, 0x83, 0xad, 0x0a,
+	0x8d, 0x6d, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x68, 0x6d, 0x6c, 0x82, 0x6d, 0x85, 0x48, 0x01,
+	0x4c, 0x48, 0x83, 0x6d, 0x00, 0x6c, 0x82, 0x48, 0x05, 0x68, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x02,
+	0x48, 0x48, 0x6d, 0x82, 0x48, 0x08, 0x6d, 0x6d, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x82,
+	0x4c, 0x13, 0x48, 0x48, 0x4c, 0x6d, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x48, 0x44, 0x00, 0x00, 0x44,
+	0x89, 0x8d, 0xad, 0x8d, 0x8d, 0xad, 0x82, 0xb1, 0x03, 0xad, 0x64, 0x44, 0x69, 0x83, 0x89, 0x02,
+	0x65, 0x69, 0x89, 0x82, 0x8d, 0x04, 0x69, 0x84, 0xcd, 0xb1, 0xb1, 0x83, 0xad, 0x0d, 0x8d, 0x68,
+	0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x4c, 0x6c, 0x6d, 0x6d, 0x6c, 0x6c, 0x84, 0x48, 0x03, 0x6c,
+	0x4c, 0x48, 0x4c, 0x82, 0x6d, 0x00, 0x6c, 0x82, 0x48, 0x05, 0x68, 0x48, 0x48, 0x68, 0x6d, 0x6d,
+	0x08, 0x48, 0x48, 0x6d, 0x6c, 0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x82, 0x6d, 0x08, 0x48, 0x48, 0x6d,
+	0x4c, 0x4d, 0x4c, 0x48, 0x4d, 0x48, 0x82, 0x6d, 0x02, 0x48, 0x4d, 0x48, 0x83, 0x00, 0x03, 0x48,
+	0x89, 0x69, 0x8d, 0x82, 0xad, 0x00, 0xd1, 0x82, 0xb1, 0x10, 0xad, 0x89, 0x89, 0x8d, 0x8d, 0xae,
+	0xae, 0x89, 0x89, 0x8d, 0x8e, 0x8d, 0x8d, 0x89, 0xad, 0xb1, 0xb1, 0x83, 0xad, 0x09, 0x8d, 0x8d,
+	0x48, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x4c, 0x84, 0x6d, 0x84, 0x48, 0x03, 0x6d, 0x4c, 0x48,
+	0x48, 0x83, 0x6d, 0x00, 0x4d, 0x84, 0x48, 0x02, 0x68, 0x6d, 0x6d, 0x08, 0x48, 0x48, 0x6d, 0x6d,
+	0x48, 0x48, 0x6d, 0x6d, 0x4c, 0x82, 0x6d, 0x0d, 0x48, 0x48, 0x6d, 0x4c, 0x4d, 0x4c, 0x48, 0x6d,
+	0x4c, 0x4c, 0x6c, 0x6d, 0x4c, 0x24, 0x84, 0x00, 0x06, 0x68, 0x89, 0x68, 0x89, 0xad, 0xad, 0x8d,
+	0x83, 0xb1, 0x10, 0xad, 0x89, 0x89, 0xad, 0x8d, 0x8e, 0xae, 0x89, 0x89, 0x8e, 0xae, 0xae, 0x89,
+	0x89, 0xad, 0xb1, 0xb1, 0x82, 0xad, 0x02, 0x8d, 0x89, 0x69, 0x82, 0x48, 0x01, 0x68, 0x48, 0x87,
+	0x6d, 0x84, 0x48, 0x03, 0x6d, 0x4c, 0x48, 0x48, 0x82, 0x6d, 0x03, 0x6c, 0x4d, 0x48, 0x68, 0x82,
+	0x48, 0x02, 0x68, 0x6d, 0x6d, 0x01, 0x48, 0x48, 0x85, 0x6d, 0x00, 0x4c, 0x82, 0x6d, 0x0c, 0x48,
+	0x48, 0x6d, 0x4c, 0x4d, 0x4c, 0x48, 0x6c, 0x4c, 0x6d, 0x6d, 0x48, 0x24, 0x85, 0x00, 0x03, 0x68,
+	0x8d, 0x68, 0x69, 0x82, 0x8d, 0x01, 0xad, 0xb1, 0x82, 0xad, 0x10, 0x8d, 0x89, 0xad, 0x8d, 0x89,
+	0x8e, 0x89, 0x89, 0x8d, 0x8d, 0xae, 0x89, 0x8d, 0xb1, 0xb1, 0xad, 0xad, 0x82, 0x8d, 0x00, 0x69,
+	0x83, 0x48, 0x01, 0x68, 0x48, 0x87, 0x6d, 0x84, 0x48, 0x03, 0x6d, 0x4c, 0x48, 0x48, 0x82, 0x6d,
+	0x03, 0x68, 0x4d, 0x48, 0x68, 0x83, 0x48, 0x01, 0x6d, 0x6d, 0x02, 0x48, 0x48, 0x68, 0x84, 0x6d,
+	0x00, 0x4c, 0x82, 0x6d, 0x01, 0x48, 0x48, 0x83, 0x6d, 0x04, 0x68, 0x68, 0x6d, 0x48, 0x24, 0x82,
+	0x00, 0x01, 0x20, 0x20, 0x82, 0x00, 0x01, 0x68, 0x8d, 0x82, 0x68, 0x82, 0x8d, 0x07, 0xad, 0xb1,
+	0xad, 0xad, 0x8d, 0x89, 0x89, 0x8d, 0x84, 0x89, 0x13, 0xad, 0xad, 0x89, 0xad, 0xb1, 0xad, 0x8d,
+	0xad, 0x8d, 0x8d, 0x89, 0x24, 0x24, 0x48, 0x68, 0x48, 0x68, 0x48, 0x6d, 0x4d, 0x85, 0x6d, 0x84,
+	0x48, 0x03, 0x6d, 0x6d, 0x48, 0x48, 0x82, 0x6d, 0x03, 0x4c, 0x4c, 0x48, 0x68, 0x82, 0x48, 0x02,
+	0x68, 0x6d, 0x6d, 0x02, 0x4d, 0x48, 0x48, 0x84, 0x6d, 0x00, 0x4c, 0x82, 0x6d, 0x85, 0x48, 0x01,
+	0x24, 0x24, 0x84, 0x00, 0x82, 0x20, 0x82, 0x00, 0x05, 0x68, 0xad, 0x89, 0x68, 0x64, 0x68, 0x82,
+	0x8d, 0x03, 0xad, 0xb1, 0xad, 0xad, 0x87, 0x89, 0x04, 0xad, 0x89, 0x89, 0xb1, 0xb1, 0x83, 0x8d,
+	0x01, 0x89, 0x44, 0x82, 0x00, 0x02, 0x48, 0x6d, 0x68, 0x82, 0x48, 0x82, 0x6d, 0x02, 0x48, 0x48,
+	0x6d, 0x83, 0x48, 0x04, 0x6c, 0x6d, 0x6d, 0x48, 0x48, 0x82, 0x6d, 0x03, 0x4c, 0x48, 0x48, 0x68,
+	0x82, 0x48, 0x02, 0x68, 0x6d, 0x6d, 0x02, 0x6d, 0x48, 0x48, 0x85, 0x6d, 0x04, 0x48, 0x24, 0x24,
+	0x20, 0x20, 0x8a, 0x00, 0x83, 0x20, 0x08, 0x00, 0x00, 0x68, 0xad, 0x89, 0x89, 0x68, 0x64, 0x68,
+	0x82, 0x8d, 0x03, 0xad, 0xb1, 0xad, 0xad, 0x88, 0x89, 0x02, 0xad, 0xd1, 0xb1, 0x82, 0x8d, 0x02,
+	0x89, 0x68, 0x20, 0x83, 0x00, 0x00, 0x24, 0x82, 0x48, 0x82, 0x6d, 0x03, 0x4c, 0x48, 0x6d, 0x68,
+	0x83, 0x48, 0x82, 0x6d, 0x08, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x4c, 0x48, 0x48, 0x68, 0x82, 0x48,
+	0x02, 0x68, 0x6d, 0x6d, 0x03, 0x6d, 0x48, 0x48, 0x6c, 0x84, 0x6d, 0x00, 0x24, 0x87, 0x00, 0x83,
+	0x20, 0x03, 0x00, 0x00, 0x20, 0x00, 0x82, 0x20, 0x12, 0x00, 0x00, 0x68, 0xad, 0x8d, 0x89, 0x69,
+	0x44, 0x64, 0x68, 0x89, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0xad, 0x65, 0x85, 0x82, 0x89, 0x01, 0x85,
+	0x65, 0x83, 0xad, 0x04, 0x8d, 0x8d, 0x89, 0x68, 0x68, 0x86, 0x00, 0x00, 0x48, 0x82, 0x6d, 0x03,
+	0x6c, 0x48, 0x6d, 0x6d, 0x84, 0x48, 0x03, 0x6d, 0x4c, 0x6d, 0x48, 0x82, 0x6d, 0x0a, 0x48, 0x6d,
+	0x48, 0x48, 0x68, 0x68, 0x48, 0x48, 0x68, 0x6d, 0x6d, 0x03, 0x6d, 0x4c, 0x48, 0x48, 0x84, 0x6d,
+	0x00, 0x48, 0x87, 0x00, 0x87, 0x20, 0x06, 0x00, 0x00, 0x20, 0x20, 0x00, 0x44, 0xad, 0x82, 0x8d,
+	0x04, 0x68, 0x44, 0x44, 0x68, 0x89, 0x84, 0x8d, 0x06, 0x89, 0x44, 0x44, 0x40, 0x40, 0x44, 0x89,
+	0x83, 0x8d, 0x04, 0x89, 0x69, 0x44, 0x68, 0x68, 0x87, 0x00, 0x82, 0x6d, 0x00, 0x48, 0x82, 0x6d,
+	0x83, 0x48, 0x82, 0x6d, 0x01, 0x4c, 0x48, 0x82, 0x6d, 0x04, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x82,
+	0x48, 0x02, 0x6c, 0x6d, 0x6d, 0x09, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x6d, 0x68, 0x6d, 0x4c, 0x48,
+	0x87, 0x00, 0x88, 0x20, 0x83, 0x00, 0x09, 0x20, 0x89, 0xad, 0x8d, 0x8d, 0x89, 0x68, 0x44, 0x44,
+	0x68, 0x85, 0x69, 0x00, 0x68, 0x82, 0x44, 0x0a, 0x68, 0x89, 0x89, 0x69, 0x69, 0x68, 0x68, 0x44,
+	0x68, 0x89, 0x44, 0x87, 0x00, 0x02, 0x24, 0x6d, 0x48, 0x82, 0x6d, 0x00, 0x68, 0x83, 0x48, 0x0c,
+	0x6d, 0x4c, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x6c, 0x6d, 0x4c, 0x48, 0x68, 0x68, 0x82, 0x48, 0x82,
+	0x6d, 0x01, 0x6d, 0x6d, 0x82, 0x48, 0x05, 0x68, 0x48, 0x6d, 0x4d, 0x4c, 0x24, 0x87, 0x00, 0x89,
+	0x20, 0x82, 0x00, 0x06, 0x44, 0xad, 0xad, 0x8d, 0x89, 0x88, 0x68, 0x85, 0x44, 0x00, 0x48, 0x83,
+	0x44, 0x02, 0x64, 0x68, 0x68, 0x84, 0x44, 0x03, 0x68, 0x68, 0x89, 0x24, 0x88, 0x00, 0x00, 0x48,
+	0x83, 0x6d, 0x83, 0x48, 0x83, 0x6d, 0x00, 0x48, 0x82, 0x6d, 0x05, 0x48, 0x6d, 0x48, 0x48, 0x68,
+	0x68, 0x82, 0x48, 0x82, 0x6d, 0x02, 0x6d, 0x6d, 0x4c, 0x83, 0x48, 0x82, 0x6d, 0x00, 0x24, 0x86,
+	0x00, 0x8c, 0x20, 0x06, 0x00, 0x00, 0x68, 0xad, 0x8d, 0x89, 0x89, 0x82, 0x68, 0x00, 0x44, 0x8d,
+	0x24, 0x04, 0x44, 0x68, 0x68, 0x89, 0x69, 0x89, 0x00, 0x00, 0x24, 0x82, 0x6d, 0x00, 0x68, 0x83,
+	0x48, 0x82, 0x6d, 0x01, 0x48, 0x48, 0x82, 0x6d, 0x04, 0x4c, 0x6d, 0x48, 0x48, 0x68, 0x82, 0x48,
+	0x03, 0x68, 0x6d, 0x6d, 0x6c, 0x82, 0x6d, 0x03, 0x48, 0x48, 0x4c, 0x48, 0x82, 0x6d, 0x00, 0x24,
+	0x85, 0x00, 0x90, 0x20, 0x03, 0x8d, 0xad, 0x8d, 0x89, 0x82, 0x68, 0x01, 0x64, 0x44, 0x89, 0x20,
+	0x82, 0x24, 0x04, 0x44, 0x68, 0x89, 0x8d, 0x68, 0x89, 0x00, 0x00, 0x20, 0x82, 0x6d, 0x83, 0x48,
+	0x83, 0x6d, 0x05, 0x48, 0x4c, 0x6d, 0x6d, 0x48, 0x6d, 0x82, 0x48, 0x00, 0x68, 0x82, 0x48, 0x03,
+	0x68, 0x6d, 0x6d, 0x48, 0x82, 0x6d, 0x82, 0x48, 0x83, 0x6d, 0x00, 0x48, 0x84, 0x00, 0x86, 0x20,
+	0x01, 0x24, 0x24, 0x89, 0x20, 0x03, 0x44, 0x68, 0x89, 0x89, 0x82, 0x68, 0x02, 0x44, 0x44, 0x24,
+	0x87, 0x20, 0x07, 0x24, 0x44, 0x44, 0x68, 0x69, 0x89, 0x8d, 0x44, 0x8a, 0x00, 0x01, 0x4c, 0x6d,
+	0x83, 0x48, 0x83, 0x6d, 0x01, 0x48, 0x48, 0x82, 0x6d, 0x05, 0x48, 0x6d, 0x48, 0x48, 0x68, 0x68,
+	0x82, 0x48, 0x82, 0x6d, 0x00, 0x48, 0x83, 0x6d, 0x01, 0x48, 0x48, 0x83, 0x6d, 0x00, 0x48, 0x83,
+	0x00, 0x87, 0x20, 0x01, 0x24, 0x24, 0x89, 0x20, 0x03, 0x00, 0x00, 0x24, 0x44, 0x83, 0x68, 0x03,
+	0x64, 0x44, 0x44, 0x24, 0x83, 0x20, 0x02, 0x24, 0x24, 0x44, 0x82, 0x68, 0x03, 0x89, 0x89, 0x8d,
+	0x24, 0x8a, 0x00, 0x01, 0x4c, 0x68, 0x83, 0x48, 0x83, 0x6d, 0x05, 0x48, 0x4c, 0x6d, 0x6d, 0x48,
+	0x6d, 0x82, 0x48, 0x08, 0x68, 0x48, 0x68, 0x68, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x83, 0x6d, 0x02,
+	0x4c, 0x48, 0x48, 0x82, 0x6d, 0x00, 0x4c, 0x83, 0x00, 0x87, 0x20, 0x01, 0x24, 0x24, 0x8a, 0x20,
+	0x82, 0x00, 0x05, 0x20, 0x24, 0x64, 0x68, 0x68, 0x64, 0x86, 0x44, 0x0a, 0x48, 0x68, 0x69, 0x89,
+	0x89, 0x69, 0x89, 0x8d, 0x20, 0x00, 0x20, 0x87, 0x00, 0x01, 0x20, 0x68, 0x83, 0x48, 0x05, 0x6d,
+	0x6c, 0x6d, 0x6d, 0x4c, 0x48, 0x82, 0x6d, 0x05, 0x4c, 0x6d, 0x48, 0x48, 0x6c, 0x68, 0x82, 0x48,
+	0x04, 0x68, 0x6d, 0x6d, 0x48, 0x48, 0x84, 0x6d, 0x82, 0x48, 0x82, 0x6d, 0x02, 0x24, 0x00, 0x00,
+	0x84, 0x20, 0x8e, 0x00, 0x83, 0x20, 0x83, 0x00, 0x01, 0x24, 0x44, 0x84, 0x68, 0x05, 0x64, 0x68,
+	0x68, 0x69, 0x89, 0x89, 0x83, 0x8d, 0x03, 0x89, 0x00, 0x00, 0x20, 0x87, 0x00, 0x00, 0x24, 0x83,
+	0x48, 0x01, 0x6d, 0x6c, 0x82, 0x6d, 0x05, 0x48, 0x68, 0x6d, 0x6d, 0x48, 0x6d, 0x82, 0x48, 0x06,
+	0x6d, 0x48, 0x48, 0x68, 0x48, 0x68, 0x6d, 0x82, 0x48, 0x85, 0x6d, 0x82, 0x48, 0x03, 0x6d, 0x6d,
+	0x24, 0x00, 0x82, 0x20, 0x9b, 0x00, 0x03, 0x20, 0x68, 0x89, 0x69, 0x82, 0x68, 0x02, 0x89, 0x89,
+	0x69, 0x82, 0x89, 0x05, 0x8d, 0xad, 0x48, 0x00, 0x20, 0x20, 0x87, 0x00, 0x83, 0x48, 0x01, 0x6d,
+	0x4c, 0x82, 0x6d, 0x10, 0x6c, 0x48, 0x6d, 0x6d, 0x48, 0x6c, 0x6d, 0x48, 0x48, 0x6d, 0x6c, 0x48,
+	0x48, 0x68, 0x68, 0x6c, 0x6c, 0x82, 0x48, 0x85, 0x6d, 0x06, 0x4c, 0x48, 0x48, 0x4c, 0x6d, 0x24,
+	0x20, 0x8c, 0x00, 0x8b, 0x20, 0x87, 0x00, 0x01, 0x24, 0x68, 0x82, 0x8d, 0x84, 0x89, 0x82, 0x8d,
+	0x02, 0x24, 0x00, 0x20, 0x87, 0x00, 0x00, 0x24, 0x82, 0x48, 0x01, 0x6d, 0x4c, 0x83, 0x6d, 0x05,
+	0x48, 0x68, 0x6d, 0x6d, 0x48, 0x6d, 0x82, 0x48, 0x00, 0x6d, 0x82, 0x48, 0x01, 0x68, 0x68, 0x84,
+	0x48, 0x86, 0x6d, 0x82, 0x48, 0x00, 0x24, 0x84, 0x00, 0x87, 0x20, 0x86, 0x00, 0x8a, 0x20, 0x84,
+	0x00, 0x01, 0x20, 0x44, 0x82, 0x8d, 0x82, 0x89, 0x06, 0x8d, 0x8d, 0xad, 0x89, 0x20, 0x00, 0x20,
+	0x86, 0x00, 0x05, 0x24, 0x48, 0x48, 0x6c, 0x6d, 0x6c, 0x83, 0x6d, 0x0e, 0x48, 0x48, 0x6d, 0x6d,
+	0x48, 0x6d, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x48, 0x68, 0x68, 0x85, 0x48, 0x87, 0x6d, 0x05,
+	0x48, 0x48, 0x20, 0x00, 0x20, 0x20, 0x9a, 0x00, 0x82, 0x20, 0x84, 0x00, 0x05, 0x24, 0x68, 0x89,
+	0x88, 0x89, 0x89, 0x82, 0x8d, 0x02, 0x68, 0x00, 0x20, 0x86, 0x00, 0x04, 0x24, 0x68, 0x48, 0x48,
+	0x4c, 0x83, 0x6d, 0x07, 0x4d, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x82, 0x48, 0x02, 0x6d,
+	0x68, 0x48, 0x82, 0x68, 0x85, 0x48, 0x88, 0x6d, 0x00, 0x24, 0x84, 0x00, 0x8d, 0x20, 0x8d, 0x00,
+	0x82, 0x20, 0x84, 0x00, 0x02, 0x44, 0x88, 0x89, 0x82, 0x8d, 0x00, 0x69, 0x86, 0x20, 0x82, 0x00,
+	0x01, 0x24, 0x48, 0x84, 0x6d, 0x08, 0x4d, 0x4c, 0x48, 0x48, 0x6d, 0x6d, 0x48, 0x6d, 0x6d, 0x82,
+	0x48, 0x02, 0x6d, 0x6d, 0x48, 0x83, 0x68, 0x85, 0x48, 0x00, 0x4c, 0x87, 0x6d, 0x00, 0x20, 0x82,
+	0x00, 0x91, 0x20, 0x8b, 0x00, 0x84, 0x20, 0x83, 0x00, 0x05, 0x44, 0x89, 0x89, 0x8d, 0x89, 0x44,
+	0x84, 0x20, 0x83, 0x00, 0x03, 0x20, 0x00, 0x00, 0x24, 0x83, 0x6d, 0x82, 0x48, 0x05, 0x6d, 0x6d,
+	0x48, 0x4c, 0x6d, 0x4c, 0x82, 0x48, 0x01, 0x6d, 0x48, 0x83, 0x68, 0x86, 0x48, 0x00, 0x48, 0x86,
+	0x6d, 0x00, 0x48, 0x82, 0x00, 0x02, 0x20, 0x20, 0x00, 0x90, 0x20, 0x86, 0x00, 0x83, 0x20, 0x01,
+	0x00, 0x00, 0x84, 0x20, 0x82, 0x00, 0x03, 0x44, 0x89, 0x89, 0x44, 0x84, 0x20, 0x88, 0x00, 0x01,
+	0x20, 0x44, 0x83, 0x48, 0x05, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x6d, 0x82, 0x48, 0x02, 0x6d, 0x6c,
+	0x48, 0x83, 0x68, 0x85, 0x48, 0x00, 0x6c, 0x00, 0x48, 0x86, 0x6d, 0x01, 0x4c, 0x00, 0x96, 0x20,
+	0x8f, 0x00, 0x82, 0x20, 0x07, 0x00, 0x00, 0x68, 0x44, 0x20, 0x24, 0x20, 0x20, 0x8c, 0x00, 0x08,
+	0x20, 0x24, 0x24, 0x6d, 0x6d, 0x4c, 0x48, 0x6d, 0x6d, 0x82, 0x48, 0x02, 0x6c, 0x6d, 0x48, 0x83,
+	0x68, 0x85, 0x48, 0x01, 0x68, 0x6d, 0x00, 0x48, 0x86, 0x6d, 0x01, 0x4d, 0x24, 0x96, 0x20, 0x92,
+	0x00, 0x01, 0x20, 0x00, 0x83, 0x20, 0x83, 0x00, 0x00, 0x20, 0x8a, 0x00, 0x06, 0x20, 0x00, 0x24,
+	0x48, 0x48, 0x6d, 0x6d, 0x83, 0x48, 0x01, 0x6d, 0x48, 0x84, 0x68, 0x85, 0x48, 0x01, 0x6d, 0x48,
+	0x01, 0x6d, 0x68, 0x85, 0x6d, 0x02, 0x24, 0x20, 0x24, 0x96, 0x20, 0x92, 0x00, 0x83, 0x20, 0x03,
+	0x00, 0x00, 0x20, 0x20, 0x8d, 0x00, 0x03, 0x20, 0x20, 0x00, 0x24, 0x84, 0x48, 0x02, 0x6d, 0x6c,
+	0x48, 0x83, 0x68, 0x85, 0x48, 0x02, 0x6d, 0x48, 0x48, 0x01, 0x6d, 0x48, 0x84, 0x6d, 0x04, 0x24,
+	0x20, 0x24, 0x20, 0x00, 0x96, 0x20, 0x01, 0x00, 0x20, 0x89, 0x00, 0x88, 0x20, 0x93, 0x00, 0x00,
+	0x20, 0x83, 0x00, 0x04, 0x20, 0x24, 0x48, 0x6d, 0x48, 0x84, 0x68, 0x84, 0x48, 0x03, 0x68, 0x68,
+	0x48, 0x48, 0x02, 0x6d, 0x6d, 0x48, 0x82, 0x6d, 0x02, 0x24, 0x20, 0x24, 0x93, 0x20, 0x01, 0x00,
+	0x00, 0x98, 0x20, 0x84, 0x00, 0x01, 0x20, 0x20, 0x8c, 0x00, 0x00, 0x20, 0x85, 0x00, 0x02, 0x24,
+	0x6d, 0x48, 0x83, 0x68, 0x84, 0x48, 0x01, 0x6d, 0x6c, 0x82, 0x48, 0x07, 0x68, 0x6d, 0x48, 0x6c,
+	0x6d, 0x48, 0x20, 0x24, 0x83, 0x20, 0x05, 0x24, 0x24, 0x20, 0x24, 0x20, 0x24, 0x89, 0x20, 0x83,
+	0x00, 0x9d, 0x20, 0x85, 0x00, 0x00, 0x20, 0x86, 0x00, 0x00, 0x20, 0x86, 0x00, 0x00, 0x48, 0x84,
+	0x68, 0x82, 0x48, 0x02, 0x68, 0x6d, 0x6d, 0x83, 0x48, 0x04, 0x68, 0x6d, 0x6d, 0x6c, 0x48, 0x86,
+	0x20, 0x86, 0x24, 0x88, 0x20, 0x83, 0x00, 0x93, 0x20, 0x00, 0x24, 0x88, 0x20, 0x86, 0x00, 0x00,
+	0x20, 0x85, 0x00, 0x00, 0x20, 0x87, 0x00, 0x00, 0x48, 0x83, 0x68, 0x01, 0x48, 0x48, 0x82, 0x6d,
+	0x84, 0x48, 0x03, 0x68, 0x68, 0x6d, 0x48, 0x85, 0x20, 0x85, 0x24, 0x82, 0x20, 0x00, 0x24, 0x87,
+	0x20, 0x00, 0x00, 0x8c, 0x20, 0x01, 0x00, 0x00, 0x84, 0x20, 0x83, 0x24, 0x87, 0x20, 0x86, 0x00,
+	0x01, 0x20, 0x20, 0x85, 0x00, 0x00, 0x20, 0x88, 0x00, 0x00, 0x44, 0x83, 0x68, 0x82, 0x6d, 0x85,
+	0x48, 0x03, 0x68, 0x68, 0x6d, 0x24, 0x84, 0x20, 0x86, 0x24, 0x84, 0x20, 0x00, 0x24, 0x95, 0x20,
+	0x00, 0x00, 0x83, 0x20, 0x83, 0x24, 0x85, 0x20, 0x88, 0x00, 0x82, 0x20, 0x84, 0x00, 0x01, 0x20,
+	0x20, 0x88, 0x00, 0x05, 0x48, 0x6c, 0x68, 0x68, 0x6d, 0x6d, 0x85, 0x48, 0x00, 0x6c, 0x02, 0x68,
+	0x6d, 0x48, 0x86, 0x20, 0x86, 0x24, 0x05, 0x20, 0x20, 0x00, 0x20, 0x20, 0x24, 0x9b, 0x20, 0x82,
+	0x24, 0x83, 0x20, 0x89, 0x00, 0x83, 0x20, 0x83, 0x00, 0x01, 0x20, 0x20, 0x86, 0x00, 0x06, 0x20,
+	0x00, 0x00, 0x44, 0x68, 0x6d, 0x6d, 0x85, 0x48, 0x01, 0x6d, 0x6c, 0x01, 0x6d, 0x48, 0x87, 0x20,
+	0x87, 0x24, 0x03, 0x20, 0x20, 0x00, 0x00, 0x9d, 0x20, 0x01, 0x24, 0x24, 0x83, 0x20, 0x88, 0x00,
+	0x84, 0x20, 0x83, 0x00, 0x01, 0x20, 0x20, 0x8a, 0x00, 0x01, 0x24, 0x68, 0x85, 0x48, 0x82, 0x6d,
+	0x01, 0x6d, 0x44, 0x86, 0x20, 0x8a, 0x24, 0x04, 0x20, 0x00, 0x00, 0x20, 0x24, 0x9a, 0x20, 0x01,
+	0x24, 0x24, 0x83, 0x20, 0x88, 0x00, 0x85, 0x20, 0x82, 0x00, 0x01, 0x20, 0x20, 0x89, 0x00, 0x03,
+	0x20, 0x00, 0x24, 0x44, 0x83, 0x48, 0x00, 0x4c, 0x82, 0x6d, 0x00, 0x48, 0x87, 0x20, 0x8b, 0x24,
+	0x04, 0x20, 0x00, 0x00, 0x20, 0x24, 0x8b, 0x20, 0x00, 0x24, 0x8c, 0x20, 0x82, 0x24, 0x82, 0x20,
+	0x87, 0x00, 0x86, 0x20, 0x82, 0x00, 0x82, 0x20, 0x8b, 0x00, 0x01, 0x20, 0x24, 0x82, 0x48, 0x83,
+	0x6d, 0x00, 0x24, 0x86, 0x20, 0x8c, 0x24, 0x03, 0x20, 0x20, 0x00, 0x00, 0x9a, 0x20, 0x82, 0x24,
+	0x82, 0x20, 0x87, 0x00, 0x86, 0x20, 0x82, 0x00, 0x82, 0x20, 0x82, 0x00, 0x82, 0x20, 0x85, 0x00,
+	0x03, 0x20, 0x00, 0x24, 0x48, 0x83, 0x6d, 0x00, 0x6c, 0x86, 0x20, 0x8e, 0x24, 0x03, 0x20, 0x20,
+	0x00, 0x00, 0x8a, 0x20, 0x01, 0x24, 0x24, 0x8d, 0x20, 0x01, 0x24, 0x24, 0x82, 0x20, 0x86, 0x00,
+	0x87, 0x20, 0x82, 0x00, 0x82, 0x20, 0x82, 0x00, 0x82, 0x20, 0x83, 0x00, 0x0a, 0x20, 0x00, 0x20,
+	0x00, 0x00, 0x48, 0x6d, 0x6d, 0x68, 0x6d, 0x6d, 0x86, 0x20, 0x8f, 0x24, 0x00, 0x20, 0x82, 0x00,
+	0x89, 0x20, 0x83, 0x24, 0x8c, 0x20, 0x00, 0x24, 0x82, 0x20, 0x85, 0x00, 0x89, 0x20, 0x01, 0x00,
+	0x00, 0x83, 0x20, 0x01, 0x00, 0x00, 0x82, 0x20, 0x84, 0x00, 0x00, 0x20, 0x82, 0x00, 0x05, 0x48,
+	0x6d, 0x68, 0x6c, 0x6d, 0x6d, 0x86, 0x20, 0x90, 0x24, 0x02, 0x20, 0x00, 0x00, 0x8b, 0x20, 0x01,
+	0x24, 0x24, 0x8c, 0x20, 0x03, 0x24, 0x24, 0x20, 0x20, 0x85, 0x00, 0x89, 0x20, 0x01, 0x00, 0x00,
+	0x83, 0x20, 0x01, 0x00, 0x00, 0x83, 0x20, 0x83, 0x00, 0x00, 0x20, 0x82, 0x00, 0x02, 0x44, 0x6d,
+	0x48, 0x82, 0x6d, 0x86, 0x20, 0x91, 0x24, 0x02, 0x20, 0x00, 0x00, 0x8a, 0x20, 0x82, 0x24, 0x8f,
+	0x20, 0x84, 0x00, 0x8a, 0x20, 0x00, 0x00, 0x84, 0x20, 0x01, 0x00, 0x00, 0x83, 0x20, 0x02, 0x00,
+	0x20, 0x20, 0x83, 0x00, 0x06, 0x20, 0x48, 0x6c, 0x6d, 0x6d, 0x48, 0x68, 0x87, 0x20, 0x91, 0x24,
+	0x02, 0x20, 0x00, 0x00, 0x85, 0x20, 0x03, 0x24, 0x24, 0x20, 0x20, 0x82, 0x24, 0x8f, 0x20, 0x84,
+	0x00, 0x8a, 0x20, 0x00, 0x00, 0x84, 0x20, 0x01, 0x00, 0x00, 0x83, 0x20, 0x02, 0x00, 0x20, 0x20,
+	0x83, 0x00, 0x06, 0x20, 0x48, 0x6d, 0x48, 0x48, 0x6d, 0x6d, 0x87, 0x20, 0x83, 0x24, 0x82, 0x20,
+	0x8a, 0x24, 0x02, 0x20, 0x00, 0x00, 0x86, 0x20, 0x02, 0x24, 0x20, 0x20, 0x83, 0x24, 0x8e, 0x20,
+	0x82, 0x00, 0x8c, 0x20, 0x00, 0x00, 0x84, 0x20, 0x01, 0x00, 0x00, 0x83, 0x20, 0x01, 0x00, 0x20,
+	0x83, 0x00, 0x07, 0x20, 0x20, 0x00, 0x48, 0x6d, 0x6d, 0x68, 0x68, 0x95, 0x20, 0x82, 0x24, 0x82,
+	0x20, 0x01, 0x00, 0x00, 0x89, 0x20, 0x82, 0x24, 0x8e, 0x20, 0x83, 0x00, 0x8b, 0x20, 0x00, 0x00,
+	0x83, 0x20, 0x82, 0x00, 0x83, 0x20, 0x84, 0x00, 0x82, 0x20, 0x02, 0x24, 0x00, 0x48, 0x82, 0x68,
+	0x86, 0x20, 0x8b, 0x24, 0x86, 0x20, 0x03, 0x24, 0x20, 0x20, 0x00, 0x8a, 0x20, 0x01, 0x24, 0x24,
+	0x8e, 0x20, 0x83, 0x00, 0x90, 0x20, 0x82, 0x00, 0x83, 0x20, 0x84, 0x00, 0x08, 0x20, 0x00, 0x24,
+	0x92, 0x24, 0x00, 0x48, 0x68, 0x68, 0x85, 0x20, 0x89, 0x24, 0x82, 0x20, 0x83, 0x24, 0x85, 0x20,
+	0x01, 0x00, 0x00, 0x8a, 0x20, 0x01, 0x24, 0x24, 0x8d, 0x20, 0x83, 0x00, 0x90, 0x20, 0x82, 0x00,
+	0x83, 0x20, 0x83, 0x00, 0x02, 0x20, 0x20, 0x44, 0x82, 0x92, 0x03, 0x44, 0x20, 0x68, 0x68, 0x96,
+	0x20, 0x01, 0x24, 0x24, 0x84, 0x20, 0x00, 0x00, 0x8a, 0x20, 0x01, 0x24, 0x24, 0x8e, 0x20, 0x83,
+	0x00, 0x8f, 0x20, 0x82, 0x00, 0x82, 0x20, 0x83, 0x00, 0x83, 0x20, 0x06, 0x49, 0x92, 0x49, 0x00,
+	0x00, 0x48, 0x6d, 0x9c, 0x20, 0x82, 0x00, 0x8a, 0x20, 0x00, 0x24, 0x88, 0x20, 0x00, 0x00, 0x84,
+	0x20, 0x83, 0x00, 0x8f, 0x20, 0x82, 0x00, 0x82, 0x20, 0x83, 0x00, 0x83, 0x20, 0x01, 0x00, 0x49,
+	0x82, 0x00, 0x01, 0x24, 0x6c, 0x94, 0x20, 0x01, 0x00, 0x00, 0x86, 0x20, 0x01, 0x00, 0x00, 0x8b,
+	0x20, 0x00, 0x24, 0x87, 0x20, 0x00, 0x00, 0x84, 0x20, 0x83, 0x00, 0x8f, 0x20, 0x82, 0x00, 0x82,
+	0x20, 0x82, 0x00, 0x05, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x82, 0x00, 0x02, 0x20, 0x20, 0x48,
+	0x00, 0x00, 0x94, 0x20, 0x01, 0x00, 0x00, 0x85, 0x20, 0x82, 0x00, 0x93, 0x20, 0x00, 0x00, 0x84,
+	0x20, 0x84, 0x00, 0x87, 0x20, 0x00, 0x00, 0x85, 0x20, 0x82, 0x00, 0x82, 0x20, 0x01, 0x00, 0x00,
+	0x82, 0x20, 0x85, 0x00, 0x82, 0x20, 0x00, 0x48, 0x00, 0x00, 0x95, 0x20, 0x82, 0x00, 0x84, 0x20,
+	0x01, 0x00, 0x00, 0x94, 0x20, 0x00, 0x00, 0x84, 0x20, 0x83, 0x00, 0x8e, 0x20, 0x82, 0x00, 0x01,
+	0x20, 0x20, 0x82, 0x00, 0x01, 0x20, 0x20, 0x85, 0x00, 0x83, 0x20, 0x00, 0x24
 };
-char bitmap_smiley_boos[1026]={
-	0x20, 0x20,
 
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,
-    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,
-    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-    0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,
-    0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x00,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0xDC,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+const uint8_t bitmap_tom[5941] = {
+	0x85, 0xdb, 0x89, 0xbb, 0x02, 0xb7, 0xbb, 0xdb, 0x85, 0xbb, 0x00, 0xdb, 0x84, 0xbb, 0x03, 0xdb,
+	0xb6, 0x49, 0x04, 0x8c, 0x24, 0x00, 0x00, 0x82, 0x24, 0x03, 0x6d, 0xb7, 0xbb, 0xdb, 0x90, 0xbb,
+	0x05, 0x96, 0x72, 0x92, 0xb6, 0xdb, 0xb7, 0x94, 0xbb, 0x82, 0xdb, 0x8c, 0xbb, 0x02, 0xb7, 0xbb,
+	0xbb, 0x85, 0xdb, 0x83, 0xbb, 0x05, 0xdb, 0xdb, 0x92, 0x24, 0x00, 0x00, 0x83, 0x24, 0x85, 0x00,
+	0x82, 0x24, 0x83, 0x00, 0x03, 0x24, 0x6d, 0xdb, 0xdb, 0x90, 0xbb, 0x04, 0xb7, 0x96, 0x72, 0xb6,
+	0xdb, 0x95, 0xbb, 0x82, 0xdb, 0x8c, 0xbb, 0x02, 0x96, 0xbb, 0xbb, 0x85, 0xdb, 0x83, 0xbb, 0x02,
+	0xdb, 0x92, 0x24, 0x8a, 0x00, 0x00, 0x24, 0x82, 0x00, 0x01, 0x24, 0x24, 0x83, 0x00, 0x02, 0x24,
+	0x72, 0x96, 0x90, 0xbb, 0x04, 0xb7, 0x96, 0x72, 0xb6, 0xdb, 0x95, 0xbb, 0x82, 0xdb, 0x89, 0xbb,
+	0x04, 0xdb, 0xbb, 0xbb, 0x96, 0xbb, 0x86, 0xdb, 0x82, 0xbb, 0x04, 0xdb, 0x92, 0x25, 0x24, 0x20,
+	0x8e, 0x00, 0x82, 0x24, 0x03, 0x00, 0x24, 0x04, 0x49, 0x91, 0xbb, 0x04, 0xb6, 0x96, 0xb7, 0xb7,
+	0xdf, 0x95, 0xbb, 0x8c, 0xbb, 0x03, 0xdb, 0xdb, 0xbb, 0xb7, 0x8b, 0xbb, 0x02, 0x6d, 0x24, 0x24,
+	0x90, 0x00, 0x06, 0x24, 0x24, 0x00, 0x20, 0x24, 0x24, 0x6d, 0x8f, 0xbb, 0x07, 0xb7, 0x96, 0x72,
+	0x6e, 0x6e, 0x92, 0xb6, 0xdb, 0x93, 0xbb, 0x8c, 0xbb, 0x03, 0xdb, 0xbb, 0xbb, 0x96, 0x87, 0xbb,
+	0x04, 0xdb, 0xbb, 0xdb, 0xb6, 0x49, 0x96, 0x00, 0x05, 0x20, 0x00, 0x00, 0x49, 0xb7, 0xdb, 0x8c,
+	0xbb, 0x06, 0x96, 0x72, 0x4d, 0x72, 0x4d, 0x49, 0x96, 0x94, 0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x89,
+	0xbb, 0x02, 0xdb, 0x96, 0x29, 0x9a, 0x00, 0x02, 0x49, 0xbb, 0xdb, 0x8c, 0xbb, 0x00, 0x96, 0x83,
+	0x92, 0x00, 0xdb, 0x94, 0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x89, 0xbb, 0x03, 0xdb, 0x92, 0x25, 0x20,
+	0x9a, 0x00, 0x02, 0x49, 0xb6, 0xdb, 0x8b, 0xbb, 0x05, 0x72, 0x6e, 0x72, 0x72, 0x6e, 0x92, 0x94,
+	0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x8a, 0xbb, 0x03, 0x92, 0x45, 0x24, 0x24, 0x82, 0x44, 0x06, 0x49,
+	0x69, 0x48, 0x44, 0x44, 0x20, 0x20, 0x90, 0x00, 0x02, 0x24, 0xb6, 0xdb, 0x8a, 0xbb, 0x01, 0x92,
+	0x4d, 0x82, 0x92, 0x00, 0xb7, 0x94, 0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x8a, 0xbb, 0x11, 0x96, 0x49,
+	0x49, 0x8d, 0xad, 0xad, 0xb1, 0xb2, 0xb1, 0xad, 0xad, 0x8d, 0x69, 0x69, 0x44, 0x24, 0x24, 0x20,
+	0x8d, 0x00, 0x02, 0x24, 0xb7, 0xdb, 0x89, 0xbb, 0x04, 0xb7, 0x6e, 0x72, 0x92, 0x96, 0x95, 0xbb,
+	0x8f, 0xbb, 0x00, 0x96, 0x8a, 0xbb, 0x02, 0xb6, 0x6d, 0xb2, 0x85, 0xd2, 0x82, 0xb1, 0x06, 0xad,
+	0x8d, 0x8d, 0x89, 0x69, 0x44, 0x20, 0x8d, 0x00, 0x01, 0x49, 0xdb, 0x89, 0xbb, 0x04, 0xb7, 0x72,
+	0x72, 0x92, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x86, 0xbb, 0x00, 0xdb, 0x82, 0xbb, 0x02,
+	0x92, 0xb2, 0xd6, 0x85, 0xd2, 0x01, 0xb2, 0xb2, 0x83, 0xb1, 0x03, 0xad, 0x8d, 0x69, 0x24, 0x8e,
+	0x00, 0x01, 0x96, 0xdb, 0x88, 0xbb, 0x01, 0x96, 0x6e, 0x82, 0x92, 0x95, 0xbb, 0x8f, 0xbb, 0x00,
+	0x96, 0x88, 0xbb, 0x04, 0xdb, 0xb6, 0x8d, 0xb2, 0xb2, 0x84, 0xd2, 0x87, 0xb1, 0x04, 0xad, 0x8d,
+	0x49, 0x24, 0x20, 0x8c, 0x00, 0x01, 0x6e, 0xdb, 0x88, 0xbb, 0x04, 0xb7, 0x72, 0x92, 0x72, 0x96,
+	0x95, 0xbb, 0x8f, 0xbb, 0x00, 0x96, 0x88, 0xbb, 0x03, 0xdb, 0xb6, 0xb2, 0xb2, 0x84, 0xd2, 0x88,
+	0xb1, 0x02, 0xad, 0x8d, 0x48, 0x82, 0x24, 0x8b, 0x00, 0x00, 0x4d, 0x89, 0xbb, 0x04, 0xb7, 0x72,
+	0x92, 0x92, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x88, 0xbb, 0x01, 0xb2, 0xb2, 0x84,
+	0xd2, 0x00, 0xb2, 0x86, 0xb1, 0x03, 0xad, 0xad, 0x8d, 0x69, 0x84, 0x24, 0x01, 0x20, 0x20, 0x88,
+	0x00, 0x00, 0x49, 0x89, 0xbb, 0x04, 0x96, 0x6e, 0x92, 0x92, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01,
+	0x96, 0xb7, 0x87, 0xbb, 0x01, 0xb7, 0xb2, 0x88, 0xd2, 0x83, 0xb1, 0x82, 0xad, 0x01, 0x8d, 0x69,
+	0x85, 0x24, 0x89, 0x00, 0x01, 0x25, 0xb7, 0x88, 0xbb, 0x04, 0xb7, 0x72, 0x72, 0x92, 0x96, 0x95,
+	0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x87, 0xbb, 0x07, 0xdb, 0xb2, 0xd2, 0xd2, 0xb2, 0xd2, 0xb1,
+	0xb2, 0x82, 0xd2, 0x02, 0xb2, 0xb1, 0xb1, 0x83, 0xad, 0x01, 0x8d, 0x68, 0x85, 0x24, 0x89, 0x00,
+	0x01, 0x24, 0x96, 0x87, 0xbb, 0x01, 0xb7, 0x96, 0x82, 0x72, 0x00, 0x92, 0x95, 0xbb, 0x8f, 0xbb,
+	0x01, 0x96, 0xb7, 0x87, 0xbb, 0x05, 0x6d, 0x49, 0x69, 0x8d, 0xad, 0xb1, 0x82, 0x8d, 0x82, 0x69,
+	0x02, 0x8d, 0x8d, 0xb1, 0x82, 0xad, 0x07, 0x8d, 0x8d, 0x44, 0x20, 0x24, 0x24, 0x20, 0x24, 0x89,
+	0x00, 0x01, 0x04, 0xb6, 0x87, 0xbb, 0x05, 0xb7, 0x92, 0x6e, 0x72, 0x6e, 0x6e, 0x95, 0xbb, 0x8f,
+	0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x0a, 0xdb, 0x6e, 0x20, 0x24, 0x20, 0x44, 0x89, 0xad, 0x69,
+	0x44, 0x44, 0x82, 0x20, 0x04, 0x44, 0x44, 0x69, 0xad, 0xad, 0x82, 0x8d, 0x01, 0x89, 0x24, 0x83,
+	0x20, 0x89, 0x00, 0x01, 0x24, 0xb7, 0x87, 0xbb, 0x01, 0xb7, 0xb7, 0x82, 0x72, 0x00, 0x92, 0x95,
+	0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x08, 0xdb, 0x6d, 0x69, 0x8d, 0x68, 0x44, 0x69,
+	0xad, 0x69, 0x82, 0x44, 0x05, 0x48, 0x69, 0x69, 0x44, 0x44, 0x64, 0x84, 0x8d, 0x02, 0x69, 0x24,
+	0x20, 0x8b, 0x00, 0x00, 0x6d, 0x88, 0xbb, 0x05, 0xb7, 0x96, 0x6e, 0x92, 0x72, 0x92, 0x95, 0xbb,
+	0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x08, 0xdb, 0xb2, 0x69, 0x44, 0x44, 0x40, 0x89, 0xb1,
+	0x69, 0x83, 0x44, 0x00, 0x68, 0x82, 0x69, 0x01, 0x64, 0x68, 0x84, 0x8d, 0x01, 0x44, 0x20, 0x8b,
+	0x00, 0x00, 0x92, 0x88, 0xbb, 0x06, 0xb7, 0x92, 0x6e, 0x92, 0x72, 0x96, 0xb7, 0x94, 0xbb, 0x8f,
+	0xbb, 0x01, 0x96, 0xb7, 0x86, 0xbb, 0x00, 0xb6, 0x82, 0x44, 0x04, 0x64, 0xb2, 0xad, 0x89, 0x64,
+	0x83, 0x44, 0x06, 0x20, 0x44, 0x68, 0x69, 0x89, 0x8d, 0x8d, 0x82, 0xad, 0x01, 0x69, 0x20, 0x8a,
+	0x00, 0x00, 0x25, 0x89, 0xbb, 0x05, 0xb7, 0x96, 0x6e, 0x72, 0x72, 0x96, 0x95, 0xbb, 0x8f, 0xbb,
+	0x01, 0x96, 0xb7, 0x86, 0xbb, 0x13, 0xb6, 0x69, 0x64, 0x64, 0xb1, 0xd2, 0xad, 0x89, 0x89, 0x64,
+	0x64, 0x68, 0x69, 0x64, 0x44, 0x64, 0x68, 0x68, 0x89, 0x8d, 0x82, 0xad, 0x01, 0x69, 0x24, 0x82,
+	0x00, 0x82, 0x20, 0x05, 0x44, 0x49, 0x20, 0x00, 0x00, 0x96, 0x89, 0xbb, 0x06, 0xb7, 0xb7, 0x6e,
+	0x72, 0x72, 0x96, 0xb7, 0x94, 0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x86, 0xbb, 0x04, 0xb2, 0xad,
+	0x89, 0xad, 0xd2, 0x82, 0xad, 0x08, 0x89, 0x8d, 0x89, 0x68, 0x64, 0x64, 0x68, 0x89, 0x89, 0x82,
+	0x8d, 0x0f, 0xad, 0xad, 0x8d, 0x69, 0x24, 0x20, 0x00, 0x20, 0x44, 0x68, 0x89, 0x8d, 0x89, 0x69,
+	0x20, 0x49, 0x8a, 0xbb, 0x05, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x92, 0x95, 0xbb, 0x8f, 0xbb, 0x01,
+	0x96, 0xb7, 0x86, 0xbb, 0x00, 0xd6, 0x83, 0xd2, 0x88, 0xad, 0x00, 0xb1, 0x85, 0xad, 0x0e, 0x8d,
+	0x8d, 0x68, 0x20, 0x20, 0x44, 0x69, 0x89, 0x89, 0x64, 0x88, 0x84, 0x64, 0x49, 0xb6, 0x8a, 0xbb,
+	0x06, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x92, 0xb7, 0x94, 0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85,
+	0xbb, 0x05, 0xb6, 0xb2, 0xad, 0xb1, 0xd2, 0xd2, 0x82, 0xad, 0x04, 0x89, 0x89, 0xad, 0xd1, 0xd1,
+	0x82, 0xd2, 0x00, 0xb1, 0x83, 0xad, 0x0d, 0x8d, 0x8d, 0x48, 0x24, 0x24, 0x69, 0x89, 0x68, 0x68,
+	0x89, 0xad, 0x89, 0x69, 0xb2, 0x8b, 0xbb, 0x05, 0x97, 0xb7, 0x72, 0x92, 0x6e, 0x92, 0x95, 0xbb,
+	0x8f, 0xbb, 0x01, 0xb6, 0xb7, 0x85, 0xbb, 0x0d, 0xb6, 0x8d, 0x89, 0xd1, 0xd1, 0xd2, 0xb1, 0xad,
+	0xd1, 0xad, 0x68, 0x68, 0xad, 0xb1, 0x82, 0xd2, 0x02, 0xb1, 0xad, 0xad, 0x83, 0x8d, 0x82, 0x44,
+	0x08, 0x8d, 0xad, 0x68, 0x40, 0x88, 0xad, 0x89, 0x8d, 0xb7, 0x8b, 0xbb, 0x06, 0x96, 0x96, 0x6e,
+	0x92, 0x72, 0x92, 0xb7, 0x94, 0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x07, 0xb2, 0x68,
+	0x68, 0xad, 0xad, 0x89, 0x89, 0x8d, 0x82, 0x89, 0x03, 0x69, 0x64, 0x89, 0x8d, 0x84, 0xad, 0x0e,
+	0x8d, 0x89, 0x8d, 0x69, 0x44, 0x44, 0x69, 0x8d, 0x89, 0x64, 0x68, 0x88, 0xad, 0x8d, 0xb2, 0x8c,
+	0xbb, 0x06, 0x96, 0x96, 0x6e, 0x92, 0x72, 0x96, 0xb7, 0x94, 0xbb, 0x8f, 0xbb, 0x01, 0xb6, 0xb7,
+	0x85, 0xbb, 0x00, 0x92, 0x82, 0x44, 0x0d, 0x64, 0x44, 0x40, 0x40, 0x44, 0x44, 0x89, 0x8d, 0x69,
+	0x64, 0x69, 0x89, 0x8d, 0xad, 0x82, 0x8d, 0x07, 0x89, 0x89, 0x68, 0x44, 0x44, 0x69, 0x89, 0x68,
+	0x82, 0x8d, 0x02, 0x89, 0x8d, 0xb7, 0x8c, 0xbb, 0x05, 0x96, 0x96, 0x6e, 0x72, 0x72, 0x96, 0x95,
+	0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x09, 0x92, 0x44, 0x20, 0x00, 0x20, 0x24, 0x20,
+	0x20, 0x24, 0x24, 0x84, 0x44, 0x01, 0x68, 0x89, 0x82, 0x8d, 0x0d, 0x89, 0x68, 0x68, 0x44, 0x44,
+	0x24, 0x68, 0x89, 0xad, 0xd1, 0xad, 0x8d, 0x69, 0xb6, 0x8d, 0xbb, 0x05, 0x97, 0xb7, 0x6e, 0x72,
+	0x72, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb6, 0xb7, 0x85, 0xbb, 0x03, 0x92, 0x24, 0x00, 0x00,
+	0x82, 0x20, 0x82, 0x00, 0x0a, 0x20, 0x20, 0x00, 0x20, 0x20, 0x44, 0x69, 0x69, 0x68, 0x69, 0x68,
+	0x82, 0x44, 0x08, 0x24, 0x24, 0x68, 0xad, 0xb1, 0xad, 0xb1, 0x69, 0x8e, 0x8e, 0xbb, 0x05, 0x96,
+	0xb7, 0x72, 0x92, 0x72, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb7, 0xb7, 0x84, 0xbb, 0x0c, 0xdb,
+	0x92, 0x20, 0x00, 0x00, 0x49, 0x69, 0x44, 0x44, 0x24, 0x44, 0x24, 0x20, 0x83, 0x00, 0x83, 0x44,
+	0x82, 0x24, 0x82, 0x20, 0x05, 0x44, 0x8d, 0xad, 0x8d, 0x44, 0x44, 0x8f, 0xbb, 0x05, 0x96, 0xb7,
+	0x72, 0x92, 0x6e, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb7, 0xb7, 0x85, 0xbb, 0x07, 0xb7, 0x24,
+	0x00, 0x20, 0x91, 0xb6, 0xb6, 0xb2, 0x82, 0x8d, 0x05, 0x69, 0x24, 0x20, 0x00, 0x00, 0x24, 0x85,
+	0x20, 0x02, 0x00, 0x20, 0x24, 0x82, 0x44, 0x03, 0x24, 0x00, 0x92, 0xdb, 0x8e, 0xbb, 0x05, 0xb7,
+	0xb7, 0x72, 0x92, 0x72, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb7, 0xb7, 0x86, 0xbb, 0x01, 0x49,
+	0x00, 0x83, 0x69, 0x01, 0x44, 0x24, 0x83, 0x44, 0x03, 0x69, 0x44, 0x00, 0x24, 0x84, 0x00, 0x08,
+	0x20, 0x24, 0x44, 0x68, 0x69, 0x8d, 0x69, 0x44, 0x6d, 0x90, 0xbb, 0x05, 0x97, 0x96, 0x72, 0x96,
+	0x92, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0x96, 0xb7, 0x85, 0xbb, 0x02, 0xdb, 0x6d, 0x24, 0x82,
+	0x8d, 0x00, 0x89, 0x84, 0x69, 0x04, 0x89, 0x89, 0x68, 0x24, 0x20, 0x82, 0x00, 0x03, 0x20, 0x44,
+	0x69, 0x6d, 0x84, 0x8d, 0x03, 0x6d, 0x6d, 0x91, 0xb6, 0x8e, 0xbb, 0x05, 0x96, 0x96, 0x72, 0x92,
+	0x72, 0xb7, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb7, 0xb7, 0x83, 0xbb, 0x07, 0xdb, 0xb6, 0x6d, 0x24,
+	0x20, 0x69, 0xb1, 0x8d, 0x82, 0xad, 0x82, 0x8d, 0x08, 0x89, 0x69, 0x69, 0x24, 0x20, 0x20, 0x24,
+	0x48, 0x6d, 0x86, 0x8d, 0x05, 0x6d, 0x69, 0x69, 0x6d, 0x91, 0xb6, 0x8d, 0xbb, 0x01, 0xb7, 0x96,
+	0x82, 0x72, 0x00, 0xb7, 0x95, 0xbb, 0x8f, 0xbb, 0x01, 0xb7, 0xb7, 0x82, 0xbb, 0x06, 0xdb, 0x92,
+	0x24, 0x00, 0x20, 0x24, 0x48, 0x85, 0x69, 0x82, 0x89, 0x04, 0x69, 0x44, 0x24, 0x44, 0x69, 0x8a,
+	0x8d, 0x00, 0x69, 0x83, 0x8d, 0x01, 0x92, 0xb6, 0x8b, 0xbb, 0x05, 0xb7, 0xb7, 0x72, 0x92, 0x72,
+	0xb7, 0x95, 0xbb, 0x8f, 0xbb, 0x0c, 0x96, 0xb7, 0xdb, 0xbb, 0xbb, 0x92, 0x49, 0x24, 0x20, 0x20,
+	0x24, 0x69, 0x44, 0x83, 0x24, 0x06, 0x44, 0x69, 0x89, 0x89, 0x69, 0x44, 0x44, 0x85, 0x8d, 0x00,
+	0xb1, 0x85, 0x8d, 0x00, 0x6d, 0x83, 0x8d, 0x03, 0x6d, 0x91, 0xb6, 0xb7, 0x88, 0xbb, 0x82, 0xb7,
+	0x03, 0x72, 0x96, 0x72, 0x96, 0x95, 0xbb, 0x8f, 0xbb, 0x0c, 0xb7, 0xb7, 0xb6, 0x92, 0x6d, 0x49,
+	0x24, 0x24, 0x20, 0x00, 0x44, 0x91, 0x69, 0x82, 0x44, 0x01, 0x64, 0x69, 0x82, 0x8d, 0x04, 0x64,
+	0x69, 0x91, 0xb1, 0x8d, 0x83, 0xb1, 0x02, 0x8d, 0x8d, 0x91, 0x85, 0x8d, 0x01, 0x91, 0xb1, 0x83,
+	0x8d, 0x01, 0x92, 0xb6, 0x89, 0xbb, 0x04, 0xb7, 0x92, 0x92, 0x72, 0x96, 0x95, 0xbb, 0x8e, 0xbb,
+	0x03, 0xdb, 0xb6, 0x6d, 0x6d, 0x82, 0x49, 0x08, 0x24, 0x24, 0x20, 0x20, 0x44, 0x6d, 0x69, 0x44,
+	0x44, 0x83, 0x8d, 0x05, 0x89, 0x68, 0x6d, 0xb1, 0xb1, 0x91, 0x83, 0xb1, 0x02, 0x91, 0x8d, 0xb1,
+	0x83, 0x8d, 0x83, 0xb1, 0x03, 0x69, 0x68, 0x68, 0x69, 0x82, 0x8d, 0x03, 0xb6, 0xb6, 0xbb, 0xdb,
+	0x85, 0xbb, 0x04, 0x97, 0x72, 0x92, 0x92, 0x96, 0x95, 0xbb, 0x8d, 0xbb, 0x02, 0xdb, 0xb7, 0x6d,
+	0x83, 0x49, 0x04, 0x44, 0x24, 0x24, 0x00, 0x00, 0x84, 0x24, 0x05, 0x48, 0x69, 0x69, 0x44, 0x44,
+	0x8d, 0x84, 0xb1, 0x01, 0x8d, 0x8d, 0x83, 0xb1, 0x00, 0x91, 0x85, 0xb1, 0x06, 0x68, 0x68, 0x69,
+	0x69, 0x8d, 0xb1, 0xb1, 0x82, 0x6d, 0x02, 0x72, 0x96, 0xbb, 0x82, 0xdb, 0x06, 0xb7, 0xb7, 0x96,
+	0x72, 0x96, 0x92, 0xb7, 0x95, 0xbb, 0x8a, 0xbb, 0x82, 0xdb, 0x09, 0xb7, 0x72, 0x49, 0x48, 0x24,
+	0x24, 0x49, 0x49, 0x48, 0x24, 0x86, 0x00, 0x82, 0x20, 0x03, 0x00, 0x69, 0xb2, 0xad, 0x83, 0xb1,
+	0x00, 0x8d, 0x8a, 0xb1, 0x01, 0x68, 0x68, 0x84, 0x8d, 0x10, 0xb1, 0x91, 0x6d, 0x6d, 0x69, 0x24,
+	0x24, 0x49, 0x72, 0xbb, 0xbb, 0xb7, 0x96, 0x72, 0x92, 0x92, 0xb7, 0x95, 0xbb, 0x88, 0xbb, 0x06,
+	0xdb, 0xbb, 0xb6, 0x92, 0x72, 0x6d, 0x48, 0x87, 0x24, 0x89, 0x00, 0x01, 0x44, 0xb2, 0x82, 0xb1,
+	0x00, 0x8d, 0x83, 0xb1, 0x00, 0x91, 0x87, 0xb1, 0x01, 0x68, 0x68, 0x86, 0x8d, 0x04, 0xb1, 0x8d,
+	0x69, 0x6d, 0x48, 0x82, 0x00, 0x07, 0x24, 0x6d, 0xbb, 0xb6, 0x92, 0x92, 0x96, 0xb7, 0x8d, 0xbb,
+	0x00, 0xdb, 0x86, 0xbb, 0x87, 0xbb, 0x01, 0xdb, 0x92, 0x8d, 0x24, 0x88, 0x00, 0x0b, 0x24, 0x8d,
+	0xb1, 0xb1, 0x91, 0x8d, 0xb1, 0xb1, 0x8d, 0xb1, 0xb1, 0x91, 0x85, 0xb1, 0x04, 0xd6, 0x8d, 0x68,
+	0x8d, 0xb1, 0x86, 0x8d, 0x04, 0xb1, 0x8d, 0x69, 0x6d, 0x24, 0x83, 0x00, 0x01, 0x49, 0x72, 0x82,
+	0x92, 0x00, 0x96, 0x90, 0xbb, 0x01, 0xba, 0xb6, 0x82, 0xbb, 0x86, 0xbb, 0x02, 0xdb, 0xb6, 0x24,
+	0x84, 0x00, 0x83, 0x24, 0x01, 0x00, 0x00, 0x82, 0x24, 0x88, 0x00, 0x0a, 0x6d, 0xb1, 0xb1, 0x91,
+	0x8d, 0xb1, 0xb1, 0x8d, 0x8d, 0xb1, 0x8d, 0x87, 0xb1, 0x02, 0x89, 0x8d, 0x8d, 0x82, 0xb1, 0x84,
+	0x8d, 0x0e, 0xb1, 0xb1, 0x6d, 0x6d, 0x48, 0x24, 0x00, 0x24, 0x24, 0x00, 0x24, 0x6d, 0x92, 0x72,
+	0x92, 0x8a, 0xbb, 0x83, 0xb6, 0x03, 0xbb, 0xbb, 0xb6, 0xb6, 0x82, 0xbb, 0x86, 0xbb, 0x01, 0xdb,
+	0x6d, 0x83, 0x24, 0x07, 0x20, 0x00, 0x00, 0x20, 0x24, 0x20, 0x00, 0x20, 0x83, 0x24, 0x86, 0x00,
+	0x00, 0x44, 0x82, 0xb1, 0x07, 0x8d, 0x8d, 0xb1, 0xb1, 0x8d, 0xb1, 0x8d, 0x8d, 0x87, 0xb1, 0x03,
+	0x8d, 0xad, 0xb1, 0xb1, 0x85, 0x8d, 0x09, 0xad, 0xb1, 0xb1, 0x6d, 0x69, 0x49, 0x24, 0x00, 0x20,
+	0x20, 0x82, 0x24, 0x05, 0x6d, 0x96, 0x96, 0xbb, 0xbb, 0xb7, 0x82, 0xbb, 0x8a, 0xb6, 0x04, 0x96,
+	0xb6, 0xbb, 0xbb, 0xba, 0x85, 0xbb, 0x02, 0xdb, 0xb6, 0x49, 0x85, 0x24, 0x00, 0x20, 0x83, 0x00,
+	0x00, 0x20, 0x8a, 0x00, 0x02, 0x6d, 0xb1, 0xb1, 0x82, 0x8d, 0x08, 0xb1, 0x91, 0xb1, 0xb1, 0x8d,
+	0x8d, 0xb1, 0xb1, 0x8d, 0x83, 0xb1, 0x04, 0x8d, 0x8d, 0xb1, 0xb1, 0xad, 0x82, 0x8d, 0x82, 0xad,
+	0x82, 0xb1, 0x03, 0x8d, 0x68, 0x49, 0x24, 0x82, 0x00, 0x0d, 0x20, 0x24, 0x24, 0x28, 0x92, 0x96,
+	0xbb, 0xba, 0xb6, 0xb6, 0xba, 0xb6, 0xb6, 0x96, 0x83, 0xb6, 0x09, 0x96, 0xb6, 0xb6, 0x96, 0xb6,
+	0x91, 0xb6, 0xba, 0xb6, 0xb6, 0x85, 0xbb, 0x02, 0xdb, 0x92, 0x49, 0x86, 0x24, 0x00, 0x20, 0x8d,
+	0x00, 0x02, 0x24, 0x91, 0xb1, 0x82, 0x8d, 0x03, 0xad, 0xb1, 0x8d, 0xb1, 0x82, 0x8d, 0x03, 0xb1,
+	0xb1, 0x8d, 0xad, 0x82, 0xb1, 0x00, 0x8d, 0x85, 0xb1, 0x82, 0xad, 0x83, 0xb1, 0x03, 0x8d, 0x68,
+	0x69, 0x24, 0x83, 0x00, 0x82, 0x24, 0x02, 0x49, 0x96, 0xba, 0x85, 0xb6, 0x01, 0x96, 0x96, 0x82,
+	0xb6, 0x05, 0x96, 0xb6, 0x96, 0x95, 0x95, 0x91, 0x83, 0xb6, 0x84, 0xbb, 0x02, 0xdb, 0xbb, 0x6d,
+	0x88, 0x24, 0x87, 0x00, 0x00, 0x20, 0x83, 0x00, 0x03, 0x20, 0x8d, 0xb1, 0x91, 0x82, 0x8d, 0x03,
+	0xb1, 0x91, 0xb1, 0xb1, 0x82, 0x8d, 0x02, 0xb1, 0x8d, 0x8d, 0x84, 0xad, 0x06, 0xb1, 0xb1, 0xd1,
+	0xb1, 0xb1, 0xad, 0xad, 0x85, 0xb1, 0x03, 0x8d, 0x68, 0x69, 0x24, 0x83, 0x00, 0x83, 0x24, 0x00,
+	0x6d, 0x82, 0xb6, 0x00, 0x92, 0x82, 0xb6, 0x00, 0x96, 0x89, 0x91, 0x03, 0xb5, 0xb5, 0x95, 0x91,
+	0x84, 0xbb, 0x02, 0xdb, 0x96, 0x49, 0x87, 0x24, 0x00, 0x20, 0x88, 0x00, 0x00, 0x20, 0x82, 0x00,
+	0x02, 0x69, 0xb1, 0xb1, 0x83, 0x8d, 0x82, 0xb1, 0x82, 0x8d, 0x04, 0xad, 0xb1, 0x8d, 0x8d, 0xad,
+	0x82, 0x8d, 0x86, 0xb1, 0x83, 0xd1, 0x82, 0xb1, 0x03, 0x8d, 0x68, 0x69, 0x24, 0x83, 0x00, 0x83,
+	0x24, 0x07, 0x48, 0x91, 0xb6, 0x91, 0x91, 0xb5, 0x91, 0xb5, 0x8e, 0x91, 0x84, 0xbb, 0x02, 0xdb,
+	0x96, 0x49, 0x88, 0x24, 0x8a, 0x00, 0x04, 0x24, 0x49, 0x8d, 0xb1, 0xb1, 0x83, 0x8d, 0x82, 0xb1,
+	0x82, 0x8d, 0x03, 0xb1, 0xad, 0x8d, 0xad, 0x83, 0x8d, 0x83, 0xb1, 0x87, 0xd1, 0x05, 0xb1, 0xad,
+	0x8d, 0x48, 0x69, 0x24, 0x84, 0x00, 0x83, 0x24, 0x00, 0x6d, 0x94, 0x91, 0x84, 0xbb, 0x01, 0xdb,
+	0x92, 0x89, 0x24, 0x01, 0x20, 0x20, 0x87, 0x00, 0x04, 0x24, 0x49, 0x69, 0x8d, 0xb1, 0x84, 0x8d,
+	0x02, 0xb1, 0x8d, 0xad, 0x82, 0x8d, 0x00, 0xb1, 0x84, 0x8d, 0x01, 0x89, 0x8d, 0x83, 0xb1, 0x85,
+	0xd1, 0x82, 0xb1, 0x04, 0xad, 0x89, 0x44, 0x69, 0x24, 0x85, 0x00, 0x82, 0x24, 0x00, 0x48, 0x94,
+	0x91, 0x84, 0xbb, 0x01, 0xdb, 0x72, 0x87, 0x24, 0x83, 0x20, 0x86, 0x00, 0x82, 0x44, 0x01, 0x8d,
+	0x91, 0x83, 0x8d, 0x03, 0x69, 0x8d, 0xb1, 0xad, 0x83, 0x8d, 0x00, 0xad, 0x83, 0x8d, 0x03, 0x89,
+	0x89, 0xad, 0xad, 0x8b, 0xb1, 0x04, 0xad, 0x69, 0x44, 0x69, 0x24, 0x85, 0x00, 0x00, 0x20, 0x82,
+	0x24, 0x00, 0x6d, 0x92, 0x91, 0x00, 0x90, 0x84, 0xbb, 0x01, 0xdb, 0x6e, 0x87, 0x24, 0x04, 0x20,
+	0x20, 0x00, 0x20, 0x20, 0x84, 0x00, 0x82, 0x24, 0x00, 0x69, 0x84, 0x8d, 0x04, 0x6d, 0x68, 0x8d,
+	0xb1, 0xad, 0x88, 0x8d, 0x03, 0x89, 0x8d, 0xad, 0xad, 0x86, 0xb1, 0x01, 0xd1, 0xd1, 0x82, 0xb1,
+	0x04, 0xad, 0x68, 0x44, 0x69, 0x24, 0x87, 0x00, 0x02, 0x24, 0x24, 0x48, 0x93, 0x91, 0x85, 0xbb,
+	0x00, 0x92, 0x88, 0x24, 0x00, 0x20, 0x86, 0x00, 0x82, 0x24, 0x01, 0x48, 0x69, 0x84, 0x8d, 0x03,
+	0x68, 0x68, 0x91, 0xb1, 0x8a, 0x8d, 0x82, 0xad, 0x85, 0xb1, 0x82, 0xd1, 0x07, 0xb1, 0xb1, 0xad,
+	0xad, 0x48, 0x24, 0x69, 0x24, 0x87, 0x00, 0x02, 0x24, 0x24, 0x44, 0x93, 0x91, 0x82, 0xbb, 0x03,
+	0xb7, 0xbb, 0xbb, 0x92, 0x88, 0x24, 0x01, 0x20, 0x20, 0x84, 0x00, 0x84, 0x24, 0x85, 0x8d, 0x06,
+	0x44, 0x68, 0xb1, 0xb1, 0x8d, 0x8d, 0x89, 0x83, 0x8d, 0x00, 0x8c, 0x82, 0x8d, 0x00, 0xad, 0x82,
+	0xb1, 0x84, 0xd1, 0x0a, 0xd2, 0xd2, 0xd1, 0xd1, 0xb1, 0xad, 0xad, 0x44, 0x20, 0x69, 0x44, 0x87,
+	0x00, 0x82, 0x24, 0x00, 0x6d, 0x83, 0x91, 0x01, 0xb1, 0xb5, 0x8a, 0x91, 0x01, 0x90, 0x90, 0x82,
+	0xb7, 0x03, 0xb6, 0xb7, 0xbb, 0x92, 0x88, 0x24, 0x03, 0x20, 0x20, 0x00, 0x20, 0x82, 0x00, 0x11,
+	0x24, 0x20, 0x24, 0x20, 0x48, 0x91, 0x8d, 0x68, 0x8d, 0x8d, 0x69, 0x44, 0x68, 0xb1, 0x8d, 0x69,
+	0x8d, 0x68, 0x82, 0x8d, 0x00, 0x89, 0x83, 0x8d, 0x00, 0xad, 0x84, 0xb1, 0x03, 0xd1, 0xd1, 0xb1,
+	0xd1, 0x83, 0xd2, 0x05, 0xb2, 0x8d, 0x24, 0x44, 0x69, 0x44, 0x88, 0x00, 0x0a, 0x24, 0x24, 0x68,
+	0xb5, 0x91, 0x91, 0xb1, 0xb5, 0xb5, 0x91, 0xb1, 0x8a, 0x91, 0x84, 0xb6, 0x01, 0xbb, 0x6d, 0x86,
+	0x24, 0x82, 0x20, 0x0c, 0x00, 0x20, 0x20, 0x00, 0x00, 0x24, 0x20, 0x24, 0x24, 0x20, 0x6d, 0x8d,
+	0x69, 0x82, 0x8d, 0x03, 0x68, 0x44, 0x6d, 0x8d, 0x82, 0x68, 0x04, 0x44, 0x44, 0x68, 0x69, 0x88,
+	0x82, 0x8d, 0x01, 0x89, 0x8d, 0x85, 0xad, 0x02, 0xb1, 0xad, 0xad, 0x84, 0x8d, 0x04, 0x69, 0x24,
+	0x48, 0x69, 0x44, 0x88, 0x00, 0x82, 0x24, 0x00, 0x48, 0x82, 0x91, 0x01, 0xb5, 0xb5, 0x8c, 0x91,
+	0x83, 0x96, 0x02, 0xb6, 0x96, 0x6d, 0x82, 0x24, 0x00, 0x20, 0x84, 0x24, 0x01, 0x20, 0x20, 0x82,
+	0x00, 0x00, 0x20, 0x82, 0x24, 0x04, 0x00, 0x44, 0x8d, 0x8d, 0x68, 0x82, 0x8d, 0x1b, 0x44, 0x44,
+	0x8d, 0x6d, 0x68, 0x68, 0x48, 0x20, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x8d, 0x69, 0x24, 0x24, 0x44,
+	0x69, 0x8d, 0x8d, 0x89, 0x69, 0x68, 0x44, 0x24, 0x20, 0x00, 0x82, 0x20, 0x04, 0x00, 0x00, 0x44,
+	0x69, 0x44, 0x87, 0x00, 0x05, 0x24, 0x00, 0x00, 0x20, 0x24, 0x6d, 0x82, 0x91, 0x00, 0xb1, 0x8a,
+	0x91, 0x01, 0x90, 0x91, 0x85, 0x91, 0x03, 0x69, 0x48, 0x00, 0x24, 0x82, 0x00, 0x07, 0x20, 0x24,
+	0x24, 0x00, 0x00, 0x20, 0x00, 0x20, 0x82, 0x24, 0x17, 0x00, 0x24, 0x6d, 0x8d, 0x68, 0x69, 0x8d,
+	0x8d, 0x69, 0x44, 0x68, 0x8d, 0x68, 0x68, 0x48, 0x44, 0x20, 0x24, 0x44, 0x68, 0x89, 0x8d, 0x8d,
+	0x68, 0x83, 0x00, 0x82, 0x20, 0x8a, 0x00, 0x02, 0x44, 0x6d, 0x44, 0x8b, 0x00, 0x01, 0x24, 0x48,
+	0x82, 0x91, 0x00, 0xb1, 0x8a, 0x91, 0x01, 0x90, 0x91, 0x85, 0x91, 0x01, 0x49, 0x49, 0x82, 0x24,
+	0x83, 0x00, 0x01, 0x20, 0x20, 0x82, 0x00, 0x0b, 0x24, 0x44, 0x24, 0x24, 0x20, 0x44, 0x8d, 0x6d,
+	0x68, 0x89, 0x8d, 0x8d, 0x82, 0x68, 0x08, 0x69, 0x68, 0x44, 0x44, 0x24, 0x20, 0x24, 0x44, 0x68,
+	0x82, 0x8d, 0x00, 0x48, 0x8e, 0x00, 0x05, 0x24, 0x00, 0x20, 0x48, 0x6d, 0x48, 0x8c, 0x00, 0x05,
+	0x24, 0x91, 0x91, 0xb5, 0xb5, 0xb1, 0x8b, 0x91, 0x84, 0x91, 0x01, 0x6d, 0x48, 0x85, 0x24, 0x84,
+	0x00, 0x01, 0x20, 0x00, 0x84, 0x24, 0x06, 0x68, 0x8d, 0x69, 0x8d, 0x89, 0x8d, 0x8d, 0x83, 0x68,
+	0x82, 0x44, 0x04, 0x24, 0x20, 0x20, 0x44, 0x68, 0x82, 0x8d, 0x00, 0x44, 0x83, 0x00, 0x01, 0x44,
+	0x44, 0x8a, 0x00, 0x03, 0x24, 0x48, 0x6d, 0x48, 0x8a, 0x00, 0x06, 0x20, 0x00, 0x00, 0x6d, 0xb5,
+	0xb1, 0xb1, 0x8a, 0x91, 0x01, 0x90, 0x91, 0x82, 0x91, 0x02, 0xb5, 0x91, 0x49, 0x88, 0x24, 0x84,
+	0x00, 0x0c, 0x48, 0x24, 0x00, 0x00, 0x24, 0x6d, 0x8d, 0x6d, 0x8d, 0x8d, 0xad, 0x8d, 0x44, 0x82,
+	0x68, 0x83, 0x44, 0x02, 0x20, 0x20, 0x48, 0x83, 0x8d, 0x00, 0x24, 0x82, 0x00, 0x03, 0x44, 0xb1,
+	0xad, 0x20, 0x87, 0x00, 0x06, 0x24, 0x44, 0x24, 0x48, 0x69, 0x48, 0x20, 0x84, 0x00, 0x87, 0x24,
+	0x01, 0x48, 0xb5, 0x8c, 0x91, 0x01, 0x6c, 0x91, 0x82, 0x91, 0x02, 0xb5, 0x6d, 0x48, 0x87, 0x24,
+	0x83, 0x20, 0x08, 0x00, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x8d, 0x69, 0x83, 0x8d, 0x0b, 0x69,
+	0x48, 0x44, 0x68, 0x68, 0x44, 0x44, 0x64, 0x68, 0x44, 0x68, 0x68, 0x82, 0x8d, 0x08, 0x68, 0x20,
+	0x00, 0x00, 0x20, 0x8d, 0xb2, 0xd2, 0x44, 0x86, 0x00, 0x07, 0x44, 0x8d, 0x44, 0x44, 0x68, 0x69,
+	0x49, 0x20, 0x87, 0x00, 0x06, 0x24, 0x00, 0x00, 0x20, 0x24, 0x24, 0x6d, 0x83, 0x91, 0x00, 0x8c,
+	0x87, 0x91, 0x01, 0x6c, 0x91, 0x84, 0x91, 0x00, 0x49, 0x8b, 0x24, 0x01, 0x20, 0x24, 0x83, 0x00,
+	0x02, 0x68, 0x8d, 0x69, 0x83, 0x8d, 0x0b, 0x68, 0x68, 0x44, 0x64, 0x68, 0x68, 0x64, 0x64, 0x68,
+	0x8d, 0x89, 0x88, 0x82, 0x8d, 0x09, 0x68, 0x44, 0x24, 0x44, 0x89, 0xad, 0xd2, 0xd2, 0x8d, 0x44,
+	0x82, 0x20, 0x0a, 0x44, 0x68, 0x8d, 0xb1, 0x8d, 0x20, 0x44, 0x68, 0x69, 0x49, 0x20, 0x88, 0x00,
+	0x00, 0x24, 0x84, 0x00, 0x04, 0x24, 0x48, 0x91, 0x91, 0x6c, 0x84, 0x91, 0x84, 0x8c, 0x84, 0x91,
+	0x00, 0x49, 0x8a, 0x24, 0x00, 0x20, 0x82, 0x24, 0x05, 0x00, 0x00, 0x24, 0x69, 0x68, 0x69, 0x83,
+	0x8d, 0x02, 0x69, 0x68, 0x44, 0x84, 0x68, 0x02, 0x88, 0x8d, 0x68, 0x83, 0x8d, 0x83, 0x89, 0x06,
+	0xad, 0xad, 0xd2, 0xd2, 0xd1, 0xad, 0x8d, 0x82, 0xad, 0x82, 0xb1, 0x05, 0x68, 0x20, 0x44, 0x68,
+	0x6d, 0x48, 0x8a, 0x00, 0x01, 0x20, 0x20, 0x84, 0x00, 0x00, 0x6d, 0x86, 0x91, 0x04, 0x8d, 0x8c,
+	0x6c, 0x6c, 0x8d, 0x83, 0x91, 0x01, 0x6d, 0x48, 0x8d, 0x24, 0x05, 0x00, 0x00, 0x24, 0x44, 0x6d,
+	0x68, 0x84, 0x8d, 0x0a, 0x68, 0x44, 0x44, 0x68, 0x8d, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x82,
+	0x8d, 0x84, 0x89, 0x06, 0xad, 0xd1, 0xd2, 0xd2, 0xd1, 0xad, 0x89, 0x85, 0xad, 0x06, 0x44, 0x20,
+	0x48, 0x68, 0x6d, 0x48, 0x20, 0x86, 0x00, 0x00, 0x24, 0x82, 0x00, 0x01, 0x20, 0x20, 0x83, 0x00,
+	0x00, 0x24, 0x87, 0x91, 0x82, 0x6c, 0x00, 0x8d, 0x82, 0x91, 0x02, 0x6d, 0x49, 0x48, 0x8d, 0x24,
+	0x05, 0x20, 0x20, 0x24, 0x68, 0x6d, 0x68, 0x84, 0x8d, 0x0c, 0x68, 0x24, 0x44, 0x8d, 0x8d, 0x68,
+	0x68, 0x88, 0x68, 0x68, 0x88, 0x8d, 0x8d, 0x82, 0x89, 0x04, 0x88, 0x88, 0x89, 0xad, 0xd1, 0x82,
+	0xd2, 0x03, 0xad, 0x89, 0x89, 0x8d, 0x82, 0xad, 0x06, 0x8d, 0x24, 0x44, 0x68, 0x68, 0x6d, 0x48,
+	0x8a, 0x00, 0x03, 0x20, 0x20, 0x24, 0x24, 0x83, 0x00, 0x01, 0x6c, 0xb5, 0x84, 0x91, 0x01, 0x8d,
+	0x91, 0x82, 0x6c, 0x07, 0x91, 0x91, 0x6d, 0x49, 0x49, 0x48, 0x24, 0x20, 0x8b, 0x24, 0x05, 0x20,
+	0x24, 0x24, 0x69, 0x68, 0x68, 0x83, 0x8d, 0x05, 0x69, 0x44, 0x20, 0x44, 0x8d, 0x8d, 0x84, 0x68,
+	0x09, 0x89, 0x8d, 0x8d, 0x88, 0x89, 0x89, 0x88, 0x64, 0x64, 0x68, 0x83, 0xad, 0x0d, 0x8d, 0x8d,
+	0x89, 0x88, 0x89, 0x8d, 0x8d, 0x69, 0x20, 0x44, 0x68, 0x68, 0x6d, 0x48, 0x8e, 0x00, 0x04, 0x24,
+	0x24, 0x00, 0x00, 0x24, 0x85, 0x91, 0x01, 0x6c, 0x91, 0x82, 0x6c, 0x03, 0x91, 0x71, 0x71, 0x6d,
+	0x82, 0x24, 0x00, 0x20, 0x8d, 0x24, 0x0d, 0x48, 0x6d, 0x68, 0x8d, 0x91, 0x68, 0x8d, 0x8d, 0x68,
+	0x24, 0x20, 0x68, 0xb1, 0x8d, 0x83, 0x68, 0x00, 0x88, 0x82, 0x8d, 0x84, 0x68, 0x83, 0x64, 0x02,
+	0x68, 0x89, 0x8d, 0x82, 0x89, 0x82, 0x8d, 0x0a, 0x44, 0x20, 0x44, 0x68, 0x68, 0x6d, 0x49, 0x00,
+	0x00, 0x24, 0x20, 0x8b, 0x00, 0x04, 0x24, 0x24, 0x00, 0x00, 0x6d, 0x83, 0x91, 0x00, 0x6c, 0x82,
+	0x91, 0x01, 0x6c, 0x91, 0x00, 0x91, 0x82, 0x6d, 0x91, 0x24, 0x11, 0x69, 0x6d, 0x68, 0x8d, 0x8d,
+	0x68, 0x8d, 0x8d, 0x48, 0x20, 0x24, 0x8d, 0xb1, 0x8d, 0x64, 0x44, 0x68, 0x68, 0x82, 0x8d, 0x0e,
+	0x88, 0x68, 0x64, 0x44, 0x68, 0x64, 0x64, 0x68, 0x68, 0x64, 0x68, 0x89, 0x68, 0x64, 0x68, 0x82,
+	0x8d, 0x07, 0x44, 0x20, 0x44, 0x44, 0x69, 0x68, 0x6d, 0x49, 0x90, 0x00, 0x03, 0x24, 0x24, 0x00,
+	0x6d, 0x83, 0x91, 0x05, 0x8d, 0x91, 0x91, 0x8d, 0x91, 0x91, 0x04, 0x91, 0x71, 0x6d, 0x48, 0x44,
+	0x8f, 0x24, 0x12, 0x44, 0x6d, 0x6d, 0x68, 0x8d, 0x68, 0x68, 0x8d, 0x68, 0x44, 0x20, 0x44, 0xb1,
+	0x8d, 0x68, 0x44, 0x44, 0x64, 0x88, 0x82, 0x8d, 0x03, 0x88, 0x88, 0x68, 0x64, 0x82, 0x44, 0x84,
+	0x64, 0x0d, 0x68, 0x88, 0x89, 0x8d, 0x8d, 0x68, 0x20, 0x20, 0x44, 0x68, 0x89, 0x68, 0x6d, 0x69,
+	0x87, 0x00, 0x87, 0x24, 0x83, 0x00, 0x00, 0x48, 0x86, 0x91, 0x02, 0x6c, 0x6c, 0x91, 0x05, 0x6d,
+	0x48, 0x49, 0x48, 0x49, 0x49, 0x8e, 0x24, 0x12, 0x69, 0x8d, 0x68, 0x8d, 0x8d, 0x44, 0x69, 0x8d,
+	0x48, 0x24, 0x20, 0x68, 0xb1, 0x8d, 0x44, 0x20, 0x44, 0x68, 0x68, 0x82, 0x8d, 0x05, 0x88, 0x8d,
+	0x8d, 0x89, 0x68, 0x68, 0x83, 0x64, 0x01, 0x88, 0x89, 0x83, 0x8d, 0x0a, 0x68, 0x20, 0x20, 0x24,
+	0x44, 0x68, 0x8d, 0x69, 0x6d, 0x6d, 0x24, 0x85, 0x00, 0x82, 0x24, 0x00, 0x48, 0x82, 0x49, 0x02,
+	0x48, 0x48, 0x49, 0x83, 0x24, 0x88, 0x91, 0x00, 0x6c, 0x82, 0x24, 0x03, 0x49, 0x92, 0x49, 0x20,
+	0x8c, 0x24, 0x17, 0x44, 0x8d, 0x8d, 0x68, 0x8d, 0x69, 0x44, 0x8d, 0x69, 0x44, 0x24, 0x20, 0x8d,
+	0x8d, 0x68, 0x20, 0x00, 0x24, 0x48, 0x8d, 0x89, 0x8d, 0x8d, 0x88, 0x82, 0x8d, 0x02, 0x89, 0x88,
+	0x88, 0x83, 0x89, 0x82, 0xad, 0x0c, 0x8d, 0x68, 0x00, 0x00, 0x20, 0x24, 0x44, 0x68, 0x8d, 0x8d,
+	0x6d, 0x6d, 0x24, 0x84, 0x00, 0x85, 0x24, 0x00, 0x48, 0x86, 0x49, 0x00, 0x24, 0x85, 0x91, 0x00,
+	0x6d, 0x82, 0x91, 0x82, 0x24, 0x02, 0x92, 0xb6, 0x49, 0x8b, 0x24, 0x10, 0x44, 0x24, 0x69, 0x8d,
+	0x68, 0x68, 0x8d, 0x68, 0x44, 0x8d, 0x68, 0x44, 0x20, 0x44, 0x8d, 0x8d, 0x44, 0x82, 0x20, 0x05,
+	0x48, 0x8d, 0x68, 0x8d, 0x88, 0x88, 0x84, 0x8d, 0x83, 0x89, 0x00, 0x8d, 0x82, 0xad, 0x00, 0x44,
+	0x82, 0x00, 0x08, 0x20, 0x44, 0x44, 0x68, 0x8d, 0x8d, 0x6d, 0x6d, 0x44, 0x83, 0x00, 0x89, 0x24,
+	0x82, 0x49, 0x02, 0x48, 0x24, 0x48, 0x88, 0x91, 0x00, 0x6c, 0x05, 0x24, 0x49, 0x92, 0xb6, 0xb6,
+	0x49, 0x88, 0x24, 0x12, 0x20, 0x24, 0x48, 0x44, 0x48, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0x44, 0x44,
+	0x8d, 0x48, 0x24, 0x20, 0x48, 0x8d, 0x68, 0x82, 0x20, 0x09, 0x44, 0x68, 0x68, 0x8c, 0x8c, 0x68,
+	0x88, 0x8d, 0x89, 0x8d, 0x88, 0xad, 0x00, 0x44, 0x83, 0x00, 0x02, 0x24, 0x44, 0x68, 0x82, 0x8d,
+	0x02, 0x6d, 0x69, 0x48, 0x88, 0x00, 0x01, 0x24, 0x24, 0x83, 0x00, 0x05, 0x24, 0x24, 0x49, 0x49,
+	0x48, 0x6d, 0x82, 0x91, 0x00, 0xb5, 0x84, 0x91, 0x08, 0x4d, 0xb6, 0xb7, 0x96, 0x92, 0x6d, 0x20,
+	0x24, 0x00, 0x86, 0x24, 0x12, 0x48, 0x24, 0x24, 0x6d, 0x8d, 0x8d, 0x68, 0x8d, 0x8d, 0x44, 0x68,
+	0x8d, 0x44, 0x44, 0x24, 0x68, 0x8d, 0x44, 0x20, 0x82, 0x24, 0x08, 0x44, 0x68, 0x8d, 0x88, 0x68,
+	0x88, 0x89, 0x89, 0x8d, 0x87, 0xad, 0x00, 0x44, 0x83, 0x00, 0x03, 0x20, 0x24, 0x44, 0x68, 0x82,
+	0x8d, 0x02, 0x6d, 0x49, 0x24, 0x90, 0x00, 0x03, 0x24, 0x49, 0x49, 0x6c, 0x88, 0x91, 0x01, 0xb7,
+	0xb6, 0x82, 0x92, 0x04, 0x6e, 0x24, 0x20, 0x24, 0x00, 0x87, 0x24, 0x0e, 0x48, 0xb1, 0x8d, 0x89,
+	0x68, 0x8d, 0x8d, 0x44, 0x69, 0x8d, 0x68, 0x44, 0x44, 0x8d, 0x69, 0x82, 0x24, 0x04, 0x20, 0x24,
+	0x44, 0x44, 0x8d, 0x83, 0x68, 0x02, 0x64, 0x68, 0x8d, 0x84, 0xad, 0x01, 0x8d, 0x44, 0x83, 0x00,
+	0x09, 0x20, 0x24, 0x44, 0x44, 0x69, 0x8d, 0x8d, 0x69, 0x48, 0x24, 0x89, 0x00, 0x00, 0x04, 0x82,
+	0x24, 0x02, 0x48, 0x49, 0x49, 0x83, 0x24, 0x00, 0x48, 0x88, 0x91, 0x00, 0x96, 0x82, 0x92, 0x02,
+	0x6e, 0x6e, 0x49, 0x82, 0x00, 0x00, 0x20, 0x84, 0x24, 0x11, 0x44, 0x48, 0x8d, 0x91, 0x8d, 0x88,
+	0x8d, 0x8d, 0x69, 0x20, 0x6d, 0x69, 0x68, 0x44, 0x44, 0x8d, 0x68, 0x24, 0x82, 0x20, 0x03, 0x44,
+	0x44, 0x68, 0x8d, 0x82, 0x68, 0x09, 0x44, 0x20, 0x24, 0x44, 0x69, 0x89, 0x8d, 0x89, 0x44, 0x20,
+	0x82, 0x00, 0x82, 0x20, 0x02, 0x24, 0x44, 0x44, 0x82, 0x8d, 0x00, 0x48, 0x82, 0x24, 0x85, 0x00,
+	0x82, 0x24, 0x00, 0x48, 0x82, 0x49, 0x01, 0x48, 0x48, 0x85, 0x49, 0x00, 0x6d, 0x87, 0x91, 0x82,
+	0x92, 0x04, 0x6e, 0x6e, 0x6d, 0x6d, 0x24, 0x82, 0x00, 0x00, 0x20, 0x82, 0x24, 0x05, 0x44, 0x48,
+	0x6d, 0xb1, 0x8d, 0x89, 0x82, 0x8d, 0x08, 0x69, 0x20, 0x8d, 0x8d, 0x68, 0x20, 0x68, 0x8d, 0x68,
+	0x82, 0x20, 0x08, 0x24, 0x44, 0x44, 0x68, 0x8d, 0x68, 0x48, 0x44, 0x24, 0x85, 0x20, 0x84, 0x00,
+	0x82, 0x20, 0x03, 0x24, 0x44, 0x44, 0x68, 0x82, 0x8d, 0x82, 0x49, 0x00, 0x24, 0x85, 0x00, 0x00,
+	0x20, 0x85, 0x24, 0x04, 0x48, 0x48, 0x28, 0x24, 0x24, 0x83, 0x48, 0x00, 0x6d, 0x86, 0x91, 0x02,
+	0x92, 0x92, 0x6e, 0x83, 0x6d, 0x0b, 0x49, 0x00, 0x00, 0x24, 0x00, 0x20, 0x24, 0x48, 0x48, 0x69,
+	0xb1, 0xb1, 0x82, 0x8d, 0x15, 0x68, 0xb1, 0x68, 0x44, 0x8d, 0x8d, 0x68, 0x20, 0x8d, 0x8d, 0x44,
+	0x20, 0x24, 0x20, 0x44, 0x24, 0x44, 0x68, 0x88, 0x68, 0x44, 0x44, 0x8b, 0x00, 0x82, 0x20, 0x06,
+	0x44, 0x44, 0x68, 0x8d, 0xad, 0xb1, 0x69, 0x82, 0x49, 0x00, 0x24, 0x83, 0x00, 0x01, 0x24, 0x69,
+	0x83, 0x8d, 0x02, 0x69, 0x48, 0x44, 0x86, 0x24, 0x02, 0x48, 0x48, 0x49, 0x86, 0x91, 0x04, 0x6e,
+	0x6e, 0x6d, 0x6d, 0x4d, 0x82, 0x49, 0x09, 0x24, 0x00, 0x00, 0x24, 0x24, 0x44, 0x48, 0x68, 0x8d,
+	0xb1, 0x82, 0x8d, 0x0b, 0x68, 0x88, 0xb1, 0x68, 0x68, 0xb1, 0xb1, 0x68, 0x24, 0x91, 0x8d, 0x44,
+	0x82, 0x20, 0x01, 0x44, 0x24, 0x83, 0x68, 0x01, 0x44, 0x24, 0x8a, 0x00, 0x13, 0x20, 0x24, 0x24,
+	0x44, 0x44, 0x64, 0x68, 0x8d, 0xad, 0x8d, 0x69, 0x49, 0x49, 0x25, 0x24, 0x00, 0x00, 0x44, 0x8d,
+	0xb1, 0x86, 0xd6, 0x04, 0xb1, 0x8d, 0x68, 0x24, 0x20, 0x83, 0x24, 0x02, 0x44, 0x48, 0x6d, 0x85,
+	0x91, 0x03, 0x6e, 0x6d, 0x6d, 0x4d, 0x84, 0x49, 0x01, 0x24, 0x20, 0x82, 0x24, 0x02, 0x48, 0x8d,
+	0xad, 0x82, 0x8d, 0x0f, 0x68, 0x68, 0x8d, 0xb1, 0x8d, 0x68, 0xad, 0xb1, 0x68, 0x68, 0xb1, 0x68,
+	0x24, 0x20, 0x20, 0x24, 0x83, 0x44, 0x03, 0x68, 0x48, 0x44, 0x20, 0x89, 0x00, 0x06, 0x20, 0x24,
+	0x24, 0x44, 0x44, 0x68, 0x68, 0x82, 0x8d, 0x09, 0x69, 0x49, 0x49, 0x25, 0x24, 0x24, 0x44, 0x8d,
+	0xb1, 0xd1, 0x83, 0xd2, 0x85, 0xd6, 0x05, 0xd2, 0xad, 0x68, 0x44, 0x20, 0x20, 0x82, 0x24, 0x00,
+	0x48, 0x83, 0x91, 0x01, 0xb5, 0x91, 0x82, 0x6d, 0x83, 0x49, 0x01, 0x25, 0x49, 0x82, 0x24, 0x05,
+	0x44, 0x48, 0x69, 0x69, 0x88, 0x8d, 0x82, 0x68, 0x0d, 0x8d, 0x68, 0x69, 0x8d, 0x68, 0x8d, 0xb1,
+	0x68, 0x8d, 0xb1, 0x44, 0x24, 0x20, 0x24, 0x82, 0x44, 0x00, 0x24, 0x83, 0x44, 0x89, 0x00, 0x0a,
+	0x20, 0x20, 0x24, 0x24, 0x44, 0x68, 0x68, 0x88, 0x8d, 0x8d, 0x6d, 0x82, 0x49, 0x06, 0x48, 0x69,
+	0x8d, 0xb1, 0xd2, 0xd1, 0xd1, 0x88, 0xd6, 0x00, 0xd2, 0x82, 0xd1, 0x06, 0xb1, 0x8d, 0x44, 0x20,
+	0x24, 0x24, 0x48, 0x85, 0x91, 0x82, 0x6d, 0x82, 0x49, 0x00, 0x25, 0x86, 0x24, 0x1c, 0x44, 0x44,
+	0x69, 0x68, 0x68, 0x44, 0x68, 0x68, 0x20, 0x48, 0xb1, 0x88, 0x8d, 0xb1, 0x8c, 0xb1, 0x8d, 0x44,
+	0x24, 0x24, 0x44, 0x44, 0x48, 0x20, 0x24, 0x44, 0x68, 0x44, 0x24, 0x89, 0x00, 0x11, 0x20, 0x24,
+	0x44, 0x44, 0x68, 0x68, 0x8c, 0x8d, 0xad, 0x6d, 0x44, 0x44, 0x49, 0x6d, 0x91, 0xb1, 0xd1, 0xd1,
+	0x89, 0xd6, 0x85, 0xd1, 0x06, 0xd2, 0xd2, 0xb1, 0x48, 0x00, 0x24, 0x6c, 0x83, 0x91, 0x01, 0xb5,
+	0xb5, 0x82, 0x6d, 0x03, 0x49, 0x49, 0x25, 0x25, 0x85, 0x24, 0x11, 0x20, 0x24, 0x44, 0x48, 0x68,
+	0x48, 0x68, 0x48, 0x24, 0x20, 0x44, 0x91, 0x8d, 0x68, 0x8d, 0x8d, 0xb1, 0x68, 0x83, 0x44, 0x08,
+	0x68, 0x44, 0x20, 0x20, 0x44, 0x68, 0x44, 0x24, 0x20, 0x87, 0x00, 0x03, 0x24, 0x24, 0x44, 0x48,
+	0x82, 0x68, 0x06, 0x8d, 0x8d, 0x69, 0x44, 0x44, 0x69, 0x91, 0x82, 0xb1, 0x01, 0xd1, 0xd2, 0x86,
+	0xd6, 0x82, 0xd1, 0x83, 0xb1, 0x84, 0xd1, 0x02, 0x8d, 0x20, 0x20, 0x86, 0x91, 0x01, 0x6d, 0x6d,
+	0x83, 0x49, 0x88, 0x24, 0x82, 0x44, 0x01, 0x48, 0x44, 0x82, 0x24, 0x06, 0x44, 0x68, 0x48, 0x20,
+	0x68, 0xb1, 0xad, 0x85, 0x44, 0x07, 0x24, 0x20, 0x24, 0x68, 0x44, 0x44, 0x20, 0x20, 0x87, 0x00,
+	0x02, 0x20, 0x24, 0x44, 0x82, 0x68, 0x05, 0x8d, 0x8d, 0x68, 0x68, 0x8d, 0xad, 0x82, 0xb1, 0x82,
+	0xd1, 0x00, 0xd2, 0x83, 0xd6, 0x01, 0xd1, 0xd1, 0x87, 0xb1, 0x83, 0xd1, 0x03, 0xb1, 0x91, 0x6d,
+	0x6d, 0x86, 0x91, 0x05, 0x6d, 0x6d, 0x49, 0x25, 0x49, 0x25, 0x83, 0x24, 0x03, 0x25, 0x24, 0x24,
+	0x00, 0x82, 0x24, 0x82, 0x20, 0x84, 0x24, 0x07, 0x20, 0x44, 0x8d, 0xb1, 0x8d, 0x64, 0x44, 0x44,
+	0x82, 0x68, 0x84, 0x44, 0x02, 0x24, 0x20, 0x24, 0x82, 0x20, 0x85, 0x00, 0x01, 0x20, 0x44, 0x83,
+	0x68, 0x02, 0x64, 0x88, 0xad, 0x83, 0xb1, 0x07, 0xd1, 0xd1, 0xd2, 0xd1, 0xd2, 0xd2, 0xd1, 0xd1,
+	0x84, 0xb1, 0x82, 0xad, 0x86, 0xb1, 0x07, 0xad, 0x91, 0xb1, 0xb1, 0x91, 0xb1, 0xb5, 0xb1, 0x82,
+	0x91, 0x82, 0x49, 0x84, 0x24, 0x06, 0x45, 0x25, 0x25, 0x24, 0x00, 0x00, 0x24, 0x83, 0x00, 0x06,
+	0x20, 0x24, 0x20, 0x20, 0x24, 0x44, 0x48, 0x82, 0x8d, 0x05, 0x68, 0x64, 0x68, 0x68, 0x89, 0x88,
+	0x82, 0x68, 0x04, 0x64, 0x64, 0x44, 0x44, 0x20, 0x82, 0x44, 0x02, 0x24, 0x20, 0x20, 0x83, 0x00,
+	0x00, 0x20, 0x84, 0x44, 0x01, 0x68, 0x8d, 0x8e, 0xb1, 0x01, 0xad, 0xb1, 0x83, 0xad, 0x84, 0xb1,
+	0x00, 0xad, 0x82, 0x8d, 0x88, 0x91, 0x02, 0x49, 0x49, 0x25, 0x85, 0x24, 0x05, 0x25, 0x24, 0x00,
+	0x00, 0x24, 0x24, 0x83, 0x00, 0x84, 0x20, 0x03, 0x24, 0x68, 0x8d, 0x88, 0x84, 0x68, 0x00, 0x89,
+	0x82, 0x88, 0x06, 0x89, 0x68, 0x64, 0x68, 0x68, 0x44, 0x44, 0x83, 0x68, 0x01, 0x69, 0x44, 0x83,
+	0x00, 0x00, 0x44, 0x83, 0x68, 0x02, 0x89, 0xad, 0xad, 0x8b, 0xb1, 0x86, 0xad, 0x83, 0xb1, 0x00,
+	0xad, 0x84, 0x8d, 0x82, 0x91, 0x00, 0xb1, 0x84, 0x91, 0x01, 0x49, 0x49, 0x87, 0x24, 0x00, 0x20,
+	0x82, 0x00, 0x01, 0x24, 0x24, 0x83, 0x00, 0x0e, 0x20, 0x24, 0x20, 0x20, 0x44, 0xb1, 0x89, 0x88,
+	0x68, 0x44, 0x44, 0x64, 0x88, 0x8d, 0x8d, 0x84, 0x88, 0x05, 0x8d, 0x89, 0x68, 0x68, 0x8d, 0xad,
+	0x82, 0xb1, 0x0c, 0xad, 0x44, 0x00, 0x24, 0x00, 0x24, 0x68, 0x69, 0x68, 0x89, 0x8d, 0xad, 0xad,
+	0x85, 0xb1, 0x85, 0xad, 0x84, 0x8d, 0x83, 0xad, 0x82, 0x8d, 0x0d, 0x88, 0x88, 0x68, 0x8d, 0x91,
+	0xb1, 0xb1, 0x91, 0x91, 0xb5, 0xb5, 0xb1, 0x91, 0x91, 0x01, 0x25, 0x25, 0x87, 0x24, 0x01, 0x00,
+	0x00, 0x84, 0x24, 0x82, 0x00, 0x00, 0x20, 0x82, 0x00, 0x07, 0x69, 0xb1, 0x89, 0x68, 0x44, 0x44,
+	0x68, 0x8d, 0x82, 0xad, 0x82, 0x8d, 0x84, 0xad, 0x86, 0xb1, 0x08, 0x69, 0x24, 0x20, 0x00, 0x00,
+	0x24, 0x69, 0x8d, 0x8d, 0x82, 0xad, 0x01, 0xb1, 0xb1, 0x83, 0xad, 0x8e, 0x8d, 0x02, 0x88, 0x88,
+	0x68, 0x83, 0x8d, 0x03, 0xb1, 0xb5, 0xb5, 0xb1, 0x82, 0xb5, 0x82, 0x91, 0x88, 0x24, 0x01, 0x00,
+	0x00, 0x86, 0x24, 0x07, 0x20, 0x44, 0x69, 0x69, 0x6d, 0x69, 0x8d, 0xad, 0x82, 0x8d, 0x04, 0xb1,
+	0xb1, 0xad, 0xb1, 0xb1, 0x84, 0xad, 0x85, 0xb1, 0x82, 0xd1, 0x03, 0xb1, 0xb1, 0x69, 0x24, 0x83,
+	0x00, 0x02, 0x20, 0x68, 0x8d, 0x83, 0xad, 0x90, 0x8d, 0x01, 0x68, 0x68, 0x82, 0x8d, 0x02, 0x91,
+	0x8d, 0x91, 0x82, 0xb1, 0x03, 0xb5, 0xb1, 0x91, 0xb1, 0x84, 0x91, 0x83, 0x24, 0x03, 0x20, 0x00,
+	0x24, 0x24, 0x82, 0x00, 0x86, 0x24, 0x01, 0x69, 0xb2, 0x83, 0xd2, 0x82, 0xd1, 0x02, 0xd2, 0xd1,
+	0xd1, 0x86, 0xb1, 0x04, 0xad, 0xb1, 0xb1, 0xd1, 0xd1, 0x84, 0xb1, 0x03, 0xd1, 0xb1, 0xad, 0x44,
+	0x85, 0x00, 0x00, 0x24, 0x92, 0x8d, 0x00, 0x89, 0x82, 0x68, 0x12, 0x8d, 0xb1, 0x91, 0x91, 0xb1,
+	0xb5, 0xb6, 0xd6, 0xd6, 0xb5, 0xb5, 0x91, 0x91, 0xb1, 0xb1, 0xb5, 0xb1, 0x91, 0xb1, 0x82, 0x24,
+	0x00, 0x20, 0x87, 0x00, 0x85, 0x24, 0x04, 0x6d, 0xb1, 0xad, 0xb1, 0xb1, 0x82, 0xad, 0x82, 0xb1,
+	0x00, 0xad, 0x92, 0xb1, 0x01, 0x69, 0x20, 0x85, 0x00, 0x00, 0x20, 0x8f, 0x8d, 0x00, 0x89, 0x84,
+	0x68, 0x04, 0x8d, 0x8d, 0xb2, 0xda, 0xda, 0x82, 0xfa, 0x03, 0xda, 0xfa, 0xda, 0xd6, 0x83, 0xb5,
+	0x03, 0xb1, 0xb5, 0xb5, 0x91, 0x84, 0x24, 0x87, 0x00, 0x08, 0x24, 0x24, 0x25, 0x49, 0x24, 0x44,
+	0x89, 0x88, 0x88, 0x82, 0x89, 0x83, 0x8d, 0x01, 0xad, 0xad, 0x84, 0xb1, 0x8b, 0xad, 0x01, 0x8d,
+	0x69, 0x86, 0x00, 0x00, 0x20, 0x87, 0x8d, 0x01, 0x89, 0x8d, 0x82, 0x89, 0x00, 0x69, 0x87, 0x68,
+	0x06, 0x69, 0x6d, 0xd6, 0xff, 0xfb, 0xff, 0xfb, 0x83, 0xda, 0x08, 0xd6, 0xd6, 0xb6, 0xb5, 0xb5,
+	0xb1, 0xb5, 0xb1, 0x91, 0x03, 0x44, 0x44, 0x24, 0x24, 0x86, 0x00, 0x83, 0x24, 0x05, 0x29, 0x25,
+	0x24, 0x44, 0x8d, 0x8d, 0x83, 0x68, 0x00, 0x8d, 0x86, 0xb1, 0x8e, 0xad, 0x02, 0x8d, 0x69, 0x20,
+	0x85, 0x00, 0x01, 0x44, 0x89, 0x88, 0x68, 0x05, 0x64, 0x64, 0x68, 0x68, 0x44, 0x44, 0x85, 0x68,
+	0x05, 0x8d, 0xda, 0xff, 0xfb, 0xfb, 0xdb, 0x84, 0xda, 0x02, 0xb5, 0xb5, 0xb6, 0x82, 0xb5, 0x82,
+	0xb1, 0x02, 0x48, 0x44, 0x24, 0x87, 0x00, 0x82, 0x24, 0x07, 0x25, 0x29, 0x49, 0x45, 0x49, 0xb2,
+	0xd6, 0xd2, 0x82, 0xd6, 0x06, 0xd2, 0xd1, 0xd2, 0xd6, 0xd6, 0xb1, 0xb1, 0x8d, 0xad, 0x83, 0x8d,
+	0x00, 0x44, 0x84, 0x00, 0x03, 0x20, 0x48, 0x44, 0x64, 0x85, 0x44, 0x00, 0x64, 0x84, 0x68, 0x01,
+	0x44, 0x48, 0x83, 0x68, 0x02, 0x69, 0x68, 0xb2, 0x83, 0xfb, 0x00, 0xdb, 0x82, 0xda, 0x01, 0xd6,
+	0xd6, 0x84, 0xb5, 0x82, 0xb1, 0x00, 0x91, 0x01, 0x44, 0x24, 0x88, 0x00, 0x82, 0x24, 0x08, 0x25,
+	0x49, 0x49, 0x45, 0x24, 0x69, 0xb1, 0xad, 0xad, 0x83, 0x8d, 0x82, 0xad, 0x83, 0x8d, 0x84, 0xad,
+	0x85, 0x8d, 0x04, 0x89, 0x89, 0x68, 0x68, 0x44, 0x84, 0x00, 0x01, 0x20, 0x44, 0x8b, 0x68, 0x03,
+	0x69, 0x69, 0x68, 0x44, 0x85, 0x68, 0x05, 0x8d, 0xda, 0xdb, 0xda, 0xff, 0xfb, 0x82, 0xda, 0x05,
+	0xb6, 0xd6, 0xd6, 0xb5, 0xb1, 0xb1, 0x83, 0xb5, 0x01, 0x91, 0x8d, 0x00, 0x20, 0x86, 0x00, 0x08,
+	0x24, 0x00, 0x00, 0x24, 0x49, 0x25, 0x24, 0x24, 0x25, 0x82, 0x24, 0x01, 0x68, 0x69, 0x87, 0x68,
+	0x01, 0x89, 0x8d, 0x82, 0xad, 0x84, 0x8d, 0x83, 0x89, 0x82, 0x68, 0x08, 0x64, 0x44, 0x24, 0x00,
+	0x00, 0x24, 0x24, 0x44, 0x48, 0x84, 0x68, 0x8a, 0x44, 0x01, 0x48, 0x48, 0x83, 0x68, 0x0d, 0x8d,
+	0xd6, 0xff, 0xda, 0xda, 0xfb, 0xfb, 0xda, 0xda, 0xd6, 0xb1, 0xb6, 0xb5, 0xb1, 0x82, 0xb5, 0x04,
+	0xb1, 0xb5, 0xb1, 0xb1, 0x91
+};
 
+const ASSET_Bitmap_t bitmaps[] = {
+	{32, 32, ASSET_FMT_1BPP, 0, sizeof(bitmap_arrow_N), bitmap_arrow_N, palette_arrow},
+	{32, 32, ASSET_FMT_1BPP, 0, sizeof(bitmap_arrow_N), bitmap_arrow_N, palette_arrow, ASSET_ROT_270},
+	{32, 32, ASSET_FMT_1BPP, 0, sizeof(bitmap_arrow_N), bitmap_arrow_N, palette_arrow, ASSET_ROT_180},
+	{32, 32, ASSET_FMT_1BPP, 0, sizeof(bitmap_arrow_N), bitmap_arrow_N, palette_arrow, ASSET_ROT_90},
+	{32, 32, ASSET_FMT_4BPP, 0, sizeof(bitmap_smiley_blij), bitmap_smiley_blij, palette_smiley},
+	{32, 32, ASSET_FMT_4BPP, 0, sizeof(bitmap_smiley_boos), bitmap_smiley_boos, palette_smiley},
+	{100, 100, ASSET_FMT_RLE, ASSET_FLAG_OPAQUE, sizeof(bitmap_michiel), bitmap_michiel, 0},
+	{100, 100, ASSET_FMT_RLE, 0, sizeof(bitmap_franc), bitmap_franc, 0},
+	{100, 100, ASSET_FMT_RLE, ASSET_FLAG_OPAQUE, sizeof(bitmap_xander), bitmap_xander, 0},
+	{100, 100, ASSET_FMT_RLE, ASSET_FLAG_OPAQUE, sizeof(bitmap_piotr), bitmap_piotr, 0},
+	{100, 100, ASSET_FMT_RLE, ASSET_FLAG_OPAQUE, sizeof(bitmap_daniel), bitmap_daniel, 0},
+	{100, 100, ASSET_FMT_RLE, ASSET_FLAG_OPAQUE, sizeof(bitmap_tom), bitmap_tom, 0}
+};
 
+#define BITMAP_COUNT (sizeof(bitmaps)/sizeof(bitmaps[0]))
 
+// Bitmap names, bitmap,<name>,x,y draws bitmap_names[n]
+const char * const bitmap_names[] = {
+	"arrow_N",
+	"arrow_W",
+	"arrow_S",
+	"arrow_E",
+	"smiley_blij",
+	"smiley_boos",
+	"michiel",
+	"franc",
+	"xander",
+	"piotr",
+	"daniel",
+	"tom"
 };
 
-const char* bitmaps[] = {bitmap_arrow_N, bitmap_arrow_W,bitmap_arrow_S,bitmap_arrow_E, bitmap_smiley_blij, bitmap_smiley_boos,michiel_bitmap, franc_bitmap, xander_bitmap, piotr_bitmap, daniel_bitmap, tom_bitmap};
-	#endif /* INC_BITMAPS_H_ */
+#endif /* INC_BITMAPS_H_ */
@@ -0,0 +1,130 @@
+/**
+ * @file Blitter.h
+ * @brief DMA blitter header file
+ *
+ * This file contains the prototypes for the DMA2 memory-to-memory
+ * blitter. Rectangular fills and copies are queued and run row by row
+ * on DMA2 Stream0 while the CPU continues with the next command.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __BLITTER_H
+#define __BLITTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// --- Configuration ---
+#define BLIT_QUEUE_SIZE		16 // Number of jobs that can be waiting
+
+// Job status for the callback
+#define BLIT_DONE			0 // All rows were transferred
+#define BLIT_ERROR			1 // DMA transfer or FIFO error, the job was dropped
+
+// Job types
+#define BLIT_JOB_FILL		0 // Fill a rectangle with one color
+#define BLIT_JOB_COPY		1 // Copy a rectangle (bitmap rows or screen data)
+
+/**
+ * @brief Function called from the DMA interrupt when a job has completed or was dropped.
+ * @param context Pointer given when the job was queued.
+ * @param status BLIT_DONE or BLIT_ERROR.
+ */
+typedef void (*BLIT_Callback_t)(void *context, int status);
+
+/**
+ * @brief One queued blitter job.
+ */
+typedef struct {
+	uint8_t type;				/**< BLIT_JOB_FILL or BLIT_JOB_COPY */
+	uint8_t color;				/**< Fill color, also the DMA source for fills */
+	uint16_t width;				/**< Bytes per row */
+	uint16_t height;			/**< Number of rows */
+	uint16_t src_stride;		/**< Bytes between two source rows */
+	uint16_t dst_stride;		/**< Bytes between two destination rows */
+	const uint8_t *src;			/**< First source byte (copy) */
+	uint8_t *dst;				/**< First destination byte */
+	BLIT_Callback_t callback;	/**< Completion callback, may be NULL */
+	void *context;				/**< Argument for the callback */
+} BLIT_Job_t;
+
+/**
+ * @brief Initializes DMA2 Stream0 for memory-to-memory transfers.
+ *
+ * The stream runs at low priority so the VGA scan-out on Stream5
+ * always wins the DMA2 arbitration.
+ */
+void BLIT_Init(void);
+
+/**
+ * @brief Queues a filled rectangle in the 8 bpp framebuffer.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param color 8-bit fill color.
+ * @param callback Completion callback, may be NULL.
+ * @param context Argument for the callback.
+ * @return 0 if the job was queued, otherwise returns 1.
+ *
+ * The rectangle is clipped to the clip rectangle of the driver (UB_VGA_SetClip),
+ * nothing is queued if it is completely outside.
+ */
+int BLIT_Fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color,
+			  BLIT_Callback_t callback, void *context);
+
+/**
+ * @brief Queues a copy of opaque bitmap rows into the 8 bpp framebuffer.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param pixels Pointer to the row-major pixel data.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param callback Completion callback, may be NULL.
+ * @param context Argument for the callback.
+ * @return 0 if the job was queued, otherwise returns 1.
+ *
+ * Like BLIT_Fill() the copy is clipped to the clip rectangle of the driver.
+ */
+int BLIT_Bitmap(uint16_t x, uint16_t y, const uint8_t *pixels, uint16_t width, uint16_t height,
+				BLIT_Callback_t callback, void *context);
+
+/**
+ * @brief Queues a generic rectangular memory copy.
+ * @param dst First destination byte.
+ * @param dst_stride Bytes between two destination rows.
+ * @param src First source byte.
+ * @param src_stride Bytes between two source rows.
+ * @param width Bytes per row.
+ * @param height Number of rows.
+ * @param callback Completion callback, may be NULL.
+ * @param context Argument for the callback.
+ * @return 0 if the job was queued, otherwise returns 1.
+ *
+ * @warning Source and destination must not overlap and must not be in CCMRAM.
+ */
+int BLIT_Copy(uint8_t *dst, uint16_t dst_stride, const uint8_t *src, uint16_t src_stride,
+			  uint16_t width, uint16_t height, BLIT_Callback_t callback, void *context);
+
+/**
+ * @brief Checks whether jobs are still running or waiting.
+ * @return true if the blitter is busy.
+ */
+bool BLIT_Busy(void);
+
+/**
+ * @brief Waits until all queued jobs have completed.
+ *
+ * Must be called before the CPU draws to the framebuffer,
+ * so CPU pixels are not overwritten by older DMA jobs.
+ */
+void BLIT_Wait(void);
+
+/**
+ * @brief DMA2 Stream0 Interrupt Service Routine (ISR).
+ */
+void DMA2_Stream0_IRQHandler(void);
+
+#endif /* __BLITTER_H */
@@ -0,0 +1,78 @@
+/**
+ * @file Cache.h
+ * @brief Asset cache header file
+ *
+ * This file contains the prototypes for the RAM asset cache.
+ * Bitmaps uploaded by the host are kept in numbered (or named) slots
+ * in CCMRAM, so an icon that is drawn every frame is sent only once.
+ * When the pool or the slot table is full the least recently used
+ * slot is evicted.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __CACHE_H
+#define __CACHE_H
+
+#include <stdint.h>
+#include "Assets.h"
+
+// --- Configuration ---
+#define CACHE_POOL_SIZE		32768 // Bytes in CCMRAM for bitmap data
+#define CACHE_SLOTS			16 // Number of slots
+#define CACHE_NAME_LEN		12 // Max. length of a slot name (incl. 0)
+#define CACHE_ID_BASE		100 // Bitmap number of slot 0 (bitmap,100,... draws slot 0)
+
+/**
+ * @brief Cache counters.
+ */
+typedef struct {
+	uint32_t hits;				/**< Draws from a loaded slot */
+	uint32_t misses;			/**< Draws from an empty or evicted slot */
+	uint32_t evictions;			/**< Slots evicted to make room */
+	uint32_t used;				/**< Bytes in use in the pool */
+	uint8_t slots;				/**< Number of loaded slots */
+} CACHE_Stats_t;
+
+/**
+ * @brief Clears all slots and the counters.
+ */
+void CACHE_Init(void);
+
+/**
+ * @brief Reserves a slot and starts the upload of its data.
+ * @param slot Slot number (0..CACHE_SLOTS-1), or -1 to select the slot by name.
+ * @param name Slot name, may be NULL for a numbered slot.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param format ASSET_FMT_...
+ * @param size Bytes that follow, paletted formats start with their palette (2 or 16 bytes).
+ * @return Slot number, or -1 if the slot or size is invalid (too small for the pixels of the format).
+ *
+ * The data follows with UPLOAD_Data(), the slot can be drawn once all bytes are received.
+ */
+int CACHE_Store(int slot, const char *name, uint16_t width, uint16_t height, uint8_t format, uint16_t size);
+
+/**
+ * @brief Finds a slot by name.
+ * @param name Slot name.
+ * @return Slot number, or -1 (counted as a miss) if the name is not loaded.
+ */
+int CACHE_Find(const char *name);
+
+/**
+ * @brief Returns the bitmap of a loaded slot and marks it as recently used.
+ * @param slot Slot number.
+ * @return Bitmap descriptor, or NULL (counted as a miss) if the slot is not loaded.
+ */
+const ASSET_Bitmap_t *CACHE_Get(int slot);
+
+/**
+ * @brief Reads the cache counters.
+ * @param stats Destination for the counters.
+ * @param reset Non-zero to clear hits, misses and evictions after reading.
+ */
+void CACHE_GetStats(CACHE_Stats_t *stats, int reset);
+
+#endif /* __CACHE_H */
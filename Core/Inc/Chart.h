@@ -0,0 +1,59 @@
+/**
+ * @file Chart.h
+ * @brief Strip chart header file
+ *
+ * This file contains the prototypes for the strip charts.
+ * A strip chart is a fixed region of the screen that plots one sample per
+ * column. New samples enter at the right: the region is shifted left in
+ * place (one memmove per row for all new samples together) and only the
+ * new columns are drawn, with the grid lines stamped again in them.
+ *
+ * The shift copies the pixels of the region, sprites over a chart are
+ * not restored first and move along with the plot.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __CHART_H
+#define __CHART_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define CHART_SLOTS			4 // Number of strip chart ids
+#define CHART_MAX_SAMPLES	64 // Samples per append call
+
+/**
+ * @brief Creates or replaces a strip chart and draws it empty.
+ * @param id Strip chart id (0..CHART_SLOTS-1).
+ * @param x Upper-left X-coordinate of the region.
+ * @param y Upper-left Y-coordinate of the region.
+ * @param width Width of the region, one sample per column.
+ * @param height Height of the region.
+ * @param min Sample value at the bottom row.
+ * @param max Sample value at the top row.
+ * @param color Color of the trace.
+ * @param background Color of the region.
+ * @param grid_color Color of the grid lines.
+ * @param grid Pixels between two grid lines, 0 for no grid.
+ * @return 0 if no errors occured, otherwise returns 1 (invalid id, region or scale).
+ */
+int CHART_Create(int id, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+				 int16_t min, int16_t max, uint8_t color, uint8_t background,
+				 uint8_t grid_color, uint8_t grid);
+
+/**
+ * @brief Appends samples, the plot scrolls left by one column per sample.
+ * @param id Strip chart id.
+ * @param samples Sample values, values outside min..max are drawn at the border.
+ * @param count Number of samples (1..CHART_MAX_SAMPLES).
+ * @return 0 if no errors occured, otherwise returns 1 (no chart or invalid count).
+ *
+ * The trace connects every sample to the previous one with a vertical run
+ * in its column. When more samples than columns are given only the last
+ * ones are drawn.
+ */
+int CHART_Append(int id, const int16_t *samples, uint16_t count);
+
+#endif /* __CHART_H */
@@ -0,0 +1,148 @@
+/**
+ * @file DisplayList.h
+ * @brief Display list header file
+ *
+ * This file contains the prototypes for the display lists.
+ * A display list is a recorded sequence of drawing commands. The commands
+ * are parsed once while recording and stored in binary form (numbers,
+ * colors and bitmap numbers already converted), so replaying a list costs
+ * no UART time and no parsing. A list can be replayed with an x/y offset,
+ * one template can be stamped in several places.
+ *
+ * One list can be written to flash as boot script, it is drawn at
+ * power-on before the host sends anything.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __DISPLAYLIST_H
+#define __DISPLAYLIST_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define DL_LISTS			8 // Number of display list ids
+#define DL_POOL_SIZE		4096 // Bytes for all recorded commands
+#define DL_MAX_ARGS			12 // Parameters per command
+#define DL_TEXT_LEN			64 // Bytes for the strings of one command (incl. 0)
+#define DL_NONE				((int16_t)0x8000) // Optional parameter that was not given
+#define DL_BOOT_SECTOR		11 // Flash sector of the boot script (not used by the linker scripts)
+#define DL_BOOT_ADDR		0x080E0000 // Start of flash sector 11 (128K)
+#define DL_BOOT_MAGIC		0x31424C44 // "DLB1"
+
+// --- Commands that can be recorded ---
+#define DL_OP_PIXEL			0
+#define DL_OP_LINE			1
+#define DL_OP_RECT			2
+#define DL_OP_CIRCLE		3
+#define DL_OP_FIGURE		4
+#define DL_OP_TEXT			5
+#define DL_OP_BITMAP		6
+#define DL_OP_BITMAP_EX		7
+#define DL_OP_CLEAR			8
+
+/**
+ * @brief Parameter layout of a command that can be recorded.
+ *
+ * Every character of the layout is one parameter, upper case is optional:
+ * x / y coordinate (moved by the replay offset), n number, c color,
+ * b bitmap number or name, m mirror (h, v or hv), s string.
+ */
+typedef struct {
+	const char *name;			/**< Command name, e.g. "lijn" */
+	uint8_t op;					/**< DL_OP_... */
+	const char *layout;			/**< Parameter layout */
+} DL_Op_t;
+
+/**
+ * @brief One parsed command.
+ */
+typedef struct {
+	uint8_t op;					/**< DL_OP_... */
+	uint8_t argc;				/**< Number of parameters */
+	uint8_t text_len;			/**< Bytes used in text */
+	int16_t arg[DL_MAX_ARGS];	/**< Parameters, strings hold their offset in text */
+	char text[DL_TEXT_LEN];		/**< Strings, each 0-terminated */
+} DL_Cmd_t;
+
+/**
+ * @brief Boot script size and the time to the first frame.
+ */
+typedef struct {
+	uint32_t script;			/**< Bytes of the boot script in flash, 0 if none */
+	uint8_t played;				/**< 1 if the script was played at power-on */
+	uint32_t drawn_us;			/**< Microseconds from the end of SystemInit() until the script was drawn */
+	uint32_t frame;				/**< First frame that shows the script */
+} DL_BootStats_t;
+
+/**
+ * @brief Looks up a command that can be recorded.
+ * @param name Command name.
+ * @return Command layout, or NULL if the command can not be recorded.
+ */
+const DL_Op_t *LIST_FindOp(const char *name);
+
+/**
+ * @brief Starts recording a display list, an existing list with this id is replaced.
+ * @param id Display list id (0..DL_LISTS-1).
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int LIST_Record(int id);
+
+/**
+ * @brief Adds one parsed command to the list that is recorded.
+ * @param cmd Parsed command.
+ * @return 0 if no errors occured, otherwise returns the error code (ERR_LIST_FULL).
+ */
+int LIST_Add(const DL_Cmd_t *cmd);
+
+/**
+ * @brief Stops recording.
+ * @return 0 if no errors occured, otherwise returns the error code (no recording).
+ */
+int LIST_Stop(void);
+
+/**
+ * @brief Returns whether a display list is recorded.
+ * @return 1 while recording, otherwise 0.
+ */
+int LIST_Recording(void);
+
+/**
+ * @brief Replays a display list.
+ * @param id Display list id.
+ * @param dx Offset added to every X-coordinate.
+ * @param dy Offset added to every Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns the first error code
+ *         (the other commands are still drawn).
+ */
+int LIST_Play(int id, int dx, int dy);
+
+/**
+ * @brief Writes a display list to flash as boot script, or erases the boot script.
+ * @param id Display list id, -1 only erases the boot script (other negative ids are invalid).
+ * @return 0 if no errors occured, otherwise returns the error code.
+ *
+ * The sector erase takes one to two seconds. Every flash read stalls
+ * meanwhile, including the fetches of the VGA interrupt handlers: the
+ * scan-out and the VSync pulses stop, so the monitor loses sync and
+ * needs a moment to find it again after the erase.
+ */
+int LIST_SaveBoot(int id);
+
+/**
+ * @brief Plays the boot script from flash, if one was written.
+ * @return 0 if the script was played, 1 if there is no valid boot script.
+ *
+ * Called once at power-on, after the fonts and caches are initialized.
+ */
+int LIST_Boot(void);
+
+/**
+ * @brief Returns the boot script size and the time to the first frame.
+ * @param stats Destination for the numbers.
+ */
+void LIST_GetBootStats(DL_BootStats_t *stats);
+
+#endif /* __DISPLAYLIST_H */
@@ -0,0 +1,129 @@
+/**
+ * @file Font.h
+ * @brief Font registry header file
+ *
+ * This file contains the prototypes for the font registry.
+ * Every font has a fixed id: the fonts compiled into fonts.h take the
+ * first ids, the other ids are slots for fonts uploaded over UART.
+ * A font is found by id with one table index.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __FONT_H
+#define __FONT_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define FONT_SLOTS			8 // Number of font ids
+#define FONT_BUILTIN		3 // Ids 0..2 are the fonts in fonts.h
+#define FONT_STORE_SIZE		16384 // Bytes in CCMRAM for uploaded glyphs
+#define FONT_MAX_GLYPHS		96 // Glyphs per font (ASCII 32..127)
+#define FONT_NAME_LEN		12 // Max. length of a font name (incl. 0)
+
+// Built-in font ids
+#define FONT_CONSOLAS		0
+#define FONT_COMICSANS		1
+#define FONT_ARIAL			2
+
+// Glyph formats
+#define FONT_FMT_NONE		0 // Empty slot
+#define FONT_FMT_GLCD		1 // MikroE GLCD: width, then 2 bytes (16 rows) per column
+#define FONT_FMT_PACKED		2 // Row-major 1 bpp per glyph, MSB is the left pixel
+
+/**
+ * Uploaded font blob (FONT_FMT_PACKED):
+ * - byte 0 : glyph height in pixels
+ * - byte 1 : first character code
+ * - byte 2 : number of glyphs
+ * - byte 3 : spacing in pixels after every glyph
+ * - then one width byte per glyph
+ * - then the glyphs, each height rows of (width+7)/8 bytes
+ */
+#define FONT_BLOB_HEADER	4
+
+/**
+ * @brief Font descriptor.
+ */
+typedef struct {
+	uint8_t format;				/**< FONT_FMT_... */
+	uint8_t height;				/**< Glyph height in pixels */
+	uint8_t first;				/**< First character code */
+	uint8_t count;				/**< Number of glyphs */
+	uint8_t spacing;			/**< Pixels between two glyphs */
+	uint16_t stride;			/**< GLCD: values per glyph */
+	const unsigned short *glcd;	/**< GLCD: glyph table */
+	const uint8_t *widths;		/**< PACKED: width per glyph */
+	const uint8_t *bitmap;		/**< PACKED: glyph data */
+	uint16_t offsets[FONT_MAX_GLYPHS]; /**< PACKED: start of every glyph in bitmap */
+	char name[FONT_NAME_LEN];	/**< Name, empty if the font has no name */
+} FONT_t;
+
+/**
+ * @brief Registers the built-in fonts and clears the upload slots.
+ */
+void FONT_Init(void);
+
+/**
+ * @brief Returns a font by id.
+ * @param id Font id (0..FONT_SLOTS-1).
+ * @return Font descriptor, or NULL if the slot is empty.
+ */
+const FONT_t *FONT_Get(int id);
+
+/**
+ * @brief Finds a font by id ("3") or by name ("consolas").
+ * @param str Id or name, leading spaces are skipped.
+ * @return Font descriptor, or NULL if the font does not exist.
+ */
+const FONT_t *FONT_Find(const char *str);
+
+/**
+ * @brief Finds the id of a font by id ("3") or by name ("consolas").
+ * @param str Id or name, leading spaces are skipped.
+ * @return Font id, or -1 if the font does not exist.
+ *
+ * Kept by objects that draw later: the descriptor of an id changes when its font is uploaded again.
+ */
+int FONT_FindId(const char *str);
+
+/**
+ * @brief Returns the width of a glyph.
+ * @param font Font descriptor.
+ * @param c Character code.
+ * @return Width in pixels, 0 if the font has no glyph for c.
+ */
+uint8_t FONT_GlyphWidth(const FONT_t *font, char c);
+
+/**
+ * @brief Returns the data of a glyph.
+ * @param font Font descriptor.
+ * @param c Character code.
+ * @return GLCD: pointer to the glyph (unsigned short), PACKED: pointer to the rows, NULL if no glyph.
+ */
+const void *FONT_Glyph(const FONT_t *font, char c);
+
+/**
+ * @brief Renders the left 8 columns of a glyph as rows of one byte.
+ * @param font Font descriptor.
+ * @param c Character code.
+ * @param rows Destination, one byte per row with the MSB as the left pixel.
+ * @param height Number of rows, rows below the glyph are cleared.
+ * @return 0 if no errors occured, otherwise returns 1 (no glyph, all rows cleared).
+ */
+int FONT_GlyphRows(const FONT_t *font, char c, uint8_t *rows, uint8_t height);
+
+/**
+ * @brief Reserves an upload slot and starts the upload of a font blob.
+ * @param id Font id (FONT_BUILTIN..FONT_SLOTS-1).
+ * @param name Font name, may be NULL.
+ * @param size Size of the blob in bytes.
+ * @return 0 if the upload was started, otherwise returns 1.
+ *
+ * The blob follows with UPLOAD_Data(), the font can be used once all bytes are received.
+ */
+int FONT_Store(int id, const char *name, uint16_t size);
+
+#endif /* __FONT_H */
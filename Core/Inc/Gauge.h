@@ -0,0 +1,68 @@
+/**
+ * @file Gauge.h
+ * @brief Gauge widget header file
+ *
+ * This file contains the prototypes for the gauges.
+ * A gauge is a round dial with ticks, a label and a needle over a sweep
+ * of 270 degrees. The needle end points are kept in a table per angle
+ * step; the pixels of the dial under the needle are saved when it is
+ * drawn, so moving the needle only restores those pixels and draws the
+ * new needle. The dial itself is drawn once.
+ *
+ * Drawings over a gauge are not known to it: a needle that moves
+ * restores the dial pixels that were under it.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __GAUGE_H
+#define __GAUGE_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define GAUGE_SLOTS			4 // Number of gauge ids
+#define GAUGE_STEPS			136 // Needle angles over the sweep (2 degrees per step)
+#define GAUGE_SWEEP			270 // Degrees from the minimum to the maximum
+#define GAUGE_MIN_RADIUS	12 // Smallest dial radius
+#define GAUGE_MAX_RADIUS	100 // Largest dial radius (sets the saved pixels per needle)
+#define GAUGE_TICKS			10 // Tick intervals over the sweep
+#define GAUGE_LABEL_LEN		16 // Max. length of the label (incl. 0)
+
+/**
+ * @brief Creates or replaces a gauge and draws the dial with the needle at the minimum.
+ * @param id Gauge id (0..GAUGE_SLOTS-1).
+ * @param x X-coordinate of the center.
+ * @param y Y-coordinate of the center.
+ * @param radius Radius of the dial.
+ * @param min Value at the start of the sweep.
+ * @param max Value at the end of the sweep.
+ * @param color Color of the ring, ticks and label.
+ * @param background Color of the dial.
+ * @param needle_color Color of the needle and the hub.
+ * @param label Text under the center, may be NULL.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int GAUGE_Set(int id, int x, int y, int radius, int min, int max,
+			  int color, int background, int needle_color, const char *label);
+
+/**
+ * @brief Moves the needle of a gauge.
+ * @param id Gauge id.
+ * @param value New value, clamped to min..max.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ *
+ * Only the old needle pixels are restored and the new needle is drawn,
+ * nothing happens when the value falls on the same angle step.
+ */
+int GAUGE_Value(int id, int value);
+
+/**
+ * @brief Forgets all gauges, the screen is not changed.
+ *
+ * Called when the screen is cleared.
+ */
+void GAUGE_Reset(void);
+
+#endif /* __GAUGE_H */
@@ -29,6 +29,13 @@
  */
 int CmdToFunc(char *cmd);
 
+/**
+ * @brief Parses a drawing command into its binary form and adds it to the recorded display list.
+ * @param token Command name, the parameters are read with strtok().
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int CmdToList(char *token);
+
 /**
  * @brief Translates a color string to a color code.
  * @param cmd Pointer to the color string buffer.
@@ -36,6 +43,13 @@ int CmdToFunc(char *cmd);
  */
 uint8_t StrToCol (char *str);
 
+/**
+ * @brief Translates a bitmap format string to a format code.
+ * @param str Pointer to the format string buffer ("raw", "rle", "1bpp" or "4bpp").
+ * @return ASSET_FMT_... if no errors occured, otherwise returns -1.
+ */
+int StrToFormat (char *str);
+
 /**
  * @brief Checks whether x coordinate is out of bounds.
  * @param x coordinate.
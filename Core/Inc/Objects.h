@@ -0,0 +1,101 @@
+/**
+ * @file Objects.h
+ * @brief Retained object table header file
+ *
+ * This file contains the prototypes for the retained objects.
+ * An object is a line, rectangle, circle, text or bitmap that is kept in
+ * a table by id. Moving, recoloring or deleting an object only redraws the
+ * damaged rectangle: the clip rectangle of the driver is set to it, the
+ * scene background is filled and the objects that intersect it are drawn
+ * again in z-order (a higher id is drawn on top).
+ *
+ * Pixels drawn by the immediate commands are not in the table, a damaged
+ * rectangle shows the scene background there. Sprites float over the
+ * objects and are not part of the redraw.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __OBJECTS_H
+#define __OBJECTS_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define OBJ_SLOTS			32 // Number of object ids
+#define OBJ_TEXT_LEN		32 // Max. length of the text of a text object (incl. 0)
+#define OBJ_FONT_LEN		12 // Max. length of the font name (incl. 0)
+
+// --- Object types ---
+#define OBJ_NONE			0 // Empty slot
+#define OBJ_LINE			1 // x, y to a, b with weight
+#define OBJ_RECT			2 // x, y, width a, height b, filled, weight and border color
+#define OBJ_CIRCLE			3 // Center x, y and radius a
+#define OBJ_TEXT			4 // Text at x, y, font size a, style
+#define OBJ_BITMAP			5 // Bitmap number a at x, y
+
+/**
+ * @brief One retained object.
+ */
+typedef struct {
+	uint8_t type;				/**< OBJ_... */
+	uint8_t color;				/**< Color, for bitmaps the primary color (0x01: unchanged) */
+	int16_t x;					/**< Upper-left X-coordinate, line start or circle center */
+	int16_t y;					/**< Upper-left Y-coordinate, line start or circle center */
+	int16_t a;					/**< Line end X, width, radius, font size or bitmap number */
+	int16_t b;					/**< Line end Y or height */
+	uint8_t weight;				/**< Line or border weight */
+	uint8_t filled;				/**< Rectangle is filled */
+	uint8_t border;				/**< Border color of a filled rectangle */
+	uint8_t style;				/**< Text style: 1 normal, 2 bold, 3 italic */
+	char text[OBJ_TEXT_LEN];	/**< Text of a text object */
+	char font[OBJ_FONT_LEN];	/**< Font id or name of a text object */
+} OBJ_t;
+
+/**
+ * @brief Creates or replaces an object and draws it.
+ * @param id Object id (0..OBJ_SLOTS-1), also the z-order.
+ * @param obj Object description, copied into the table.
+ * @return 0 if no errors occured, otherwise returns the error code
+ *         (ERR_OBJECT_INVALID or the error of the draw function).
+ *
+ * An object that cannot be drawn is not stored.
+ */
+int OBJ_Set(int id, const OBJ_t *obj);
+
+/**
+ * @brief Moves an object, only the old and new rectangles are redrawn.
+ * @param id Object id.
+ * @param x New X-coordinate (line start, upper-left or center).
+ * @param y New Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ *
+ * A line keeps its length and direction.
+ */
+int OBJ_Move(int id, int x, int y);
+
+/**
+ * @brief Gives an object a new color, only its rectangle is redrawn.
+ * @param id Object id.
+ * @param color New 8-bit color.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int OBJ_Color(int id, int color);
+
+/**
+ * @brief Deletes an object, its rectangle is redrawn without it.
+ * @param id Object id.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int OBJ_Delete(int id);
+
+/**
+ * @brief Forgets all objects, the screen is not changed.
+ * @param color Scene background, used to fill damaged rectangles.
+ *
+ * Called when the screen is cleared.
+ */
+void OBJ_Reset(int color);
+
+#endif /* __OBJECTS_H */
@@ -0,0 +1,69 @@
+/**
+ * @file SevenSeg.h
+ * @brief Seven-segment display header file
+ *
+ * This file contains the prototypes for the seven-segment displays.
+ * A display shows a signed number with a fixed number of digits. Every
+ * digit is built from seven rectangular segments and a decimal point,
+ * filled as rectangles at any height. The display keeps the segments
+ * that are lit, a new value only fills the segments that toggle.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __SEVENSEG_H
+#define __SEVENSEG_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define SEG_SLOTS			8 // Number of display ids
+#define SEG_MAX_DIGITS		10 // Digits per display
+#define SEG_MIN_HEIGHT		10 // Smallest digit height in pixels
+
+// --- Segment bits ---
+#define SEG_A				0x01 // Top
+#define SEG_B				0x02 // Upper right
+#define SEG_C				0x04 // Lower right
+#define SEG_D				0x08 // Bottom
+#define SEG_E				0x10 // Lower left
+#define SEG_F				0x20 // Upper left
+#define SEG_G				0x40 // Middle
+#define SEG_DP				0x80 // Decimal point
+
+/**
+ * @brief Creates or replaces a seven-segment display and draws it with all segments off.
+ * @param id Display id (0..SEG_SLOTS-1).
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param height Digit height, the width and segment thickness follow from it.
+ * @param digits Number of digits (1..SEG_MAX_DIGITS).
+ * @param color Color of a lit segment.
+ * @param off_color Color of an unlit segment (the background to hide them).
+ * @param background Color around the segments.
+ * @param decimals Digits after the decimal point, 0 for none.
+ * @param leading_zeros 1 to fill unused digits with zeros.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int SEG_Set(int id, int x, int y, int height, int digits, int color, int off_color,
+			int background, int decimals, int leading_zeros);
+
+/**
+ * @brief Shows a number on a seven-segment display, only the toggled segments are filled.
+ * @param id Display id.
+ * @param value Number, with the decimals as the last digits (1234 with 2 decimals is 12.34).
+ * @return 0 if no errors occured, otherwise returns the error code.
+ *
+ * A number that does not fit is shown as dashes.
+ */
+int SEG_Value(int id, int32_t value);
+
+/**
+ * @brief Forgets all seven-segment displays, the screen is not changed.
+ *
+ * Called when the screen is cleared.
+ */
+void SEG_Reset(void);
+
+#endif /* __SEVENSEG_H */
@@ -0,0 +1,74 @@
+/**
+ * @file Sprite.h
+ * @brief Sprite layer header file
+ *
+ * This file contains the prototypes for the sprite layer.
+ * A sprite is a bitmap with a position and a z-order that floats over
+ * the screen. The pixels under a sprite are saved before it is drawn,
+ * so a moved sprite only restores its old rectangle and draws the new
+ * one. Changes are collected and applied once per frame by SPRITE_Update().
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __SPRITE_H
+#define __SPRITE_H
+
+#include <stdint.h>
+#include "Assets.h"
+
+// --- Configuration ---
+#define SPRITE_SLOTS		16 // Number of sprite ids
+#define SPRITE_SAVE_SIZE	8192 // Bytes for the pixels under all sprites
+
+/**
+ * @brief Removes all sprites (without restoring the screen).
+ */
+void SPRITE_Init(void);
+
+/**
+ * @brief Creates or replaces a sprite.
+ * @param id Sprite id (0..SPRITE_SLOTS-1).
+ * @param bitnr Bitmap number (flash or cache slot), drawn with its own transform.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param z Z-order, higher is drawn on top (same z: higher id on top).
+ * @return 0 if no errors occured, otherwise returns 1 (invalid id or bitmap, or the save buffers are full).
+ *
+ * The bitmap is looked up again at every draw, a sprite whose cache slot
+ * was evicted is not drawn.
+ */
+int SPRITE_Set(int id, int bitnr, uint16_t x, uint16_t y, uint8_t z);
+
+/**
+ * @brief Moves a sprite.
+ * @param id Sprite id.
+ * @param x New upper-left X-coordinate.
+ * @param y New upper-left Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns 1 (no sprite with this id).
+ */
+int SPRITE_Move(int id, uint16_t x, uint16_t y);
+
+/**
+ * @brief Removes a sprite, the pixels under it are restored at the next update.
+ * @param id Sprite id.
+ * @return 0 if no errors occured, otherwise returns 1 (no sprite with this id).
+ */
+int SPRITE_Remove(int id);
+
+/**
+ * @brief Restores and redraws all sprites that changed since the last update.
+ *
+ * Called once per frame from the main loop.
+ */
+void SPRITE_Update(void);
+
+/**
+ * @brief Forgets the saved pixels, all sprites are drawn again at the next update.
+ *
+ * Called when the screen is cleared, the old pixels under the sprites are gone.
+ */
+void SPRITE_Invalidate(void);
+
+#endif /* __SPRITE_H */
@@ -0,0 +1,62 @@
+/**
+ * @file TextField.h
+ * @brief Text field header file
+ *
+ * This file contains the prototypes for the text fields.
+ * A text field is one line of text at a fixed place with its own font,
+ * color and background, e.g. a numeric readout. The field keeps the text
+ * on the screen and the x-position of every character, an update clears
+ * and draws only the character cells that changed. A character that keeps
+ * its glyph and its place is not touched.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __TEXTFIELD_H
+#define __TEXTFIELD_H
+
+#include <stdint.h>
+
+// --- Configuration ---
+#define FIELD_SLOTS			16 // Number of text field ids
+#define FIELD_TEXT_LEN		32 // Max. length of the text of a field (incl. 0)
+
+/**
+ * @brief Creates or replaces a text field, the field starts empty.
+ * @param id Text field id (0..FIELD_SLOTS-1).
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param color Text color.
+ * @param background Color of the cleared cells.
+ * @param fontname Font id or name.
+ * @param fontsize Font size multiplier.
+ * @param fontstyle "normaal", "vet" or "cursief".
+ * @return 0 if no errors occured, otherwise returns the error code.
+ *
+ * The text of a replaced field is cleared.
+ */
+int FIELD_Set(int id, int x, int y, int color, int background,
+			  char *fontname, int fontsize, char *fontstyle);
+
+/**
+ * @brief Shows a new text in a field, only the changed character cells are drawn.
+ * @param id Text field id.
+ * @param text New text, one line.
+ * @return 0 if no errors occured, otherwise returns the error code
+ *         (the field keeps its old text if the new one does not fit).
+ *
+ * The font is looked up by its id on every update: a font that is gone,
+ * or was uploaded again with another height, gives ERR_FONT_INVALID.
+ */
+int FIELD_Update(int id, const char *text);
+
+/**
+ * @brief Forgets the text of all fields, the screen is not changed.
+ *
+ * Called when the screen is cleared: the fields keep their place and
+ * font, the next update draws every character.
+ */
+void FIELD_Reset(void);
+
+#endif /* __TEXTFIELD_H */
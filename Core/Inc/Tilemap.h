@@ -0,0 +1,63 @@
+/**
+ * @file Tilemap.h
+ * @brief Tile map header file
+ *
+ * This file contains the prototypes for the tile maps.
+ * A tile map is a grid of cells on the screen, every cell holds the
+ * index of a tile. The tiles come from one tile set bitmap: the tiles
+ * are stacked from top to bottom, so tile n starts at row n * tile height.
+ * Changing a cell redraws only that cell.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __TILEMAP_H
+#define __TILEMAP_H
+
+#include <stdint.h>
+#include "Assets.h"
+
+// --- Configuration ---
+#define TILE_MAPS			4 // Number of tile map ids
+#define TILE_MAX_CELLS		1200 // Cells per map (a full screen of 8x8 tiles)
+#define TILE_EMPTY			0xFF // Cell index that only shows the background
+
+/**
+ * @brief Creates or replaces a tile map, all cells are empty.
+ * @param id Tile map id (0..TILE_MAPS-1).
+ * @param bitnr Bitmap number of the tile set (flash or cache slot), not run-length encoded.
+ * @param tile_height Height of one tile in the tile set.
+ * @param x Upper-left X-coordinate of the map.
+ * @param y Upper-left Y-coordinate of the map.
+ * @param columns Number of cells per row.
+ * @param rows Number of rows.
+ * @param background Color behind transparent tile pixels and empty cells.
+ * @return 0 if no errors occured, otherwise returns 1 (invalid id, tile set or size).
+ *
+ * The map is not drawn, use TILE_Draw() after the cells are set. The tile
+ * set is looked up again at every draw, nothing is drawn while its cache
+ * slot is evicted.
+ */
+int TILE_Create(int id, int bitnr, uint16_t tile_height,
+				uint16_t x, uint16_t y, uint8_t columns, uint8_t rows, uint8_t background);
+
+/**
+ * @brief Sets a number of cells and redraws the cells that changed.
+ * @param id Tile map id.
+ * @param column Column of the first cell.
+ * @param row Row of the first cell.
+ * @param indices Tile indices, cells are filled left to right and continue on the next row.
+ * @param count Number of indices.
+ * @return 0 if no errors occured, otherwise returns 1 (no map, cell outside the map or invalid index).
+ */
+int TILE_Set(int id, uint8_t column, uint8_t row, const uint8_t *indices, uint16_t count);
+
+/**
+ * @brief Draws all cells of a tile map.
+ * @param id Tile map id.
+ * @return 0 if no errors occured, otherwise returns 1 (no map).
+ */
+int TILE_Draw(int id);
+
+#endif /* __TILEMAP_H */
@@ -49,6 +49,17 @@ uint8_t usart2_receive_char(void);
  */
 void usart2_enable_rx_interrupt(void);
 
+/**
+ * @brief Disables the Receive Not Empty (RXNE) interrupt for USART2.
+ */
+void usart2_disable_rx_interrupt(void);
+
+/**
+ * @brief Drops the byte in the data register and clears an overrun.
+ * Used after the flash stalled and the received bytes could not be stored.
+ */
+void usart2_discard_rx(void);
+
 /**
  * @brief USART2 Interrupt Service Routine (ISR).
  * This function must be defined in the startup file's vector table.
@@ -0,0 +1,85 @@
+/**
+ * @file Upload.h
+ * @brief Image upload header file
+ *
+ * This file contains the prototypes for the image upload over UART.
+ * An image is sent as a QOI file ("Quite OK Image" format) in base64
+ * chunks. The chunks are decoded as they arrive and every completed
+ * row is written to the framebuffer, the whole file is never stored.
+ * The same chunks can also be copied into a buffer (asset cache).
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#ifndef __UPLOAD_H
+#define __UPLOAD_H
+
+#include <stdint.h>
+
+// Upload states
+#define UPLOAD_IDLE			0 // No upload active
+#define UPLOAD_HEADER		1 // Receiving the 14 byte QOI header
+#define UPLOAD_PIXELS		2 // Decoding pixel data
+#define UPLOAD_DONE			3 // All pixels written, end marker is ignored
+#define UPLOAD_STORE		4 // Copying raw bytes into a buffer (asset cache)
+
+// QOI format
+#define UPLOAD_QOI_MAGIC	0x716F6966 // "qoif"
+#define UPLOAD_QOI_HEADER	14 // Bytes in the header
+#define UPLOAD_QOI_INDEX	64 // Entries in the color index
+
+#define UPLOAD_QOI_OP_INDEX	0x00 // 00xxxxxx
+#define UPLOAD_QOI_OP_DIFF	0x40 // 01xxxxxx
+#define UPLOAD_QOI_OP_LUMA	0x80 // 10xxxxxx
+#define UPLOAD_QOI_OP_RUN	0xC0 // 11xxxxxx
+#define UPLOAD_QOI_OP_RGB	0xFE // 11111110
+#define UPLOAD_QOI_OP_RGBA	0xFF // 11111111
+#define UPLOAD_QOI_MASK_2	0xC0
+
+/**
+ * @brief Function called when a store upload has received all bytes.
+ * @param context Pointer given when the upload was started.
+ */
+typedef void (*UPLOAD_Callback_t)(void *context);
+
+/**
+ * @brief Starts a new upload, an active upload is aborted.
+ * @param x Upper-left X-coordinate of the image.
+ * @param y Upper-left Y-coordinate of the image.
+ * @param dither 1 to quantize with a 4x4 ordered dither, 0 to round.
+ *
+ * The image size is taken from the QOI header.
+ */
+void UPLOAD_Begin(uint16_t x, uint16_t y, uint8_t dither);
+
+/**
+ * @brief Starts an upload of raw bytes into a buffer, an active upload is aborted.
+ * @param dst Destination buffer.
+ * @param size Number of bytes expected.
+ * @param callback Called when all bytes are stored, may be NULL.
+ * @param context Argument for the callback.
+ */
+void UPLOAD_BeginStore(uint8_t *dst, uint32_t size, UPLOAD_Callback_t callback, void *context);
+
+/**
+ * @brief Decodes one base64 chunk of the upload.
+ * @param text Zero-terminated base64 text, may be split at any position.
+ * @return 0 if no errors occured, otherwise returns 1 (no upload, invalid data or image out of bounds).
+ *
+ * On an error the upload is aborted.
+ */
+int UPLOAD_Data(const char *text);
+
+/**
+ * @brief Aborts the active upload, following data is refused.
+ */
+void UPLOAD_Abort(void);
+
+/**
+ * @brief Returns the state of the upload.
+ * @return UPLOAD_IDLE, UPLOAD_HEADER, UPLOAD_PIXELS, UPLOAD_DONE or UPLOAD_STORE.
+ */
+uint8_t UPLOAD_State(void);
+
+#endif /* __UPLOAD_H */
@@ -18,6 +18,20 @@
 #include "stm32f4xx_dma.h"
 
 
+//--------------------------------------------------------------
+// cycle counter (DWT), started by UB_VGA_Screen_Init()
+// the CMSIS core header in Core/Inc (V2.10) has no DWT yet
+//--------------------------------------------------------------
+#ifndef DWT
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+#define DWT             ((DWT_Type *)0xE0001000)
+#endif
+
+
 
 //--------------------------------------------------------------
 // color designation
@@ -49,28 +63,127 @@
 #define VGA_DISPLAY_X   320
 #define VGA_DISPLAY_Y   240
 
+
+//--------------------------------------------------------------
+// framebuffer modes
+// 8BPP : one R3G3B2 byte per pixel, scanned out directly
+// 4BPP : two palette indices per byte (left pixel in the high
+//        nibble), two pages in VGA_RAM1, expanded per line
+//        into a DMA line buffer through VGA_PAL_LUT
+//--------------------------------------------------------------
+#define VGA_MODE_8BPP   0
+#define VGA_MODE_4BPP   1
+#define VGA_MODE_TEXT   2
+
+#define VGA_PAL_SIZE      16
+#define VGA_PAGE_STRIDE   (VGA_DISPLAY_X/2)                // 160 Byte
+#define VGA_PAGE_SIZE     (VGA_PAGE_STRIDE*VGA_DISPLAY_Y)  // 38400 Byte
+#define VGA_FLIP_FRAMES   2                                // FlipPage gives up after this many frames
+#define VGA_LINE_STRIDE   (VGA_DISPLAY_X+4)                // word aligned
+
+//--------------------------------------------------------------
+// text mode
+// TEXT : a grid of cells at the start of VGA_RAM1, two bytes per
+//        cell (glyph index, attribute). The attribute holds two
+//        palette indices (high nibble background, low nibble
+//        foreground). Every line is expanded from VGA_TEXT_FONT
+//        into a DMA line buffer, pixel drawing is switched off
+//--------------------------------------------------------------
+#define VGA_TEXT_CELL_W   8
+#define VGA_TEXT_CELL_H   12
+#define VGA_TEXT_COLS     (VGA_DISPLAY_X/VGA_TEXT_CELL_W)  // 40
+#define VGA_TEXT_ROWS     (VGA_DISPLAY_Y/VGA_TEXT_CELL_H)  // 20
+#define VGA_TEXT_FIRST    32                               // character of glyph 0
+#define VGA_TEXT_GLYPHS   96                               // ASCII 32..127
+
 //--------------------------------------------------------------
 // VGA Structure
 //--------------------------------------------------------------
 typedef struct {
-  uint16_t hsync_cnt;   // counter
-  uint32_t start_adr;   // start_adres
-  uint32_t dma2_cr_reg; // Register constant CR-Register
+  uint16_t hsync_cnt;   // last line done (line interrupt)
+  uint8_t mode;                  // framebuffer mode for drawing
+  uint8_t scan_mode;             // framebuffer mode latched at vsync
+  uint8_t draw_page;             // page written by SetPixel (4bpp)
+  volatile uint8_t show_page;    // page scanned out (4bpp)
+  volatile uint8_t flip_pending; // page flip requested for next vsync
+  uint32_t isr_cycles;           // CPU cycles in the VGA ISRs this frame
+  volatile uint32_t isr_load;    // CPU cycles in the VGA ISRs last frame
+  volatile uint32_t frame_cnt;   // frames output
+  uint16_t lat_min;              // line interrupt latency this frame (min)
+  uint16_t lat_max;              // line interrupt latency this frame (max)
+  volatile uint16_t jitter_min;  // line interrupt latency last frame (min)
+  volatile uint16_t jitter_max;  // line interrupt latency last frame (max)
+  volatile uint32_t underrun_cnt;// lines skipped by a late line interrupt
+  volatile uint32_t dma_err_cnt; // Stream5 transfer or direct mode errors
+  volatile uint16_t lat_peak;    // largest line interrupt latency since reset
+  uint16_t clip_x0;              // drawing clip rectangle, first column
+  uint16_t clip_y0;              // drawing clip rectangle, first line
+  uint16_t clip_x1;              // drawing clip rectangle, last column + 1
+  uint16_t clip_y1;              // drawing clip rectangle, last line + 1
 }VGA_t;
 extern VGA_t VGA;
 
 
 
+//--------------------------------------------------------------
+// dirty rectangles
+// every write to the screen merges its bounds into a small set
+// of rectangles, UB_VGA_DirtyFrame() closes the set once per
+// frame (x1 and y1 are exclusive)
+//--------------------------------------------------------------
+#define VGA_DIRTY_RECTS   8
+
+typedef struct {
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1;
+  uint16_t y1;
+}VGA_RECT_t;
+
+typedef struct {
+  VGA_RECT_t rect[VGA_DIRTY_RECTS];  // dirty rectangles of this frame
+  uint8_t cnt;                       // rectangles used this frame
+  uint8_t last;                      // rectangle merged last (fast path)
+  VGA_RECT_t done[VGA_DIRTY_RECTS];  // dirty rectangles of the last closed frame
+  uint8_t done_cnt;                  // rectangles of the last closed frame
+  uint32_t area_last;                // dirty pixels of the last closed frame
+  uint32_t area_peak;                // largest dirty area of one frame since reset
+  uint32_t area_sum;                 // dirty pixels since reset
+  uint32_t frames;                   // closed frames since reset
+  uint32_t dirty_frames;             // closed frames with a change since reset
+}VGA_DIRTY_t;
+extern VGA_DIRTY_t VGA_DIRTY;
+
+
+
 //--------------------------------------------------------------
 // Display RAM
 //--------------------------------------------------------------
 extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 
+//--------------------------------------------------------------
+// 4bpp mode tables
+// VGA_PAL       : palette index -> R3G3B2 color
+// VGA_PAL_LUT   : packed byte -> two R3G3B2 pixels (byte-pair LUT)
+// VGA_PAL_INDEX : R3G3B2 color -> nearest palette index
+//--------------------------------------------------------------
+extern uint8_t VGA_PAL[VGA_PAL_SIZE];
+extern uint16_t VGA_PAL_LUT[256];
+extern uint8_t VGA_PAL_INDEX[256];
+
+//--------------------------------------------------------------
+// text mode glyphs : one byte per glyph row, MSB is the left pixel
+//--------------------------------------------------------------
+extern uint8_t VGA_TEXT_FONT[VGA_TEXT_GLYPHS][VGA_TEXT_CELL_H];
+
 
 
 //--------------------------------------------------------------
 // Timer-1
 // Function  = Pixelclock (Speed for  DMA Transfer)
+//             gated by the pixel window of Timer4 (TRGO -> ITR3) :
+//             counts only in the window, so every line gets exactly
+//             VGA_DISPLAY_X+1 DMA requests at the same place
 //
 // basefreq = 2*APB2 (APB2=84MHz) => TIM_CLK=168MHz
 // Frq       = 168MHz/1/12 = 14MHz
@@ -78,13 +191,15 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 //--------------------------------------------------------------
 #define VGA_TIM1_PERIODE      10-1
 #define VGA_TIM1_PRESCALE      0
+#define VGA_TIM1_PHASE        ((VGA_TIM1_PERIODE+1)/2)  // counter at window start (update in the middle of a pixel)
 
 
 
 //--------------------------------------------------------------
 // Timer-2
 // Function  = CH4 : HSync-Signal on PB11
-//             CH3 : Trigger point for DMA start
+//             Update as TRGO : line clock for Timer3 and
+//                              start of the Timer4 pixel window
 //
 // basefreq = 2*APB1 (APB1=48MHz) => TIM_CLK=84MHz
 // Frq       = 84MHz/1/2668 = 31,48kHz => T = 31,76us
@@ -95,10 +210,44 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 #define  VGA_TIM2_HSYNC_PRESCALE     0
 
 #define  VGA_TIM2_HSYNC_IMP       240  // HSync-length (3,81us)
-#define  VGA_TIM2_HTRIGGER_START  480  // HSync+BackPorch (5,71us)
-#define  VGA_TIM2_DMA_DELAY       200  // ease the delay when DMA START (Optimization = none)
-									   //DMA delay not perfect jet
-//#define  VGA_TIM2_DMA_DELAY        30  // ease the delay when DMA START (Optimization = -O1)
+#define  VGA_TIM2_BACK_PORCH      120  // BackPorch (1,91us)
+
+// pixel window : VGA_DISPLAY_X+1 Timer1 periods (Timer1 runs at twice the Timer2 clock)
+//   start       = HSync + BackPorch   = 240 + 120      = 360
+//   length      = 321 * 10 / 2                         = 1605 (25,48us)
+//   end         = 360 + 1605                           = 1965
+//   FrontPorch  = 2002 - 1965                          = 37   (0,59us)
+#define  VGA_TIM2_PIXEL_TICKS     (((VGA_DISPLAY_X+1)*(VGA_TIM1_PERIODE+1))/2)
+#define  VGA_TIM2_PIXEL_START     (VGA_TIM2_HSYNC_IMP+VGA_TIM2_BACK_PORCH)
+#define  VGA_TIM2_PIXEL_END       (VGA_TIM2_PIXEL_START+VGA_TIM2_PIXEL_TICKS)
+
+
+//--------------------------------------------------------------
+// Timer-4
+// Function  = pixel window, started by Timer2 Update (TRGO -> ITR1)
+//             one pulse : counts 0..VGA_TIM2_PIXEL_END-1 and stops
+//             CH1 : PWM2 (no pin), high from VGA_TIM2_PIXEL_START
+//                   as TRGO, gate for Timer1
+//
+// same clock as Timer2, so the window is in Timer2 ticks
+//--------------------------------------------------------------
+
+
+//--------------------------------------------------------------
+// Timer-3
+// Function  = line counter, clocked by Timer2 Update (TRGO -> ITR1)
+//             CNT : number of the current line (0..524)
+//             CH1 : before the first picture line -> line interrupts on
+//             CH3 : VSync-Signal on PB0 (VGA_VSYNC_TIMER = 1)
+//             CH4 : end of VSync pulse on PB12 (VGA_VSYNC_TIMER = 0)
+//
+// The DMA runs in double buffer mode and is never stopped, its
+// Transfer Complete interrupt at the end of a line sets the
+// address of the line after next. After the last picture line
+// both buffers show a black line and the interrupt is switched off
+//--------------------------------------------------------------
+#define  VGA_VSYNC_TIMER           0   // 1 = VSync from TIM3 CH3 on PB0 (VSync wire on PB0)
+                                       // 0 = VSync on PB12, set in TIM3 ISR
 
 
 //--------------------------------------------------------------
@@ -110,8 +259,12 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 #define  VGA_VSYNC_IMP  2
 #define  VGA_VSYNC_BILD_START      36
 #define  VGA_VSYNC_BILD_STOP      514   // (16,38ms)
+#define  VGA_VSYNC_LINE_IRQ       (VGA_VSYNC_BILD_START-3)  // line interrupts on
 #define RAM_SIZE		(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y
 
+// CPU cycles per frame (TIM2 runs at half the CPU clock)
+#define  VGA_FRAME_CYCLES  ((uint32_t)VGA_VSYNC_PERIODE*(VGA_TIM2_HSYNC_PERIODE+1)*2)
+
 
 //--------------------------------------------------------------
 // Adress from PORTE (Reg ODR) callback DMA
@@ -136,6 +289,23 @@ extern uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
 void UB_VGA_Screen_Init(void);
 void UB_VGA_FillScreen(uint8_t color);
 void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color);
+void UB_VGA_FillSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t color);
+void UB_VGA_WriteSpan(uint16_t xp, uint16_t yp, uint16_t len, const uint8_t *src);
+void UB_VGA_WriteSpanKeyed(uint16_t xp, uint16_t yp, uint16_t len, const uint8_t *src, uint8_t key);
+void UB_VGA_ReadSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t *dst);
+void UB_VGA_CopyRect(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, uint16_t dx, uint16_t dy);
+void UB_VGA_SetClip(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height);
+void UB_VGA_ResetClip(void);
+void UB_VGA_SetMode(uint8_t mode);
+void UB_VGA_TextPut(uint8_t col, uint8_t row, char c, uint8_t attr);
+void UB_VGA_TextScroll(uint8_t lines, uint8_t attr);
+void UB_VGA_SetPalette(uint8_t index, uint8_t color);
+uint8_t UB_VGA_FlipPage(void);
+uint16_t UB_VGA_GetIsrLoad(void);
+void UB_VGA_ResetStats(void);
+void UB_VGA_MarkDirty(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height);
+void UB_VGA_DirtyFrame(void);
+uint8_t UB_VGA_GetDirty(VGA_RECT_t *rects);
 
 //--------------------------------------------------------------
 #endif // __STM32F4_UB_VGA_SCREEN_H
@@ -10,9 +10,20 @@
  */
 #include <API_LIB.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include "stm32_ub_vga_screen.h"
 #include "Bitmaps.h"
-#include "fonts.h"
+#include "Font.h"
+#include "Blitter.h"
+#include "Assets.h"
+#include "Upload.h"
+#include "Cache.h"
+#include "Sprite.h"
+#include "Tilemap.h"
+#include "Chart.h"
+
+static int text_row = 0; /**< Console row of the next API_text_line() (text mode) */
+
 /**
  * @brief Draws a filled circle on the VGA display.
  *
@@ -48,6 +59,8 @@ int API_draw_circle(int x0, int y0, int radius, int color, int reserved)
 		return ERR_OBJ_OUT_OF_BOUNDS;
 	if(radius<0)
 		return ERR_CIR_RADIUS_INVALID;
+
+	BLIT_Wait(); /**< Queued DMA fills must not overwrite the CPU pixels. */
     int x = radius;
     int y = 0;
     int decisionOver2 = 1 - x;  /**< Bresenham decision variable, distance between ideal circle. */
@@ -199,15 +212,25 @@ int API_draw_rectangle (int x, int y, int width, int height, int color, int fill
 
 	if(filled) // The width parameter is 0 or negative, resulting in an empty rectangle
 	{
-		for( i = x; i <= xEnd; i++)
+		/**< Fill in the background on DMA2, the CPU continues (or fills it itself when the queue is full). */
+		if (VGA.mode != VGA_MODE_8BPP || xEnd >= VGA_DISPLAY_X || yEnd >= VGA_DISPLAY_Y ||
+			BLIT_Fill(x, y, width, height, color, NULL, NULL) != 0)
 		{
-
-			for(j = y; j <= yEnd; j++)
+			BLIT_Wait();
+			for( i = x; i <= xEnd; i++)
 			{
-				UB_VGA_SetPixel(i, j, color);
+
+				for(j = y; j <= yEnd; j++)
+				{
+					UB_VGA_SetPixel(i, j, color);
+				}
 			}
 		}
 
+		/**< A thin border in the fill color would not change a pixel. */
+		if (bordercolor == color && weight <= 1)
+			return 0;
+
 		API_draw_line(x, y, x, yEnd, weight, bordercolor, 0); /**< Draw a borderline around the rectangle> */
 		API_draw_line(x, y, xEnd, y, weight, bordercolor, 0);
 		API_draw_line(xEnd, yEnd, x, yEnd, weight, bordercolor, 0);
@@ -216,6 +239,8 @@ int API_draw_rectangle (int x, int y, int width, int height, int color, int fill
 
 	else
 	{
+		BLIT_Wait();
+
 		/**<  Draw horizontal lines (Top and Bottom) */
 		for ( i = x; i <= xEnd; i++)
 		{
@@ -236,48 +261,118 @@ int API_draw_rectangle (int x, int y, int width, int height, int color, int fill
 /**
  * @brief Draws a bitmap on the screen at the specified upper-left position.
  *
- * This function takes a bitmap index from a global bitmap array and renders it
- * at the given (x, y) coordinates on the screen. Each bitmap is expected to have
- * the following format:
- * - bmp[0] = height of the bitmap in pixels
- * - bmp[1] = width of the bitmap in pixels
- * - bmp[2..] = pixel color data (row-major order)
+ * This function takes a bitmap index from the global bitmap table and renders it
+ * at the given (x, y) coordinates on the screen. Each table entry is an
+ * ASSET_Bitmap_t descriptor with the width, height and encoding of the pixel
+ * data, see Assets.h. Numbers from CACHE_ID_BASE select a cache slot.
  *
  * @param x_lup The x-coordinate of the upper-left pixel where the bitmap will be drawn.
  * @param y_lup The y-coordinate of the upper-left pixel where the bitmap will be drawn.
- * @param bitnr The index of the bitmap in the global `bitmaps` array.
+ * @param bitnr The index of the bitmap in the global `bitmaps` table, or CACHE_ID_BASE + slot.
  *
- * @note The function assumes that the `bitmaps` array and `UB_VGA_SetPixel` function
- *       are properly defined and accessible.
+ * @note Pixels with color 0x01 are transparent and are not drawn.
  */
 int API_draw_bitmap(int x_lup, int y_lup, int bitnr)
 {
-	if(bitnr<0||bitnr>12)
+	const ASSET_Bitmap_t* bmp;
+	int ErrorCode = _GetBitmap(bitnr, &bmp);/**< Select bitmap from argument. */
+	if(ErrorCode)
+		return ErrorCode;
+
+	uint16_t width, height;
+	ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+	if(x_lup<0||x_lup+width>VGA_DISPLAY_X||y_lup<0||y_lup+height>VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	if(ASSET_DrawBitmap(bmp, x_lup, y_lup)) /**< Decode straight into the framebuffer. */
 		return ERR_BITMAP_INVALID;
-	char bitmap_size;
-	if(bitnr<=5)
-	{
-		bitmap_size = 100;
-	}
-	else
+    return 0;
+}
+
+/**
+ * @brief Draws a bitmap with its primary color replaced.
+ *
+ * Paletted bitmaps (1 bpp and 4 bpp) are drawn with palette index 1
+ * replaced by @p color, so one icon can be drawn in every status color.
+ * Other bitmaps are drawn unchanged.
+ *
+ * @param x_lup The x-coordinate of the upper-left pixel where the bitmap will be drawn.
+ * @param y_lup The y-coordinate of the upper-left pixel where the bitmap will be drawn.
+ * @param bitnr The index of the bitmap in the global `bitmaps` table.
+ * @param color 8-bit color for the primary palette entry.
+ *
+ * @return 0 on success, or an error code if invalid parameters are passed.
+ */
+int API_draw_bitmap_color(int x_lup, int y_lup, int bitnr, int color)
+{
+	const ASSET_Bitmap_t* bmp;
+	int ErrorCode = _GetBitmap(bitnr, &bmp);
+	if(ErrorCode)
+		return ErrorCode;
+
+	uint16_t width, height;
+	ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+	if(x_lup<0||x_lup+width>VGA_DISPLAY_X||y_lup<0||y_lup+height>VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	if(ASSET_DrawBitmapColor(bmp, x_lup, y_lup, (uint8_t)color))
+		return ERR_BITMAP_INVALID;
+    return 0;
+}
+
+/**
+ * @brief Draws a bitmap scaled, rotated and/or mirrored.
+ *
+ * The source is sampled with incremental steps, so a larger or turned
+ * icon needs no extra asset.
+ *
+ * @param x_lup 	The x-coordinate of the upper-left pixel of the result.
+ * @param y_lup 	The y-coordinate of the upper-left pixel of the result.
+ * @param bitnr 	The index of the bitmap in the global `bitmaps` table, or CACHE_ID_BASE + slot.
+ * @param rotation 	Clockwise rotation in degrees (0, 90, 180 or 270).
+ * @param mirror 	0 = none, 1 = left-right, 2 = top-bottom, 3 = both (applied after the rotation).
+ * @param scale 	1..8 to enlarge, -2..-8 to shrink by that factor.
+ * @param color 	Color for palette index 1 of paletted bitmaps, -1 for the default palette.
+ *
+ * @return 0 on success, or an error code if invalid parameters are passed.
+ */
+int API_draw_bitmap_ex(int x_lup, int y_lup, int bitnr, int rotation, int mirror, int scale, int color)
+{
+	const ASSET_Bitmap_t* bmp;
+	int ErrorCode = _GetBitmap(bitnr, &bmp);
+	if(ErrorCode)
+		return ErrorCode;
+
+	if(rotation%90||rotation<0||rotation>270||mirror<0||mirror>3)
+		return ERR_TRANSFORM_INVALID;
+	if(scale==0||scale>ASSET_SCALE_MAX||scale<-ASSET_SCALE_MAX)
+		return ERR_TRANSFORM_INVALID;
+
+	uint8_t transform = rotation/90;
+	if(mirror & 0x01)
+		transform = ASSET_Compose(transform, ASSET_FLIP_H);
+	if(mirror & 0x02)
+		transform = ASSET_Compose(transform, ASSET_FLIP_V);
+
+	uint16_t width, height;
+	ASSET_GetSize(bmp, transform, scale, &width, &height);
+	if(width==0||height==0)
+		return ERR_TRANSFORM_INVALID;
+	if(x_lup<0||x_lup+width>VGA_DISPLAY_X||y_lup<0||y_lup+height>VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	// Replace the primary color of a paletted bitmap
+	uint8_t palette[16];
+	const uint8_t *pal = NULL;
+	if(color>=0 && bmp->palette)
 	{
-		bitmap_size = 32;
+		memcpy(palette, bmp->palette, (bmp->format==ASSET_FMT_1BPP) ? 2 : 16);
+		palette[ASSET_PAL_PRIMARY] = color;
+		pal = palette;
 	}
-	if(x_lup<0||x_lup+bitmap_size>VGA_DISPLAY_X||y_lup<0||y_lup+bitmap_size>VGA_DISPLAY_Y)
-		return ERR_OBJ_OUT_OF_BOUNDS;
-	const char* bmp = bitmaps[bitnr];/**< Select bitmap from argument. */
-	uint8_t height = bmp[0];
-	uint8_t width  = bmp[1];
-	const uint8_t* pixels = &bmp[2];
 
-    for (uint16_t y = 0; y < height; y++) /**< Move up y coordinate. */
-    {
-        for (uint16_t x = 0; x < width; x++) /**< Move up x coordinate. */
-        {
-            uint16_t color = pixels[y * width + x];
-            UB_VGA_SetPixel(x+x_lup, y+y_lup, color); /**< Color current pixel. */
-        }
-    }
+	if(ASSET_DrawBitmapEx(bmp, x_lup, y_lup, transform, scale, pal))
+		return ERR_BITMAP_INVALID;
     return 0;
 }
 
@@ -291,7 +386,7 @@ int API_draw_bitmap(int x_lup, int y_lup, int bitnr)
  * @param y_lup    			The y-coordinate of the upper-left pixel where text starts.
  * @param color     		8-bit color value used to draw the text.
  * @param text     		 	Pointer to the string of characters to be drawn.
-*  @param fontname 			String representing the font name ("ComicSans" or "Consolas").
+*  @param fontname 			Font id ("0"-"7") or name ("consolas", "comicsans", "arial" or an uploaded font).
  * @param fontsize  		Multiplier for the font size (1 = original, 2 = double, etc.).
  * @param fontstyle 		Variable for styles (bold/italic).
  *
@@ -299,39 +394,80 @@ int API_draw_bitmap(int x_lup, int y_lup, int bitnr)
  */
 int API_draw_text(int x_lup, int y_lup, int color, char *text,
                   char *fontname, int fontsize, char *fontstyle)
+{
+    return _layout_text(x_lup, y_lup, color, text, fontname, fontsize, fontstyle, 1, NULL, NULL);
+}
+
+/**
+ * @brief Measures the rectangle that API_draw_text() would touch.
+ *
+ * The text is laid out with the same word-wrap as API_draw_text(), but
+ * nothing is drawn. The size includes the italic slant and bold pixel.
+ *
+ * @param x_lup     		The x-coordinate of the upper-left pixel where text starts.
+ * @param y_lup    			The y-coordinate of the upper-left pixel where text starts.
+ * @param text     		 	Pointer to the string of characters.
+ * @param fontname 			Font id ("0"-"7") or name.
+ * @param fontsize  		Multiplier for the font size.
+ * @param fontstyle 		Variable for styles (bold/italic).
+ * @param width 			Returns the width in pixels, from x_lup.
+ * @param height 			Returns the height in pixels, from y_lup.
+ *
+ * @return 0 on success, or an error code if invalid parameters are passed.
+ */
+int API_text_size(int x_lup, int y_lup, char *text, char *fontname, int fontsize, char *fontstyle,
+                  int *width, int *height)
+{
+    return _layout_text(x_lup, y_lup, 0, text, fontname, fontsize, fontstyle, 0, width, height);
+}
+
+/**
+ * @brief Lays out a string of text and draws it, or only measures it.
+ *
+ * @param x_lup     		The x-coordinate of the upper-left pixel where text starts.
+ * @param y_lup    			The y-coordinate of the upper-left pixel where text starts.
+ * @param color     		8-bit color value used to draw the text.
+ * @param text     		 	Pointer to the string of characters.
+ * @param fontname 			Font id ("0"-"7") or name.
+ * @param fontsize  		Multiplier for the font size.
+ * @param fontstyle 		Variable for styles (bold/italic).
+ * @param draw 				1 to draw the text, 0 to only measure it.
+ * @param width 			Returns the width of the touched pixels, may be NULL.
+ * @param height 			Returns the height of the touched pixels, may be NULL.
+ *
+ * @return 0 on success, or an error code if invalid parameters are passed.
+ */
+int _layout_text(int x_lup, int y_lup, int color, char *text, char *fontname, int fontsize,
+                 char *fontstyle, int draw, int *width, int *height)
 {
     int current_x = x_lup;
     int current_y = y_lup;
+    int right = x_lup;
+    int bottom = y_lup;
     int style = 1; // normaal
-    char font_size_average = 8;//not representative of actual font size
 
-    const unsigned short *font_base = NULL;
-    int step_size = 0;
-
-    if (strcmp(fontname, "consolas") == 0||strcmp(fontname, " consolas")==0)
-    {
-        font_base = Consolas;
-        step_size = 13;
-    }
-    else if (strcmp(fontname, "comicsans") == 0||strcmp(fontname, " comicsans") == 0)
-    {
-        font_base = ComicSans;
-        step_size = 17;
-    }
-    else if (strcmp(fontname, "arial") == 0||strcmp(fontname, " arial") == 0)
-    {
-        font_base = Arial;
-        step_size = 21;
-    }
-    else
+    const FONT_t *font = FONT_Find(fontname); /**< Font by id ("3") or name ("consolas") */
+    if (font == NULL)
     {
         return ERR_FONT_INVALID;
     }
 
+    if (draw)
+        BLIT_Wait();
+
     if (strcmp(fontstyle, "vet") == 0||strcmp(fontstyle, " vet")==0)       style = 2;
     else if (strcmp(fontstyle, "cursief") == 0||strcmp(fontstyle, " cursief")==0) style = 3;
 
+    /* GLCD fonts keep their original line distance */
+    int line_height = (font->format == FONT_FMT_GLCD) ? (font->stride*fontsize/2) + 2
+                                                      : (font->height + 2)*fontsize;
 
+    /* Rows a glyph can touch, and how far italic shifts the top row */
+    int glyph_rows = (font->format == FONT_FMT_GLCD) ? 12 : font->height;
+    int italic_max = (style != 3) ? 0 : (font->format == FONT_FMT_GLCD) ? 10 / 3 : (font->height - 1) / 3;
+
+    /* Room a wrapped line needs: GLCD fonts keep their original step size (13/17/21) */
+    int wrap_room = (font->format == FONT_FMT_GLCD) ? font->stride : font->height;
 
     while (*text != '\0')
     {
@@ -350,36 +486,44 @@ int API_draw_text(int x_lup, int y_lup, int color, char *text,
             /* Measure pixel width of the word */
             while (*peek && *peek != ' ')
             {
-                uint8_t idx = (uint8_t)(*peek - 32);
-                const unsigned short *ptr = &font_base[idx * step_size];
-                word_width += (ptr[0] + 1 + bold_padding) * fontsize;
+                word_width += (FONT_GlyphWidth(font, *peek) + font->spacing + bold_padding) * fontsize;
                 peek++;
             }
             /*move to next line if does not fit*/
             if (current_x + word_width > 320)
             {
                 current_x = x_lup;
-                current_y += (step_size*fontsize/2) + 2;
+                current_y += line_height;
 
-                if (current_y + (step_size) > 240)
+                if (current_y + wrap_room > 240)
                     return ERR_OBJ_OUT_OF_BOUNDS;
             }
         }
 
         /* ---- Draw character ---- */
-        uint8_t ascii_idx = (uint8_t)(*text - 32);
-        const unsigned short *char_ptr = &font_base[ascii_idx * step_size];
-        uint8_t char_width = (uint8_t)char_ptr[0];
+        const void *glyph = FONT_Glyph(font, *text);
+        uint8_t char_width = FONT_GlyphWidth(font, *text);
 
         int bold_padding = (style == 2) ? 1 : 0;
-        int char_pixel_width = (char_width + 1 + bold_padding) * fontsize;
+        int char_pixel_width = (char_width + font->spacing + bold_padding) * fontsize;
+
+        if (glyph && draw && font->format == FONT_FMT_GLCD)
+            _draw_glcd_char(current_x, current_y, glyph, color, fontsize, style);
+        else if (glyph && draw)
+            _draw_packed_char(current_x, current_y, glyph, char_width, font->height, color, fontsize, style);
 
-        _draw_glcd_char(current_x, current_y, char_ptr, color, fontsize, style);
+        /* Extent of the pixels this character can touch */
+        right = _Max(right, current_x + (char_width + italic_max) * fontsize + bold_padding);
+        bottom = _Max(bottom, current_y + glyph_rows * fontsize);
 
         current_x += char_pixel_width;
         text++;
     }
 
+    if (width)
+        *width = right - x_lup;
+    if (height)
+        *height = bottom - y_lup;
     return 0;
 }
 
@@ -446,6 +590,52 @@ void _draw_glcd_char(int x, int y, const unsigned short *data, int color, int fo
         }
     }
 }
+
+/**
+ * @brief Internal helper function to draw a single packed (uploaded) character.
+ *
+ * The rows are stored 1 bpp with the MSB as the left pixel. Every run of
+ * set bits is drawn as one span, scaled rows repeat the span fontsize times.
+ *
+ * @param x         X-coordinate for the character.
+ * @param y         Y-coordinate for the character.
+ * @param data      Pointer to the first row of the glyph.
+ * @param width     Glyph width in pixels.
+ * @param height    Glyph height in pixels.
+ * @param color     Color of the pixels.
+ * @param fontsize  Scaling factor.
+ * @param fontstlye What style the text should be in (1=normal, 2=bold, 3=italic)
+ */
+void _draw_packed_char(int x, int y, const uint8_t *data, int width, int height, int color, int fontsize, int fontstyle)
+{
+    int stride = (width + 7) / 8;
+
+    for (int row = 0; row < height; row++, data += stride)
+    {
+        // Italic: top rows shift right, like the GLCD fonts
+        int italic_shift = (fontstyle == 3) ? (height - 1 - row) / 3 : 0;
+
+        int col = 0;
+        while (col < width)
+        {
+            // Skip clear bits, then measure the run of set bits
+            while (col < width && !(data[col >> 3] & (0x80 >> (col & 7)))) col++;
+            int start = col;
+            while (col < width && (data[col >> 3] & (0x80 >> (col & 7)))) col++;
+
+            if (col > start)
+            {
+                int px = x + (start + italic_shift) * fontsize;
+                int len = (col - start) * fontsize + ((fontstyle == 2) ? 1 : 0);
+                for (int j = 0; j < fontsize; j++)
+                {
+                    UB_VGA_FillSpan(px, y + (row * fontsize) + j, len, color);
+                }
+            }
+        }
+    }
+}
+
  /** @brief Draws a figure based on 5 coordinates
  *
  * @param x_1 		X-coordinate 1
@@ -468,6 +658,8 @@ void _draw_glcd_char(int x, int y, const unsigned short *data, int color, int fo
  */
 int API_draw_figure(int x_1, int y_1, int x_2, int y_2, int x_3, int y_3, int x_4, int y_4, int x_5, int y_5, int color, int filled)
 {
+	BLIT_Wait();
+
 	// Draw outline
 	API_draw_line(x_1, y_1, x_2, y_2, 1, color, 0);
 	API_draw_line(x_2, y_2, x_3, y_3, 1, color, 0);
@@ -532,6 +724,29 @@ int _Min(int a, int b)
 	return a < b ? a : b;
 }
 
+/**
+ * @brief Looks up a bitmap in flash (`bitmaps` table) or in the asset cache.
+ *
+ * @param bitnr 	Bitmap number, CACHE_ID_BASE and up select a cache slot
+ * @param bmp 		Destination for the bitmap descriptor
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int _GetBitmap(int bitnr, const ASSET_Bitmap_t **bmp)
+{
+	if (bitnr >= 0 && bitnr < (int)BITMAP_COUNT)
+	{
+		*bmp = &bitmaps[bitnr];
+		return 0;
+	}
+	if (bitnr >= CACHE_ID_BASE && bitnr < CACHE_ID_BASE + CACHE_SLOTS)
+	{
+		*bmp = CACHE_Get(bitnr - CACHE_ID_BASE);
+		return *bmp ? 0 : ERR_CACHE_MISS;
+	}
+	return ERR_BITMAP_INVALID;
+}
+
 /**
  * @brief Returns bigger of two numbers
  *
@@ -660,6 +875,68 @@ int _IsInPolygon(int x_p, int y_p, int x_1, int y_1, int x_2, int y_2, int x_3,
 	return (winding_number != 0);
 }
 
+/**
+ * @brief Copies a rectangle of the screen to another place.
+ *
+ * Rectangles that do not overlap are copied by DMA2 in 8 bpp mode, the
+ * CPU continues with the next command. Overlapping rectangles are copied
+ * by the CPU in the direction that reads every pixel before it is
+ * overwritten, so a region can be scrolled in place.
+ *
+ * @param x_src		Upper-left X-coordinate of the source
+ * @param y_src		Upper-left Y-coordinate of the source
+ * @param width		Width in pixels
+ * @param height	Height in pixels
+ * @param x_dst		Upper-left X-coordinate of the destination
+ * @param y_dst		Upper-left Y-coordinate of the destination
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_copy_rect (int x_src, int y_src, int width, int height, int x_dst, int y_dst)
+{
+	if (width <= 0) return ERR_RECT_WIDTH_INVALID;
+	if (height <= 0) return ERR_RECT_HEIGHT_INVALID;
+	if (x_src < 0 || y_src < 0 || x_src + width > VGA_DISPLAY_X || y_src + height > VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+	if (x_dst < 0 || y_dst < 0 || x_dst + width > VGA_DISPLAY_X || y_dst + height > VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	int overlap = x_src < x_dst + width && x_dst < x_src + width &&
+				  y_src < y_dst + height && y_dst < y_src + height;
+
+	// The DMA job starts after the queued jobs, it reads their result
+	if (VGA.mode == VGA_MODE_8BPP && !overlap &&
+		BLIT_Copy(&VGA_RAM1[(y_dst * (VGA_DISPLAY_X + 1)) + x_dst], VGA_DISPLAY_X + 1,
+				  &VGA_RAM1[(y_src * (VGA_DISPLAY_X + 1)) + x_src], VGA_DISPLAY_X + 1,
+				  width, height, NULL, NULL) == 0)
+	{
+		UB_VGA_MarkDirty(x_dst, y_dst, width, height);
+		return 0;
+	}
+
+	BLIT_Wait();
+	UB_VGA_CopyRect(x_src, y_src, width, height, x_dst, y_dst);
+	return 0;
+}
+
+/**
+ * @brief Forgets everything that is retained on the screen, the screen itself is not changed.
+ *
+ * Called after the screen was cleared: the sprites, objects, fields, gauges and
+ * seven-segment displays are drawn completely again, the console starts at the top.
+ *
+ * @param color		New background of the scene
+ */
+static void _reset_retained (int color)
+{
+	SPRITE_Invalidate();
+	OBJ_Reset(color);
+	FIELD_Reset();
+	GAUGE_Reset();
+	SEG_Reset();
+	text_row = 0;
+}
+
 /**
  * @brief Sets all pixels to given color.
  *
@@ -669,12 +946,775 @@ int _IsInPolygon(int x_p, int y_p, int x_1, int y_1, int x_2, int y_2, int x_3,
  */
 int API_clearscreen (int color)
 {
+	/**< Whole screen on DMA2 (CPU fill below when the queue is full), the black last column is kept. */
+	if (VGA.mode == VGA_MODE_8BPP && color != 0x01 &&
+		BLIT_Fill(0, 0, VGA_DISPLAY_X, VGA_DISPLAY_Y, color, NULL, NULL) == 0)
+	{
+		_reset_retained(color);
+		return 0;
+	}
+
+	BLIT_Wait();
 	UB_VGA_FillScreen(color);
+	_reset_retained(color);
+	return 0;
+}
+
+/**
+ * @brief Switches the framebuffer mode.
+ *
+ * @param bpp		Bits per pixel (8 or 4)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_mode (int bpp)
+{
+	BLIT_Wait();
+
+	if (bpp == 8)
+		UB_VGA_SetMode(VGA_MODE_8BPP);
+	else if (bpp == 4)
+		UB_VGA_SetMode(VGA_MODE_4BPP);
+	else
+		return ERR_MODE_INVALID;
+
+	_reset_retained(VGA_COL_BLACK); /**< The screen was cleared. */
+	return 0;
+}
+
+/**
+ * @brief Switches to the character-cell text mode.
+ *
+ * @param fontname	Font id or name of the glyphs, the left 8 columns are used
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_text_mode (char *fontname)
+{
+	const FONT_t *font = FONT_Find(fontname);
+	if (font == NULL)
+		return ERR_FONT_INVALID;
+
+	BLIT_Wait();
+
+	/**< The glyph rows are read by the scan-out, filled before the mode starts. */
+	for (int n = 0; n < VGA_TEXT_GLYPHS; n++)
+	{
+		FONT_GlyphRows(font, VGA_TEXT_FIRST + n, VGA_TEXT_FONT[n], VGA_TEXT_CELL_H);
+	}
+	UB_VGA_SetMode(VGA_MODE_TEXT);
+	_reset_retained(VGA_COL_BLACK);
+	return 0;
+}
+
+/**
+ * @brief Writes a string into the cells from a given cell on (text mode).
+ *
+ * @param column	Column of the first character
+ * @param row		Row of the first character
+ * @param text		String, cut off at the end of the row
+ * @param color		Foreground color (nearest palette entry)
+ * @param background Background color (nearest palette entry)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_text_put (int column, int row, const char *text, int color, int background)
+{
+	if (VGA.mode != VGA_MODE_TEXT)
+		return ERR_MODE_INVALID;
+	if (column < 0 || column >= VGA_TEXT_COLS || row < 0 || row >= VGA_TEXT_ROWS)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	uint8_t attr = (VGA_PAL_INDEX[background & 0xFF] << 4) | VGA_PAL_INDEX[color & 0xFF];
+
+	for (; *text && column < VGA_TEXT_COLS; text++, column++)
+	{
+		UB_VGA_TextPut(column, row, *text, attr);
+	}
+	return 0;
+}
+
+/**
+ * @brief Writes a string as the next console line (text mode).
+ *
+ * @param text		String
+ * @param color		Foreground color (nearest palette entry)
+ * @param background Background color (nearest palette entry)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_text_line (const char *text, int color, int background)
+{
+	if (VGA.mode != VGA_MODE_TEXT)
+		return ERR_MODE_INVALID;
+
+	uint8_t attr = (VGA_PAL_INDEX[background & 0xFF] << 4) | VGA_PAL_INDEX[color & 0xFF];
+
+	do
+	{
+		/**< Below the last row: everything moves up one row. */
+		if (text_row >= VGA_TEXT_ROWS)
+		{
+			UB_VGA_TextScroll(1, attr);
+			text_row = VGA_TEXT_ROWS - 1;
+		}
+
+		/**< The rest of the row gets the background, no old characters remain. */
+		for (int column = 0; column < VGA_TEXT_COLS; column++)
+		{
+			UB_VGA_TextPut(column, text_row, *text ? *text++ : ' ', attr);
+		}
+		text_row++;
+	} while (*text);
+
+	return 0;
+}
+
+/**
+ * @brief Sets one entry of the 4 bpp palette.
+ *
+ * @param index		Palette index (0-15)
+ * @param color		8-bit color value for this index
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_set_palette (int index, int color)
+{
+	if (index < 0 || index >= VGA_PAL_SIZE)
+		return ERR_PALETTE_INVALID;
+	if (color < 0 || color > 255)
+		return ERR_COLOR_INVALID;
+
+	UB_VGA_SetPalette(index, color);
+	return 0;
+}
+
+/**
+ * @brief Shows the page that is being drawn on (4 bpp mode).
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_flip_page (void)
+{
+	if (VGA.mode != VGA_MODE_4BPP)
+		return ERR_MODE_INVALID;
+
+	if (UB_VGA_FlipPage())
+		return ERR_FLIP_FAILED;
 	return 0;
 }
 
+/**
+ * @brief Writes the scan-out health counters as text.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ * @param reset		Non-zero to clear the counters after reading
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_status (char *msg, int size, int reset)
+{
+	snprintf(msg, size, "frames=%lu underruns=%lu dma_errors=%lu max_latency=%u jitter=%u-%u isr_load=%u/1000",
+			 (unsigned long)VGA.frame_cnt, (unsigned long)VGA.underrun_cnt, (unsigned long)VGA.dma_err_cnt,
+			 VGA.lat_peak, VGA.jitter_min, VGA.jitter_max, UB_VGA_GetIsrLoad());
+
+	if (reset)
+		UB_VGA_ResetStats();
+	return 0;
+}
 
+/**
+ * @brief Writes the dirty rectangle statistics as text.
+ *
+ * Closed frames, frames with a change, the dirty pixels and rectangles of
+ * the last frame, the largest and average dirty area per frame and the
+ * average as part of the screen. Cleared by API_get_status() with reset.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_dirty_status (char *msg, int size)
+{
+	uint32_t average = VGA_DIRTY.frames ? VGA_DIRTY.area_sum / VGA_DIRTY.frames : 0;
 
+	snprintf(msg, size, "frames=%lu changed=%lu last=%lu rects=%u peak=%lu average=%lu screen=%lu/1000",
+			 (unsigned long)VGA_DIRTY.frames, (unsigned long)VGA_DIRTY.dirty_frames,
+			 (unsigned long)VGA_DIRTY.area_last, VGA_DIRTY.done_cnt, (unsigned long)VGA_DIRTY.area_peak,
+			 (unsigned long)average, (unsigned long)(average * 1000 / (VGA_DISPLAY_X * VGA_DISPLAY_Y)));
+	return 0;
+}
 
+/**
+ * @brief Starts an image upload at the given position.
+ *
+ * @param x_lup		The x-coordinate of the upper-left pixel of the image
+ * @param y_lup		The y-coordinate of the upper-left pixel of the image
+ * @param dither	1 to quantize to RGB332 with an ordered dither, 0 to round
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_upload_start (int x_lup, int y_lup, int dither)
+{
+	if (x_lup < 0 || x_lup >= VGA_DISPLAY_X || y_lup < 0 || y_lup >= VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
 
+	UPLOAD_Begin(x_lup, y_lup, dither);
+	return 0;
+}
 
+/**
+ * @brief Decodes the next base64 chunk of the uploaded image.
+ *
+ * @param data		Base64 text, chunks may be split at any character
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_upload_data (char *data)
+{
+	if (UPLOAD_State() == UPLOAD_IDLE)
+		return ERR_UPLOAD_NOT_STARTED;
+
+	BLIT_Wait(); // Rows are written by the CPU
+
+	if (UPLOAD_Data(data))
+		return ERR_UPLOAD_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Reserves an asset cache slot, the data follows with API_upload_data().
+ *
+ * @param slot		Slot number (0-15), or -1 to select the slot by name
+ * @param name		Slot name, NULL for a numbered slot
+ * @param width		Width in pixels
+ * @param height	Height in pixels
+ * @param format	ASSET_FMT_RAW, ASSET_FMT_RLE, ASSET_FMT_1BPP or ASSET_FMT_4BPP
+ * @param size		Bytes of data, paletted formats start with their palette
+ * @param bitnr		Destination for the bitmap number of the slot, may be NULL
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_cache_store (int slot, char *name, int width, int height, int format, int size, int *bitnr)
+{
+	if (width <= 0 || width > VGA_DISPLAY_X || height <= 0 || height > VGA_DISPLAY_Y)
+		return ERR_CACHE_INVALID;
+	if (format < 0 || size <= 0 || size > CACHE_POOL_SIZE)
+		return ERR_CACHE_INVALID;
+
+	int result = CACHE_Store(slot, name, width, height, format, size);
+	if (result < 0)
+		return ERR_CACHE_INVALID;
+
+	if (bitnr)
+		*bitnr = CACHE_ID_BASE + result;
+	return 0;
+}
+
+/**
+ * @brief Finds the bitmap number of a named bitmap, flash bitmaps first, then cache slots.
+ *
+ * @param name		Bitmap name (`bitmap_names` table) or cache slot name
+ * @param bitnr		Destination for the bitmap number
+ *
+ * @return			0 if succesfull, ERR_CACHE_MISS if the name is not known
+ */
+int API_find_bitmap (char *name, int *bitnr)
+{
+	for (int n = 0; n < (int)BITMAP_COUNT; n++)
+	{
+		if (strcmp(bitmap_names[n], name) == 0)
+		{
+			*bitnr = n;
+			return 0;
+		}
+	}
+
+	int slot = CACHE_Find(name);
+	if (slot < 0)
+		return ERR_CACHE_MISS;
+
+	*bitnr = CACHE_ID_BASE + slot;
+	return 0;
+}
+
+/**
+ * @brief Writes the asset cache counters as text.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ * @param reset		Non-zero to clear hits, misses and evictions after reading
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_cache_status (char *msg, int size, int reset)
+{
+	CACHE_Stats_t stats;
+	CACHE_GetStats(&stats, reset);
+
+	snprintf(msg, size, "hits=%lu misses=%lu evictions=%lu slots=%u/%u used=%lu/%u",
+			 (unsigned long)stats.hits, (unsigned long)stats.misses, (unsigned long)stats.evictions,
+			 stats.slots, CACHE_SLOTS, (unsigned long)stats.used, CACHE_POOL_SIZE);
+	return 0;
+}
+
+/**
+ * @brief Starts the upload of a packed font blob into a font slot.
+ *
+ * @param id		Font id (3-7, ids 0-2 are the built-in fonts)
+ * @param name		Font name for `tekst`, may be NULL
+ * @param size		Size of the blob in bytes
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_font_store (int id, char *name, int size)
+{
+	if (size <= 0 || size > FONT_STORE_SIZE)
+		return ERR_FONT_UPLOAD_INVALID;
+
+	if (FONT_Store(id, name, size))
+		return ERR_FONT_UPLOAD_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Creates or replaces a sprite, it is drawn at the next frame.
+ *
+ * @param id		Sprite id (0-15)
+ * @param bitnr		Bitmap number (flash or cache slot)
+ * @param x_lup		Upper-left x-coordinate
+ * @param y_lup		Upper-left y-coordinate
+ * @param z			Z-order, higher is drawn on top
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_set (int id, int bitnr, int x_lup, int y_lup, int z)
+{
+	const ASSET_Bitmap_t* bmp;
+	int ErrorCode = _GetBitmap(bitnr, &bmp);
+	if (ErrorCode)
+		return ErrorCode;
+
+	if (id < 0 || id >= SPRITE_SLOTS || z < 0 || z > 255)
+		return ERR_SPRITE_INVALID;
+
+	uint16_t width, height;
+	ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+	if (x_lup < 0 || x_lup + width > VGA_DISPLAY_X || y_lup < 0 || y_lup + height > VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	if (SPRITE_Set(id, bitnr, x_lup, y_lup, z))
+		return ERR_SPRITE_FULL;
+	return 0;
+}
+
+/**
+ * @brief Moves a sprite, the old and new rectangle are redrawn at the next frame.
+ *
+ * @param id		Sprite id
+ * @param x_lup		New upper-left x-coordinate
+ * @param y_lup		New upper-left y-coordinate
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_move (int id, int x_lup, int y_lup)
+{
+	if (x_lup < 0 || y_lup < 0)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	if (SPRITE_Move(id, x_lup, y_lup))
+		return ERR_SPRITE_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Removes a sprite, the pixels under it are restored at the next frame.
+ *
+ * @param id		Sprite id
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_sprite_remove (int id)
+{
+	if (SPRITE_Remove(id))
+		return ERR_SPRITE_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Creates or replaces a tile map and draws it with all cells empty.
+ *
+ * @param id			Tile map id (0-3)
+ * @param bitnr			Bitmap number of the tile set, the tiles are stacked from top to bottom
+ * @param tile_height	Height of one tile in the tile set
+ * @param x_lup			Upper-left x-coordinate of the map
+ * @param y_lup			Upper-left y-coordinate of the map
+ * @param columns		Cells per row
+ * @param rows			Number of rows
+ * @param color			Color behind transparent pixels and empty cells
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_create (int id, int bitnr, int tile_height, int x_lup, int y_lup, int columns, int rows, int color)
+{
+	const ASSET_Bitmap_t* bmp;
+	int ErrorCode = _GetBitmap(bitnr, &bmp);
+	if (ErrorCode)
+		return ErrorCode;
+
+	if (tile_height <= 0 || columns <= 0 || columns > 255 || rows <= 0 || rows > 255)
+		return ERR_TILEMAP_INVALID;
+
+	if (TILE_Create(id, bitnr, tile_height, x_lup, y_lup, columns, rows, color))
+		return ERR_TILEMAP_INVALID;
+
+	TILE_Draw(id);
+	return 0;
+}
+
+/**
+ * @brief Sets cells of a tile map, only the changed cells are drawn.
+ *
+ * @param id			Tile map id
+ * @param column		Column of the first cell
+ * @param row			Row of the first cell
+ * @param indices		Tile indices (255 = empty), continued on the next row
+ * @param count			Number of indices
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_set (int id, int column, int row, const uint8_t *indices, int count)
+{
+	if (column < 0 || column > 255 || row < 0 || row > 255 || count <= 0)
+		return ERR_TILEMAP_INVALID;
+
+	if (TILE_Set(id, column, row, indices, count))
+		return ERR_TILEMAP_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Draws all cells of a tile map.
+ *
+ * @param id			Tile map id
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_tilemap_draw (int id)
+{
+	if (TILE_Draw(id))
+		return ERR_TILEMAP_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Creates or replaces a strip chart and draws it empty.
+ *
+ * @param id			Strip chart id (0-3)
+ * @param x_lup			Upper-left x-coordinate of the region
+ * @param y_lup			Upper-left y-coordinate of the region
+ * @param width			Width of the region, one sample per column
+ * @param height		Height of the region
+ * @param min			Sample value at the bottom
+ * @param max			Sample value at the top
+ * @param color			Color of the trace
+ * @param background	Color of the region
+ * @param grid_color	Color of the grid lines
+ * @param grid			Pixels between two grid lines, 0 for no grid
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_chart_create (int id, int x_lup, int y_lup, int width, int height, int min, int max,
+					  int color, int background, int grid_color, int grid)
+{
+	if (width <= 0) return ERR_RECT_WIDTH_INVALID;
+	if (height <= 0) return ERR_RECT_HEIGHT_INVALID;
+	if (x_lup < 0 || y_lup < 0 || x_lup + width > VGA_DISPLAY_X || y_lup + height > VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	if (min < INT16_MIN || max > INT16_MAX || grid < 0 || grid > 255)
+		return ERR_CHART_INVALID;
+
+	if (CHART_Create(id, x_lup, y_lup, width, height, min, max, color, background, grid_color, grid))
+		return ERR_CHART_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Appends samples to a strip chart, the plot scrolls left and only the new columns are drawn.
+ *
+ * @param id			Strip chart id
+ * @param samples		Sample values
+ * @param count			Number of samples
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_chart_add (int id, const int16_t *samples, int count)
+{
+	if (count <= 0 || count > CHART_MAX_SAMPLES)
+		return ERR_CHART_INVALID;
+
+	if (CHART_Append(id, samples, count))
+		return ERR_CHART_INVALID;
+	return 0;
+}
+
+/**
+ * @brief Creates or replaces a retained object and draws it.
+ *
+ * @param id		Object id (0-31), also the z-order
+ * @param obj		Object description, copied into the object table
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_set (int id, const OBJ_t *obj)
+{
+	return OBJ_Set(id, obj);
+}
+
+/**
+ * @brief Moves a retained object, only the old and new rectangles are redrawn.
+ *
+ * @param id		Object id
+ * @param x			New x-coordinate (line start, upper-left or center)
+ * @param y			New y-coordinate
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_move (int id, int x, int y)
+{
+	return OBJ_Move(id, x, y);
+}
+
+/**
+ * @brief Gives a retained object a new color, only its rectangle is redrawn.
+ *
+ * @param id		Object id
+ * @param color		New color
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_color (int id, int color)
+{
+	return OBJ_Color(id, color);
+}
+
+/**
+ * @brief Deletes a retained object, its rectangle is redrawn without it.
+ *
+ * @param id		Object id
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_object_delete (int id)
+{
+	return OBJ_Delete(id);
+}
+
+/**
+ * @brief Looks up a command that can be recorded in a display list.
+ *
+ * @param name		Command name
+ *
+ * @return			Command layout, or NULL if the command can not be recorded
+ */
+const DL_Op_t *API_list_find_op (const char *name)
+{
+	return LIST_FindOp(name);
+}
+
+/**
+ * @brief Starts recording a display list, an existing list with this id is replaced.
+ *
+ * @param id		Display list id (0-7)
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_record (int id)
+{
+	return LIST_Record(id);
+}
+
+/**
+ * @brief Adds one parsed command to the display list that is recorded.
+ *
+ * @param cmd		Parsed command
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_add (const DL_Cmd_t *cmd)
+{
+	return LIST_Add(cmd);
+}
+
+/**
+ * @brief Stops recording a display list.
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_stop (void)
+{
+	return LIST_Stop();
+}
+
+/**
+ * @brief Returns whether a display list is recorded.
+ *
+ * @return			1 while recording, otherwise 0
+ */
+int API_list_recording (void)
+{
+	return LIST_Recording();
+}
+
+/**
+ * @brief Replays a display list, the other commands are still drawn after an error.
+ *
+ * @param id		Display list id
+ * @param dx		Offset added to every x-coordinate
+ * @param dy		Offset added to every y-coordinate
+ *
+ * @return			0 if succesfull, otherwise the first error code
+ */
+int API_list_play (int id, int dx, int dy)
+{
+	return LIST_Play(id, dx, dy);
+}
+
+/**
+ * @brief Writes a display list to flash as boot script, or erases the boot script.
+ *
+ * @param id		Display list id, -1 only erases the boot script
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_list_save_boot (int id)
+{
+	return LIST_SaveBoot(id);
+}
+
+/**
+ * @brief Writes the boot script size and the time to the first frame as text.
+ *
+ * @param msg		Destination string buffer
+ * @param size		Size of the destination buffer
+ *
+ * @return			0 if succesfull, otherwise error code
+ */
+int API_get_boot_status (char *msg, int size)
+{
+	DL_BootStats_t stats;
+	LIST_GetBootStats(&stats);
+
+	if (!stats.played)
+		snprintf(msg, size, "script=%lu (not played at power-on)", (unsigned long)stats.script);
+	else
+		snprintf(msg, size, "script=%lu drawn=%luus frame=%lu", (unsigned long)stats.script,
+				 (unsigned long)stats.drawn_us, (unsigned long)stats.frame);
+	return 0;
+}
+
+/**
+ * @brief Creates or replaces a text field, the field starts empty.
+ *
+ * @param id			Text field id (0-15)
+ * @param x				Upper-left x-coordinate
+ * @param y				Upper-left y-coordinate
+ * @param color			Text color
+ * @param background	Color of the cleared cells
+ * @param fontname		Font id or name
+ * @param fontsize		Font size multiplier
+ * @param fontstyle		"normaal", "vet" or "cursief"
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_field_set (int id, int x, int y, int color, int background,
+				   char *fontname, int fontsize, char *fontstyle)
+{
+	return FIELD_Set(id, x, y, color, background, fontname, fontsize, fontstyle);
+}
+
+/**
+ * @brief Shows a new text in a text field, only the changed character cells are drawn.
+ *
+ * @param id			Text field id
+ * @param text			New text, one line
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_field_update (int id, const char *text)
+{
+	return FIELD_Update(id, text);
+}
+
+/**
+ * @brief Creates or replaces a gauge and draws the dial with the needle at the minimum.
+ *
+ * @param id			Gauge id (0-3)
+ * @param x				X-coordinate of the center
+ * @param y				Y-coordinate of the center
+ * @param radius		Radius of the dial
+ * @param min			Value at the start of the sweep
+ * @param max			Value at the end of the sweep
+ * @param color			Color of the ring, ticks and label
+ * @param background	Color of the dial
+ * @param needle_color	Color of the needle and the hub
+ * @param label			Text under the center, may be NULL
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_gauge_set (int id, int x, int y, int radius, int min, int max,
+				   int color, int background, int needle_color, const char *label)
+{
+	return GAUGE_Set(id, x, y, radius, min, max, color, background, needle_color, label);
+}
+
+/**
+ * @brief Moves the needle of a gauge, only the old needle pixels are restored.
+ *
+ * @param id			Gauge id
+ * @param value			New value, clamped to min..max
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_gauge_value (int id, int value)
+{
+	return GAUGE_Value(id, value);
+}
+
+/**
+ * @brief Creates or replaces a seven-segment display and draws it with all segments off.
+ *
+ * @param id			Display id (0-7)
+ * @param x				Upper-left x-coordinate
+ * @param y				Upper-left y-coordinate
+ * @param height		Digit height, the width and segment thickness follow from it
+ * @param digits		Number of digits (1-10)
+ * @param color			Color of a lit segment
+ * @param off_color		Color of an unlit segment
+ * @param background	Color around the segments
+ * @param decimals		Digits after the decimal point, 0 for none
+ * @param leading_zeros	1 to fill unused digits with zeros
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_segment_set (int id, int x, int y, int height, int digits, int color, int off_color,
+					 int background, int decimals, int leading_zeros)
+{
+	return SEG_Set(id, x, y, height, digits, color, off_color, background, decimals, leading_zeros);
+}
+
+/**
+ * @brief Shows a number on a seven-segment display, only the toggled segments are filled.
+ *
+ * @param id			Display id
+ * @param value			Number, with the decimals as the last digits (1234 with 2 decimals is 12.34)
+ *
+ * @return				0 if succesfull, otherwise error code
+ */
+int API_segment_value (int id, int32_t value)
+{
+	return SEG_Value(id, value);
+}
@@ -0,0 +1,514 @@
+/**
+ * @file Assets.c
+ * @brief Bitmap asset code file
+ *
+ * This file contains the decoders for the bitmap formats.
+ * Every decoder streams its pixels straight into the framebuffer
+ * as spans, no intermediate image buffer is used.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Assets.h"
+#include "stm32_ub_vga_screen.h"
+#include "Blitter.h"
+
+#include <string.h>
+
+// CCMRAM (asset cache) can not be read by the DMA controller
+#define ASSET_CCMRAM_START	0x10000000
+#define ASSET_CCMRAM_END	0x10010000
+#define ASSET_DMA_OK(ptr)	((uint32_t)(ptr) < ASSET_CCMRAM_START || (uint32_t)(ptr) >= ASSET_CCMRAM_END)
+
+// Row buffer for the paletted formats (one screen line)
+static uint8_t asset_row[VGA_DISPLAY_X] __attribute__((aligned(4)));
+
+// 1 bpp : 4 bits -> byte mask for 4 pixels (MSB is the left pixel = lowest byte)
+static const uint32_t asset_mask_lut[16] = {
+	0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000,
+	0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+	0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF,
+	0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF
+};
+
+// 4 bpp : packed byte -> two pixels, built from the palette for every draw
+static uint16_t asset_pair_lut[256];
+
+// RLE bitmaps are unpacked here before they are transformed (CPU only, so CCMRAM)
+static uint8_t asset_scratch[ASSET_SCRATCH_SIZE] __attribute__((section(".ccmram")));
+
+static int _ASSET_DrawRaw(const ASSET_Bitmap_t *bmp, int x, int y);
+static int _ASSET_DrawRle(const ASSET_Bitmap_t *bmp, int x, int y);
+static int _ASSET_Draw1bpp(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette);
+static int _ASSET_Draw4bpp(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette);
+static void _ASSET_WriteRow(int x, int y, const uint8_t *pixels, uint16_t width);
+static int _ASSET_DrawTransformed(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t transform, int scale, const uint8_t *palette);
+static int _ASSET_DecodeRle(const ASSET_Bitmap_t *bmp, uint8_t *dst);
+
+/**
+ * @brief Draws a bitmap with its upper-left corner at (x, y).
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+int ASSET_DrawBitmap(const ASSET_Bitmap_t *bmp, int x, int y)
+{
+	return ASSET_DrawBitmapPalette(bmp, x, y, 0);
+}
+
+/**
+ * @brief Draws a bitmap with its own palette replaced.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param palette Palette of 2 (1 bpp) or 16 (4 bpp) colors, NULL for the default palette.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+int ASSET_DrawBitmapPalette(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette)
+{
+	return ASSET_DrawBitmapEx(bmp, x, y, ASSET_ROT_0, 1, palette);
+}
+
+/**
+ * @brief Draws a bitmap scaled, rotated and/or mirrored.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate of the result.
+ * @param y Upper-left Y-coordinate of the result.
+ * @param transform ASSET_ROT_... / ASSET_FLIP_..., applied after the transform of the descriptor.
+ * @param scale 1..ASSET_SCALE_MAX to enlarge, -2..-ASSET_SCALE_MAX to shrink (1/n).
+ * @param palette Palette for the paletted formats, NULL for the default palette.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+int ASSET_DrawBitmapEx(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t transform, int scale, const uint8_t *palette)
+{
+	if (bmp == 0 || bmp->data == 0) return 1;
+	if (scale > ASSET_SCALE_MAX || scale < -ASSET_SCALE_MAX) return 1;
+	if (scale == 0 || scale == -1) scale = 1;
+
+	if (palette == 0) palette = bmp->palette;
+	transform = ASSET_Compose(bmp->transform, transform);
+
+	// Transformed bitmaps are sampled pixel by pixel
+	if (transform != ASSET_ROT_0 || scale != 1)
+	{
+		return _ASSET_DrawTransformed(bmp, x, y, transform, scale, palette);
+	}
+
+	if (bmp->width > VGA_DISPLAY_X) return 1;
+
+	switch (bmp->format)
+	{
+	case ASSET_FMT_RAW:
+		return _ASSET_DrawRaw(bmp, x, y);
+	case ASSET_FMT_RLE:
+		return _ASSET_DrawRle(bmp, x, y);
+	case ASSET_FMT_1BPP:
+		return _ASSET_Draw1bpp(bmp, x, y, palette);
+	case ASSET_FMT_4BPP:
+		return _ASSET_Draw4bpp(bmp, x, y, palette);
+	default:
+		return 1;
+	}
+}
+
+/**
+ * @brief Calculates the size of a transformed bitmap on the screen.
+ * @param bmp Bitmap descriptor.
+ * @param transform ASSET_ROT_... / ASSET_FLIP_...
+ * @param scale Scale factor, see ASSET_DrawBitmapEx().
+ * @param width Destination for the width in pixels.
+ * @param height Destination for the height in pixels.
+ */
+void ASSET_GetSize(const ASSET_Bitmap_t *bmp, uint8_t transform, int scale, uint16_t *width, uint16_t *height)
+{
+	uint16_t w = bmp->width;
+	uint16_t h = bmp->height;
+
+	// 90 and 270 degrees swap width and height
+	if (ASSET_Compose(bmp->transform, transform) & ASSET_ROT_90)
+	{
+		w = bmp->height;
+		h = bmp->width;
+	}
+
+	if (scale > 1)
+	{
+		w *= scale;
+		h *= scale;
+	}
+	else if (scale < -1)
+	{
+		w /= -scale;
+		h /= -scale;
+	}
+	*width = w;
+	*height = h;
+}
+
+/**
+ * @brief Combines two transforms.
+ *
+ * A transform is a rotation R followed by a mirror H. A mirror turns the
+ * direction of a following rotation around (R.H = H.R^-1), so:
+ * (H^f2.R^r2).(H^f1.R^r1) = H^(f1^f2).R^(r1 + (f1 ? -r2 : r2)).
+ *
+ * @param first Transform that is applied first.
+ * @param then Transform that is applied to the result.
+ * @return The combined transform.
+ */
+uint8_t ASSET_Compose(uint8_t first, uint8_t then)
+{
+	uint8_t rot = (first & ASSET_FLIP_H) ? (first - then) : (first + then);
+
+	return ((first ^ then) & ASSET_FLIP_H) | (rot & ASSET_ROT_MASK);
+}
+
+/**
+ * @brief Draws a paletted bitmap with its primary color replaced.
+ * @param bmp Bitmap descriptor.
+ * @param x Upper-left X-coordinate.
+ * @param y Upper-left Y-coordinate.
+ * @param color New color for palette index 1.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+int ASSET_DrawBitmapColor(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t color)
+{
+	uint8_t palette[16];
+
+	if (bmp == 0 || bmp->palette == 0) return ASSET_DrawBitmap(bmp, x, y);
+
+	memcpy(palette, bmp->palette, (bmp->format == ASSET_FMT_1BPP) ? 2 : 16);
+	palette[ASSET_PAL_PRIMARY] = color;
+
+	return ASSET_DrawBitmapPalette(bmp, x, y, palette);
+}
+
+/**
+ * @brief Draws an uncompressed bitmap.
+ *
+ * Opaque bitmaps are copied by the DMA blitter in 8 bpp mode (unless
+ * they are in CCMRAM), otherwise every row is split into spans around
+ * transparent pixels.
+ */
+static int _ASSET_DrawRaw(const ASSET_Bitmap_t *bmp, int x, int y)
+{
+	const uint8_t *pixels = bmp->data;
+
+	if ((uint32_t)bmp->width * bmp->height > bmp->size) return 1;
+
+	if ((bmp->flags & ASSET_FLAG_OPAQUE) && VGA.mode == VGA_MODE_8BPP && ASSET_DMA_OK(pixels))
+	{
+		return BLIT_Bitmap(x, y, pixels, bmp->width, bmp->height, 0, 0);
+	}
+
+	BLIT_Wait();
+
+	for (uint16_t row = 0; row < bmp->height; row++)
+	{
+		_ASSET_WriteRow(x, y + row, pixels, bmp->width);
+		pixels += bmp->width;
+	}
+	return 0;
+}
+
+/**
+ * @brief Draws a run-length encoded bitmap.
+ *
+ * Repeat runs become one span fill, literal runs one span copy
+ * and transparent runs only move the cursor.
+ */
+static int _ASSET_DrawRle(const ASSET_Bitmap_t *bmp, int x, int y)
+{
+	const uint8_t *ptr = bmp->data;
+	const uint8_t *end = bmp->data + bmp->size;
+
+	BLIT_Wait();
+
+	for (uint16_t row = 0; row < bmp->height; row++)
+	{
+		uint16_t col = 0;
+		while (col < bmp->width)
+		{
+			if (ptr + 2 > end) return 1;
+
+			uint8_t control = *ptr++;
+			uint16_t count = (control & ASSET_RLE_COUNT) + 1;
+
+			// Runs never cross a row
+			if (col + count > bmp->width) return 1;
+
+			if (control & ASSET_RLE_REPEAT)
+			{
+				uint8_t color = *ptr++;
+				if (color != ASSET_TRANSPARENT)
+				{
+					UB_VGA_FillSpan(x + col, y + row, count, color);
+				}
+			}
+			else
+			{
+				if (ptr + count > end) return 1;
+				UB_VGA_WriteSpan(x + col, y + row, count, ptr);
+				ptr += count;
+			}
+			col += count;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Draws a 1 bpp bitmap.
+ *
+ * Every 4 source bits select a byte mask from asset_mask_lut,
+ * which blends the two palette colors 4 pixels at a time.
+ */
+static int _ASSET_Draw1bpp(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette)
+{
+	const uint8_t *ptr = bmp->data;
+	uint16_t stride = (bmp->width + 7) / 8;
+
+	if (palette == 0) return 1;
+	if (stride * bmp->height > bmp->size) return 1;
+
+	uint32_t back = palette[0] * 0x01010101;
+	uint32_t fore = palette[1] * 0x01010101;
+	uint32_t *row = (uint32_t *)asset_row;
+
+	BLIT_Wait();
+
+	for (uint16_t line = 0; line < bmp->height; line++)
+	{
+		for (uint16_t n = 0; n < stride; n++)
+		{
+			uint32_t mask_l = asset_mask_lut[ptr[n] >> 4];
+			uint32_t mask_r = asset_mask_lut[ptr[n] & 0x0F];
+
+			// Last byte may be written past width, asset_row is a full line
+			if (2 * n + 1 < VGA_DISPLAY_X / 4)
+			{
+				row[2 * n] = (fore & mask_l) | (back & ~mask_l);
+				row[2 * n + 1] = (fore & mask_r) | (back & ~mask_r);
+			}
+		}
+		_ASSET_WriteRow(x, y + line, asset_row, bmp->width);
+		ptr += stride;
+	}
+	return 0;
+}
+
+/**
+ * @brief Draws a 4 bpp bitmap.
+ *
+ * The palette is first turned into a 256 entry byte-pair table,
+ * after that every source byte gives two pixels with one lookup.
+ */
+static int _ASSET_Draw4bpp(const ASSET_Bitmap_t *bmp, int x, int y, const uint8_t *palette)
+{
+	const uint8_t *ptr = bmp->data;
+	uint16_t stride = (bmp->width + 1) / 2;
+	uint16_t *row = (uint16_t *)asset_row;
+
+	if (palette == 0) return 1;
+	if (stride * bmp->height > bmp->size) return 1;
+
+	// Left pixel (high nibble) is the low byte of the halfword
+	for (uint16_t n = 0; n < 256; n++)
+	{
+		asset_pair_lut[n] = palette[n >> 4] | (palette[n & 0x0F] << 8);
+	}
+
+	BLIT_Wait();
+
+	for (uint16_t line = 0; line < bmp->height; line++)
+	{
+		for (uint16_t n = 0; n < stride; n++)
+		{
+			row[n] = asset_pair_lut[ptr[n]];
+		}
+		_ASSET_WriteRow(x, y + line, asset_row, bmp->width);
+		ptr += stride;
+	}
+	return 0;
+}
+
+/**
+ * @brief Writes one row of 8 bpp pixels, transparent pixels are skipped.
+ *
+ * The keyed span compares and selects four pixels per word, so a row
+ * with transparent pixels costs about the same as a plain copy.
+ */
+static void _ASSET_WriteRow(int x, int y, const uint8_t *pixels, uint16_t width)
+{
+	UB_VGA_WriteSpanKeyed(x, y, width, pixels, ASSET_TRANSPARENT);
+}
+
+/**
+ * @brief Draws a bitmap scaled, rotated and/or mirrored.
+ *
+ * Every screen row is sampled along a straight line through the source.
+ * The position is kept as a pixel index plus a 16.16 fraction, so every
+ * pixel only adds the step (no multiplies), and one row of output is
+ * written as spans like an untransformed bitmap.
+ */
+static int _ASSET_DrawTransformed(const ASSET_Bitmap_t *bmp, int x, int y, uint8_t transform, int scale, const uint8_t *palette)
+{
+	const uint8_t *src = bmp->data;
+	uint8_t format = bmp->format;
+	int32_t w = bmp->width;
+	int32_t h = bmp->height;
+	int32_t row_px;	// Pixels per source row, including the padding
+	uint16_t dw, dh;
+
+	switch (format)
+	{
+	case ASSET_FMT_RAW:
+		if (w * h > bmp->size) return 1;
+		row_px = w;
+		break;
+	case ASSET_FMT_RLE:
+		if (w * h > ASSET_SCRATCH_SIZE) return 1;
+		BLIT_Wait();
+		if (_ASSET_DecodeRle(bmp, asset_scratch)) return 1;
+		src = asset_scratch;
+		format = ASSET_FMT_RAW;
+		row_px = w;
+		break;
+	case ASSET_FMT_1BPP:
+		if (palette == 0 || ((w + 7) / 8) * h > bmp->size) return 1;
+		row_px = ((w + 7) / 8) * 8;
+		break;
+	case ASSET_FMT_4BPP:
+		if (palette == 0 || ((w + 1) / 2) * h > bmp->size) return 1;
+		row_px = ((w + 1) / 2) * 2;
+		break;
+	default:
+		return 1;
+	}
+
+	// Size of the rotated image, then scaled
+	int32_t rw = (transform & ASSET_ROT_90) ? h : w;
+	int32_t rh = (transform & ASSET_ROT_90) ? w : h;
+
+	dw = (scale > 1) ? rw * scale : (scale < -1) ? rw / -scale : rw;
+	dh = (scale > 1) ? rh * scale : (scale < -1) ? rh / -scale : rh;
+	if (dw == 0 || dh == 0 || dw > VGA_DISPLAY_X) return 1;
+
+	// Source x/y for screen column a and row b of the rotated image:
+	// start (ox, oy), one column further (ax, ay), one row further (bx, by)
+	int32_t ox, oy, ax, ay, bx, by;
+
+	switch (transform & ASSET_ROT_MASK)
+	{
+	case ASSET_ROT_0:	ox = 0;		oy = 0;		ax = 1;		ay = 0;		bx = 0;		by = 1;		break;
+	case ASSET_ROT_90:	ox = 0;		oy = h - 1;	ax = 0;		ay = -1;	bx = 1;		by = 0;		break;
+	case ASSET_ROT_180:	ox = w - 1;	oy = h - 1;	ax = -1;	ay = 0;		bx = 0;		by = -1;	break;
+	default:			ox = w - 1;	oy = 0;		ax = 0;		ay = 1;		bx = -1;	by = 0;		break;
+	}
+
+	// Mirror: start at the last column and walk back
+	if (transform & ASSET_FLIP_H)
+	{
+		ox += (rw - 1) * ax;
+		oy += (rw - 1) * ay;
+		ax = -ax;
+		ay = -ay;
+	}
+
+	// Steps as pixel index in the source
+	int32_t origin = ox + (oy * row_px);
+	int32_t step_a = ax + (ay * row_px);
+	int32_t step_b = bx + (by * row_px);
+
+	// Source pixels per screen pixel (16.16), sampled in the pixel centre
+	uint32_t step = (scale > 0) ? (0x10000 / scale) : (uint32_t)(-scale) << 16;
+	uint32_t bias = step / 2;
+	int32_t step_int = (int32_t)(step >> 16) * step_a;
+	uint32_t step_frac = step & 0xFFFF;
+
+	uint32_t b_fp = bias;
+	int32_t last_b = -1;
+
+	BLIT_Wait();
+
+	for (uint16_t v = 0; v < dh; v++, b_fp += step)
+	{
+		int32_t b = b_fp >> 16;
+
+		// Enlarged rows repeat: the row buffer is still valid
+		if (b != last_b)
+		{
+			int32_t idx = origin + (b * step_b) + ((int32_t)(bias >> 16) * step_a);
+			uint32_t frac = bias & 0xFFFF;
+			last_b = b;
+
+			for (uint16_t u = 0; u < dw; u++)
+			{
+				if (format == ASSET_FMT_RAW)
+				{
+					asset_row[u] = src[idx];
+				}
+				else if (format == ASSET_FMT_1BPP)
+				{
+					asset_row[u] = palette[(src[idx >> 3] >> (7 - (idx & 0x07))) & 0x01];
+				}
+				else
+				{
+					asset_row[u] = palette[(idx & 0x01) ? (src[idx >> 1] & 0x0F) : (src[idx >> 1] >> 4)];
+				}
+
+				idx += step_int;
+				frac += step_frac;
+				if (frac & 0x10000)
+				{
+					frac -= 0x10000;
+					idx += step_a;
+				}
+			}
+		}
+		_ASSET_WriteRow(x, y + v, asset_row, dw);
+	}
+	return 0;
+}
+
+/**
+ * @brief Unpacks a run-length encoded bitmap to one byte per pixel.
+ * @param bmp RLE bitmap.
+ * @param dst Destination, width * height bytes.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+static int _ASSET_DecodeRle(const ASSET_Bitmap_t *bmp, uint8_t *dst)
+{
+	const uint8_t *ptr = bmp->data;
+	const uint8_t *end = bmp->data + bmp->size;
+
+	for (uint16_t row = 0; row < bmp->height; row++)
+	{
+		uint16_t col = 0;
+		while (col < bmp->width)
+		{
+			if (ptr + 2 > end) return 1;
+
+			uint8_t control = *ptr++;
+			uint16_t count = (control & ASSET_RLE_COUNT) + 1;
+
+			if (col + count > bmp->width) return 1;
+
+			if (control & ASSET_RLE_REPEAT)
+			{
+				memset(dst, *ptr++, count);
+			}
+			else
+			{
+				if (ptr + count > end) return 1;
+				memcpy(dst, ptr, count);
+				ptr += count;
+			}
+			dst += count;
+			col += count;
+		}
+	}
+	return 0;
+}
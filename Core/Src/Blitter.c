@@ -0,0 +1,277 @@
+/**
+ * @file Blitter.c
+ * @brief DMA blitter code file
+ *
+ * This file contains the code for the DMA2 memory-to-memory blitter.
+ * The DMA controller has no 2D mode, so every job is transferred one
+ * row at a time: the transfer complete interrupt programs the next row,
+ * and starts the next job from the queue when the last row is done.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Blitter.h"
+#include "stm32f4xx.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <stddef.h>
+
+// Stream0 flags in LISR/LIFCR (FEIF, DMEIF, TEIF, HTIF, TCIF)
+#define BLIT_STREAM_FLAGS	0x0000003D
+
+// --- Job queue (written by main loop, read by ISR) ---
+static BLIT_Job_t blit_queue[BLIT_QUEUE_SIZE];
+static volatile uint8_t blit_head = 0;	// Index where the next job is stored
+static volatile uint8_t blit_tail = 0;	// Index of the running job
+static volatile bool blit_running = false;
+static uint16_t blit_row = 0;			// Row of the running job
+
+static uint32_t blit_cr_fill = 0;		// CR-Register for fill jobs
+static uint32_t blit_cr_copy = 0;		// CR-Register for copy jobs
+
+static int _BLIT_Queue(BLIT_Job_t *job);
+static void _BLIT_StartRow(BLIT_Job_t *job);
+static void _BLIT_StartNext(void);
+
+/**
+ * @brief Initializes DMA2 Stream0 for memory-to-memory transfers.
+ */
+void BLIT_Init(void)
+{
+	// Enable DMA2 clock (AHB1)
+	RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+
+	// Disable stream and wait until it is really off
+	DMA2_Stream0->CR = 0;
+	while (DMA2_Stream0->CR & DMA_SxCR_EN);
+	DMA2->LIFCR = BLIT_STREAM_FLAGS;
+
+	// Channel 0, memory-to-memory, byte size, low priority, single beats,
+	// transfer complete and error interrupt. Fills keep the source address fixed.
+	blit_cr_fill = DMA_SxCR_DIR_1 | DMA_SxCR_MINC | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+	blit_cr_copy = blit_cr_fill | DMA_SxCR_PINC;
+
+	// Memory-to-memory requires the FIFO (direct mode not allowed)
+	DMA2_Stream0->FCR = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH_0 | DMA_SxFCR_FTH_1;
+
+	// Below the VGA interrupts, the scan-out must never wait for the blitter
+	NVIC_SetPriority(DMA2_Stream0_IRQn, 4);
+	NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+}
+
+/**
+ * @brief Queues a filled rectangle in the 8 bpp framebuffer.
+ */
+int BLIT_Fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color,
+			  BLIT_Callback_t callback, void *context)
+{
+	BLIT_Job_t job;
+
+	if (width == 0 || height == 0) return 1;
+	if (x + width > VGA_DISPLAY_X || y + height > VGA_DISPLAY_Y) return 1;
+
+	// Only the part inside the clip rectangle is filled
+	uint16_t x1 = x + width, y1 = y + height;
+	if (x < VGA.clip_x0) x = VGA.clip_x0;
+	if (y < VGA.clip_y0) y = VGA.clip_y0;
+	if (x1 > VGA.clip_x1) x1 = VGA.clip_x1;
+	if (y1 > VGA.clip_y1) y1 = VGA.clip_y1;
+	if (x1 <= x || y1 <= y) return 0;
+	width = x1 - x;
+	height = y1 - y;
+	UB_VGA_MarkDirty(x, y, width, height);
+
+	job.type = BLIT_JOB_FILL;
+	job.color = color;
+	job.width = width;
+	job.height = height;
+	job.src = NULL;
+	job.src_stride = 0;
+	job.dst = &VGA_RAM1[(y * (VGA_DISPLAY_X + 1)) + x];
+	job.dst_stride = VGA_DISPLAY_X + 1;
+	job.callback = callback;
+	job.context = context;
+
+	return _BLIT_Queue(&job);
+}
+
+/**
+ * @brief Queues a copy of opaque bitmap rows into the 8 bpp framebuffer.
+ */
+int BLIT_Bitmap(uint16_t x, uint16_t y, const uint8_t *pixels, uint16_t width, uint16_t height,
+				BLIT_Callback_t callback, void *context)
+{
+	if (x + width > VGA_DISPLAY_X || y + height > VGA_DISPLAY_Y) return 1;
+
+	// Only the part inside the clip rectangle is copied, the source keeps its stride
+	uint16_t stride = width;
+	uint16_t x1 = x + width, y1 = y + height;
+	if (x < VGA.clip_x0) { pixels += VGA.clip_x0 - x; x = VGA.clip_x0; }
+	if (y < VGA.clip_y0) { pixels += (VGA.clip_y0 - y) * stride; y = VGA.clip_y0; }
+	if (x1 > VGA.clip_x1) x1 = VGA.clip_x1;
+	if (y1 > VGA.clip_y1) y1 = VGA.clip_y1;
+	if (x1 <= x || y1 <= y) return 0;
+	UB_VGA_MarkDirty(x, y, x1 - x, y1 - y);
+
+	return BLIT_Copy(&VGA_RAM1[(y * (VGA_DISPLAY_X + 1)) + x], VGA_DISPLAY_X + 1,
+					 pixels, stride, x1 - x, y1 - y, callback, context);
+}
+
+/**
+ * @brief Queues a generic rectangular memory copy.
+ */
+int BLIT_Copy(uint8_t *dst, uint16_t dst_stride, const uint8_t *src, uint16_t src_stride,
+			  uint16_t width, uint16_t height, BLIT_Callback_t callback, void *context)
+{
+	BLIT_Job_t job;
+
+	if (width == 0 || height == 0) return 1;
+
+	job.type = BLIT_JOB_COPY;
+	job.color = 0;
+	job.width = width;
+	job.height = height;
+	job.src = src;
+	job.src_stride = src_stride;
+	job.dst = dst;
+	job.dst_stride = dst_stride;
+	job.callback = callback;
+	job.context = context;
+
+	return _BLIT_Queue(&job);
+}
+
+/**
+ * @brief Checks whether jobs are still running or waiting.
+ * @return true if the blitter is busy.
+ */
+bool BLIT_Busy(void)
+{
+	return blit_running;
+}
+
+/**
+ * @brief Waits until all queued jobs have completed.
+ */
+void BLIT_Wait(void)
+{
+	while (blit_running);
+}
+
+/**
+ * @brief Stores a job in the queue and starts it if the blitter is idle.
+ * @param job Job to copy into the queue.
+ * @return 0 if the job was queued.
+ */
+static int _BLIT_Queue(BLIT_Job_t *job)
+{
+	uint8_t next_head = (blit_head + 1) % BLIT_QUEUE_SIZE;
+
+	// Queue full: wait for the ISR to finish a job
+	while (next_head == blit_tail && blit_running);
+
+	blit_queue[blit_head] = *job;
+
+	// The ISR may not pick up a new job while we start one
+	NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+	blit_head = next_head;
+	if (!blit_running)
+	{
+		_BLIT_StartNext();
+	}
+	NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+	return 0;
+}
+
+/**
+ * @brief Starts the job at the tail of the queue, if any.
+ */
+static void _BLIT_StartNext(void)
+{
+	if (blit_tail == blit_head)
+	{
+		blit_running = false;
+		return;
+	}
+
+	blit_running = true;
+	blit_row = 0;
+	_BLIT_StartRow(&blit_queue[blit_tail]);
+}
+
+/**
+ * @brief Programs and enables the stream for the current row of a job.
+ * @param job Running job.
+ */
+static void _BLIT_StartRow(BLIT_Job_t *job)
+{
+	DMA2->LIFCR = BLIT_STREAM_FLAGS;
+
+	if (job->type == BLIT_JOB_FILL)
+	{
+		DMA2_Stream0->CR = blit_cr_fill;
+		DMA2_Stream0->PAR = (uint32_t)&job->color;
+	}
+	else
+	{
+		DMA2_Stream0->CR = blit_cr_copy;
+		DMA2_Stream0->PAR = (uint32_t)(job->src + (blit_row * job->src_stride));
+	}
+	DMA2_Stream0->M0AR = (uint32_t)(job->dst + (blit_row * job->dst_stride));
+	DMA2_Stream0->NDTR = job->width;
+
+	DMA2_Stream0->CR |= DMA_SxCR_EN;
+}
+
+/**
+ * @brief DMA2 Stream0 Interrupt Service Routine (ISR).
+ *
+ * Runs after every row: starts the next row, or finishes the job,
+ * calls its callback and starts the next job. A job with a DMA error
+ * is dropped, its callback gets BLIT_ERROR.
+ */
+void DMA2_Stream0_IRQHandler(void)
+{
+	if (DMA2->LISR & DMA_LISR_TCIF0)
+	{
+		DMA2->LIFCR = BLIT_STREAM_FLAGS;
+
+		BLIT_Job_t *job = &blit_queue[blit_tail];
+
+		blit_row++;
+		if (blit_row < job->height)
+		{
+			_BLIT_StartRow(job);
+			return;
+		}
+
+		// Job done, release its queue slot before the callback queues more
+		BLIT_Callback_t callback = job->callback;
+		void *context = job->context;
+		blit_tail = (blit_tail + 1) % BLIT_QUEUE_SIZE;
+		_BLIT_StartNext();
+
+		if (callback)
+		{
+			callback(context, BLIT_DONE);
+		}
+	}
+	else
+	{
+		// Transfer or FIFO error: drop the job, its waiter still hears of it
+		DMA2->LIFCR = BLIT_STREAM_FLAGS;
+
+		BLIT_Job_t *job = &blit_queue[blit_tail];
+		BLIT_Callback_t callback = job->callback;
+		void *context = job->context;
+		blit_tail = (blit_tail + 1) % BLIT_QUEUE_SIZE;
+		_BLIT_StartNext();
+
+		if (callback)
+		{
+			callback(context, BLIT_ERROR);
+		}
+	}
+}
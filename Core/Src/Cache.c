@@ -0,0 +1,274 @@
+/**
+ * @file Cache.c
+ * @brief Asset cache code file
+ *
+ * This file contains the RAM asset cache. The pool is kept compact:
+ * slot data is stored back to back from the start of the pool, and a
+ * freed slot is closed by moving the data behind it down. New data is
+ * always appended at the end, so there is no fragmentation.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Cache.h"
+#include "Upload.h"
+
+#include <string.h>
+
+/**
+ * @brief One cache slot.
+ */
+typedef struct {
+	ASSET_Bitmap_t bmp;			/**< Descriptor, data points into the pool */
+	uint16_t offset;			/**< Start of the data in the pool */
+	uint16_t alloc;				/**< Bytes reserved in the pool (multiple of 4) */
+	uint32_t last_used;			/**< Value of cache_clock at the last use */
+	uint8_t loaded;				/**< Slot has data reserved in the pool */
+	uint8_t ready;				/**< All data received, slot can be drawn */
+	char name[CACHE_NAME_LEN];	/**< Slot name, empty for numbered slots */
+} CACHE_Slot_t;
+
+// CCMRAM is not reachable by DMA, cached bitmaps are always drawn by the CPU
+static uint8_t cache_pool[CACHE_POOL_SIZE] __attribute__((section(".ccmram"), aligned(4)));
+
+static CACHE_Slot_t cache_slots[CACHE_SLOTS];
+static uint32_t cache_used = 0;		// Bytes in use from the start of the pool
+static uint32_t cache_clock = 0;	// Incremented on every use, for LRU
+static uint32_t cache_hits = 0;
+static uint32_t cache_misses = 0;
+static uint32_t cache_evictions = 0;
+
+static void _CACHE_Free(int slot);
+static int _CACHE_Lru(void);
+static void _CACHE_Bind(CACHE_Slot_t *entry);
+static void _CACHE_Ready(void *context);
+
+/**
+ * @brief Clears all slots and the counters.
+ */
+void CACHE_Init(void)
+{
+	memset(cache_slots, 0, sizeof(cache_slots));
+	cache_used = 0;
+	cache_clock = 0;
+	cache_hits = 0;
+	cache_misses = 0;
+	cache_evictions = 0;
+}
+
+/**
+ * @brief Reserves a slot and starts the upload of its data.
+ */
+int CACHE_Store(int slot, const char *name, uint16_t width, uint16_t height, uint8_t format, uint16_t size)
+{
+	uint16_t alloc = (size + 3) & ~3;
+	uint32_t needed = 0;
+	int n;
+
+	// The pending store (if any) may point to data that is moved below
+	UPLOAD_Abort();
+
+	if (format > ASSET_FMT_4BPP || width == 0 || height == 0) return -1;
+	if (size == 0 || alloc > CACHE_POOL_SIZE) return -1;
+
+	// Fixed-size formats need all their pixels and the palette, run-length data is checked while drawing
+	if (format == ASSET_FMT_RAW) needed = (uint32_t)width * height;
+	if (format == ASSET_FMT_1BPP) needed = (uint32_t)((width + 7) / 8) * height + 2;
+	if (format == ASSET_FMT_4BPP) needed = (uint32_t)((width + 1) / 2) * height + 16;
+	if (size < needed) return -1;
+	if (slot >= CACHE_SLOTS || (slot < 0 && (name == 0 || name[0] == 0))) return -1;
+
+	// Slots of aborted uploads are never completed
+	for (n = 0; n < CACHE_SLOTS; n++)
+	{
+		if (cache_slots[n].loaded && !cache_slots[n].ready) _CACHE_Free(n);
+	}
+
+	// Select by name: same name, else an empty slot, else the LRU slot
+	if (slot < 0)
+	{
+		for (n = 0; n < CACHE_SLOTS && slot < 0; n++)
+		{
+			if (cache_slots[n].loaded && strncmp(cache_slots[n].name, name, CACHE_NAME_LEN) == 0) slot = n;
+		}
+		for (n = 0; n < CACHE_SLOTS && slot < 0; n++)
+		{
+			if (!cache_slots[n].loaded) slot = n;
+		}
+		if (slot < 0)
+		{
+			slot = _CACHE_Lru();
+			cache_evictions++;
+		}
+	}
+
+	// Replace the old contents of the slot
+	if (cache_slots[slot].loaded) _CACHE_Free(slot);
+
+	// Evict until the data fits behind the used part of the pool
+	while (CACHE_POOL_SIZE - cache_used < alloc)
+	{
+		_CACHE_Free(_CACHE_Lru());
+		cache_evictions++;
+	}
+
+	CACHE_Slot_t *entry = &cache_slots[slot];
+	entry->offset = cache_used;
+	entry->alloc = alloc;
+	entry->last_used = ++cache_clock;
+	entry->loaded = 1;
+	entry->ready = 0;
+	entry->bmp.width = width;
+	entry->bmp.height = height;
+	entry->bmp.format = format;
+	entry->bmp.flags = 0;
+	entry->bmp.size = size;
+	entry->name[0] = 0;
+	if (name)
+	{
+		strncpy(entry->name, name, CACHE_NAME_LEN - 1);
+		entry->name[CACHE_NAME_LEN - 1] = 0;
+	}
+	cache_used += alloc;
+
+	UPLOAD_BeginStore(&cache_pool[entry->offset], size, _CACHE_Ready, entry);
+	return slot;
+}
+
+/**
+ * @brief Finds a slot by name.
+ */
+int CACHE_Find(const char *name)
+{
+	for (int n = 0; n < CACHE_SLOTS; n++)
+	{
+		if (cache_slots[n].ready && strncmp(cache_slots[n].name, name, CACHE_NAME_LEN) == 0) return n;
+	}
+	cache_misses++;
+	return -1;
+}
+
+/**
+ * @brief Returns the bitmap of a loaded slot and marks it as recently used.
+ */
+const ASSET_Bitmap_t *CACHE_Get(int slot)
+{
+	if (slot < 0 || slot >= CACHE_SLOTS || !cache_slots[slot].ready)
+	{
+		cache_misses++;
+		return 0;
+	}
+
+	cache_hits++;
+	cache_slots[slot].last_used = ++cache_clock;
+	return &cache_slots[slot].bmp;
+}
+
+/**
+ * @brief Reads the cache counters.
+ */
+void CACHE_GetStats(CACHE_Stats_t *stats, int reset)
+{
+	stats->hits = cache_hits;
+	stats->misses = cache_misses;
+	stats->evictions = cache_evictions;
+	stats->used = cache_used;
+	stats->slots = 0;
+	for (int n = 0; n < CACHE_SLOTS; n++)
+	{
+		if (cache_slots[n].ready) stats->slots++;
+	}
+
+	if (reset)
+	{
+		cache_hits = 0;
+		cache_misses = 0;
+		cache_evictions = 0;
+	}
+}
+
+/**
+ * @brief Frees a slot and closes the gap in the pool.
+ * @param slot Loaded slot.
+ */
+static void _CACHE_Free(int slot)
+{
+	CACHE_Slot_t *entry = &cache_slots[slot];
+	uint32_t end = entry->offset + entry->alloc;
+
+	memmove(&cache_pool[entry->offset], &cache_pool[end], cache_used - end);
+
+	for (int n = 0; n < CACHE_SLOTS; n++)
+	{
+		if (cache_slots[n].loaded && cache_slots[n].offset > entry->offset)
+		{
+			cache_slots[n].offset -= entry->alloc;
+			_CACHE_Bind(&cache_slots[n]);
+		}
+	}
+
+	cache_used -= entry->alloc;
+	entry->loaded = 0;
+	entry->ready = 0;
+}
+
+/**
+ * @brief Returns the least recently used loaded slot.
+ */
+static int _CACHE_Lru(void)
+{
+	int lru = 0;
+
+	for (int n = 1; n < CACHE_SLOTS; n++)
+	{
+		if (!cache_slots[lru].loaded ||
+			(cache_slots[n].loaded && cache_slots[n].last_used < cache_slots[lru].last_used))
+		{
+			lru = n;
+		}
+	}
+	return lru;
+}
+
+/**
+ * @brief Points the descriptor to the data of the slot in the pool.
+ *
+ * Paletted formats start with their palette, the pixels follow.
+ */
+static void _CACHE_Bind(CACHE_Slot_t *entry)
+{
+	uint8_t *data = &cache_pool[entry->offset];
+	uint16_t palette = 0;
+
+	if (entry->bmp.format == ASSET_FMT_1BPP) palette = 2;
+	if (entry->bmp.format == ASSET_FMT_4BPP) palette = 16;
+
+	entry->bmp.palette = palette ? data : 0;
+	entry->bmp.data = data + palette;
+}
+
+/**
+ * @brief Called by the upload when all data of a slot is received.
+ * @param context Slot that is complete.
+ */
+static void _CACHE_Ready(void *context)
+{
+	CACHE_Slot_t *entry = (CACHE_Slot_t *)context;
+	uint16_t palette = 0;
+
+	if (entry->bmp.format == ASSET_FMT_1BPP) palette = 2;
+	if (entry->bmp.format == ASSET_FMT_4BPP) palette = 16;
+
+	// Size of the pixel data without the palette
+	if (entry->bmp.size <= palette) return;
+	entry->bmp.size -= palette;
+	_CACHE_Bind(entry);
+
+	if (entry->bmp.format == ASSET_FMT_RAW &&
+		memchr(entry->bmp.data, ASSET_TRANSPARENT, entry->bmp.size) == 0)
+	{
+		entry->bmp.flags = ASSET_FLAG_OPAQUE;
+	}
+	entry->ready = 1;
+}
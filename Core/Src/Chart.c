@@ -0,0 +1,159 @@
+/**
+ * @file Chart.c
+ * @brief Strip chart code file
+ *
+ * This file contains the strip charts. The vertical grid lines belong to
+ * the samples (every grid-th sample), so they scroll with the plot; the
+ * horizontal grid lines are fixed rows and only stamped in new columns.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Chart.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+/**
+ * @brief One strip chart.
+ */
+typedef struct {
+	uint16_t width;				/**< Width of the region, 0 if the id is not used */
+	uint16_t height;			/**< Height of the region */
+	uint16_t x;					/**< Upper-left X-coordinate */
+	uint16_t y;					/**< Upper-left Y-coordinate */
+	int16_t min;				/**< Sample value at the bottom row */
+	int16_t max;				/**< Sample value at the top row */
+	uint8_t color;				/**< Trace color */
+	uint8_t background;			/**< Region color */
+	uint8_t grid_color;			/**< Grid line color */
+	uint8_t grid;				/**< Pixels between grid lines, 0: no grid */
+	uint8_t phase;				/**< Column 0 shows a vertical grid line when phase is 0 */
+	int16_t last;				/**< Row of the last sample, -1 before the first sample */
+} CHART_t;
+
+static CHART_t charts[CHART_SLOTS];
+
+static uint16_t _CHART_Row(const CHART_t *chart, int16_t value);
+static void _CHART_DrawColumns(CHART_t *chart, uint16_t column, uint16_t count);
+
+/**
+ * @brief Creates or replaces a strip chart and draws it empty.
+ */
+int CHART_Create(int id, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+				 int16_t min, int16_t max, uint8_t color, uint8_t background,
+				 uint8_t grid_color, uint8_t grid)
+{
+	if (id < 0 || id >= CHART_SLOTS) return 1;
+	if (width < 2 || height < 2 || x + width > VGA_DISPLAY_X || y + height > VGA_DISPLAY_Y) return 1;
+	if (max <= min) return 1;
+
+	CHART_t *chart = &charts[id];
+	chart->x = x;
+	chart->y = y;
+	chart->width = width;
+	chart->height = height;
+	chart->min = min;
+	chart->max = max;
+	chart->color = color;
+	chart->background = background;
+	chart->grid_color = grid_color;
+	chart->grid = grid;
+	chart->last = -1;
+	chart->phase = 0;
+
+	BLIT_Wait();
+	_CHART_DrawColumns(chart, 0, width);
+	return 0;
+}
+
+/**
+ * @brief Appends samples, the plot scrolls left by one column per sample.
+ */
+int CHART_Append(int id, const int16_t *samples, uint16_t count)
+{
+	if (id < 0 || id >= CHART_SLOTS || charts[id].width == 0) return 1;
+	if (count == 0 || count > CHART_MAX_SAMPLES) return 1;
+
+	CHART_t *chart = &charts[id];
+	uint16_t shift = count < chart->width ? count : chart->width;
+
+	// Samples that scroll out at once are not drawn, only the one before the first drawn
+	if (count > shift)
+	{
+		chart->last = _CHART_Row(chart, samples[count - shift - 1]);
+		samples += count - shift;
+	}
+
+	// Queued DMA jobs may still write the region
+	BLIT_Wait();
+	if (shift < chart->width)
+	{
+		UB_VGA_CopyRect(chart->x + shift, chart->y, chart->width - shift, chart->height, chart->x, chart->y);
+	}
+	if (chart->grid)
+	{
+		chart->phase = (chart->phase + count) % chart->grid;
+	}
+	_CHART_DrawColumns(chart, chart->width - shift, shift);
+
+	// The trace: a vertical run from the previous sample to this one
+	for (uint16_t n = 0; n < shift; n++)
+	{
+		uint16_t row = _CHART_Row(chart, samples[n]);
+		uint16_t top = row, bottom = row;
+
+		if (chart->last >= 0)
+		{
+			if (chart->last < top) top = chart->last;
+			if (chart->last > bottom) bottom = chart->last;
+		}
+		for (uint16_t yp = top; yp <= bottom; yp++)
+		{
+			UB_VGA_SetPixel(chart->x + chart->width - shift + n, yp, chart->color);
+		}
+		chart->last = row;
+	}
+	return 0;
+}
+
+/**
+ * @brief Converts a sample value to a screen row, clamped to the region.
+ */
+static uint16_t _CHART_Row(const CHART_t *chart, int16_t value)
+{
+	if (value < chart->min) value = chart->min;
+	if (value > chart->max) value = chart->max;
+
+	int32_t scaled = ((int32_t)(value - chart->min) * (chart->height - 1)) / (chart->max - chart->min);
+	return chart->y + chart->height - 1 - scaled;
+}
+
+/**
+ * @brief Draws background and grid of a number of columns, without the trace.
+ * @param chart Strip chart.
+ * @param column First column (relative to the region).
+ * @param count Number of columns.
+ */
+static void _CHART_DrawColumns(CHART_t *chart, uint16_t column, uint16_t count)
+{
+	uint16_t x = chart->x + column;
+
+	// Horizontal grid lines count from the bottom row, like the values
+	for (uint16_t row = 0; row < chart->height; row++)
+	{
+		int line = chart->grid && ((chart->height - 1 - row) % chart->grid) == 0;
+		UB_VGA_FillSpan(x, chart->y + row, count, line ? chart->grid_color : chart->background);
+	}
+	if (chart->grid == 0) return;
+
+	for (uint16_t n = column; n < column + count; n++)
+	{
+		if ((chart->phase + n) % chart->grid) continue;
+
+		for (uint16_t row = 0; row < chart->height; row++)
+		{
+			UB_VGA_SetPixel(chart->x + n, chart->y + row, chart->grid_color);
+		}
+	}
+}
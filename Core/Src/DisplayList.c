@@ -0,0 +1,392 @@
+/**
+ * @file DisplayList.c
+ * @brief Display list code file
+ *
+ * This file contains the display lists. All lists share one pool, a list
+ * is a run of records: op, number of parameters, length of the strings,
+ * the parameters (16 bit) and the strings. Replacing a list moves the
+ * lists behind it down, so the pool never has holes.
+ *
+ * One list can be copied to flash sector 11 as boot script: a header
+ * (magic, size, checksum) followed by the same records. The script is
+ * played from flash at power-on, before the UART is served.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "DisplayList.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32f4xx.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+#define DL_HEADER_SIZE		3 // op, argc, text_len
+#define DL_OPS				(sizeof(dl_ops) / sizeof(dl_ops[0]))
+
+// Flash keys and all error flags in FLASH->SR
+#define DL_FLASH_KEY1		0x45670123
+#define DL_FLASH_KEY2		0xCDEF89AB
+#define DL_FLASH_ERRORS		(FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR)
+
+// Core clock: HSE 8 MHz / PLL_M 4 * PLL_N 504 / PLL_P 8 (SystemCoreClock keeps its 168 MHz default)
+#define DL_CORE_MHZ			126
+
+/**
+ * @brief Header of the boot script in flash.
+ */
+typedef struct {
+	uint32_t magic;				/**< DL_BOOT_MAGIC if a script was written */
+	uint32_t size;				/**< Bytes of all records */
+	uint32_t checksum;			/**< Sum of all record bytes */
+} DL_Boot_t;
+
+/**
+ * @brief One display list in the pool.
+ */
+typedef struct {
+	uint16_t start;				/**< First byte in the pool */
+	uint16_t size;				/**< Bytes of all records */
+	uint8_t used;				/**< 1 if the list was recorded */
+} DL_List_t;
+
+// Layouts, in DL_OP_ order (same parameters as the immediate commands)
+static const DL_Op_t dl_ops[] = {
+	{ "pixel",			DL_OP_PIXEL,		"xyc" },
+	{ "lijn",			DL_OP_LINE,			"xyxycnN" },
+	{ "rechthoek",		DL_OP_RECT,			"xynncnNC" },
+	{ "cirkel",			DL_OP_CIRCLE,		"xyncN" },
+	{ "figuur",			DL_OP_FIGURE,		"xyxyxyxyxycN" },
+	{ "tekst",			DL_OP_TEXT,			"xycssNS" },
+	{ "bitmap",			DL_OP_BITMAP,		"bxyC" },
+	{ "bitmapdraai",	DL_OP_BITMAP_EX,	"bxynmnC" },
+	{ "clearscherm",	DL_OP_CLEAR,		"c" },
+};
+
+static uint8_t dl_pool[DL_POOL_SIZE];
+static uint16_t dl_pool_used = 0;
+static DL_List_t dl_lists[DL_LISTS];
+static int dl_recording = -1;	// List id that is recorded, -1 for none
+
+static uint32_t dl_boot_cycles = 0;	// CPU cycles from SystemInit() until the boot script was drawn
+static uint32_t dl_boot_frame = 0;	// Frame counter when the boot script was drawn
+
+static void _DL_Remove(int id);
+static int _DL_Play(const uint8_t *rec, uint16_t size, int dx, int dy);
+static int _DL_Exec(DL_Cmd_t *cmd);
+static int _DL_FlashWait(void);
+static uint32_t _DL_Checksum(const uint8_t *data, uint16_t size);
+
+/**
+ * @brief Looks up a command that can be recorded.
+ */
+const DL_Op_t *LIST_FindOp(const char *name)
+{
+	for (uint8_t n = 0; n < sizeof(dl_ops) / sizeof(dl_ops[0]); n++)
+	{
+		if (strcmp(dl_ops[n].name, name) == 0) return &dl_ops[n];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Starts recording a display list, an existing list with this id is replaced.
+ */
+int LIST_Record(int id)
+{
+	if (id < 0 || id >= DL_LISTS || dl_recording >= 0) return ERR_LIST_INVALID;
+
+	_DL_Remove(id);
+
+	// Records are appended behind the last list
+	dl_lists[id].start = dl_pool_used;
+	dl_lists[id].size = 0;
+	dl_recording = id;
+	return 0;
+}
+
+/**
+ * @brief Adds one parsed command to the list that is recorded.
+ */
+int LIST_Add(const DL_Cmd_t *cmd)
+{
+	if (dl_recording < 0) return ERR_LIST_INVALID;
+
+	uint16_t size = DL_HEADER_SIZE + cmd->argc * sizeof(int16_t) + cmd->text_len;
+	if (dl_pool_used + size > DL_POOL_SIZE) return ERR_LIST_FULL;
+
+	uint8_t *rec = &dl_pool[dl_pool_used];
+	rec[0] = cmd->op;
+	rec[1] = cmd->argc;
+	rec[2] = cmd->text_len;
+	memcpy(&rec[DL_HEADER_SIZE], cmd->arg, cmd->argc * sizeof(int16_t));
+	memcpy(&rec[DL_HEADER_SIZE + cmd->argc * sizeof(int16_t)], cmd->text, cmd->text_len);
+
+	dl_pool_used += size;
+	dl_lists[dl_recording].size += size;
+	return 0;
+}
+
+/**
+ * @brief Stops recording.
+ */
+int LIST_Stop(void)
+{
+	if (dl_recording < 0) return ERR_LIST_INVALID;
+
+	dl_lists[dl_recording].used = 1;
+	dl_recording = -1;
+	return 0;
+}
+
+/**
+ * @brief Returns whether a display list is recorded.
+ */
+int LIST_Recording(void)
+{
+	return dl_recording >= 0;
+}
+
+/**
+ * @brief Replays a display list.
+ */
+int LIST_Play(int id, int dx, int dy)
+{
+	if (id < 0 || id >= DL_LISTS || !dl_lists[id].used) return ERR_LIST_INVALID;
+
+	return _DL_Play(&dl_pool[dl_lists[id].start], dl_lists[id].size, dx, dy);
+}
+
+/**
+ * @brief Writes a display list to flash as boot script, or erases the boot script.
+ */
+int LIST_SaveBoot(int id)
+{
+	if (id < -1 || id >= DL_LISTS || (id >= 0 && !dl_lists[id].used)) return ERR_LIST_INVALID;
+
+	DL_Boot_t header = { DL_BOOT_MAGIC, 0, 0 };
+	const uint8_t *records = NULL;
+	if (id >= 0)
+	{
+		records = &dl_pool[dl_lists[id].start];
+		header.size = dl_lists[id].size;
+		header.checksum = _DL_Checksum(records, header.size);
+	}
+
+	BLIT_Wait();
+
+	// Unlock and clear old error flags
+	if (FLASH->CR & FLASH_CR_LOCK)
+	{
+		FLASH->KEYR = DL_FLASH_KEY1;
+		FLASH->KEYR = DL_FLASH_KEY2;
+	}
+	FLASH->SR = FLASH_SR_EOP | FLASH_SR_SOP | DL_FLASH_ERRORS;
+
+	// Sector erase, 32 bit parallelism (2.7-3.6 V)
+	FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_SER | (DL_BOOT_SECTOR * FLASH_CR_SNB_0);
+	FLASH->CR |= FLASH_CR_STRT;
+	int ErrorCode = _DL_FlashWait();
+
+	// Records first, the header last: a script that was cut off has no magic
+	if (!ErrorCode && id >= 0)
+	{
+		FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_PG;
+		for (uint16_t n = 0; n < header.size && !ErrorCode; n += 4)
+		{
+			uint32_t word = 0xFFFFFFFF;
+			memcpy(&word, &records[n], (header.size - n < 4) ? header.size - n : 4);
+			*(volatile uint32_t *)(DL_BOOT_ADDR + sizeof(DL_Boot_t) + n) = word;
+			ErrorCode = _DL_FlashWait();
+		}
+		for (uint16_t n = 0; n < sizeof(DL_Boot_t) / 4 && !ErrorCode; n++)
+		{
+			*(volatile uint32_t *)(DL_BOOT_ADDR + n * 4) = ((uint32_t *)&header)[n];
+			ErrorCode = _DL_FlashWait();
+		}
+	}
+
+	FLASH->CR = FLASH_CR_LOCK;
+
+	// The data cache may still hold the old sector
+	FLASH->ACR &= ~FLASH_ACR_DCEN;
+	FLASH->ACR |= FLASH_ACR_DCRST;
+	FLASH->ACR &= ~FLASH_ACR_DCRST;
+	FLASH->ACR |= FLASH_ACR_DCEN;
+	return ErrorCode;
+}
+
+/**
+ * @brief Plays the boot script from flash.
+ */
+int LIST_Boot(void)
+{
+	const DL_Boot_t *header = (const DL_Boot_t *)DL_BOOT_ADDR;
+	const uint8_t *records = (const uint8_t *)(DL_BOOT_ADDR + sizeof(DL_Boot_t));
+
+	if (header->magic != DL_BOOT_MAGIC || header->size > DL_POOL_SIZE) return 1;
+	if (header->checksum != _DL_Checksum(records, header->size)) return 1;
+
+	_DL_Play(records, header->size, 0, 0);
+	BLIT_Wait();
+
+	// The cycle counter runs from the end of SystemInit() in main()
+	dl_boot_cycles = DWT->CYCCNT;
+	dl_boot_frame = VGA.frame_cnt;
+	return 0;
+}
+
+/**
+ * @brief Returns the boot script size and the time to the first frame.
+ */
+void LIST_GetBootStats(DL_BootStats_t *stats)
+{
+	const DL_Boot_t *header = (const DL_Boot_t *)DL_BOOT_ADDR;
+
+	stats->script = (header->magic == DL_BOOT_MAGIC) ? header->size : 0;
+	stats->played = dl_boot_cycles != 0;
+	stats->drawn_us = dl_boot_cycles / DL_CORE_MHZ;
+	// The script is visible from the frame after it was drawn
+	stats->frame = dl_boot_frame + 1;
+}
+
+/**
+ * @brief Plays a run of records.
+ * @param rec First record.
+ * @param size Bytes of all records.
+ * @param dx Offset added to every X-coordinate.
+ * @param dy Offset added to every Y-coordinate.
+ * @return 0 if no errors occured, otherwise returns the first error code.
+ */
+static int _DL_Play(const uint8_t *rec, uint16_t size, int dx, int dy)
+{
+	const uint8_t *end = rec + size;
+	DL_Cmd_t cmd;
+	int ErrorCode = 0;
+
+	while (rec + DL_HEADER_SIZE <= end)
+	{
+		cmd.op = rec[0];
+		cmd.argc = rec[1];
+		cmd.text_len = rec[2];
+
+		// Records from flash are checked before they are used
+		uint16_t length = DL_HEADER_SIZE + cmd.argc * sizeof(int16_t) + cmd.text_len;
+		if (cmd.op >= DL_OPS || cmd.argc > DL_MAX_ARGS || cmd.text_len > DL_TEXT_LEN || rec + length > end)
+			return ERR_LIST_INVALID;
+
+		memcpy(cmd.arg, &rec[DL_HEADER_SIZE], cmd.argc * sizeof(int16_t));
+		memcpy(cmd.text, &rec[DL_HEADER_SIZE + cmd.argc * sizeof(int16_t)], cmd.text_len);
+		rec += length;
+
+		// Move the coordinates by the offset
+		const char *layout = dl_ops[cmd.op].layout;
+		for (uint8_t n = 0; n < cmd.argc; n++)
+		{
+			if (layout[n] == 'x') cmd.arg[n] += dx;
+			if (layout[n] == 'y') cmd.arg[n] += dy;
+		}
+
+		int result = _DL_Exec(&cmd);
+		if (result && ErrorCode == 0) ErrorCode = result;
+	}
+	return ErrorCode;
+}
+
+/**
+ * @brief Removes a list from the pool, the lists behind it move down.
+ * @param id Display list id.
+ */
+static void _DL_Remove(int id)
+{
+	uint16_t start = dl_lists[id].start;
+	uint16_t size = dl_lists[id].size;
+
+	dl_lists[id].used = 0;
+	dl_lists[id].size = 0;
+	if (size == 0) return;
+
+	memmove(&dl_pool[start], &dl_pool[start + size], dl_pool_used - start - size);
+	dl_pool_used -= size;
+
+	for (int n = 0; n < DL_LISTS; n++)
+	{
+		if (dl_lists[n].size && dl_lists[n].start > start) dl_lists[n].start -= size;
+	}
+}
+
+/**
+ * @brief Executes one parsed command.
+ * @param cmd Parsed command, the offset is already applied.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+static int _DL_Exec(DL_Cmd_t *cmd)
+{
+	int16_t *a = cmd->arg;
+
+	switch (cmd->op)
+	{
+	case DL_OP_PIXEL:
+		if (a[0] < 0 || a[0] >= VGA_DISPLAY_X || a[1] < 0 || a[1] >= VGA_DISPLAY_Y) return ERR_OBJ_OUT_OF_BOUNDS;
+		BLIT_Wait();
+		UB_VGA_SetPixel(a[0], a[1], a[2]);
+		return 0;
+
+	case DL_OP_LINE:
+		return API_draw_line(a[0], a[1], a[2], a[3], a[5], a[4], (a[6] == DL_NONE) ? 0 : a[6]);
+
+	case DL_OP_RECT:
+		return API_draw_rectangle(a[0], a[1], a[2], a[3], a[4], a[5],
+								  (a[6] == DL_NONE) ? 1 : a[6], (a[7] == DL_NONE) ? a[4] : a[7]);
+
+	case DL_OP_CIRCLE:
+		return API_draw_circle(a[0], a[1], a[2], a[3], (a[4] == DL_NONE) ? 0 : a[4]);
+
+	case DL_OP_FIGURE:
+		return API_draw_figure(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10],
+							   (a[11] == DL_NONE) ? 0 : a[11]);
+
+	case DL_OP_TEXT:
+		return API_draw_text(a[0], a[1], a[2], &cmd->text[a[3]], &cmd->text[a[4]], (a[5] == DL_NONE) ? 1 : a[5],
+							 (a[6] == DL_NONE) ? "normaal" : &cmd->text[a[6]]);
+
+	case DL_OP_BITMAP:
+		if (a[3] == DL_NONE) return API_draw_bitmap(a[1], a[2], a[0]);
+		return API_draw_bitmap_color(a[1], a[2], a[0], a[3]);
+
+	case DL_OP_BITMAP_EX:
+		return API_draw_bitmap_ex(a[1], a[2], a[0], a[3], a[4], a[5], (a[6] == DL_NONE) ? -1 : a[6]);
+
+	case DL_OP_CLEAR:
+		return API_clearscreen(a[0]);
+	}
+	return ERR_LIST_INVALID;
+}
+
+/**
+ * @brief Waits until the flash operation is done.
+ * @return 0 if no errors occured, otherwise returns ERR_FLASH_FAILED.
+ */
+static int _DL_FlashWait(void)
+{
+	while (FLASH->SR & FLASH_SR_BSY);
+
+	if (FLASH->SR & DL_FLASH_ERRORS) return ERR_FLASH_FAILED;
+	return 0;
+}
+
+/**
+ * @brief Adds all bytes, to recognise a boot script that was not written completely.
+ */
+static uint32_t _DL_Checksum(const uint8_t *data, uint16_t size)
+{
+	uint32_t sum = 0;
+
+	for (uint16_t n = 0; n < size; n++)
+	{
+		sum += data[n];
+	}
+	return sum;
+}
@@ -0,0 +1,290 @@
+/**
+ * @file Font.c
+ * @brief Font registry code file
+ *
+ * This file contains the font registry and the glyph store for
+ * uploaded fonts. The glyph store is kept compact like the asset
+ * cache: a replaced font is removed and the fonts behind it move down.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Font.h"
+#include "Upload.h"
+#include "fonts.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Place of an uploaded font in the glyph store.
+ */
+typedef struct {
+	uint16_t offset;			/**< Start of the blob in the store */
+	uint16_t alloc;				/**< Bytes reserved (multiple of 4) */
+	uint16_t size;				/**< Bytes of the blob */
+	uint8_t loaded;				/**< Blob has room reserved in the store */
+} FONT_Store_t;
+
+// Uploaded glyphs are only read by the CPU, so they can live in CCMRAM
+static uint8_t font_store[FONT_STORE_SIZE] __attribute__((section(".ccmram"), aligned(4)));
+
+static FONT_t font_table[FONT_SLOTS];
+static FONT_Store_t font_blobs[FONT_SLOTS];
+static uint32_t font_used = 0;
+
+static void _FONT_Builtin(int id, const char *name, const unsigned short *glcd, uint16_t stride, uint8_t height);
+static void _FONT_Free(int id);
+static int _FONT_Parse(int id);
+static void _FONT_Ready(void *context);
+
+/**
+ * @brief Registers the built-in fonts and clears the upload slots.
+ */
+void FONT_Init(void)
+{
+	memset(font_table, 0, sizeof(font_table));
+	memset(font_blobs, 0, sizeof(font_blobs));
+	font_used = 0;
+
+	_FONT_Builtin(FONT_CONSOLAS, "consolas", Consolas, 13, 11);
+	_FONT_Builtin(FONT_COMICSANS, "comicsans", ComicSans, 17, 9);
+	_FONT_Builtin(FONT_ARIAL, "arial", Arial, 21, 10);
+}
+
+/**
+ * @brief Returns a font by id.
+ */
+const FONT_t *FONT_Get(int id)
+{
+	if (id < 0 || id >= FONT_SLOTS) return 0;
+	if (font_table[id].format == FONT_FMT_NONE) return 0;
+	return &font_table[id];
+}
+
+/**
+ * @brief Finds a font by id ("3") or by name ("consolas").
+ */
+const FONT_t *FONT_Find(const char *str)
+{
+	return FONT_Get(FONT_FindId(str));
+}
+
+/**
+ * @brief Finds the id of a font by id ("3") or by name ("consolas").
+ */
+int FONT_FindId(const char *str)
+{
+	if (str == 0) return -1;
+	while (*str == ' ') str++;
+
+	if (*str >= '0' && *str <= '9') return FONT_Get(atoi(str)) ? atoi(str) : -1;
+
+	for (int id = 0; id < FONT_SLOTS; id++)
+	{
+		if (font_table[id].format != FONT_FMT_NONE && strcmp(font_table[id].name, str) == 0)
+		{
+			return id;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief Returns the width of a glyph.
+ */
+uint8_t FONT_GlyphWidth(const FONT_t *font, char c)
+{
+	uint8_t index = (uint8_t)c - font->first;
+
+	if ((uint8_t)c < font->first || index >= font->count) return 0;
+
+	if (font->format == FONT_FMT_GLCD) return (uint8_t)font->glcd[index * font->stride];
+	return font->widths[index];
+}
+
+/**
+ * @brief Returns the data of a glyph.
+ */
+const void *FONT_Glyph(const FONT_t *font, char c)
+{
+	uint8_t index = (uint8_t)c - font->first;
+
+	if ((uint8_t)c < font->first || index >= font->count) return 0;
+
+	if (font->format == FONT_FMT_GLCD) return &font->glcd[index * font->stride];
+	return &font->bitmap[font->offsets[index]];
+}
+
+/**
+ * @brief Renders the left 8 columns of a glyph as rows of one byte.
+ */
+int FONT_GlyphRows(const FONT_t *font, char c, uint8_t *rows, uint8_t height)
+{
+	const void *glyph = FONT_Glyph(font, c);
+	uint8_t width = FONT_GlyphWidth(font, c);
+
+	memset(rows, 0, height);
+	if (glyph == 0) return 1;
+	if (width > 8) width = 8;
+
+	if (font->format == FONT_FMT_GLCD)
+	{
+		// Column-major: two values (16 rows) per column after the width
+		const unsigned short *data = glyph;
+		for (uint8_t col = 0; col < width; col++)
+		{
+			unsigned int bits = data[(col * 2) + 1] | (data[(col * 2) + 2] << 8);
+			for (uint8_t row = 0; row < height && row < 16; row++)
+			{
+				if (bits & (1 << row)) rows[row] |= 0x80 >> col;
+			}
+		}
+		return 0;
+	}
+
+	// Row-major: the first byte of every row holds the left 8 pixels
+	const uint8_t *data = glyph;
+	uint8_t stride = (FONT_GlyphWidth(font, c) + 7) / 8;
+	uint8_t mask = 0xFF << (8 - width);
+	for (uint8_t row = 0; row < height && row < font->height; row++)
+	{
+		rows[row] = data[row * stride] & mask;
+	}
+	return 0;
+}
+
+/**
+ * @brief Reserves an upload slot and starts the upload of a font blob.
+ */
+int FONT_Store(int id, const char *name, uint16_t size)
+{
+	uint16_t alloc = (size + 3) & ~3;
+
+	// The pending store (if any) may point to data that is moved below
+	UPLOAD_Abort();
+
+	if (id < FONT_BUILTIN || id >= FONT_SLOTS) return 1;
+	if (size <= FONT_BLOB_HEADER || alloc > FONT_STORE_SIZE) return 1;
+
+	// Blobs of aborted uploads are never completed, the old font is replaced
+	for (int n = FONT_BUILTIN; n < FONT_SLOTS; n++)
+	{
+		if (font_blobs[n].loaded && (n == id || font_table[n].format == FONT_FMT_NONE)) _FONT_Free(n);
+	}
+
+	if (FONT_STORE_SIZE - font_used < alloc) return 1;
+
+	FONT_Store_t *blob = &font_blobs[id];
+	blob->offset = font_used;
+	blob->alloc = alloc;
+	blob->size = size;
+	blob->loaded = 1;
+	font_used += alloc;
+
+	font_table[id].name[0] = 0;
+	if (name)
+	{
+		strncpy(font_table[id].name, name, FONT_NAME_LEN - 1);
+		font_table[id].name[FONT_NAME_LEN - 1] = 0;
+	}
+
+	UPLOAD_BeginStore(&font_store[blob->offset], size, _FONT_Ready, &font_blobs[id]);
+	return 0;
+}
+
+/**
+ * @brief Fills a registry entry with a font from fonts.h.
+ */
+static void _FONT_Builtin(int id, const char *name, const unsigned short *glcd, uint16_t stride, uint8_t height)
+{
+	FONT_t *font = &font_table[id];
+
+	font->format = FONT_FMT_GLCD;
+	font->height = height;
+	font->first = ' ';
+	font->count = FONT_MAX_GLYPHS;
+	font->spacing = 1;
+	font->stride = stride;
+	font->glcd = glcd;
+	strncpy(font->name, name, FONT_NAME_LEN - 1);
+}
+
+/**
+ * @brief Removes an uploaded font and closes the gap in the store.
+ * @param id Slot with a loaded blob.
+ */
+static void _FONT_Free(int id)
+{
+	FONT_Store_t *blob = &font_blobs[id];
+	uint32_t end = blob->offset + blob->alloc;
+
+	memmove(&font_store[blob->offset], &font_store[end], font_used - end);
+
+	for (int n = FONT_BUILTIN; n < FONT_SLOTS; n++)
+	{
+		if (font_blobs[n].loaded && font_blobs[n].offset > blob->offset)
+		{
+			font_blobs[n].offset -= blob->alloc;
+			if (font_table[n].format != FONT_FMT_NONE) _FONT_Parse(n);
+		}
+	}
+
+	font_used -= blob->alloc;
+	blob->loaded = 0;
+	font_table[id].format = FONT_FMT_NONE;
+}
+
+/**
+ * @brief Checks a blob and fills the registry entry and the glyph offsets.
+ * @param id Slot with a complete blob.
+ * @return 0 if the blob is valid, otherwise returns 1.
+ */
+static int _FONT_Parse(int id)
+{
+	FONT_Store_t *blob = &font_blobs[id];
+	FONT_t *font = &font_table[id];
+	const uint8_t *data = &font_store[blob->offset];
+
+	uint8_t height = data[0];
+	uint8_t count = data[2];
+	uint32_t offset = 0;
+
+	if (height == 0 || count == 0 || count > FONT_MAX_GLYPHS) return 1;
+	if (FONT_BLOB_HEADER + count > blob->size) return 1;
+
+	font->widths = &data[FONT_BLOB_HEADER];
+	font->bitmap = &data[FONT_BLOB_HEADER + count];
+
+	// Offsets are computed once, so a glyph is found with one lookup
+	for (int n = 0; n < count; n++)
+	{
+		font->offsets[n] = offset;
+		offset += height * ((font->widths[n] + 7) / 8);
+	}
+	if (FONT_BLOB_HEADER + count + offset > blob->size) return 1;
+
+	font->height = height;
+	font->first = data[1];
+	font->count = count;
+	font->spacing = data[3];
+	font->stride = 0;
+	font->glcd = 0;
+	font->format = FONT_FMT_PACKED;
+	return 0;
+}
+
+/**
+ * @brief Called by the upload when all bytes of a blob are received.
+ * @param context Store entry that is complete.
+ */
+static void _FONT_Ready(void *context)
+{
+	int id = (FONT_Store_t *)context - font_blobs;
+
+	if (_FONT_Parse(id))
+	{
+		font_table[id].format = FONT_FMT_NONE;
+	}
+}
@@ -0,0 +1,270 @@
+/**
+ * @file Gauge.c
+ * @brief Gauge widget code file
+ *
+ * This file contains the gauges. The angles come from a quarter sine
+ * table, the needle end points of every angle step are calculated once
+ * when the gauge is created. A needle is a line from the hub to its end
+ * point; the same line is walked to save, draw and restore its pixels.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Gauge.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+#define GAUGE_START			225 // Angle of the minimum (degrees, counter-clockwise from 3 o'clock)
+
+// Walking a line: only draw, save the pixels under it first, or put them back
+#define GAUGE_DRAW			0
+#define GAUGE_SAVE			1
+#define GAUGE_RESTORE		2
+
+/**
+ * @brief One gauge.
+ */
+typedef struct {
+	uint8_t used;				/**< Gauge is on the screen */
+	uint8_t radius;				/**< Radius of the dial */
+	uint8_t hub;				/**< Radius of the hub, the needle starts outside it */
+	uint8_t length;				/**< Needle length from the center */
+	int16_t x;					/**< X-coordinate of the center */
+	int16_t y;					/**< Y-coordinate of the center */
+	int16_t min;				/**< Value at the start of the sweep */
+	int16_t max;				/**< Value at the end of the sweep */
+	uint8_t needle_color;		/**< Needle color */
+	uint8_t step;				/**< Angle step of the needle on the screen */
+	int8_t tip[GAUGE_STEPS][2];	/**< Needle end point per angle step, from the center */
+	uint8_t under[GAUGE_MAX_RADIUS + 1]; /**< Dial pixels under the needle */
+} GAUGE_t;
+
+// sin(0..90 degrees) * 16384
+static const int16_t gauge_sine[91] = {
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+static GAUGE_t gauges[GAUGE_SLOTS];
+
+static int _GAUGE_Sin(int angle);
+static void _GAUGE_Point(int angle, int radius, int *dx, int *dy);
+static void _GAUGE_Line(GAUGE_t *gauge, int x0, int y0, int x1, int y1, int mode, uint8_t color);
+static void _GAUGE_Needle(GAUGE_t *gauge, int mode);
+static void _GAUGE_Disc(int x, int y, int radius, uint8_t color);
+
+/**
+ * @brief Creates or replaces a gauge and draws the dial with the needle at the minimum.
+ */
+int GAUGE_Set(int id, int x, int y, int radius, int min, int max,
+			  int color, int background, int needle_color, const char *label)
+{
+	if (id < 0 || id >= GAUGE_SLOTS) return ERR_GAUGE_INVALID;
+	if (radius < GAUGE_MIN_RADIUS || radius > GAUGE_MAX_RADIUS) return ERR_CIR_RADIUS_INVALID;
+	if (x - radius < 0 || x + radius >= VGA_DISPLAY_X || y - radius < 0 || y + radius >= VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+	if (min >= max || min < INT16_MIN || max > INT16_MAX) return ERR_GAUGE_INVALID;
+
+	GAUGE_t *gauge = &gauges[id];
+	gauge->used = 0;
+	gauge->x = x;
+	gauge->y = y;
+	gauge->radius = radius;
+	gauge->hub = radius / 16 + 2;
+	gauge->length = radius - 8;
+	gauge->min = min;
+	gauge->max = max;
+	gauge->needle_color = needle_color;
+	gauge->step = 0;
+
+	// Needle geometry per angle step
+	for (int n = 0; n < GAUGE_STEPS; n++)
+	{
+		int dx, dy;
+		_GAUGE_Point(GAUGE_START - (n * GAUGE_SWEEP) / (GAUGE_STEPS - 1), gauge->length, &dx, &dy);
+		gauge->tip[n][0] = dx;
+		gauge->tip[n][1] = dy;
+	}
+
+	// Dial: disc, ring and ticks
+	BLIT_Wait();
+	_GAUGE_Disc(x, y, radius, background);
+	for (int n = 0; n < 360; n++)
+	{
+		int dx, dy;
+		_GAUGE_Point(n, radius, &dx, &dy);
+		UB_VGA_SetPixel(x + dx, y + dy, color);
+	}
+	for (int n = 0; n <= GAUGE_TICKS; n++)
+	{
+		int angle = GAUGE_START - (n * GAUGE_SWEEP) / GAUGE_TICKS;
+		int x0, y0, x1, y1;
+		_GAUGE_Point(angle, radius - 6, &x0, &y0);
+		_GAUGE_Point(angle, radius - 2, &x1, &y1);
+		_GAUGE_Line(gauge, x + x0, y + y0, x + x1, y + y1, GAUGE_DRAW, color);
+	}
+
+	// Label centered under the hub
+	if (label && *label)
+	{
+		char text[GAUGE_LABEL_LEN];
+		int width, height;
+
+		strncpy(text, label, GAUGE_LABEL_LEN - 1);
+		text[GAUGE_LABEL_LEN - 1] = '\0';
+
+		int ErrorCode = API_text_size(0, 0, text, "consolas", 1, "normaal", &width, &height);
+		if (ErrorCode == 0)
+			ErrorCode = API_draw_text(x - width / 2, y + radius / 3, color, text, "consolas", 1, "normaal");
+		if (ErrorCode)
+			return ErrorCode;
+	}
+
+	_GAUGE_Disc(x, y, gauge->hub, needle_color);
+	_GAUGE_Needle(gauge, GAUGE_SAVE);
+	gauge->used = 1;
+	return 0;
+}
+
+/**
+ * @brief Moves the needle of a gauge.
+ */
+int GAUGE_Value(int id, int value)
+{
+	if (id < 0 || id >= GAUGE_SLOTS || !gauges[id].used) return ERR_GAUGE_INVALID;
+
+	GAUGE_t *gauge = &gauges[id];
+
+	if (value < gauge->min) value = gauge->min;
+	if (value > gauge->max) value = gauge->max;
+
+	int step = ((int32_t)(value - gauge->min) * (GAUGE_STEPS - 1) + (gauge->max - gauge->min) / 2) / (gauge->max - gauge->min);
+	if (step == gauge->step) return 0;
+
+	BLIT_Wait();
+	_GAUGE_Needle(gauge, GAUGE_RESTORE);
+	gauge->step = step;
+	_GAUGE_Needle(gauge, GAUGE_SAVE);
+	return 0;
+}
+
+/**
+ * @brief Forgets all gauges, the screen is not changed.
+ */
+void GAUGE_Reset(void)
+{
+	for (int n = 0; n < GAUGE_SLOTS; n++)
+	{
+		gauges[n].used = 0;
+	}
+}
+
+/**
+ * @brief Returns sin(angle) * 16384, angle in degrees.
+ */
+static int _GAUGE_Sin(int angle)
+{
+	angle %= 360;
+	if (angle < 0) angle += 360;
+
+	if (angle <= 90) return gauge_sine[angle];
+	if (angle <= 180) return gauge_sine[180 - angle];
+	if (angle <= 270) return -gauge_sine[angle - 180];
+	return -gauge_sine[360 - angle];
+}
+
+/**
+ * @brief Calculates a point on a circle around the center (screen y points down).
+ */
+static void _GAUGE_Point(int angle, int radius, int *dx, int *dy)
+{
+	int c = _GAUGE_Sin(angle + 90);
+	int s = _GAUGE_Sin(angle);
+
+	*dx = (c * radius + ((c < 0) ? -8192 : 8192)) / 16384;
+	*dy = -(s * radius + ((s < 0) ? -8192 : 8192)) / 16384;
+}
+
+/**
+ * @brief Walks a line (Bresenham) and draws, saves or restores its pixels.
+ * @param gauge Gauge whose save buffer is used.
+ * @param x0 Start X-coordinate.
+ * @param y0 Start Y-coordinate.
+ * @param x1 End X-coordinate.
+ * @param y1 End Y-coordinate.
+ * @param mode GAUGE_DRAW, GAUGE_SAVE (save, then draw) or GAUGE_RESTORE.
+ * @param color Color for GAUGE_DRAW and GAUGE_SAVE.
+ */
+static void _GAUGE_Line(GAUGE_t *gauge, int x0, int y0, int x1, int y1, int mode, uint8_t color)
+{
+	int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+	int sx = (x0 < x1) ? 1 : -1;
+	int sy = (y0 < y1) ? 1 : -1;
+	int err = dx + dy;
+	int n = 0;
+
+	while (n <= GAUGE_MAX_RADIUS)
+	{
+		if (mode == GAUGE_RESTORE)
+		{
+			UB_VGA_WriteSpan(x0, y0, 1, &gauge->under[n]);
+		}
+		else
+		{
+			if (mode == GAUGE_SAVE) UB_VGA_ReadSpan(x0, y0, 1, &gauge->under[n]);
+			UB_VGA_SetPixel(x0, y0, color);
+		}
+		n++;
+
+		if (x0 == x1 && y0 == y1) break;
+		int e2 = 2 * err;
+		if (e2 >= dy) { err += dy; x0 += sx; }
+		if (e2 <= dx) { err += dx; y0 += sy; }
+	}
+}
+
+/**
+ * @brief Saves and draws, or restores, the needle at its current step.
+ */
+static void _GAUGE_Needle(GAUGE_t *gauge, int mode)
+{
+	int tx = gauge->tip[gauge->step][0];
+	int ty = gauge->tip[gauge->step][1];
+
+	// Starts just outside the hub, on the same line as the end point
+	int start = gauge->hub + 1;
+	int sx = (tx * start) / gauge->length;
+	int sy = (ty * start) / gauge->length;
+
+	_GAUGE_Line(gauge, gauge->x + sx, gauge->y + sy, gauge->x + tx, gauge->y + ty, mode, gauge->needle_color);
+}
+
+/**
+ * @brief Fills a disc with spans.
+ */
+static void _GAUGE_Disc(int x, int y, int radius, uint8_t color)
+{
+	int half = radius;
+
+	for (int dy = 0; dy <= radius; dy++)
+	{
+		// Widest half-span that stays inside the circle
+		while (half > 0 && half * half + dy * dy > radius * radius) half--;
+
+		UB_VGA_FillSpan(x - half, y - dy, 2 * half + 1, color);
+		if (dy) UB_VGA_FillSpan(x - half, y + dy, 2 * half + 1, color);
+	}
+}
@@ -12,11 +12,14 @@
 #include "stm32f4xx.h"
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
 
 #include "stm32_ub_vga_screen.h"
 #include "API_LIB.h"
+#include "Blitter.h"
+#include "UART.h"
 
 /**
  * @brief Receives the command string from the CmdForwarder, extracts the required function and parameters and calls the corresponding API function.
@@ -33,6 +36,12 @@ int CmdToFunc (char *cmd)
 	// Get requested function from command
 	token = strtok (cmd, delimiter);
 
+	// While a display list is recorded, drawing commands are stored instead of drawn
+	if (API_list_recording() && strcmp(token, "stop") != 0)
+	{
+		return CmdToList(token);
+	}
+
 	if (strcmp(token, "pixel") == 0)
 	{
 		// Fill input_buffer[] with command parameters
@@ -53,6 +62,7 @@ int CmdToFunc (char *cmd)
 		uint8_t col = StrToCol (input_buffer[2]);
 		if (col==1) return ERR_INVALID_COLOR_INPUT;
 
+		BLIT_Wait();
 		UB_VGA_SetPixel (x, y, col);
 	}
 
@@ -154,7 +164,64 @@ int CmdToFunc (char *cmd)
 			ptr = strtok (NULL, delimiter);
 		}
 
-		uint16_t bitnr = atoi (input_buffer[0]);
+		// Number (flash 0-11, cache 100-115) or the name of a flash bitmap or cache slot
+		int bitnr = atoi (input_buffer[0]);
+		if (input_buffer[0] && (input_buffer[0][0] < '0' || input_buffer[0][0] > '9'))
+		{
+			int ErrorCode = API_find_bitmap(input_buffer[0], &bitnr);
+			if (ErrorCode)
+			{
+				return ErrorCode;
+			}
+		}
+
+		uint16_t x_lup = atoi (input_buffer[1]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[2]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int ErrorCode;
+		// Optional color replaces the primary color of paletted bitmaps
+		if (input_buffer[3])
+		{
+			uint8_t color = StrToCol (input_buffer[3]);
+			if (color==1) return ERR_INVALID_COLOR_INPUT;
+
+			ErrorCode = API_draw_bitmap_color(x_lup, y_lup, bitnr, color);
+		}
+		else
+		{
+			ErrorCode = API_draw_bitmap(x_lup, y_lup, bitnr);
+		}
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+
+	else if (strcmp(token, "bitmapdraai") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 6) return ERR_INVALID_PARAM_INPUT;
+
+		// Number (flash 0-11, cache 100-115) or the name of a flash bitmap or cache slot
+		int bitnr = atoi (input_buffer[0]);
+		if (input_buffer[0][0] < '0' || input_buffer[0][0] > '9')
+		{
+			int ErrorCode = API_find_bitmap(input_buffer[0], &bitnr);
+			if (ErrorCode)
+			{
+				return ErrorCode;
+			}
+		}
 
 		uint16_t x_lup = atoi (input_buffer[1]);
 		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
@@ -162,7 +229,24 @@ int CmdToFunc (char *cmd)
 		uint16_t y_lup = atoi (input_buffer[2]);
 		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
 
-		int ErrorCode = API_draw_bitmap(x_lup, y_lup, bitnr);
+		int rotation = atoi (input_buffer[3]);
+
+		// Mirror: geen, h (left-right), v (top-bottom) or hv
+		int mirror = 0;
+		if (strchr(input_buffer[4], 'h')) mirror |= 0x01;
+		if (strchr(input_buffer[4], 'v')) mirror |= 0x02;
+
+		int scale = atoi (input_buffer[5]);
+
+		// Optional color replaces the primary color of paletted bitmaps
+		int color = -1;
+		if (input_buffer[6])
+		{
+			color = StrToCol (input_buffer[6]);
+			if (color==1) return ERR_INVALID_COLOR_INPUT;
+		}
+
+		int ErrorCode = API_draw_bitmap_ex(x_lup, y_lup, bitnr, rotation, mirror, scale, color);
 		if (ErrorCode)
 		{
 			return ErrorCode;
@@ -306,8 +390,9 @@ int CmdToFunc (char *cmd)
 		// Basic safety check to ensure text exists
 		if (text_string == 0) return ERR_INVALID_PARAM_INPUT; // Ensure this error is defined, or return a generic error
 
-		// 5. Get Font Name
+		// 5. Get Font Name or Font Id
 		char *font_name = input_buffer[4];
+		if (font_name == 0) return ERR_INVALID_PARAM_INPUT;
 
 		// 6. Get Font Size (Optional, default to 1)
 		uint16_t fontsize = 1;
@@ -327,57 +412,1192 @@ int CmdToFunc (char *cmd)
 			return ErrorCode;
 		}
 	}
-	else
+	else if (strcmp(token, "kopieer") == 0)
 	{
-		// Return error for unsupported command.
-		return ERR_UNSUPPORTED_COMMAND;
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 6) return ERR_INVALID_PARAM_INPUT;
+
+		uint16_t x_src = atoi (input_buffer[0]);
+		if (XOutOfBound(x_src)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_src = atoi (input_buffer[1]);
+		if (YOutOfBound(y_src)) return ERR_Y_OUT_OF_BOUND;
+
+		uint16_t width = atoi (input_buffer[2]);
+
+		uint16_t height = atoi (input_buffer[3]);
+
+		uint16_t x_dst = atoi (input_buffer[4]);
+		if (XOutOfBound(x_dst)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_dst = atoi (input_buffer[5]);
+		if (YOutOfBound(y_dst)) return ERR_Y_OUT_OF_BOUND;
+
+		int ErrorCode = API_copy_rect(x_src, y_src, width, height, x_dst, y_dst);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
 	}
+	else if (strcmp(token, "modus") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
 
-	return 0;
-}
+		if (input_buffer[0] == 0) return ERR_INVALID_PARAM_INPUT;
 
-/**
- * @brief Translates a color string to a color code.
- * @param cmd Pointer to the color string buffer.
- * @return Color code if no errors occured, otherwise returns 1.
- */
-uint8_t StrToCol (char *str)
-{
-	// Compare strings to colors and return color code.
-	if (strcmp(str, "zwart") == 0)
-		return VGA_COL_BLACK;
-	else if (strcmp(str, "blauw") == 0)
-		return VGA_COL_BLUE;
-	else if (strcmp(str, "lichtblauw") == 0)
-		return VGA_COL_LIGHT_BLUE;
-	else if (strcmp(str, "groen") == 0)
-		return VGA_COL_GREEN;
-	else if (strcmp(str, "lichtgroen") == 0)
-		return VGA_COL_LIGHT_GREEN;
-	else if (strcmp(str, "rood") == 0)
-		return VGA_COL_RED;
-	else if (strcmp(str, "lichtrood") == 0)
-		return VGA_COL_LIGHT_RED;
-	else if (strcmp(str, "wit") == 0)
-		return VGA_COL_WHITE;
-	else if (strcmp(str, "cyaan") == 0)
-		return VGA_COL_CYAN;
-	else if (strcmp(str, "lichtcyaan") == 0)
-		return VGA_COL_LIGHT_CYAN;
-	else if (strcmp(str, "magenta") == 0)
-		return VGA_COL_MAGENTA;
-	else if (strcmp(str, "lichtmagenta") == 0)
-		return VGA_COL_LIGHT_MAGENTA;
-	else if (strcmp(str, "geel") == 0)
-		return VGA_COL_YELLOW;
-	else if (strcmp(str, "bruin") == 0)
-		return VGA_COL_BROWN;
-	else if (strcmp(str, "grijs") == 0)
-		return VGA_COL_GRAY;
+		// Character cells, optional font of the glyphs
+		if (strcmp(input_buffer[0], "tekst") == 0)
+		{
+			return API_set_text_mode((i > 1) ? input_buffer[1] : "consolas");
+		}
+		uint8_t bpp = atoi (input_buffer[0]);
 
-	// Return 1 if color not found.
-	else
-		return 1;
+		int ErrorCode = API_set_mode(bpp);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+
+	else if (strcmp(token, "cel") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 3) return ERR_INVALID_PARAM_INPUT;
+
+		int column = atoi (input_buffer[0]);
+		int row = atoi (input_buffer[1]);
+		char * text = input_buffer[2];
+
+		// Optional colors, white on black
+		int color = (i > 3) ? StrToCol (input_buffer[3]) : VGA_COL_WHITE;
+		int background = (i > 4) ? StrToCol (input_buffer[4]) : VGA_COL_BLACK;
+
+		if (color == 1 || background == 1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_text_put(column, row, text, color, background);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "regel") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		// Without text an empty line
+		char * text = (i > 0) ? input_buffer[0] : "";
+		int color = (i > 1) ? StrToCol (input_buffer[1]) : VGA_COL_WHITE;
+		int background = (i > 2) ? StrToCol (input_buffer[2]) : VGA_COL_BLACK;
+
+		if (color == 1 || background == 1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_text_line(text, color, background);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+
+	else if (strcmp(token, "palet") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		if (input_buffer[0] == 0) return ERR_INVALID_PARAM_INPUT;
+		uint8_t index = atoi (input_buffer[0]);
+
+		if (input_buffer[1] == 0) return ERR_INVALID_PARAM_INPUT;
+		uint8_t color = StrToCol (input_buffer[1]);
+		if (color==1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_set_palette(index, color);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+
+	else if (strcmp(token, "wissel") == 0)
+	{
+		int ErrorCode = API_flip_page();
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "status") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		// Optional "reset" clears the counters after reading
+		int reset = 0;
+		if (input_buffer[0] && strcmp(input_buffer[0], "reset") == 0)
+		{
+			reset = 1;
+		}
+
+		char status_msg[128];
+		int ErrorCode = API_get_status(status_msg, sizeof(status_msg), reset);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+
+		// Reply status line, followed by the normal error reply
+		usart2_send_string("STATUS: ");
+		usart2_send_string(status_msg);
+		usart2_send_string("\r\n");
+	}
+	else if (strcmp(token, "dirty") == 0)
+	{
+		char dirty_msg[128];
+		int ErrorCode = API_get_dirty_status(dirty_msg, sizeof(dirty_msg));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+
+		// Reply dirty line, followed by the normal error reply
+		usart2_send_string("DIRTY: ");
+		usart2_send_string(dirty_msg);
+		usart2_send_string("\r\n");
+	}
+	else if (strcmp(token, "upload") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		uint16_t x_lup = atoi (input_buffer[0]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[1]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		// Optional "dither" selects the ordered dither
+		int dither = 0;
+		if (input_buffer[2] && strcmp(input_buffer[2], "dither") == 0)
+		{
+			dither = 1;
+		}
+
+		int ErrorCode = API_upload_start(x_lup, y_lup, dither);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "data") == 0)
+	{
+		// Base64 has no commas, the whole chunk is one parameter
+		char * ptr = strtok (NULL, delimiter);
+		if (ptr == NULL) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_upload_data(ptr);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "opslaan") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 5) return ERR_INVALID_PARAM_INPUT;
+
+		// Slot number, or a name (the slot is chosen by the cache)
+		int slot = -1;
+		char * name = NULL;
+		if (input_buffer[0][0] >= '0' && input_buffer[0][0] <= '9')
+		{
+			slot = atoi (input_buffer[0]);
+		}
+		else
+		{
+			name = input_buffer[0];
+		}
+
+		int width = atoi (input_buffer[1]);
+		int height = atoi (input_buffer[2]);
+
+		int format = StrToFormat (input_buffer[3]);
+		if (format < 0) return ERR_INVALID_PARAM_INPUT;
+
+		int size = atoi (input_buffer[4]);
+
+		int bitnr;
+		int ErrorCode = API_cache_store(slot, name, width, height, format, size, &bitnr);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+
+		// Reply the bitmap number of the slot, followed by the normal error reply
+		char bitnr_msg[12];
+		sprintf(bitnr_msg, "%d", bitnr);
+		usart2_send_string("BITMAP: ");
+		usart2_send_string(bitnr_msg);
+		usart2_send_string("\r\n");
+	}
+	else if (strcmp(token, "lettertype") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 3) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+		char * name = input_buffer[1];
+		int size = atoi (input_buffer[2]);
+
+		// The font blob follows with data commands
+		int ErrorCode = API_font_store(id, name, size);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "cache") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		// Optional "reset" clears the counters after reading
+		int reset = 0;
+		if (input_buffer[0] && strcmp(input_buffer[0], "reset") == 0)
+		{
+			reset = 1;
+		}
+
+		char cache_msg[128];
+		int ErrorCode = API_get_cache_status(cache_msg, sizeof(cache_msg), reset);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+
+		// Reply cache line, followed by the normal error reply
+		usart2_send_string("CACHE: ");
+		usart2_send_string(cache_msg);
+		usart2_send_string("\r\n");
+	}
+	else if (strcmp(token, "sprite") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 5) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		// Bitmap number or the name of a flash bitmap or cache slot
+		int bitnr = atoi (input_buffer[1]);
+		if (input_buffer[1][0] < '0' || input_buffer[1][0] > '9')
+		{
+			int ErrorCode = API_find_bitmap(input_buffer[1], &bitnr);
+			if (ErrorCode)
+			{
+				return ErrorCode;
+			}
+		}
+
+		uint16_t x_lup = atoi (input_buffer[2]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[3]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int z = atoi (input_buffer[4]);
+
+		int ErrorCode = API_sprite_set(id, bitnr, x_lup, y_lup, z);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "beweeg") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 3) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		uint16_t x_lup = atoi (input_buffer[1]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[2]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int ErrorCode = API_sprite_move(id, x_lup, y_lup);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "spriteweg") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_sprite_remove(atoi (input_buffer[0]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "tilemap") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		// Only the id: draw the whole map again
+		if (i == 1)
+		{
+			return API_tilemap_draw(id);
+		}
+		if (i < 8) return ERR_INVALID_PARAM_INPUT;
+
+		// Tile set: bitmap number or the name of a flash bitmap or cache slot
+		int bitnr = atoi (input_buffer[1]);
+		if (input_buffer[1][0] < '0' || input_buffer[1][0] > '9')
+		{
+			int ErrorCode = API_find_bitmap(input_buffer[1], &bitnr);
+			if (ErrorCode)
+			{
+				return ErrorCode;
+			}
+		}
+
+		int tile_height = atoi (input_buffer[2]);
+
+		uint16_t x_lup = atoi (input_buffer[3]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[4]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int columns = atoi (input_buffer[5]);
+		int rows = atoi (input_buffer[6]);
+		int color = StrToCol (input_buffer[7]);
+		if (color == 1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_tilemap_create(id, bitnr, tile_height, x_lup, y_lup, columns, rows, color);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "tile") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 4) return ERR_INVALID_PARAM_INPUT;
+
+		// One or more tile indices, from the given cell to the right
+		uint8_t indices[9];
+		int count = i - 3;
+		for (int n = 0; n < count; n++)
+		{
+			indices[n] = atoi (input_buffer[3 + n]);
+		}
+
+		int ErrorCode = API_tilemap_set(atoi (input_buffer[0]), atoi (input_buffer[1]), atoi (input_buffer[2]), indices, count);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "tiles") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 4) return ERR_INVALID_PARAM_INPUT;
+
+		// Tile indices as hex pairs ("00010aff"), ff is an empty cell
+		char * hex = input_buffer[3];
+		int count = strlen (hex) / 2;
+		if (count == 0 || strlen (hex) % 2) return ERR_INVALID_PARAM_INPUT;
+
+		// Decoded in place, two characters become one index
+		uint8_t * indices = (uint8_t *)hex;
+		for (int n = 0; n < count; n++)
+		{
+			char pair[3] = {hex[2 * n], hex[2 * n + 1], 0};
+			char * end;
+			indices[n] = strtol (pair, &end, 16);
+			if (*end) return ERR_INVALID_PARAM_INPUT;
+		}
+
+		int ErrorCode = API_tilemap_set(atoi (input_buffer[0]), atoi (input_buffer[1]), atoi (input_buffer[2]), indices, count);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "grafiek") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 9) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		uint16_t x_lup = atoi (input_buffer[1]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[2]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int width = atoi (input_buffer[3]);
+		int height = atoi (input_buffer[4]);
+		int min = atoi (input_buffer[5]);
+		int max = atoi (input_buffer[6]);
+		int color = StrToCol (input_buffer[7]);
+		int background = StrToCol (input_buffer[8]);
+		if (color == 1 || background == 1) return ERR_INVALID_COLOR_INPUT;
+
+		// Optional grid: color and spacing
+		int grid_color = background;
+		int grid = 0;
+		if (i >= 11)
+		{
+			grid_color = StrToCol (input_buffer[9]);
+			if (grid_color == 1) return ERR_INVALID_COLOR_INPUT;
+			grid = atoi (input_buffer[10]);
+		}
+
+		int ErrorCode = API_chart_create(id, x_lup, y_lup, width, height, min, max, color, background, grid_color, grid);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "meet") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 2) return ERR_INVALID_PARAM_INPUT;
+
+		// One or more samples, oldest first
+		int16_t samples[11];
+		int count = i - 1;
+		for (int n = 0; n < count; n++)
+		{
+			samples[n] = atoi (input_buffer[1 + n]);
+		}
+
+		int ErrorCode = API_chart_add(atoi (input_buffer[0]), samples, count);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "veld") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 8) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		uint16_t x_lup = atoi (input_buffer[1]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[2]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int color = StrToCol (input_buffer[3]);
+		int background = StrToCol (input_buffer[4]);
+		if (color == 1 || background == 1) return ERR_INVALID_COLOR_INPUT;
+
+		char * fontname = input_buffer[5];
+		int fontsize = atoi (input_buffer[6]);
+		char * fontstyle = input_buffer[7];
+
+		int ErrorCode = API_field_set(id, x_lup, y_lup, color, background, fontname, fontsize, fontstyle);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "waarde") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		// Without text the field is emptied
+		int id = atoi (input_buffer[0]);
+		char * text = (i > 1) ? input_buffer[1] : "";
+
+		int ErrorCode = API_field_update(id, text);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "meter") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 9) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		uint16_t x_mid = atoi (input_buffer[1]);
+		if (XOutOfBound(x_mid)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_mid = atoi (input_buffer[2]);
+		if (YOutOfBound(y_mid))	return ERR_Y_OUT_OF_BOUND;
+
+		int radius = atoi (input_buffer[3]);
+		int min = atoi (input_buffer[4]);
+		int max = atoi (input_buffer[5]);
+
+		int color = StrToCol (input_buffer[6]);
+		int background = StrToCol (input_buffer[7]);
+		int needle_color = StrToCol (input_buffer[8]);
+		if (color == 1 || background == 1 || needle_color == 1) return ERR_INVALID_COLOR_INPUT;
+
+		// Optional label under the center
+		char * label = (i > 9) ? input_buffer[9] : NULL;
+
+		int ErrorCode = API_gauge_set(id, x_mid, y_mid, radius, min, max, color, background, needle_color, label);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "wijzer") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 2) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_gauge_value(atoi (input_buffer[0]), atoi (input_buffer[1]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "segment") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 8) return ERR_INVALID_PARAM_INPUT;
+
+		int id = atoi (input_buffer[0]);
+
+		uint16_t x_lup = atoi (input_buffer[1]);
+		if (XOutOfBound(x_lup)) return ERR_X_OUT_OF_BOUND;
+
+		uint16_t y_lup = atoi (input_buffer[2]);
+		if (YOutOfBound(y_lup))	return ERR_Y_OUT_OF_BOUND;
+
+		int height = atoi (input_buffer[3]);
+		int digits = atoi (input_buffer[4]);
+
+		int color = StrToCol (input_buffer[5]);
+		int off_color = StrToCol (input_buffer[6]);
+		int background = StrToCol (input_buffer[7]);
+		if (color == 1 || off_color == 1 || background == 1) return ERR_INVALID_COLOR_INPUT;
+
+		// Optional: decimals and leading zeros
+		int decimals = (i > 8) ? atoi (input_buffer[8]) : 0;
+		int leading_zeros = (i > 9) ? atoi (input_buffer[9]) : 0;
+
+		int ErrorCode = API_segment_set(id, x_lup, y_lup, height, digits, color, off_color, background, decimals, leading_zeros);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "getal") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 2) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_segment_value(atoi (input_buffer[0]), atol (input_buffer[1]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "object") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 3) return ERR_INVALID_PARAM_INPUT;
+
+		// Same parameters as the immediate command, after the id and type
+		int id = atoi (input_buffer[0]);
+		char * type = input_buffer[1];
+		char ** param = &input_buffer[2];
+		OBJ_t obj;
+		memset (&obj, 0, sizeof(obj));
+
+		if (strcmp(type, "lijn") == 0)
+		{
+			if (i < 8) return ERR_INVALID_PARAM_INPUT;
+			obj.type = OBJ_LINE;
+			obj.x = atoi (param[0]);
+			obj.y = atoi (param[1]);
+			obj.a = atoi (param[2]);
+			obj.b = atoi (param[3]);
+			obj.color = StrToCol (param[4]);
+			obj.weight = atoi (param[5]);
+		}
+		else if (strcmp(type, "rechthoek") == 0)
+		{
+			if (i < 8) return ERR_INVALID_PARAM_INPUT;
+			obj.type = OBJ_RECT;
+			obj.x = atoi (param[0]);
+			obj.y = atoi (param[1]);
+			obj.a = atoi (param[2]);
+			obj.b = atoi (param[3]);
+			obj.color = StrToCol (param[4]);
+			obj.filled = atoi (param[5]);
+			obj.weight = param[6] ? atoi (param[6]) : 1;
+			obj.border = param[7] ? StrToCol (param[7]) : obj.color;
+			if (obj.border==1) return ERR_INVALID_COLOR_INPUT;
+		}
+		else if (strcmp(type, "cirkel") == 0)
+		{
+			if (i < 6) return ERR_INVALID_PARAM_INPUT;
+			obj.type = OBJ_CIRCLE;
+			obj.x = atoi (param[0]);
+			obj.y = atoi (param[1]);
+			obj.a = atoi (param[2]);
+			obj.color = StrToCol (param[3]);
+		}
+		else if (strcmp(type, "tekst") == 0)
+		{
+			if (i < 7) return ERR_INVALID_PARAM_INPUT;
+			obj.type = OBJ_TEXT;
+			obj.x = atoi (param[0]);
+			obj.y = atoi (param[1]);
+			obj.color = StrToCol (param[2]);
+			strncpy (obj.text, param[3], OBJ_TEXT_LEN - 1);
+			strncpy (obj.font, param[4], OBJ_FONT_LEN - 1);
+			obj.a = param[5] ? atoi (param[5]) : 1;
+			obj.style = 1;
+			if (param[6] && strstr (param[6], "vet")) obj.style = 2;
+			if (param[6] && strstr (param[6], "cursief")) obj.style = 3;
+		}
+		else if (strcmp(type, "bitmap") == 0)
+		{
+			if (i < 5) return ERR_INVALID_PARAM_INPUT;
+			obj.type = OBJ_BITMAP;
+
+			// Bitmap number or the name of a flash bitmap or cache slot
+			int bitnr = atoi (param[0]);
+			if (param[0][0] < '0' || param[0][0] > '9')
+			{
+				int ErrorCode = API_find_bitmap(param[0], &bitnr);
+				if (ErrorCode)
+				{
+					return ErrorCode;
+				}
+			}
+			obj.a = bitnr;
+			obj.x = atoi (param[1]);
+			obj.y = atoi (param[2]);
+
+			// Optional color replaces the primary color of paletted bitmaps
+			obj.color = ASSET_TRANSPARENT;
+			if (param[3])
+			{
+				obj.color = StrToCol (param[3]);
+				if (obj.color==1) return ERR_INVALID_COLOR_INPUT;
+			}
+		}
+		else
+		{
+			return ERR_INVALID_PARAM_INPUT;
+		}
+
+		if (obj.type != OBJ_BITMAP && obj.color==1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_object_set(id, &obj);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "verplaats") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 3) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_object_move(atoi (input_buffer[0]), atoi (input_buffer[1]), atoi (input_buffer[2]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "herkleur") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 2) return ERR_INVALID_PARAM_INPUT;
+
+		uint8_t color = StrToCol (input_buffer[1]);
+		if (color==1) return ERR_INVALID_COLOR_INPUT;
+
+		int ErrorCode = API_object_color(atoi (input_buffer[0]), color);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "verwijder") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_object_delete(atoi (input_buffer[0]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "opname") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		int ErrorCode = API_list_record(atoi (input_buffer[0]));
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "stop") == 0)
+	{
+		int ErrorCode = API_list_stop();
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "speel") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+		if (i < 1) return ERR_INVALID_PARAM_INPUT;
+
+		// Optional offset, one template in several places
+		int dx = 0;
+		int dy = 0;
+		if (input_buffer[1])
+		{
+			dx = atoi (input_buffer[1]);
+		}
+		if (input_buffer[2])
+		{
+			dy = atoi (input_buffer[2]);
+		}
+
+		int ErrorCode = API_list_play(atoi (input_buffer[0]), dx, dy);
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else if (strcmp(token, "opstart") == 0)
+	{
+		// Fill input_buffer[] with command parameters
+		char i = 0;
+		char * ptr = strtok (NULL, delimiter);
+		while(ptr != NULL && i < 12)
+		{
+			input_buffer[i++] = ptr;
+			ptr = strtok (NULL, delimiter);
+		}
+
+		// Without a list id: reply the boot script status
+		if (i < 1)
+		{
+			char boot_msg[64];
+			int ErrorCode = API_get_boot_status(boot_msg, sizeof(boot_msg));
+			if (ErrorCode)
+			{
+				return ErrorCode;
+			}
+
+			// Reply boot line, followed by the normal error reply
+			usart2_send_string("BOOT: ");
+			usart2_send_string(boot_msg);
+			usart2_send_string("\r\n");
+			return 0;
+		}
+
+		// List id becomes the boot script, only "geen" erases it
+		int id = atoi (input_buffer[0]);
+		if (strcmp(input_buffer[0], "geen") == 0)
+		{
+			id = -1;
+		}
+		else if (id < 0)
+		{
+			return ERR_INVALID_PARAM_INPUT;
+		}
+
+		// The erase stalls the flash for one to two seconds, the UART interrupt can not run:
+		// the host waits for the error reply, bytes it sends meanwhile are dropped
+		usart2_send_string("BUSY\r\n");
+		usart2_disable_rx_interrupt();
+		int ErrorCode = API_list_save_boot(id);
+		usart2_discard_rx();
+		usart2_enable_rx_interrupt();
+		if (ErrorCode)
+		{
+			return ErrorCode;
+		}
+	}
+	else
+	{
+		// Return error for unsupported command.
+		return ERR_UNSUPPORTED_COMMAND;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Parses a drawing command into its binary form and adds it to the recorded display list.
+ * @param token Command name, the parameters are read with strtok().
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+int CmdToList (char *token)
+{
+	const char delimiter[] = ",\r\n"; // Separation character
+	const DL_Op_t *op = API_list_find_op(token);
+	DL_Cmd_t list_cmd;
+
+	if (op == NULL) return ERR_LIST_INVALID;
+
+	list_cmd.op = op->op;
+	list_cmd.argc = strlen (op->layout);
+	list_cmd.text_len = 0;
+
+	// One parameter per layout character, upper case is optional
+	for (uint8_t n = 0; n < list_cmd.argc; n++)
+	{
+		char type = op->layout[n];
+		char * ptr = strtok (NULL, delimiter);
+
+		if (ptr == NULL)
+		{
+			if (type >= 'a' && type <= 'z') return ERR_INVALID_PARAM_INPUT;
+			list_cmd.arg[n] = DL_NONE;
+			continue;
+		}
+
+		switch (type | 0x20) // lower case
+		{
+		case 'c':
+			list_cmd.arg[n] = StrToCol (ptr);
+			if (list_cmd.arg[n]==1) return ERR_INVALID_COLOR_INPUT;
+			break;
+
+		case 'b':
+		{
+			// Number (flash 0-11, cache 100-115) or the name of a flash bitmap or cache slot
+			int bitnr = atoi (ptr);
+			if (ptr[0] < '0' || ptr[0] > '9')
+			{
+				int ErrorCode = API_find_bitmap(ptr, &bitnr);
+				if (ErrorCode)
+				{
+					return ErrorCode;
+				}
+			}
+			list_cmd.arg[n] = bitnr;
+			break;
+		}
+
+		case 'm':
+			// Mirror: geen, h (left-right), v (top-bottom) or hv
+			list_cmd.arg[n] = 0;
+			if (strchr(ptr, 'h')) list_cmd.arg[n] |= 0x01;
+			if (strchr(ptr, 'v')) list_cmd.arg[n] |= 0x02;
+			break;
+
+		case 's':
+		{
+			// Strings are stored behind each other, the parameter is the offset
+			int len = strlen (ptr) + 1;
+			if (list_cmd.text_len + len > DL_TEXT_LEN) return ERR_INVALID_PARAM_INPUT;
+			memcpy (&list_cmd.text[list_cmd.text_len], ptr, len);
+			list_cmd.arg[n] = list_cmd.text_len;
+			list_cmd.text_len += len;
+			break;
+		}
+
+		default: // x, y and n
+			list_cmd.arg[n] = atoi (ptr);
+			break;
+		}
+	}
+
+	return API_list_add(&list_cmd);
+}
+
+/**
+ * @brief Translates a color string to a color code.
+ * @param cmd Pointer to the color string buffer.
+ * @return Color code if no errors occured, otherwise returns 1.
+ */
+uint8_t StrToCol (char *str)
+{
+	// Compare strings to colors and return color code.
+	if (strcmp(str, "zwart") == 0)
+		return VGA_COL_BLACK;
+	else if (strcmp(str, "blauw") == 0)
+		return VGA_COL_BLUE;
+	else if (strcmp(str, "lichtblauw") == 0)
+		return VGA_COL_LIGHT_BLUE;
+	else if (strcmp(str, "groen") == 0)
+		return VGA_COL_GREEN;
+	else if (strcmp(str, "lichtgroen") == 0)
+		return VGA_COL_LIGHT_GREEN;
+	else if (strcmp(str, "rood") == 0)
+		return VGA_COL_RED;
+	else if (strcmp(str, "lichtrood") == 0)
+		return VGA_COL_LIGHT_RED;
+	else if (strcmp(str, "wit") == 0)
+		return VGA_COL_WHITE;
+	else if (strcmp(str, "cyaan") == 0)
+		return VGA_COL_CYAN;
+	else if (strcmp(str, "lichtcyaan") == 0)
+		return VGA_COL_LIGHT_CYAN;
+	else if (strcmp(str, "magenta") == 0)
+		return VGA_COL_MAGENTA;
+	else if (strcmp(str, "lichtmagenta") == 0)
+		return VGA_COL_LIGHT_MAGENTA;
+	else if (strcmp(str, "geel") == 0)
+		return VGA_COL_YELLOW;
+	else if (strcmp(str, "bruin") == 0)
+		return VGA_COL_BROWN;
+	else if (strcmp(str, "grijs") == 0)
+		return VGA_COL_GRAY;
+
+	// Return 1 if color not found.
+	else
+		return 1;
+}
+
+/**
+ * @brief Translates a bitmap format string to a format code.
+ * @param str Pointer to the format string buffer.
+ * @return ASSET_FMT_... if no errors occured, otherwise returns -1.
+ */
+int StrToFormat (char *str)
+{
+	if (strcmp(str, "raw") == 0)
+		return ASSET_FMT_RAW;
+	else if (strcmp(str, "rle") == 0)
+		return ASSET_FMT_RLE;
+	else if (strcmp(str, "1bpp") == 0)
+		return ASSET_FMT_1BPP;
+	else if (strcmp(str, "4bpp") == 0)
+		return ASSET_FMT_4BPP;
+
+	// Return -1 if format not found.
+	else
+		return -1;
 }
 
 /**
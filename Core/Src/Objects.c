@@ -0,0 +1,290 @@
+/**
+ * @file Objects.c
+ * @brief Retained object table code file
+ *
+ * This file contains the retained objects. Every object keeps the
+ * rectangle it touches on the screen, a change redraws only the objects
+ * that intersect the damaged rectangle, clipped to that rectangle.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Objects.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+/**
+ * @brief Screen rectangle of an object, x1 and y1 are exclusive.
+ */
+typedef struct {
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} OBJ_Rect_t;
+
+static OBJ_t objects[OBJ_SLOTS];
+static OBJ_Rect_t obj_rects[OBJ_SLOTS];
+static uint8_t obj_background = VGA_COL_BLACK;
+
+// Text styles as API_draw_text() expects them (index 1..3)
+static char * const obj_styles[] = { "normaal", "normaal", "vet", "cursief" };
+
+static int _OBJ_Bounds(OBJ_t *obj, OBJ_Rect_t *rect);
+static int _OBJ_Draw(OBJ_t *obj);
+static int _OBJ_Redraw(const OBJ_Rect_t *rect, int fill, int from, int target);
+static void _OBJ_Fill(const OBJ_Rect_t *rect);
+
+/**
+ * @brief Creates or replaces an object and draws it.
+ */
+int OBJ_Set(int id, const OBJ_t *obj)
+{
+	if (id < 0 || id >= OBJ_SLOTS) return ERR_OBJECT_INVALID;
+	if (obj->type == OBJ_NONE || obj->type > OBJ_BITMAP) return ERR_OBJECT_INVALID;
+	if (obj->type == OBJ_TEXT && (obj->style < 1 || obj->style > 3)) return ERR_OBJECT_INVALID;
+
+	OBJ_t old = objects[id];
+	OBJ_Rect_t old_rect = obj_rects[id];
+	OBJ_Rect_t rect;
+
+	objects[id] = *obj;
+	objects[id].text[OBJ_TEXT_LEN - 1] = '\0';
+	objects[id].font[OBJ_FONT_LEN - 1] = '\0';
+
+	int ErrorCode = _OBJ_Bounds(&objects[id], &rect);
+	if (ErrorCode)
+	{
+		objects[id] = old;
+		return ErrorCode;
+	}
+	obj_rects[id] = rect;
+
+	// The new object and everything above it, nothing below has to change
+	ErrorCode = _OBJ_Redraw(&rect, 0, id, id);
+	if (ErrorCode)
+	{
+		// Not stored: repair what the failed draw may have touched
+		objects[id] = old;
+		obj_rects[id] = old_rect;
+		_OBJ_Redraw(&rect, 1, 0, -1);
+		return ErrorCode;
+	}
+
+	// The old place of a replaced (or moved) object shows what was under it
+	if (old.type != OBJ_NONE)
+	{
+		_OBJ_Redraw(&old_rect, 1, 0, -1);
+	}
+	return 0;
+}
+
+/**
+ * @brief Moves an object, only the old and new rectangles are redrawn.
+ */
+int OBJ_Move(int id, int x, int y)
+{
+	if (id < 0 || id >= OBJ_SLOTS || objects[id].type == OBJ_NONE) return ERR_OBJECT_INVALID;
+
+	OBJ_t obj = objects[id];
+
+	// A line keeps its length and direction
+	if (obj.type == OBJ_LINE)
+	{
+		obj.a += x - obj.x;
+		obj.b += y - obj.y;
+	}
+	obj.x = x;
+	obj.y = y;
+
+	return OBJ_Set(id, &obj);
+}
+
+/**
+ * @brief Gives an object a new color, only its rectangle is redrawn.
+ */
+int OBJ_Color(int id, int color)
+{
+	if (id < 0 || id >= OBJ_SLOTS || objects[id].type == OBJ_NONE) return ERR_OBJECT_INVALID;
+
+	uint8_t old = objects[id].color;
+	objects[id].color = color;
+
+	// Same shape, same pixels: no background fill, objects below stay hidden
+	int ErrorCode = _OBJ_Redraw(&obj_rects[id], 0, id, id);
+	if (ErrorCode)
+	{
+		objects[id].color = old;
+		return ErrorCode;
+	}
+	return 0;
+}
+
+/**
+ * @brief Deletes an object, its rectangle is redrawn without it.
+ */
+int OBJ_Delete(int id)
+{
+	if (id < 0 || id >= OBJ_SLOTS || objects[id].type == OBJ_NONE) return ERR_OBJECT_INVALID;
+
+	objects[id].type = OBJ_NONE;
+	_OBJ_Redraw(&obj_rects[id], 1, 0, -1);
+	return 0;
+}
+
+/**
+ * @brief Forgets all objects, the screen is not changed.
+ */
+void OBJ_Reset(int color)
+{
+	for (int n = 0; n < OBJ_SLOTS; n++)
+	{
+		objects[n].type = OBJ_NONE;
+	}
+	obj_background = color;
+}
+
+/**
+ * @brief Calculates the screen rectangle an object can touch.
+ * @param obj Object.
+ * @param rect Returns the rectangle, clipped to the screen.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+static int _OBJ_Bounds(OBJ_t *obj, OBJ_Rect_t *rect)
+{
+	int x0 = obj->x, y0 = obj->y, x1 = obj->x, y1 = obj->y;
+	int margin = obj->weight / 2; // Lines are drawn with a circle brush
+
+	switch (obj->type)
+	{
+	case OBJ_LINE:
+		x0 = _Min(obj->x, obj->a) - margin;
+		y0 = _Min(obj->y, obj->b) - margin;
+		x1 = _Max(obj->x, obj->a) + margin + 1;
+		y1 = _Max(obj->y, obj->b) + margin + 1;
+		break;
+
+	case OBJ_RECT:
+		x0 -= margin;
+		y0 -= margin;
+		x1 += obj->a + margin;
+		y1 += obj->b + margin;
+		break;
+
+	case OBJ_CIRCLE:
+		x0 -= obj->a;
+		y0 -= obj->a;
+		x1 += obj->a + 1;
+		y1 += obj->a + 1;
+		break;
+
+	case OBJ_TEXT:
+	{
+		int width, height;
+		int ErrorCode = API_text_size(obj->x, obj->y, obj->text, obj->font, obj->a,
+									  obj_styles[obj->style], &width, &height);
+		if (ErrorCode) return ErrorCode;
+		x1 += width;
+		y1 += height;
+		break;
+	}
+
+	case OBJ_BITMAP:
+	{
+		const ASSET_Bitmap_t *bmp;
+		uint16_t width, height;
+		int ErrorCode = _GetBitmap(obj->a, &bmp);
+		if (ErrorCode) return ErrorCode;
+		ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+		x1 += width;
+		y1 += height;
+		break;
+	}
+	}
+
+	rect->x0 = _Max(x0, 0);
+	rect->y0 = _Max(y0, 0);
+	rect->x1 = _Min(x1, VGA_DISPLAY_X);
+	rect->y1 = _Min(y1, VGA_DISPLAY_Y);
+	if (rect->x1 <= rect->x0 || rect->y1 <= rect->y0) return ERR_OBJ_OUT_OF_BOUNDS;
+	return 0;
+}
+
+/**
+ * @brief Draws one object with the immediate draw functions.
+ * @return 0 if no errors occured, otherwise returns the error code.
+ */
+static int _OBJ_Draw(OBJ_t *obj)
+{
+	switch (obj->type)
+	{
+	case OBJ_LINE:
+		return API_draw_line(obj->x, obj->y, obj->a, obj->b, obj->weight, obj->color, 0);
+	case OBJ_RECT:
+		return API_draw_rectangle(obj->x, obj->y, obj->a, obj->b, obj->color, obj->filled, obj->weight, obj->border);
+	case OBJ_CIRCLE:
+		return API_draw_circle(obj->x, obj->y, obj->a, obj->color, 0);
+	case OBJ_TEXT:
+		return API_draw_text(obj->x, obj->y, obj->color, obj->text, obj->font, obj->a, obj_styles[obj->style]);
+	case OBJ_BITMAP:
+		if (obj->color == ASSET_TRANSPARENT) return API_draw_bitmap(obj->x, obj->y, obj->a);
+		return API_draw_bitmap_color(obj->x, obj->y, obj->a, obj->color);
+	}
+	return 0;
+}
+
+/**
+ * @brief Redraws the objects that intersect a rectangle, clipped to it.
+ * @param rect Damaged rectangle.
+ * @param fill 1 to fill the scene background first.
+ * @param from First object id that is drawn (lower ids are already correct).
+ * @param target Object id whose draw error is returned, -1 for none.
+ * @return 0 if no errors occured, otherwise returns the error code of the target.
+ */
+static int _OBJ_Redraw(const OBJ_Rect_t *rect, int fill, int from, int target)
+{
+	int ErrorCode = 0;
+
+	UB_VGA_SetClip(rect->x0, rect->y0, rect->x1 - rect->x0, rect->y1 - rect->y0);
+
+	if (fill)
+	{
+		_OBJ_Fill(rect);
+	}
+
+	for (int n = from; n < OBJ_SLOTS; n++)
+	{
+		const OBJ_Rect_t *r = &obj_rects[n];
+
+		if (objects[n].type == OBJ_NONE) continue;
+		if (r->x1 <= rect->x0 || r->x0 >= rect->x1 || r->y1 <= rect->y0 || r->y0 >= rect->y1) continue;
+
+		int result = _OBJ_Draw(&objects[n]);
+		if (n == target) ErrorCode = result;
+	}
+
+	// Queued DMA jobs were clipped when they were queued
+	UB_VGA_ResetClip();
+	return ErrorCode;
+}
+
+/**
+ * @brief Fills a rectangle with the scene background, on the DMA in 8 bpp mode.
+ */
+static void _OBJ_Fill(const OBJ_Rect_t *rect)
+{
+	uint16_t width = rect->x1 - rect->x0;
+	uint16_t height = rect->y1 - rect->y0;
+
+	if (VGA.mode == VGA_MODE_8BPP && BLIT_Fill(rect->x0, rect->y0, width, height, obj_background, 0, 0) == 0) return;
+
+	BLIT_Wait();
+	for (uint16_t row = 0; row < height; row++)
+	{
+		UB_VGA_FillSpan(rect->x0, rect->y0 + row, width, obj_background);
+	}
+}
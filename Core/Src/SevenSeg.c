@@ -0,0 +1,222 @@
+/**
+ * @file SevenSeg.c
+ * @brief Seven-segment display code file
+ *
+ * This file contains the seven-segment displays. The segment thickness
+ * is a tenth of the digit height; the space between two digits holds the
+ * decimal point. A segment is one rectangle fill, on the DMA in 8 bpp mode.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "SevenSeg.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+/**
+ * @brief One seven-segment display.
+ */
+typedef struct {
+	uint8_t used;				/**< Display is on the screen */
+	uint8_t digits;				/**< Number of digits */
+	uint8_t decimals;			/**< Digits after the decimal point */
+	uint8_t leading_zeros;		/**< Unused digits show a zero */
+	int16_t x;					/**< Upper-left X-coordinate */
+	int16_t y;					/**< Upper-left Y-coordinate */
+	uint8_t thick;				/**< Segment thickness */
+	uint8_t half;				/**< Distance from the top to the middle segment */
+	uint8_t width;				/**< Digit width */
+	uint8_t pitch;				/**< Distance between two digits */
+	uint8_t color;				/**< Lit segment color */
+	uint8_t off_color;			/**< Unlit segment color */
+	uint8_t lit[SEG_MAX_DIGITS]; /**< Segments on the screen per digit */
+} SEG_t;
+
+// Segments of the digits 0..9
+static const uint8_t seg_digits[10] = {
+	0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+static SEG_t displays[SEG_SLOTS];
+
+static void _SEG_Format(const SEG_t *seg, int32_t value, uint8_t *lit);
+static void _SEG_Segment(const SEG_t *seg, int digit, uint8_t bit, uint8_t color);
+static void _SEG_Fill(int x, int y, int width, int height, uint8_t color);
+
+/**
+ * @brief Creates or replaces a seven-segment display and draws it with all segments off.
+ */
+int SEG_Set(int id, int x, int y, int height, int digits, int color, int off_color,
+			int background, int decimals, int leading_zeros)
+{
+	if (id < 0 || id >= SEG_SLOTS) return ERR_SEGMENT_INVALID;
+	if (digits < 1 || digits > SEG_MAX_DIGITS || decimals < 0 || decimals >= digits) return ERR_SEGMENT_INVALID;
+	if (height < SEG_MIN_HEIGHT || height > VGA_DISPLAY_Y) return ERR_RECT_HEIGHT_INVALID;
+
+	SEG_t *seg = &displays[id];
+	seg->used = 0;
+	seg->x = x;
+	seg->y = y;
+	seg->digits = digits;
+	seg->decimals = decimals;
+	seg->leading_zeros = leading_zeros != 0;
+	seg->thick = (height + 5) / 10;
+	seg->half = (height - seg->thick) / 2;
+	seg->width = seg->half + seg->thick;
+	seg->pitch = seg->width + 2 * seg->thick;
+	seg->color = color;
+	seg->off_color = off_color;
+
+	// An odd middle leaves the last row free: the height is 2 * half + thick
+	int total_width = digits * seg->pitch;
+	int total_height = 2 * seg->half + seg->thick;
+	if (x < 0 || y < 0 || x + total_width > VGA_DISPLAY_X || y + total_height > VGA_DISPLAY_Y)
+		return ERR_OBJ_OUT_OF_BOUNDS;
+
+	_SEG_Fill(x, y, total_width, total_height, background);
+	for (int n = 0; n < digits; n++)
+	{
+		seg->lit[n] = 0;
+		if (off_color == background) continue;
+
+		for (uint8_t bit = SEG_A; bit; bit <<= 1)
+		{
+			_SEG_Segment(seg, n, bit, off_color);
+		}
+	}
+	seg->used = 1;
+	return 0;
+}
+
+/**
+ * @brief Shows a number on a seven-segment display, only the toggled segments are filled.
+ */
+int SEG_Value(int id, int32_t value)
+{
+	if (id < 0 || id >= SEG_SLOTS || !displays[id].used) return ERR_SEGMENT_INVALID;
+
+	SEG_t *seg = &displays[id];
+	uint8_t lit[SEG_MAX_DIGITS];
+
+	_SEG_Format(seg, value, lit);
+
+	for (int n = 0; n < seg->digits; n++)
+	{
+		uint8_t toggle = seg->lit[n] ^ lit[n];
+
+		for (uint8_t bit = SEG_A; toggle; bit <<= 1)
+		{
+			if (!(toggle & bit)) continue;
+
+			_SEG_Segment(seg, n, bit, (lit[n] & bit) ? seg->color : seg->off_color);
+			toggle &= ~bit;
+		}
+		seg->lit[n] = lit[n];
+	}
+	return 0;
+}
+
+/**
+ * @brief Forgets all seven-segment displays, the screen is not changed.
+ */
+void SEG_Reset(void)
+{
+	for (int n = 0; n < SEG_SLOTS; n++)
+	{
+		displays[n].used = 0;
+	}
+}
+
+/**
+ * @brief Converts a number to the segments of every digit.
+ * @param seg Display.
+ * @param value Number, the last digits are the decimals.
+ * @param lit Returns the segments per digit (left digit first).
+ */
+static void _SEG_Format(const SEG_t *seg, int32_t value, uint8_t *lit)
+{
+	uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+	int pos = seg->digits - 1;
+
+	for (int n = 0; n < seg->digits; n++)
+	{
+		lit[n] = 0;
+	}
+
+	// At least one digit before the decimal point (0.05)
+	do
+	{
+		lit[pos--] = seg_digits[mag % 10];
+		mag /= 10;
+	} while (pos >= 0 && (mag || seg->digits - 1 - pos <= seg->decimals));
+
+	// Leading zeros leave the first digit for the minus sign
+	if (seg->leading_zeros)
+	{
+		while (pos >= ((value < 0) ? 1 : 0))
+		{
+			lit[pos--] = seg_digits[0];
+		}
+	}
+
+	if (value < 0)
+	{
+		if (pos < 0) mag = 1; // No room for the minus sign
+		else lit[pos] = SEG_G;
+	}
+
+	// Does not fit: dashes
+	if (mag)
+	{
+		for (int n = 0; n < seg->digits; n++)
+		{
+			lit[n] = SEG_G;
+		}
+		return;
+	}
+
+	if (seg->decimals)
+	{
+		lit[seg->digits - 1 - seg->decimals] |= SEG_DP;
+	}
+}
+
+/**
+ * @brief Fills one segment of a digit.
+ */
+static void _SEG_Segment(const SEG_t *seg, int digit, uint8_t bit, uint8_t color)
+{
+	int x = seg->x + digit * seg->pitch;
+	int y = seg->y;
+	int t = seg->thick;
+	int half = seg->half;
+	int w = seg->width;
+
+	switch (bit)
+	{
+	case SEG_A:  _SEG_Fill(x + t, y, w - 2 * t, t, color); break;
+	case SEG_B:  _SEG_Fill(x + w - t, y + t, t, half - t, color); break;
+	case SEG_C:  _SEG_Fill(x + w - t, y + half + t, t, half - t, color); break;
+	case SEG_D:  _SEG_Fill(x + t, y + 2 * half, w - 2 * t, t, color); break;
+	case SEG_E:  _SEG_Fill(x, y + half + t, t, half - t, color); break;
+	case SEG_F:  _SEG_Fill(x, y + t, t, half - t, color); break;
+	case SEG_G:  _SEG_Fill(x + t, y + half, w - 2 * t, t, color); break;
+	case SEG_DP: _SEG_Fill(x + w + t / 2, y + 2 * half, t, t, color); break;
+	}
+}
+
+/**
+ * @brief Fills a rectangle, on the DMA in 8 bpp mode.
+ */
+static void _SEG_Fill(int x, int y, int width, int height, uint8_t color)
+{
+	if (VGA.mode == VGA_MODE_8BPP && BLIT_Fill(x, y, width, height, color, 0, 0) == 0) return;
+
+	BLIT_Wait();
+	for (int row = 0; row < height; row++)
+	{
+		UB_VGA_FillSpan(x, y + row, width, color);
+	}
+}
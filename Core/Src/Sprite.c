@@ -0,0 +1,316 @@
+/**
+ * @file Sprite.c
+ * @brief Sprite layer code file
+ *
+ * This file contains the sprite layer. Every update collects the changed
+ * sprites plus the drawn sprites that overlap them, restores those from
+ * the top down and draws them again from the bottom up. Sprites that do
+ * not touch a change are left alone.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Sprite.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+/**
+ * @brief One sprite.
+ */
+typedef struct {
+	uint8_t used;				/**< Id is in use */
+	int16_t bitnr;				/**< Bitmap number (flash or cache slot) */
+	uint16_t x;					/**< X-coordinate at the next update */
+	uint16_t y;					/**< Y-coordinate at the next update */
+	uint16_t width;				/**< Width of the bitmap */
+	uint16_t height;			/**< Height of the bitmap */
+	uint8_t z;					/**< Z-order at the next update */
+	uint8_t dirty;				/**< Restored and drawn again at the next update */
+	uint8_t drawn;				/**< On the screen, the pixels under it are saved */
+	uint8_t drawn_z;			/**< Z-order on the screen */
+	uint16_t drawn_x;			/**< X-coordinate on the screen */
+	uint16_t drawn_y;			/**< Y-coordinate on the screen */
+	uint16_t drawn_width;		/**< Width of the saved rectangle */
+	uint16_t drawn_height;		/**< Height of the saved rectangle */
+	uint16_t offset;			/**< Start of the saved pixels in the save buffer */
+} SPRITE_t;
+
+static uint8_t sprite_save[SPRITE_SAVE_SIZE];
+static SPRITE_t sprites[SPRITE_SLOTS];
+static uint32_t sprite_used = 0;	// Bytes in use from the start of the save buffer
+
+static int _SPRITE_Reserved(int skip);
+static int _SPRITE_Overlap(uint16_t ax, uint16_t ay, uint16_t aw, uint16_t ah,
+						   uint16_t bx, uint16_t by, uint16_t bw, uint16_t bh);
+static int _SPRITE_Touches(const SPRITE_t *drawn, const SPRITE_t *changed);
+static int _SPRITE_Order(uint8_t *order, int drawn);
+static void _SPRITE_Compact(void);
+
+/**
+ * @brief Removes all sprites (without restoring the screen).
+ */
+void SPRITE_Init(void)
+{
+	memset(sprites, 0, sizeof(sprites));
+	sprite_used = 0;
+}
+
+/**
+ * @brief Creates or replaces a sprite.
+ */
+int SPRITE_Set(int id, int bitnr, uint16_t x, uint16_t y, uint8_t z)
+{
+	const ASSET_Bitmap_t *bmp;
+	uint16_t width, height;
+
+	if (id < 0 || id >= SPRITE_SLOTS || _GetBitmap(bitnr, &bmp)) return 1;
+
+	ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+	if (x + width > VGA_DISPLAY_X || y + height > VGA_DISPLAY_Y) return 1;
+
+	// Every sprite must fit in the save buffer at the same time
+	if (_SPRITE_Reserved(id) + width * height > SPRITE_SAVE_SIZE) return 1;
+
+	SPRITE_t *sprite = &sprites[id];
+	sprite->used = 1;
+	sprite->bitnr = bitnr;
+	sprite->x = x;
+	sprite->y = y;
+	sprite->width = width;
+	sprite->height = height;
+	sprite->z = z;
+	sprite->dirty = 1;
+	return 0;
+}
+
+/**
+ * @brief Moves a sprite.
+ */
+int SPRITE_Move(int id, uint16_t x, uint16_t y)
+{
+	if (id < 0 || id >= SPRITE_SLOTS || !sprites[id].used) return 1;
+
+	SPRITE_t *sprite = &sprites[id];
+	if (x + sprite->width > VGA_DISPLAY_X || y + sprite->height > VGA_DISPLAY_Y) return 1;
+
+	sprite->x = x;
+	sprite->y = y;
+	sprite->dirty = 1;
+	return 0;
+}
+
+/**
+ * @brief Removes a sprite, the pixels under it are restored at the next update.
+ */
+int SPRITE_Remove(int id)
+{
+	if (id < 0 || id >= SPRITE_SLOTS || !sprites[id].used) return 1;
+
+	sprites[id].used = 0;
+	sprites[id].dirty = 1;
+	return 0;
+}
+
+/**
+ * @brief Restores and redraws all sprites that changed since the last update.
+ */
+void SPRITE_Update(void)
+{
+	uint8_t order[SPRITE_SLOTS];
+	int count, n, m, grown;
+
+	for (n = 0; n < SPRITE_SLOTS && !sprites[n].dirty; n++);
+	if (n == SPRITE_SLOTS) return;
+
+	// A drawn sprite that overlaps a change is restored and drawn again too
+	do
+	{
+		grown = 0;
+		for (n = 0; n < SPRITE_SLOTS; n++)
+		{
+			if (sprites[n].dirty || !sprites[n].drawn) continue;
+			for (m = 0; m < SPRITE_SLOTS; m++)
+			{
+				if (sprites[m].dirty && _SPRITE_Touches(&sprites[n], &sprites[m]))
+				{
+					sprites[n].dirty = 1;
+					grown = 1;
+					break;
+				}
+			}
+		}
+	} while (grown);
+
+	// Screen rows are read and written by the CPU
+	BLIT_Wait();
+
+	// Restore from the top down, the bottom sprite saved the background
+	count = _SPRITE_Order(order, 1);
+	while (count--)
+	{
+		SPRITE_t *sprite = &sprites[order[count]];
+		const uint8_t *src = &sprite_save[sprite->offset];
+
+		for (uint16_t row = 0; row < sprite->drawn_height; row++)
+		{
+			UB_VGA_WriteSpan(sprite->drawn_x, sprite->drawn_y + row, sprite->drawn_width, src);
+			src += sprite->drawn_width;
+		}
+		sprite->drawn = 0;
+	}
+	_SPRITE_Compact();
+
+	// Save and draw from the bottom up
+	count = _SPRITE_Order(order, 0);
+	for (n = 0; n < count; n++)
+	{
+		SPRITE_t *sprite = &sprites[order[n]];
+		uint8_t *dst = &sprite_save[sprite_used];
+
+		sprite->offset = sprite_used;
+		sprite->drawn_x = sprite->x;
+		sprite->drawn_y = sprite->y;
+		sprite->drawn_width = sprite->width;
+		sprite->drawn_height = sprite->height;
+		sprite->drawn_z = sprite->z;
+		sprite->drawn = 1;
+		sprite_used += sprite->width * sprite->height;
+
+		// The sprite below may still be on the DMA
+		BLIT_Wait();
+		for (uint16_t row = 0; row < sprite->height; row++)
+		{
+			UB_VGA_ReadSpan(sprite->x, sprite->y + row, sprite->width, dst);
+			dst += sprite->width;
+		}
+
+		// A cache slot may have been evicted or replaced by a bitmap of another size
+		const ASSET_Bitmap_t *bmp;
+		uint16_t width, height;
+		if (_GetBitmap(sprite->bitnr, &bmp)) continue;
+		ASSET_GetSize(bmp, ASSET_ROT_0, 1, &width, &height);
+		if (width == sprite->width && height == sprite->height)
+		{
+			ASSET_DrawBitmap(bmp, sprite->x, sprite->y);
+		}
+	}
+
+	for (n = 0; n < SPRITE_SLOTS; n++)
+	{
+		sprites[n].dirty = 0;
+	}
+}
+
+/**
+ * @brief Forgets the saved pixels, all sprites are drawn again at the next update.
+ */
+void SPRITE_Invalidate(void)
+{
+	for (int n = 0; n < SPRITE_SLOTS; n++)
+	{
+		sprites[n].drawn = 0;
+		sprites[n].dirty = sprites[n].used;
+	}
+	sprite_used = 0;
+}
+
+/**
+ * @brief Returns the save buffer bytes needed by all sprites except one.
+ * @param skip Sprite id that is not counted.
+ */
+static int _SPRITE_Reserved(int skip)
+{
+	int total = 0;
+
+	for (int n = 0; n < SPRITE_SLOTS; n++)
+	{
+		if (n != skip && sprites[n].used) total += sprites[n].width * sprites[n].height;
+	}
+	return total;
+}
+
+/**
+ * @brief Checks whether two rectangles overlap.
+ */
+static int _SPRITE_Overlap(uint16_t ax, uint16_t ay, uint16_t aw, uint16_t ah,
+						   uint16_t bx, uint16_t by, uint16_t bw, uint16_t bh)
+{
+	return ax < bx + bw && bx < ax + aw && ay < by + bh && by < ay + ah;
+}
+
+/**
+ * @brief Checks whether a drawn sprite overlaps the old or new rectangle of a changed sprite.
+ */
+static int _SPRITE_Touches(const SPRITE_t *drawn, const SPRITE_t *changed)
+{
+	if (changed->drawn &&
+		_SPRITE_Overlap(drawn->drawn_x, drawn->drawn_y, drawn->drawn_width, drawn->drawn_height,
+						changed->drawn_x, changed->drawn_y, changed->drawn_width, changed->drawn_height))
+	{
+		return 1;
+	}
+	return changed->used &&
+		_SPRITE_Overlap(drawn->drawn_x, drawn->drawn_y, drawn->drawn_width, drawn->drawn_height,
+						changed->x, changed->y, changed->width, changed->height);
+}
+
+/**
+ * @brief Lists the changed sprites from the bottom up.
+ * @param order Destination for the sprite ids.
+ * @param drawn 1: sprites on the screen by drawn z-order, 0: sprites to draw by new z-order.
+ * @return Number of ids in order.
+ */
+static int _SPRITE_Order(uint8_t *order, int drawn)
+{
+	int count = 0;
+
+	for (int n = 0; n < SPRITE_SLOTS; n++)
+	{
+		const SPRITE_t *sprite = &sprites[n];
+		if (!sprite->dirty || (drawn ? !sprite->drawn : !sprite->used)) continue;
+
+		// Insertion sort on z, ids are visited in order so equal z keeps the id order
+		uint8_t z = drawn ? sprite->drawn_z : sprite->z;
+		int pos = count++;
+		while (pos > 0 && (drawn ? sprites[order[pos - 1]].drawn_z : sprites[order[pos - 1]].z) > z)
+		{
+			order[pos] = order[pos - 1];
+			pos--;
+		}
+		order[pos] = n;
+	}
+	return count;
+}
+
+/**
+ * @brief Moves the saved pixels of the drawn sprites to the start of the save buffer.
+ */
+static void _SPRITE_Compact(void)
+{
+	uint32_t used = 0;
+
+	// Visit the drawn sprites by offset, so data only moves down
+	for (;;)
+	{
+		SPRITE_t *next = 0;
+		for (int n = 0; n < SPRITE_SLOTS; n++)
+		{
+			SPRITE_t *sprite = &sprites[n];
+			if (sprite->drawn && sprite->offset >= used && (next == 0 || sprite->offset < next->offset))
+			{
+				next = sprite;
+			}
+		}
+		if (next == 0) break;
+
+		uint32_t size = next->drawn_width * next->drawn_height;
+		memmove(&sprite_save[used], &sprite_save[next->offset], size);
+		next->offset = used;
+		used += size;
+	}
+	sprite_used = used;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file TextField.c
+ * @brief Text field code file
+ *
+ * This file contains the text fields. A cell reaches from the x-position
+ * of its character to the next one, the last cell also covers the pixels
+ * that stick out (bold, italic). Italic glyphs lean into the next cell,
+ * so there a changed cell also clears the next one and redraws the one
+ * before it.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "TextField.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "Font.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+/**
+ * @brief One text field.
+ */
+typedef struct {
+	uint8_t used;				/**< Id is in use */
+	int8_t font_id;				/**< Font id, resolved on every draw */
+	uint16_t rows;				/**< Pixel rows of one line of glyphs */
+	int16_t x;					/**< Upper-left X-coordinate */
+	int16_t y;					/**< Upper-left Y-coordinate */
+	uint8_t color;				/**< Text color */
+	uint8_t background;			/**< Color of the cleared cells */
+	uint8_t size;				/**< Font size multiplier */
+	uint8_t style;				/**< 1 normal, 2 bold, 3 italic */
+	uint8_t len;				/**< Characters on the screen */
+	char text[FIELD_TEXT_LEN];	/**< Text on the screen */
+	int16_t pos[FIELD_TEXT_LEN]; /**< X-coordinate of every cell, pos[len] is the end */
+	int16_t ink;				/**< Right edge of the touched pixels */
+} FIELD_t;
+
+static FIELD_t fields[FIELD_SLOTS];
+
+static const FONT_t *_FIELD_Font(const FIELD_t *field);
+static int _FIELD_Rows(const FONT_t *font, int size);
+static int _FIELD_Layout(const FIELD_t *field, const FONT_t *font, const char *text, int len, int16_t *pos, int16_t *ink);
+static int _FIELD_CellEnd(const int16_t *pos, int len, int16_t ink, int n);
+static void _FIELD_Clear(const FIELD_t *field, int x0, int x1);
+static void _FIELD_DrawChar(const FIELD_t *field, const FONT_t *font, int x, char c);
+
+/**
+ * @brief Creates or replaces a text field, the field starts empty.
+ */
+int FIELD_Set(int id, int x, int y, int color, int background,
+			  char *fontname, int fontsize, char *fontstyle)
+{
+	if (id < 0 || id >= FIELD_SLOTS || fontsize < 1 || fontsize > 255) return ERR_FIELD_INVALID;
+	if (x < 0 || x >= VGA_DISPLAY_X || y < 0 || y >= VGA_DISPLAY_Y) return ERR_OBJ_OUT_OF_BOUNDS;
+
+	int font_id = FONT_FindId(fontname);
+	if (font_id < 0) return ERR_FONT_INVALID;
+	const FONT_t *font = FONT_Get(font_id);
+
+	FIELD_t field = { 0 };
+	field.used = 1;
+	field.font_id = font_id;
+	field.x = x;
+	field.y = y;
+	field.color = color;
+	field.background = background;
+	field.size = fontsize;
+	field.style = 1;
+	if (strcmp(fontstyle, "vet") == 0 || strcmp(fontstyle, " vet") == 0) field.style = 2;
+	else if (strcmp(fontstyle, "cursief") == 0 || strcmp(fontstyle, " cursief") == 0) field.style = 3;
+
+	// One line of glyphs must fit below the field
+	field.rows = _FIELD_Rows(font, fontsize);
+	if (y + field.rows > VGA_DISPLAY_Y) return ERR_OBJ_OUT_OF_BOUNDS;
+
+	// The text of a replaced field disappears
+	FIELD_t *old = &fields[id];
+	if (old->used && old->len)
+	{
+		BLIT_Wait();
+		_FIELD_Clear(old, old->x, _FIELD_CellEnd(old->pos, old->len, old->ink, old->len - 1));
+	}
+
+	field.pos[0] = x;
+	field.ink = x;
+	*old = field;
+	return 0;
+}
+
+/**
+ * @brief Shows a new text in a field, only the changed character cells are drawn.
+ */
+int FIELD_Update(int id, const char *text)
+{
+	if (id < 0 || id >= FIELD_SLOTS || !fields[id].used) return ERR_FIELD_INVALID;
+
+	FIELD_t *field = &fields[id];
+	int len = strlen(text);
+	if (len >= FIELD_TEXT_LEN) return ERR_FIELD_INVALID;
+
+	// The font may have been uploaded again since the field was set
+	const FONT_t *font = _FIELD_Font(field);
+	if (font == NULL) return ERR_FONT_INVALID;
+
+	int16_t pos[FIELD_TEXT_LEN];
+	int16_t ink;
+	if (_FIELD_Layout(field, font, text, len, pos, &ink)) return ERR_OBJ_OUT_OF_BOUNDS;
+
+	int cells = _Max(len, field->len);
+	int italic = field->style == 3;
+	uint8_t clear[FIELD_TEXT_LEN + 1] = { 0 };
+
+	// A cell changes with its character or its place (a wider glyph before it)
+	for (int n = 0; n < cells; n++)
+	{
+		if (n >= len || n >= field->len || text[n] != field->text[n] || pos[n] != field->pos[n])
+		{
+			clear[n] = 1;
+			if (italic) clear[n + 1] = 1; // The old glyph leaned into the next cell
+		}
+	}
+
+	BLIT_Wait();
+
+	// Old and new place of every changed cell, unchanged cells are never covered
+	for (int n = 0; n < cells; n++)
+	{
+		if (!clear[n]) continue;
+		if (n < field->len) _FIELD_Clear(field, field->pos[n], _FIELD_CellEnd(field->pos, field->len, field->ink, n));
+		if (n < len) _FIELD_Clear(field, pos[n], _FIELD_CellEnd(pos, len, ink, n));
+	}
+
+	for (int n = 0; n < len; n++)
+	{
+		// Italic: the cell before a cleared one lost the pixels that leaned over
+		if (clear[n] || (italic && clear[n + 1]))
+		{
+			_FIELD_DrawChar(field, font, pos[n], text[n]);
+		}
+	}
+
+	memcpy(field->text, text, len);
+	memcpy(field->pos, pos, (len + 1) * sizeof(int16_t));
+	field->len = len;
+	field->ink = ink;
+	return 0;
+}
+
+/**
+ * @brief Forgets the text of all fields, the screen is not changed.
+ */
+void FIELD_Reset(void)
+{
+	for (int n = 0; n < FIELD_SLOTS; n++)
+	{
+		fields[n].len = 0;
+		fields[n].pos[0] = fields[n].x;
+		fields[n].ink = fields[n].x;
+	}
+}
+
+/**
+ * @brief Returns the font of a field.
+ * @return Font descriptor, or NULL if the font is gone or no longer has the height of the field.
+ */
+static const FONT_t *_FIELD_Font(const FIELD_t *field)
+{
+	const FONT_t *font = FONT_Get(field->font_id);
+
+	if (font == NULL || _FIELD_Rows(font, field->size) != field->rows) return NULL;
+	return font;
+}
+
+/**
+ * @brief Returns the pixel rows of one line of glyphs.
+ */
+static int _FIELD_Rows(const FONT_t *font, int size)
+{
+	return ((font->format == FONT_FMT_GLCD) ? 12 : font->height) * size;
+}
+
+/**
+ * @brief Calculates the cell positions of a text, like API_draw_text() without word-wrap.
+ * @param field Text field.
+ * @param font Font of the field.
+ * @param text Text.
+ * @param len Number of characters.
+ * @param pos Returns the x-coordinate of every cell and the end (len + 1 values).
+ * @param ink Returns the right edge of the touched pixels.
+ * @return 0 if the text fits on the screen, otherwise 1.
+ */
+static int _FIELD_Layout(const FIELD_t *field, const FONT_t *font, const char *text, int len, int16_t *pos, int16_t *ink)
+{
+	int bold_padding = (field->style == 2) ? 1 : 0;
+	int italic_max = (field->style != 3) ? 0 : (font->format == FONT_FMT_GLCD) ? 10 / 3 : (font->height - 1) / 3;
+	int x = field->x;
+	int right = x;
+
+	for (int n = 0; n < len; n++)
+	{
+		uint8_t char_width = FONT_GlyphWidth(font, text[n]);
+
+		pos[n] = x;
+		right = _Max(right, x + (char_width + italic_max) * field->size + bold_padding);
+		x += (char_width + font->spacing + bold_padding) * field->size;
+	}
+	pos[len] = x;
+	*ink = right;
+
+	return right > VGA_DISPLAY_X;
+}
+
+/**
+ * @brief Returns the exclusive right edge of a cell, the last cell ends at the ink.
+ */
+static int _FIELD_CellEnd(const int16_t *pos, int len, int16_t ink, int n)
+{
+	if (n == len - 1) return _Max(pos[len], ink);
+	return pos[n + 1];
+}
+
+/**
+ * @brief Fills the columns x0..x1-1 of the field with its background.
+ */
+static void _FIELD_Clear(const FIELD_t *field, int x0, int x1)
+{
+	if (x1 > VGA_DISPLAY_X) x1 = VGA_DISPLAY_X;
+	if (x1 <= x0) return;
+
+	for (int row = 0; row < field->rows; row++)
+	{
+		UB_VGA_FillSpan(x0, field->y + row, x1 - x0, field->background);
+	}
+}
+
+/**
+ * @brief Draws one character of a field.
+ */
+static void _FIELD_DrawChar(const FIELD_t *field, const FONT_t *font, int x, char c)
+{
+	const void *glyph = FONT_Glyph(font, c);
+
+	if (glyph == NULL) return;
+
+	if (font->format == FONT_FMT_GLCD)
+		_draw_glcd_char(x, field->y, glyph, field->color, field->size, field->style);
+	else
+		_draw_packed_char(x, field->y, glyph, FONT_GlyphWidth(font, c), font->height, field->color, field->size, field->style);
+}
@@ -0,0 +1,223 @@
+/**
+ * @file Tilemap.c
+ * @brief Tile map code file
+ *
+ * This file contains the tile maps. A tile is drawn through a bitmap
+ * descriptor that points into the rows of the tile set, so every format
+ * with byte-aligned rows (raw, 1 bpp and 4 bpp) can be used as tile set.
+ * The tile set is looked up by its number at every draw, a cache slot may
+ * have been evicted or loaded with another bitmap since the map was made.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Tilemap.h"
+#include "API_LIB.h"
+#include "Blitter.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+/**
+ * @brief One tile map.
+ */
+typedef struct {
+	uint8_t used;				/**< Id is in use */
+	uint8_t format;				/**< Format of the tile set */
+	int16_t bitnr;				/**< Bitmap number of the tile set (flash or cache slot) */
+	uint16_t set_width;			/**< Width of the tile set */
+	uint16_t set_height;		/**< Height of the tile set */
+	uint16_t tile_height;		/**< Rows of one tile in the tile set */
+	uint16_t tile_count;		/**< Number of tiles in the tile set */
+	uint16_t x;					/**< Upper-left X-coordinate */
+	uint16_t y;					/**< Upper-left Y-coordinate */
+	uint16_t cell_width;		/**< Width of a cell on the screen */
+	uint16_t cell_height;		/**< Height of a cell on the screen */
+	uint8_t columns;			/**< Cells per row */
+	uint8_t rows;				/**< Number of rows */
+	uint8_t background;			/**< Color behind the tiles */
+	uint8_t cells[TILE_MAX_CELLS]; /**< Tile index per cell, row-major */
+} TILE_Map_t;
+
+static TILE_Map_t tile_maps[TILE_MAPS];
+
+static const ASSET_Bitmap_t *_TILE_Tileset(const TILE_Map_t *map);
+static void _TILE_Get(const TILE_Map_t *map, const ASSET_Bitmap_t *set, uint8_t index, ASSET_Bitmap_t *tile);
+static void _TILE_Fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color);
+static void _TILE_DrawCell(const TILE_Map_t *map, const ASSET_Bitmap_t *set, uint8_t column, uint8_t row, int fill);
+
+/**
+ * @brief Creates or replaces a tile map, all cells are empty.
+ */
+int TILE_Create(int id, int bitnr, uint16_t tile_height,
+				uint16_t x, uint16_t y, uint8_t columns, uint8_t rows, uint8_t background)
+{
+	const ASSET_Bitmap_t *tileset;
+	ASSET_Bitmap_t tile;
+	uint16_t width, height;
+
+	if (id < 0 || id >= TILE_MAPS || _GetBitmap(bitnr, &tileset)) return 1;
+	if (tileset->format == ASSET_FMT_RLE || tile_height == 0 || tile_height > tileset->height) return 1;
+	if (columns == 0 || rows == 0 || columns * rows > TILE_MAX_CELLS) return 1;
+
+	// Cell size on the screen, 90 and 270 degree tile sets swap width and height
+	tile = *tileset;
+	tile.height = tile_height;
+	ASSET_GetSize(&tile, ASSET_ROT_0, 1, &width, &height);
+	if (x + columns * width > VGA_DISPLAY_X || y + rows * height > VGA_DISPLAY_Y) return 1;
+
+	TILE_Map_t *map = &tile_maps[id];
+	map->used = 1;
+	map->bitnr = bitnr;
+	map->format = tileset->format;
+	map->set_width = tileset->width;
+	map->set_height = tileset->height;
+	map->tile_height = tile_height;
+	map->tile_count = tileset->height / tile_height;
+	if (map->tile_count > TILE_EMPTY) map->tile_count = TILE_EMPTY;
+	map->cell_width = width;
+	map->cell_height = height;
+	map->x = x;
+	map->y = y;
+	map->columns = columns;
+	map->rows = rows;
+	map->background = background;
+	memset(map->cells, TILE_EMPTY, sizeof(map->cells));
+	return 0;
+}
+
+/**
+ * @brief Sets a number of cells and redraws the cells that changed.
+ */
+int TILE_Set(int id, uint8_t column, uint8_t row, const uint8_t *indices, uint16_t count)
+{
+	if (id < 0 || id >= TILE_MAPS || !tile_maps[id].used) return 1;
+
+	TILE_Map_t *map = &tile_maps[id];
+	if (column >= map->columns || row >= map->rows) return 1;
+
+	uint16_t cell = row * map->columns + column;
+	if (cell + count > map->columns * map->rows) return 1;
+
+	for (uint16_t n = 0; n < count; n++)
+	{
+		if (indices[n] >= map->tile_count && indices[n] != TILE_EMPTY) return 1;
+	}
+
+	// Without its tile set the cells are only stored
+	const ASSET_Bitmap_t *set = _TILE_Tileset(map);
+
+	for (uint16_t n = 0; n < count; n++, cell++)
+	{
+		// An unchanged cell is not drawn again
+		if (map->cells[cell] == indices[n]) continue;
+
+		map->cells[cell] = indices[n];
+		if (set) _TILE_DrawCell(map, set, cell % map->columns, cell / map->columns, 1);
+	}
+	return 0;
+}
+
+/**
+ * @brief Draws all cells of a tile map.
+ */
+int TILE_Draw(int id)
+{
+	if (id < 0 || id >= TILE_MAPS || !tile_maps[id].used) return 1;
+
+	TILE_Map_t *map = &tile_maps[id];
+	const ASSET_Bitmap_t *set = _TILE_Tileset(map);
+	if (set == 0) return 0;
+
+	int opaque = (set->flags & ASSET_FLAG_OPAQUE) != 0;
+
+	// One fill for the whole map, then the tiles row by row (opaque tiles: only empty cells are filled)
+	if (!opaque)
+	{
+		_TILE_Fill(map->x, map->y, map->columns * map->cell_width, map->rows * map->cell_height, map->background);
+	}
+
+	for (uint8_t row = 0; row < map->rows; row++)
+	{
+		for (uint8_t column = 0; column < map->columns; column++)
+		{
+			_TILE_DrawCell(map, set, column, row, opaque);
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Looks up the tile set of a map.
+ * @param map Tile map.
+ * @return Tile set, NULL if its cache slot is not loaded or holds a bitmap of another shape.
+ */
+static const ASSET_Bitmap_t *_TILE_Tileset(const TILE_Map_t *map)
+{
+	const ASSET_Bitmap_t *set;
+
+	if (_GetBitmap(map->bitnr, &set)) return 0;
+	if (set->format != map->format || set->width != map->set_width || set->height != map->set_height) return 0;
+	return set;
+}
+
+/**
+ * @brief Fills a descriptor for one tile of the tile set.
+ * @param map Tile map.
+ * @param set Tile set of the map.
+ * @param index Tile index (below tile_count).
+ * @param tile Destination descriptor, points into the tile set data.
+ */
+static void _TILE_Get(const TILE_Map_t *map, const ASSET_Bitmap_t *set, uint8_t index, ASSET_Bitmap_t *tile)
+{
+	uint16_t stride = set->width;
+
+	if (set->format == ASSET_FMT_1BPP) stride = (set->width + 7) / 8;
+	if (set->format == ASSET_FMT_4BPP) stride = (set->width + 1) / 2;
+
+	*tile = *set;
+	tile->height = map->tile_height;
+	tile->size = stride * map->tile_height;
+	tile->data = set->data + index * tile->size;
+}
+
+/**
+ * @brief Fills a rectangle, on the DMA in 8 bpp mode.
+ */
+static void _TILE_Fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color)
+{
+	if (VGA.mode == VGA_MODE_8BPP && BLIT_Fill(x, y, width, height, color, 0, 0) == 0) return;
+
+	BLIT_Wait();
+	for (uint16_t row = 0; row < height; row++)
+	{
+		UB_VGA_FillSpan(x, y + row, width, color);
+	}
+}
+
+/**
+ * @brief Draws one cell.
+ * @param map Tile map.
+ * @param set Tile set of the map.
+ * @param column Column of the cell.
+ * @param row Row of the cell.
+ * @param fill 1 to fill the background first, 0 if it is already filled.
+ */
+static void _TILE_DrawCell(const TILE_Map_t *map, const ASSET_Bitmap_t *set, uint8_t column, uint8_t row, int fill)
+{
+	uint16_t x = map->x + column * map->cell_width;
+	uint16_t y = map->y + row * map->cell_height;
+	uint8_t index = map->cells[row * map->columns + column];
+	ASSET_Bitmap_t tile;
+
+	// Transparent pixels and empty cells show the background
+	if (fill && (index == TILE_EMPTY || !(set->flags & ASSET_FLAG_OPAQUE)))
+	{
+		_TILE_Fill(x, y, map->cell_width, map->cell_height, map->background);
+	}
+	if (index == TILE_EMPTY) return;
+
+	_TILE_Get(map, set, index, &tile);
+	ASSET_DrawBitmap(&tile, x, y);
+}
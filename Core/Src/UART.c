@@ -143,6 +143,25 @@ void usart2_enable_rx_interrupt(void)
     NVIC_EnableIRQ(USART2_IRQn);
 }
 
+/**
+ * @brief Disables the Receive Not Empty (RXNE) interrupt for USART2.
+ */
+void usart2_disable_rx_interrupt(void)
+{
+    USART2->CR1 &= ~USART_CR1_RXNEIE;
+    NVIC_ClearPendingIRQ(USART2_IRQn);
+}
+
+/**
+ * @brief Drops the byte in the data register and clears an overrun.
+ */
+void usart2_discard_rx(void)
+{
+    // Reading SR and then DR clears RXNE and ORE
+    (void)USART2->SR;
+    (void)USART2->DR;
+}
+
 
 #define LF_CHAR 0x0A // Line Feed character
 
@@ -0,0 +1,357 @@
+/**
+ * @file Upload.c
+ * @brief Image upload code file
+ *
+ * This file contains the streaming QOI decoder for the image upload.
+ * Bytes are fed one at a time into a small state machine, so a chunk
+ * may end in the middle of the header or of a QOI operation. Decoded
+ * pixels are quantized to RGB332 and collected in one row buffer, a
+ * full row is written to the framebuffer with UB_VGA_WriteSpan().
+ * A store upload copies the decoded bytes into a buffer instead.
+ *
+ * @author Xander Perry
+ * @date 2026-10-18
+ */
+
+#include "Upload.h"
+#include "stm32_ub_vga_screen.h"
+
+#include <string.h>
+
+/**
+ * @brief Upload and decoder state.
+ */
+typedef struct {
+	uint8_t state;				/**< UPLOAD_... */
+	uint8_t dither;				/**< 1 = ordered dither */
+	uint16_t x;					/**< Upper-left X-coordinate */
+	uint16_t y;					/**< Upper-left Y-coordinate */
+	uint16_t width;				/**< Image width from the header */
+	uint16_t height;			/**< Image height from the header */
+	uint16_t col;				/**< Next pixel in the row buffer */
+	uint16_t row;				/**< Row being decoded */
+	uint8_t op[5];				/**< Bytes of the current QOI operation */
+	uint8_t op_len;				/**< Bytes received of the current operation or header */
+	uint8_t header[UPLOAD_QOI_HEADER];
+	uint8_t px[4];				/**< Previous pixel (r, g, b, a) */
+	uint8_t index[UPLOAD_QOI_INDEX][4];
+	uint32_t b64_bits;			/**< Base64 bits not yet returned as bytes */
+	uint8_t b64_count;			/**< Number of 6-bit groups in b64_bits */
+	uint8_t *dst;				/**< Next byte of the store buffer */
+	uint32_t remaining;			/**< Bytes still expected by the store */
+	UPLOAD_Callback_t callback;	/**< Called when the store is complete */
+	void *context;				/**< Argument for the callback */
+} UPLOAD_t;
+
+static UPLOAD_t upload;
+static uint8_t upload_line[VGA_DISPLAY_X];
+
+// 4x4 ordered dither thresholds (Bayer matrix, 0..15)
+static const uint8_t upload_bayer[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5}
+};
+
+static int _UPLOAD_Byte(uint8_t byte);
+static int _UPLOAD_Header(void);
+static int _UPLOAD_OpSize(uint8_t op);
+static void _UPLOAD_Decode(void);
+static void _UPLOAD_Pixel(void);
+static int _UPLOAD_Base64(char c);
+
+/**
+ * @brief Starts a new upload, an active upload is aborted.
+ */
+void UPLOAD_Begin(uint16_t x, uint16_t y, uint8_t dither)
+{
+	memset(&upload, 0, sizeof(upload));
+	upload.x = x;
+	upload.y = y;
+	upload.dither = dither ? 1 : 0;
+	upload.px[3] = 255;
+	upload.state = UPLOAD_HEADER;
+}
+
+/**
+ * @brief Starts an upload of raw bytes into a buffer, an active upload is aborted.
+ */
+void UPLOAD_BeginStore(uint8_t *dst, uint32_t size, UPLOAD_Callback_t callback, void *context)
+{
+	memset(&upload, 0, sizeof(upload));
+	upload.dst = dst;
+	upload.remaining = size;
+	upload.callback = callback;
+	upload.context = context;
+	upload.state = size ? UPLOAD_STORE : UPLOAD_DONE;
+}
+
+/**
+ * @brief Decodes one base64 chunk of the upload.
+ */
+int UPLOAD_Data(const char *text)
+{
+	uint8_t padded = 0;
+
+	if (upload.state == UPLOAD_IDLE) return 1;
+
+	while (*text)
+	{
+		char c = *text++;
+
+		// Padding ends the base64 data, the remaining bits are fill
+		if (c == '=')
+		{
+			padded = 1;
+			break;
+		}
+
+		int value = _UPLOAD_Base64(c);
+		if (value < 0)
+		{
+			upload.state = UPLOAD_IDLE;
+			return 1;
+		}
+
+		upload.b64_bits = (upload.b64_bits << 6) | value;
+		upload.b64_count++;
+
+		// 4 characters = 3 bytes
+		if (upload.b64_count == 4)
+		{
+			if (_UPLOAD_Byte(upload.b64_bits >> 16) ||
+				_UPLOAD_Byte(upload.b64_bits >> 8) ||
+				_UPLOAD_Byte(upload.b64_bits))
+			{
+				upload.state = UPLOAD_IDLE;
+				return 1;
+			}
+			upload.b64_bits = 0;
+			upload.b64_count = 0;
+		}
+	}
+
+	// Padded tail: 2 characters = 1 byte, 3 characters = 2 bytes
+	if (padded)
+	{
+		int error = 0;
+		if (upload.b64_count == 2)
+		{
+			error = _UPLOAD_Byte(upload.b64_bits >> 4);
+		}
+		else if (upload.b64_count == 3)
+		{
+			error = _UPLOAD_Byte(upload.b64_bits >> 10) || _UPLOAD_Byte(upload.b64_bits >> 2);
+		}
+		upload.b64_bits = 0;
+		upload.b64_count = 0;
+
+		if (error)
+		{
+			upload.state = UPLOAD_IDLE;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Aborts the active upload, following data is refused.
+ */
+void UPLOAD_Abort(void)
+{
+	upload.state = UPLOAD_IDLE;
+}
+
+/**
+ * @brief Returns the state of the upload.
+ */
+uint8_t UPLOAD_State(void)
+{
+	return upload.state;
+}
+
+/**
+ * @brief Feeds one byte of the QOI file into the decoder.
+ * @param byte Next file byte.
+ * @return 0 if no errors occured, otherwise returns 1.
+ */
+static int _UPLOAD_Byte(uint8_t byte)
+{
+	switch (upload.state)
+	{
+	case UPLOAD_HEADER:
+		upload.header[upload.op_len++] = byte;
+		if (upload.op_len == UPLOAD_QOI_HEADER)
+		{
+			upload.op_len = 0;
+			return _UPLOAD_Header();
+		}
+		return 0;
+
+	case UPLOAD_PIXELS:
+		upload.op[upload.op_len++] = byte;
+		if (upload.op_len == _UPLOAD_OpSize(upload.op[0]))
+		{
+			_UPLOAD_Decode();
+			upload.op_len = 0;
+		}
+		return 0;
+
+	case UPLOAD_STORE:
+		*upload.dst++ = byte;
+		if (--upload.remaining == 0)
+		{
+			upload.state = UPLOAD_DONE;
+			if (upload.callback)
+			{
+				upload.callback(upload.context);
+			}
+		}
+		return 0;
+
+	case UPLOAD_DONE:
+		// End marker (7x 0x00, 0x01)
+		return 0;
+
+	default:
+		return 1;
+	}
+}
+
+/**
+ * @brief Checks the QOI header and the image position.
+ * @return 0 if the image fits on the screen, otherwise returns 1.
+ */
+static int _UPLOAD_Header(void)
+{
+	const uint8_t *h = upload.header;
+
+	uint32_t magic = (h[0] << 24) | (h[1] << 16) | (h[2] << 8) | h[3];
+	uint32_t width = (h[4] << 24) | (h[5] << 16) | (h[6] << 8) | h[7];
+	uint32_t height = (h[8] << 24) | (h[9] << 16) | (h[10] << 8) | h[11];
+
+	if (magic != UPLOAD_QOI_MAGIC) return 1;
+	if (h[12] != 3 && h[12] != 4) return 1;
+	if (upload.x >= VGA_DISPLAY_X || upload.y >= VGA_DISPLAY_Y) return 1;
+
+	// Sizes come from the host: compared against the room left, a sum could wrap
+	if (width == 0 || width > (uint32_t)(VGA_DISPLAY_X - upload.x)) return 1;
+	if (height == 0 || height > (uint32_t)(VGA_DISPLAY_Y - upload.y)) return 1;
+
+	upload.width = width;
+	upload.height = height;
+	upload.state = UPLOAD_PIXELS;
+	return 0;
+}
+
+/**
+ * @brief Returns the number of bytes of a QOI operation.
+ * @param op First byte of the operation.
+ */
+static int _UPLOAD_OpSize(uint8_t op)
+{
+	if (op == UPLOAD_QOI_OP_RGB) return 4;
+	if (op == UPLOAD_QOI_OP_RGBA) return 5;
+	if ((op & UPLOAD_QOI_MASK_2) == UPLOAD_QOI_OP_LUMA) return 2;
+	return 1;
+}
+
+/**
+ * @brief Decodes the complete operation in upload.op and emits its pixels.
+ */
+static void _UPLOAD_Decode(void)
+{
+	uint8_t *px = upload.px;
+	uint8_t b1 = upload.op[0];
+	uint8_t run = 1;
+
+	if (b1 == UPLOAD_QOI_OP_RGB)
+	{
+		px[0] = upload.op[1];
+		px[1] = upload.op[2];
+		px[2] = upload.op[3];
+	}
+	else if (b1 == UPLOAD_QOI_OP_RGBA)
+	{
+		px[0] = upload.op[1];
+		px[1] = upload.op[2];
+		px[2] = upload.op[3];
+		px[3] = upload.op[4];
+	}
+	else if ((b1 & UPLOAD_QOI_MASK_2) == UPLOAD_QOI_OP_INDEX)
+	{
+		memcpy(px, upload.index[b1], 4);
+	}
+	else if ((b1 & UPLOAD_QOI_MASK_2) == UPLOAD_QOI_OP_DIFF)
+	{
+		px[0] += ((b1 >> 4) & 0x03) - 2;
+		px[1] += ((b1 >> 2) & 0x03) - 2;
+		px[2] += (b1 & 0x03) - 2;
+	}
+	else if ((b1 & UPLOAD_QOI_MASK_2) == UPLOAD_QOI_OP_LUMA)
+	{
+		uint8_t b2 = upload.op[1];
+		int vg = (b1 & 0x3F) - 32;
+		px[0] += vg - 8 + ((b2 >> 4) & 0x0F);
+		px[1] += vg;
+		px[2] += vg - 8 + (b2 & 0x0F);
+	}
+	else
+	{
+		run = (b1 & 0x3F) + 1;
+	}
+
+	uint8_t hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % UPLOAD_QOI_INDEX;
+	memcpy(upload.index[hash], px, 4);
+
+	while (run-- && upload.state == UPLOAD_PIXELS)
+	{
+		_UPLOAD_Pixel();
+	}
+}
+
+/**
+ * @brief Quantizes the current pixel to RGB332 and writes full rows.
+ *
+ * The threshold t (0..15) is added before the truncation to 3/3/2 bits,
+ * t = 8 for every pixel gives normal rounding.
+ */
+static void _UPLOAD_Pixel(void)
+{
+	uint16_t t = upload.dither ? upload_bayer[upload.row & 0x03][upload.col & 0x03] : 8;
+	uint16_t bias = (t << 4) + 8;
+
+	uint8_t r = ((upload.px[0] * 7) + bias) >> 8;
+	uint8_t g = ((upload.px[1] * 7) + bias) >> 8;
+	uint8_t b = ((upload.px[2] * 3) + bias) >> 8;
+
+	upload_line[upload.col++] = (r << 5) | (g << 2) | b;
+
+	if (upload.col == upload.width)
+	{
+		UB_VGA_WriteSpan(upload.x, upload.y + upload.row, upload.width, upload_line);
+		upload.col = 0;
+		upload.row++;
+		if (upload.row == upload.height)
+		{
+			upload.state = UPLOAD_DONE;
+		}
+	}
+}
+
+/**
+ * @brief Converts a base64 character to its 6-bit value.
+ * @param c Base64 character.
+ * @return Value 0..63, or -1 for an invalid character.
+ */
+static int _UPLOAD_Base64(char c)
+{
+	if (c >= 'A' && c <= 'Z') return c - 'A';
+	if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+	if (c >= '0' && c <= '9') return c - '0' + 52;
+	if (c == '+') return 62;
+	if (c == '/') return 63;
+	return -1;
+}
@@ -16,6 +16,10 @@
 
 #include "uart.h"
 #include "LogicLayer.h"
+#include "Blitter.h"
+#include "Cache.h"
+#include "Font.h"
+#include "Sprite.h"
 
 #define CMD_BUFF_SIZE 512
 
@@ -24,6 +28,11 @@ int main(void)
 {
 	SystemInit(); // System speed to 168MHz
 
+	// Cycle counter from here on, the boot time in `opstart` counts from the end of SystemInit()
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= 0x00000001;
+
 	usart2_init(); // initialize UART
 
 	usart2_enable_rx_interrupt(); // Enable UART the interrupt
@@ -32,10 +41,29 @@ int main(void)
 
 	UB_VGA_Screen_Init(); // Init VGA-Screen
 
-	UB_VGA_FillScreen(VGA_COL_GREEN); // Startup VGA screen with green background
+	BLIT_Init(); // Init DMA blitter for fills and copies
+	CACHE_Init(); // Init RAM asset cache (CCMRAM)
+	FONT_Init(); // Register built-in fonts
+	SPRITE_Init(); // No sprites on the screen
+
+	// Boot script from flash (written with opstart), otherwise a green background
+	if (LIST_Boot())
+	{
+		UB_VGA_FillScreen(VGA_COL_GREEN);
+	}
+
+  uint32_t sprite_frame = 0; // Last frame in which the sprites were updated
 
   while(1)
   {
+	  // Apply the sprite changes once per frame, then close the dirty rectangles of the frame
+	  if (VGA.frame_cnt != sprite_frame)
+	  {
+		  sprite_frame = VGA.frame_cnt;
+		  SPRITE_Update();
+		  UB_VGA_DirtyFrame();
+	  }
+
 	  // Check the flag raised by the ISR
 	  if (uart_rx_line_ready)
 	  {
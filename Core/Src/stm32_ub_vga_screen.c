@@ -6,12 +6,12 @@
 // Function : VGA out by GPIO (320x240 Pixel, 8bit color)
 //
 // signals  : PB11      = HSync-Signal
-//            PB12      = VSync-Signal
+//            PB12      = VSync-Signal (PB0 with VGA_VSYNC_TIMER)
 //            PE8+PE9   = color Blue
 //            PE10-PE12 = color Green
 //            PE13-PE15 = color red
 //
-// uses     : TIM1, TIM2
+// uses     : TIM1, TIM2, TIM3, TIM4
 //            DMA2, Channel6, Stream5
 //--------------------------------------------------------------
 
@@ -20,8 +20,48 @@
 //--------------------------------------------------------------
 #include "stm32_ub_vga_screen.h"
 
+#include <string.h>
+
+//--------------------------------------------------------------
+// all Stream5 flags in HIFCR (FEIF5, DMEIF5, TEIF5, HTIF5, TCIF5)
+//--------------------------------------------------------------
+#define VGA_DMA_FLAGS    ((uint32_t)0x00000F40)
+
 VGA_t VGA;
+VGA_DIRTY_t VGA_DIRTY;
 uint8_t VGA_RAM1[(VGA_DISPLAY_X+1)*VGA_DISPLAY_Y];
+
+//--------------------------------------------------------------
+// 4bpp mode : palette, lookup tables and DMA line buffers
+// (two pages of VGA_PAGE_SIZE fit in VGA_RAM1)
+//--------------------------------------------------------------
+uint8_t VGA_PAL[VGA_PAL_SIZE] = {
+  VGA_COL_BLACK, VGA_COL_BLUE, VGA_COL_LIGHT_BLUE, VGA_COL_GREEN,
+  VGA_COL_LIGHT_GREEN, VGA_COL_RED, VGA_COL_LIGHT_RED, VGA_COL_WHITE,
+  VGA_COL_BROWN, VGA_COL_CYAN, VGA_COL_LIGHT_CYAN, VGA_COL_MAGENTA,
+  VGA_COL_LIGHT_MAGENTA, VGA_COL_YELLOW, VGA_COL_GRAY, 0x49
+};
+uint16_t VGA_PAL_LUT[256];
+uint8_t VGA_PAL_INDEX[256];
+uint8_t VGA_LINE_BUF[2][VGA_LINE_STRIDE] __attribute__((aligned(4)));
+
+//--------------------------------------------------------------
+// black line for the DMA outside the picture (in RAM like the picture)
+//--------------------------------------------------------------
+static uint8_t VGA_BLACK_LINE[VGA_DISPLAY_X+1];
+
+//--------------------------------------------------------------
+// text mode : glyph rows and the byte masks for one glyph nibble
+// (MSB of the nibble is the left pixel = lowest byte of the word)
+//--------------------------------------------------------------
+uint8_t VGA_TEXT_FONT[VGA_TEXT_GLYPHS][VGA_TEXT_CELL_H];
+static const uint32_t VGA_TEXT_MASK[16] = {
+  0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000,
+  0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+  0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF,
+  0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF
+};
+
 //--------------------------------------------------------------
 // internal Functions
 //--------------------------------------------------------------
@@ -29,6 +69,12 @@ void P_VGA_InitIO(void);
 void P_VGA_InitTIM(void);
 void P_VGA_InitINT(void);
 void P_VGA_InitDMA(void);
+void P_VGA_StartDMA(void);
+void P_VGA_BuildPalette(void);
+void P_VGA_ExpandLine(uint8_t *dst, const uint8_t *src);
+void P_VGA_ExpandText(uint8_t *dst, uint16_t yp);
+void P_VGA_ScanLine(uint8_t *dst, uint16_t yp);
+uint32_t P_VGA_Area(const VGA_RECT_t *r);
 
 
 //--------------------------------------------------------------
@@ -39,8 +85,31 @@ void UB_VGA_Screen_Init(void)
   uint16_t xp,yp;
 
   VGA.hsync_cnt=0;
-  VGA.start_adr=0;
-  VGA.dma2_cr_reg=0;
+  VGA.mode=VGA_MODE_8BPP;
+  VGA.scan_mode=VGA_MODE_8BPP;
+  VGA.draw_page=0;
+  VGA.show_page=0;
+  VGA.flip_pending=0;
+  UB_VGA_ResetClip();
+  memset(&VGA_DIRTY,0,sizeof(VGA_DIRTY));
+  VGA.isr_cycles=0;
+  VGA.isr_load=0;
+  VGA.frame_cnt=0;
+  VGA.lat_min=0xFFFF;
+  VGA.lat_max=0;
+  VGA.jitter_min=0;
+  VGA.jitter_max=0;
+  VGA.underrun_cnt=0;
+  VGA.dma_err_cnt=0;
+  VGA.lat_peak=0;
+
+  // cycle counter on (main() started it already, it is not cleared : the boot time counts from main)
+  CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL|=0x00000001;
+
+  // 4bpp tables, last pixel of each line buffer stays black
+  P_VGA_BuildPalette();
+  memset(VGA_LINE_BUF,0,sizeof(VGA_LINE_BUF));
 
   // RAM init total black
   for(yp=0;yp<VGA_DISPLAY_Y;yp++) {
@@ -53,16 +122,11 @@ void UB_VGA_Screen_Init(void)
   P_VGA_InitIO();
   // init Timer
   P_VGA_InitTIM();
-  // init DMA
+  // init DMA (started by the first frame start)
   P_VGA_InitDMA();
+
   // init Interrupts
   P_VGA_InitINT();
-
-  //-----------------------
-  // Register swap and safe
-  //-----------------------
-  // content of CR-Register read and save
-  VGA.dma2_cr_reg=DMA2_Stream5->CR;
 }
 
 
@@ -73,6 +137,20 @@ void UB_VGA_FillScreen(uint8_t color)
 {
   uint16_t xp,yp;
 
+  if(color == 0x01) return;  // skip background pixel
+  UB_VGA_MarkDirty(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    // both nibbles of every byte get the same index
+    memset(&VGA_RAM1[VGA.draw_page*VGA_PAGE_SIZE],VGA_PAL_INDEX[color]*0x11,VGA_PAGE_SIZE);
+    return;
+  }
+  if(VGA.mode==VGA_MODE_TEXT) {
+    // empty cells, fore- and background in the color
+    UB_VGA_TextScroll(VGA_TEXT_ROWS,VGA_PAL_INDEX[color]*0x11);
+    return;
+  }
+
   for(yp=0;yp<VGA_DISPLAY_Y;yp++) {
     for(xp=0;xp<VGA_DISPLAY_X;xp++) {
       UB_VGA_SetPixel(xp,yp,color);
@@ -90,12 +168,640 @@ void UB_VGA_SetPixel(uint16_t xp, uint16_t yp, uint8_t color)
   if (color == 0x01) return;  // skip background pixel
   if(xp>=VGA_DISPLAY_X) xp=0;
   if(yp>=VGA_DISPLAY_Y) yp=0;
+  if((xp<VGA.clip_x0) || (xp>=VGA.clip_x1) || (yp<VGA.clip_y0) || (yp>=VGA.clip_y1)) return;
+
+  // inside the rectangle merged last : nothing to do
+  VGA_RECT_t *r=&VGA_DIRTY.rect[VGA_DIRTY.last];
+  if((VGA_DIRTY.cnt==0) || (xp<r->x0) || (xp>=r->x1) || (yp<r->y0) || (yp>=r->y1)) {
+    UB_VGA_MarkDirty(xp,yp,1,1);
+  }
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    // Write palette index into one nibble of the draw page
+    uint8_t *adr=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)+(xp>>1)];
+    uint8_t index=VGA_PAL_INDEX[color];
+    if(xp & 0x01) {
+      *adr=(*adr & 0xF0) | index;
+    }
+    else {
+      *adr=(*adr & 0x0F) | (index<<4);
+    }
+    return;
+  }
 
   // Write pixel to ram
   VGA_RAM1[(yp*(VGA_DISPLAY_X+1))+xp]=color;
 }
 
 
+//--------------------------------------------------------------
+// fill a horizontal span of len pixels with one color
+// (clipped to the clip rectangle, no transparent color)
+//--------------------------------------------------------------
+void UB_VGA_FillSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t color)
+{
+  // clip to the clip rectangle (default the whole screen)
+  if((yp<VGA.clip_y0) || (yp>=VGA.clip_y1) || (xp>=VGA.clip_x1)) return;
+  if(xp<VGA.clip_x0) {
+    if(len<=(VGA.clip_x0-xp)) return;
+    len-=VGA.clip_x0-xp;
+    xp=VGA.clip_x0;
+  }
+  if(len>(VGA.clip_x1-xp)) len=VGA.clip_x1-xp;
+  if(len==0) return;
+  UB_VGA_MarkDirty(xp,yp,len,1);
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    uint8_t *adr=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)+(xp>>1)];
+    uint8_t index=VGA_PAL_INDEX[color];
+
+    // odd start : low nibble of the first byte
+    if(xp & 0x01) {
+      *adr=(*adr & 0xF0) | index;
+      adr++;
+      len--;
+    }
+    // two pixels per byte
+    memset(adr,index*0x11,len>>1);
+    adr+=len>>1;
+    // odd end : high nibble of the last byte
+    if(len & 0x01) {
+      *adr=(*adr & 0x0F) | (index<<4);
+    }
+    return;
+  }
+
+  memset(&VGA_RAM1[(yp*(VGA_DISPLAY_X+1))+xp],color,len);
+}
+
+
+//--------------------------------------------------------------
+// copy a horizontal span of len pixels into the screen
+// (clipped to the clip rectangle, no transparent color)
+//--------------------------------------------------------------
+void UB_VGA_WriteSpan(uint16_t xp, uint16_t yp, uint16_t len, const uint8_t *src)
+{
+  uint16_t n;
+
+  // clip to the clip rectangle (default the whole screen)
+  if((yp<VGA.clip_y0) || (yp>=VGA.clip_y1) || (xp>=VGA.clip_x1)) return;
+  if(xp<VGA.clip_x0) {
+    if(len<=(VGA.clip_x0-xp)) return;
+    src+=VGA.clip_x0-xp;
+    len-=VGA.clip_x0-xp;
+    xp=VGA.clip_x0;
+  }
+  if(len>(VGA.clip_x1-xp)) len=VGA.clip_x1-xp;
+  if(len==0) return;
+  UB_VGA_MarkDirty(xp,yp,len,1);
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    uint8_t *adr=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)];
+    for(n=0;n<len;n++,xp++) {
+      uint8_t index=VGA_PAL_INDEX[src[n]];
+      if(xp & 0x01) {
+        adr[xp>>1]=(adr[xp>>1] & 0xF0) | index;
+      }
+      else {
+        adr[xp>>1]=(adr[xp>>1] & 0x0F) | (index<<4);
+      }
+    }
+    return;
+  }
+
+  memcpy(&VGA_RAM1[(yp*(VGA_DISPLAY_X+1))+xp],src,len);
+}
+
+
+//--------------------------------------------------------------
+// copy a horizontal span of len pixels into the screen,
+// pixels with the key color are skipped (transparent)
+// (clipped to the clip rectangle)
+//
+// 8bpp : four pixels per word with the SIMD instructions
+//        USUB8 sets one GE flag per byte that differs from the key,
+//        SEL takes those bytes from src and the others from screen
+//--------------------------------------------------------------
+void UB_VGA_WriteSpanKeyed(uint16_t xp, uint16_t yp, uint16_t len, const uint8_t *src, uint8_t key)
+{
+  uint16_t n;
+
+  // clip to the clip rectangle (default the whole screen)
+  if((yp<VGA.clip_y0) || (yp>=VGA.clip_y1) || (xp>=VGA.clip_x1)) return;
+  if(xp<VGA.clip_x0) {
+    if(len<=(VGA.clip_x0-xp)) return;
+    src+=VGA.clip_x0-xp;
+    len-=VGA.clip_x0-xp;
+    xp=VGA.clip_x0;
+  }
+  if(len>(VGA.clip_x1-xp)) len=VGA.clip_x1-xp;
+  if(len==0) return;
+  UB_VGA_MarkDirty(xp,yp,len,1);
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    uint8_t *adr=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)];
+    for(n=0;n<len;n++,xp++) {
+      if(src[n]==key) continue;
+      uint8_t index=VGA_PAL_INDEX[src[n]];
+      if(xp & 0x01) {
+        adr[xp>>1]=(adr[xp>>1] & 0xF0) | index;
+      }
+      else {
+        adr[xp>>1]=(adr[xp>>1] & 0x0F) | (index<<4);
+      }
+    }
+    return;
+  }
+
+  uint8_t *adr=&VGA_RAM1[(yp*(VGA_DISPLAY_X+1))+xp];
+  uint32_t keys=key*0x01010101;
+  uint32_t pixels,diff;
+
+  // lines are 321 bytes : single pixels up to the first word boundary
+  while((len>0) && ((uint32_t)adr & 0x03)) {
+    if(*src!=key) *adr=*src;
+    adr++;
+    src++;
+    len--;
+  }
+
+  // four pixels per word (src may be unaligned, the M4 loads it anyway)
+  for(;len>=4;len-=4,adr+=4,src+=4) {
+    memcpy(&pixels,src,4);
+    diff=pixels^keys;
+    if(diff==0) continue; // four transparent pixels
+    __USUB8(diff,0x01010101); // GE[n] = (byte n != key)
+    *(uint32_t *)adr=__SEL(pixels,*(uint32_t *)adr);
+  }
+
+  // remaining pixels
+  for(n=0;n<len;n++) {
+    if(src[n]!=key) adr[n]=src[n];
+  }
+}
+
+
+//--------------------------------------------------------------
+// copy a horizontal span of len pixels from the screen
+// (clipped at the right border, 4bpp returns the palette colors)
+//--------------------------------------------------------------
+void UB_VGA_ReadSpan(uint16_t xp, uint16_t yp, uint16_t len, uint8_t *dst)
+{
+  uint16_t n;
+
+  if((xp>=VGA_DISPLAY_X) || (yp>=VGA_DISPLAY_Y)) return;
+  if(len>(VGA_DISPLAY_X-xp)) len=VGA_DISPLAY_X-xp;
+
+  if(VGA.mode==VGA_MODE_4BPP) {
+    uint8_t *adr=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)];
+    for(n=0;n<len;n++,xp++) {
+      if(xp & 0x01) {
+        dst[n]=VGA_PAL[adr[xp>>1] & 0x0F];
+      }
+      else {
+        dst[n]=VGA_PAL[adr[xp>>1]>>4];
+      }
+    }
+    return;
+  }
+
+  memcpy(dst,&VGA_RAM1[(yp*(VGA_DISPLAY_X+1))+xp],len);
+}
+
+
+//--------------------------------------------------------------
+// copy a rectangle of the screen to another place
+// source and destination may overlap : the rows are copied
+// bottom-up when the destination is lower, every row with
+// memmove (clipped at the screen border, not at the clip rectangle)
+//--------------------------------------------------------------
+void UB_VGA_CopyRect(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height, uint16_t dx, uint16_t dy)
+{
+  uint16_t row,n,src_row,dst_row;
+  uint8_t line[VGA_DISPLAY_X];
+
+  if(VGA.mode==VGA_MODE_TEXT) return;
+  if((sx>=VGA_DISPLAY_X) || (sy>=VGA_DISPLAY_Y) || (dx>=VGA_DISPLAY_X) || (dy>=VGA_DISPLAY_Y)) return;
+  if(width>(VGA_DISPLAY_X-sx)) width=VGA_DISPLAY_X-sx;
+  if(width>(VGA_DISPLAY_X-dx)) width=VGA_DISPLAY_X-dx;
+  if(height>(VGA_DISPLAY_Y-sy)) height=VGA_DISPLAY_Y-sy;
+  if(height>(VGA_DISPLAY_Y-dy)) height=VGA_DISPLAY_Y-dy;
+  if((width==0) || (height==0)) return;
+  UB_VGA_MarkDirty(dx,dy,width,height);
+
+  for(row=0;row<height;row++) {
+    // lower destination : start with the last row
+    src_row=(dy>sy) ? sy+height-1-row : sy+row;
+    dst_row=(dy>sy) ? dy+height-1-row : dy+row;
+
+    if(VGA.mode==VGA_MODE_4BPP) {
+      // palette indices through a line buffer (source and destination nibbles can differ)
+      uint8_t *src=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(src_row*VGA_PAGE_STRIDE)];
+      uint8_t *dst=&VGA_RAM1[(VGA.draw_page*VGA_PAGE_SIZE)+(dst_row*VGA_PAGE_STRIDE)];
+      for(n=0;n<width;n++) {
+        line[n]=((sx+n) & 0x01) ? (src[(sx+n)>>1] & 0x0F) : (src[(sx+n)>>1]>>4);
+      }
+      for(n=0;n<width;n++) {
+        uint8_t *adr=&dst[(dx+n)>>1];
+        if((dx+n) & 0x01) {
+          *adr=(*adr & 0xF0) | line[n];
+        }
+        else {
+          *adr=(*adr & 0x0F) | (line[n]<<4);
+        }
+      }
+      continue;
+    }
+
+    memmove(&VGA_RAM1[(dst_row*(VGA_DISPLAY_X+1))+dx],&VGA_RAM1[(src_row*(VGA_DISPLAY_X+1))+sx],width);
+  }
+}
+
+
+//--------------------------------------------------------------
+// limit all drawing (SetPixel, spans, blitter) to a rectangle
+// the rectangle is clipped to the screen
+// (text mode : the rectangle stays empty, pixels are not drawn)
+//--------------------------------------------------------------
+void UB_VGA_SetClip(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height)
+{
+  if(VGA.mode==VGA_MODE_TEXT) {
+    width=0;
+    height=0;
+  }
+  if(xp>VGA_DISPLAY_X) xp=VGA_DISPLAY_X;
+  if(yp>VGA_DISPLAY_Y) yp=VGA_DISPLAY_Y;
+  if(width>(VGA_DISPLAY_X-xp)) width=VGA_DISPLAY_X-xp;
+  if(height>(VGA_DISPLAY_Y-yp)) height=VGA_DISPLAY_Y-yp;
+
+  VGA.clip_x0=xp;
+  VGA.clip_y0=yp;
+  VGA.clip_x1=xp+width;
+  VGA.clip_y1=yp+height;
+}
+
+
+//--------------------------------------------------------------
+// drawing is allowed on the whole screen again
+//--------------------------------------------------------------
+void UB_VGA_ResetClip(void)
+{
+  UB_VGA_SetClip(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+}
+
+
+//--------------------------------------------------------------
+// switch the framebuffer mode (VGA_MODE_8BPP, _4BPP or _TEXT)
+// the RAM is cleared to black, the scan-out follows at next vsync
+// (text mode : VGA_TEXT_FONT must be filled before)
+//--------------------------------------------------------------
+void UB_VGA_SetMode(uint8_t mode)
+{
+  if((mode!=VGA_MODE_4BPP) && (mode!=VGA_MODE_TEXT)) mode=VGA_MODE_8BPP;
+
+  // text mode : glyph 0 (space) on palette index 0
+  memset(VGA_RAM1,0,sizeof(VGA_RAM1));
+  UB_VGA_MarkDirty(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+  // 4bpp : drawing starts on the hidden page
+  VGA.draw_page=(mode==VGA_MODE_4BPP) ? 1 : 0;
+  VGA.show_page=0;
+  VGA.flip_pending=0;
+  VGA.mode=mode;
+  UB_VGA_ResetClip();
+}
+
+
+//--------------------------------------------------------------
+// write one character cell (text mode)
+// characters without glyph are shown as space
+//--------------------------------------------------------------
+void UB_VGA_TextPut(uint8_t col, uint8_t row, char c, uint8_t attr)
+{
+  uint8_t glyph=(uint8_t)c-VGA_TEXT_FIRST;
+  uint8_t *cell;
+
+  if((VGA.mode!=VGA_MODE_TEXT) || (col>=VGA_TEXT_COLS) || (row>=VGA_TEXT_ROWS)) return;
+  if(glyph>=VGA_TEXT_GLYPHS) glyph=0;
+
+  cell=&VGA_RAM1[((row*VGA_TEXT_COLS)+col)*2];
+  cell[0]=glyph;
+  cell[1]=attr;
+  UB_VGA_MarkDirty(col*VGA_TEXT_CELL_W,row*VGA_TEXT_CELL_H,VGA_TEXT_CELL_W,VGA_TEXT_CELL_H);
+}
+
+
+//--------------------------------------------------------------
+// move all cells up (text mode)
+// the rows that come free are spaces with the attribute
+//--------------------------------------------------------------
+void UB_VGA_TextScroll(uint8_t lines, uint8_t attr)
+{
+  uint16_t n,keep;
+  uint8_t *cell;
+
+  if(VGA.mode!=VGA_MODE_TEXT) return;
+  if(lines>VGA_TEXT_ROWS) lines=VGA_TEXT_ROWS;
+
+  keep=(VGA_TEXT_ROWS-lines)*VGA_TEXT_COLS*2;
+  memmove(VGA_RAM1,&VGA_RAM1[lines*VGA_TEXT_COLS*2],keep);
+
+  cell=&VGA_RAM1[keep];
+  for(n=0;n<lines*VGA_TEXT_COLS;n++) {
+    *cell++=0;
+    *cell++=attr;
+  }
+  UB_VGA_MarkDirty(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+}
+
+
+//--------------------------------------------------------------
+// set one palette entry (4bpp and text mode)
+// every pixel using this index changes color with the next frame
+//--------------------------------------------------------------
+void UB_VGA_SetPalette(uint8_t index, uint8_t color)
+{
+  if(index>=VGA_PAL_SIZE) return;
+
+  VGA_PAL[index]=color;
+  P_VGA_BuildPalette();
+  UB_VGA_MarkDirty(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+}
+
+
+//--------------------------------------------------------------
+// show the draw page at the next vsync (4bpp mode)
+// waits until the flip is done, after that SetPixel
+// writes to the page that is no longer visible
+// return : 0=flipped, 1=no flip within VGA_FLIP_FRAMES frames
+//          (vsync interrupt not running), the pages stay as they were
+//--------------------------------------------------------------
+uint8_t UB_VGA_FlipPage(void)
+{
+  uint32_t start=DWT->CYCCNT;
+  uint8_t shown=VGA.show_page;
+
+  if(VGA.mode!=VGA_MODE_4BPP) return(1);
+
+  // timed with the cycle counter : frame_cnt stops with the interrupt
+  VGA.flip_pending=1;
+  while(VGA.flip_pending && ((DWT->CYCCNT-start)<(VGA_FLIP_FRAMES*VGA_FRAME_CYCLES)));
+  // the vsync may still flip between the test and the clear,
+  // the draw page follows show_page in both cases
+  VGA.flip_pending=0;
+  VGA.draw_page=VGA.show_page^0x01;
+  if(VGA.show_page==shown) return(1);
+
+  UB_VGA_MarkDirty(0,0,VGA_DISPLAY_X,VGA_DISPLAY_Y);
+  return(0);
+}
+
+
+//--------------------------------------------------------------
+// clear the scan-out health counters
+//--------------------------------------------------------------
+void UB_VGA_ResetStats(void)
+{
+  VGA.frame_cnt=0;
+  VGA.underrun_cnt=0;
+  VGA.dma_err_cnt=0;
+  VGA.lat_peak=0;
+  VGA_DIRTY.area_peak=0;
+  VGA_DIRTY.area_sum=0;
+  VGA_DIRTY.frames=0;
+  VGA_DIRTY.dirty_frames=0;
+}
+
+
+//--------------------------------------------------------------
+// merge a changed rectangle into the dirty set of this frame
+// a rectangle that overlaps or touches one in the set grows it,
+// when the set is full the cheapest union is taken
+//--------------------------------------------------------------
+void UB_VGA_MarkDirty(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height)
+{
+  VGA_RECT_t n,u,*r;
+  uint32_t growth,best_growth=0xFFFFFFFF;
+  uint8_t i,j,best=0;
+
+  if((width==0) || (height==0)) return;
+  n.x0=xp;
+  n.y0=yp;
+  n.x1=xp+width;
+  n.y1=yp+height;
+
+  // fast path : inside the rectangle merged last
+  r=&VGA_DIRTY.rect[VGA_DIRTY.last];
+  if((VGA_DIRTY.cnt>0) && (n.x0>=r->x0) && (n.x1<=r->x1) && (n.y0>=r->y0) && (n.y1<=r->y1)) return;
+
+  for(i=0;i<VGA_DIRTY.cnt;i++) {
+    r=&VGA_DIRTY.rect[i];
+    if((n.x0<=r->x1) && (r->x0<=n.x1) && (n.y0<=r->y1) && (r->y0<=n.y1)) break;
+  }
+
+  if((i==VGA_DIRTY.cnt) && (VGA_DIRTY.cnt<VGA_DIRTY_RECTS)) {
+    VGA_DIRTY.rect[VGA_DIRTY.cnt]=n;
+    VGA_DIRTY.last=VGA_DIRTY.cnt++;
+    return;
+  }
+
+  if(i==VGA_DIRTY.cnt) {
+    // set is full : merge where the union grows the least
+    for(j=0;j<VGA_DIRTY.cnt;j++) {
+      r=&VGA_DIRTY.rect[j];
+      u.x0=(r->x0<n.x0)?r->x0:n.x0;
+      u.y0=(r->y0<n.y0)?r->y0:n.y0;
+      u.x1=(r->x1>n.x1)?r->x1:n.x1;
+      u.y1=(r->y1>n.y1)?r->y1:n.y1;
+      growth=P_VGA_Area(&u)-P_VGA_Area(r);
+      if(growth<best_growth) {
+        best_growth=growth;
+        best=j;
+      }
+    }
+    i=best;
+  }
+
+  r=&VGA_DIRTY.rect[i];
+  if(n.x0<r->x0) r->x0=n.x0;
+  if(n.y0<r->y0) r->y0=n.y0;
+  if(n.x1>r->x1) r->x1=n.x1;
+  if(n.y1>r->y1) r->y1=n.y1;
+
+  // the grown rectangle swallows the ones it now overlaps
+  for(j=0;j<VGA_DIRTY.cnt;) {
+    VGA_RECT_t *o=&VGA_DIRTY.rect[j];
+    if((j!=i) && (o->x0<r->x1) && (r->x0<o->x1) && (o->y0<r->y1) && (r->y0<o->y1)) {
+      if(o->x0<r->x0) r->x0=o->x0;
+      if(o->y0<r->y0) r->y0=o->y0;
+      if(o->x1>r->x1) r->x1=o->x1;
+      if(o->y1>r->y1) r->y1=o->y1;
+      // last rectangle moves into the free place
+      VGA_DIRTY.cnt--;
+      *o=VGA_DIRTY.rect[VGA_DIRTY.cnt];
+      if(i==VGA_DIRTY.cnt) {
+        i=j;
+        r=o;
+      }
+      j=0;
+      continue;
+    }
+    j++;
+  }
+  VGA_DIRTY.last=i;
+}
+
+
+//--------------------------------------------------------------
+// close the dirty set of this frame (called once per frame)
+// the set moves to VGA_DIRTY.done and the statistics are updated
+//--------------------------------------------------------------
+void UB_VGA_DirtyFrame(void)
+{
+  uint32_t area=0;
+  uint8_t i;
+
+  for(i=0;i<VGA_DIRTY.cnt;i++) {
+    area+=P_VGA_Area(&VGA_DIRTY.rect[i]);
+    VGA_DIRTY.done[i]=VGA_DIRTY.rect[i];
+  }
+  VGA_DIRTY.done_cnt=VGA_DIRTY.cnt;
+  VGA_DIRTY.cnt=0;
+  VGA_DIRTY.last=0;
+
+  VGA_DIRTY.area_last=area;
+  VGA_DIRTY.area_sum+=area;
+  if(area>VGA_DIRTY.area_peak) VGA_DIRTY.area_peak=area;
+  VGA_DIRTY.frames++;
+  if(area) VGA_DIRTY.dirty_frames++;
+}
+
+
+//--------------------------------------------------------------
+// copy the dirty rectangles of the last closed frame
+// rects needs room for VGA_DIRTY_RECTS, returns the number
+//--------------------------------------------------------------
+uint8_t UB_VGA_GetDirty(VGA_RECT_t *rects)
+{
+  memcpy(rects,VGA_DIRTY.done,VGA_DIRTY.done_cnt*sizeof(VGA_RECT_t));
+  return VGA_DIRTY.done_cnt;
+}
+
+
+//--------------------------------------------------------------
+// CPU load of the VGA interrupts during the last frame
+// in 1/1000 (ISR entry and exit not included)
+//--------------------------------------------------------------
+uint16_t UB_VGA_GetIsrLoad(void)
+{
+  return (uint16_t)(((uint64_t)VGA.isr_load*1000)/VGA_FRAME_CYCLES);
+}
+
+
+//--------------------------------------------------------------
+// internal Function
+// pixels in a rectangle
+//--------------------------------------------------------------
+uint32_t P_VGA_Area(const VGA_RECT_t *r)
+{
+  return (uint32_t)(r->x1-r->x0)*(r->y1-r->y0);
+}
+
+
+//--------------------------------------------------------------
+// internal Function
+// build the byte-pair LUT and the nearest index table
+// from the 16 palette colors
+//--------------------------------------------------------------
+void P_VGA_BuildPalette(void)
+{
+  uint16_t n;
+  uint8_t i,best;
+  int32_t dr,dg,db,dist,best_dist;
+
+  // left pixel (high nibble) is the low byte of the halfword
+  for(n=0;n<256;n++) {
+    VGA_PAL_LUT[n]=VGA_PAL[n>>4] | (VGA_PAL[n&0x0F]<<8);
+  }
+
+  // nearest palette entry in R3G3B2 space (blue weighted up to 3bit)
+  for(n=0;n<256;n++) {
+    best=0;
+    best_dist=0x7FFFFFFF;
+    for(i=0;i<VGA_PAL_SIZE;i++) {
+      dr=((n>>5)&0x07)-((VGA_PAL[i]>>5)&0x07);
+      dg=((n>>2)&0x07)-((VGA_PAL[i]>>2)&0x07);
+      db=((n&0x03)-(VGA_PAL[i]&0x03))*2;
+      dist=dr*dr+dg*dg+db*db;
+      if(dist<best_dist) {
+        best_dist=dist;
+        best=i;
+      }
+    }
+    VGA_PAL_INDEX[n]=best;
+  }
+}
+
+
+//--------------------------------------------------------------
+// internal Function
+// expand one 4bpp line (160 Byte) into a DMA line buffer
+//--------------------------------------------------------------
+void P_VGA_ExpandLine(uint8_t *dst, const uint8_t *src)
+{
+  uint16_t *ptr=(uint16_t *)dst;
+  uint16_t n;
+
+  for(n=0;n<VGA_PAGE_STRIDE;n++) {
+    ptr[n]=VGA_PAL_LUT[src[n]];
+  }
+}
+
+
+//--------------------------------------------------------------
+// internal Function
+// expand one line of character cells into a DMA line buffer
+// (text mode, two words per cell)
+//--------------------------------------------------------------
+void P_VGA_ExpandText(uint8_t *dst, uint16_t yp)
+{
+  uint32_t *ptr=(uint32_t *)dst;
+  const uint8_t *cell=&VGA_RAM1[(yp/VGA_TEXT_CELL_H)*VGA_TEXT_COLS*2];
+  uint8_t line=yp%VGA_TEXT_CELL_H;
+  uint32_t fg,bg,mask;
+  uint8_t bits;
+  uint16_t n;
+
+  for(n=0;n<VGA_TEXT_COLS;n++) {
+    bits=VGA_TEXT_FONT[cell[0]][line];
+    fg=VGA_PAL[cell[1] & 0x0F]*0x01010101;
+    bg=VGA_PAL[cell[1]>>4]*0x01010101;
+
+    mask=VGA_TEXT_MASK[bits>>4];
+    ptr[0]=(fg & mask) | (bg & ~mask);
+    mask=VGA_TEXT_MASK[bits & 0x0F];
+    ptr[1]=(fg & mask) | (bg & ~mask);
+
+    ptr+=2;
+    cell+=2;
+  }
+}
+
+
+//--------------------------------------------------------------
+// internal Function
+// fill a DMA line buffer with line yp (4bpp or text mode)
+//--------------------------------------------------------------
+void P_VGA_ScanLine(uint8_t *dst, uint16_t yp)
+{
+  if(VGA.scan_mode==VGA_MODE_TEXT) {
+    P_VGA_ExpandText(dst,yp);
+  }
+  else {
+    P_VGA_ExpandLine(dst,&VGA_RAM1[(VGA.show_page*VGA_PAGE_SIZE)+(yp*VGA_PAGE_STRIDE)]);
+  }
+}
+
+
 //--------------------------------------------------------------
 // interne Funktionen
 // init aller IO-Pins
@@ -145,6 +851,26 @@ void P_VGA_InitIO(void)
   GPIO_PinAFConfig(GPIOB, GPIO_PinSource11, GPIO_AF_TIM2);
 
 
+#if VGA_VSYNC_TIMER
+  //---------------------------------------------
+  // init of V-Sync Pin (PB0)
+  // using Timer3 and CH3
+  //---------------------------------------------
+
+  // Clock Enable
+  RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
+
+  // Config Pins as Digital-out
+  GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0;
+  GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+  GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+  GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+  GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP ;
+  GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+  // alternative function connect with IO
+  GPIO_PinAFConfig(GPIOB, GPIO_PinSource0, GPIO_AF_TIM3);
+#else
   //---------------------------------------------
   // init of V-Sync Pin (PB12)
   // using GPIO
@@ -162,6 +888,7 @@ void P_VGA_InitIO(void)
   GPIO_Init(GPIOB, &GPIO_InitStructure);
 
   GPIOB->BSRRL = GPIO_Pin_12;
+#endif
 }
 
 
@@ -190,11 +917,14 @@ void P_VGA_InitTIM(void)
   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
   TIM_TimeBaseInit(TIM1, &TIM_TimeBaseStructure);
 
+  // Timer1 counts only in the pixel window of Timer4 (ITR3)
+  TIM_SelectInputTrigger(TIM1, TIM_TS_ITR3);
+  TIM_SelectSlaveMode(TIM1, TIM_SlaveMode_Gated);
+
 
   //---------------------------------------------
   // init Timer2
   // CH4 for HSYNC-Signal
-  // CH3 for DMA Trigger start
   //---------------------------------------------
 
   // Clock enable
@@ -207,14 +937,6 @@ void P_VGA_InitTIM(void)
   TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
   TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
 
-  // Timer2 Channel 3 ( for DMA Trigger start)
-  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
-  TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
-  TIM_OCInitStructure.TIM_Pulse = VGA_TIM2_HTRIGGER_START-VGA_TIM2_DMA_DELAY;
-  TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
-  TIM_OC3Init(TIM2, &TIM_OCInitStructure);
-  TIM_OC3PreloadConfig(TIM2, TIM_OCPreload_Enable);
-
   // Timer2 Channel 4 (for HSYNC)
   TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
   TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
@@ -224,12 +946,91 @@ void P_VGA_InitTIM(void)
   TIM_OC4PreloadConfig(TIM2, TIM_OCPreload_Enable);
 
 
+  // Timer2 Update as trigger output (line clock for Timer3, start for Timer4)
+  TIM_SelectOutputTrigger(TIM2, TIM_TRGOSource_Update);
+
+
+  //---------------------------------------------
+  // init Timer4 for the pixel window
+  // started by Timer2 Update (ITR1), one pulse
+  //---------------------------------------------
+
+  // Clock enable
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
+
+  // Timer4 init (from the line start to the end of the window)
+  TIM_TimeBaseStructure.TIM_Period = VGA_TIM2_PIXEL_END-1;
+  TIM_TimeBaseStructure.TIM_Prescaler = VGA_TIM2_HSYNC_PRESCALE;
+  TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+  TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+  TIM_TimeBaseInit(TIM4, &TIM_TimeBaseStructure);
+
+  TIM_SelectOnePulseMode(TIM4, TIM_OPMode_Single);
+  TIM_SelectInputTrigger(TIM4, TIM_TS_ITR1);
+  TIM_SelectSlaveMode(TIM4, TIM_SlaveMode_Trigger);
+
+  // Timer4 Channel 1 (pixel window, high from PIXEL_START until the counter stops)
+  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM2;
+  TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Disable;
+  TIM_OCInitStructure.TIM_Pulse = VGA_TIM2_PIXEL_START;
+  TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+  TIM_OC1Init(TIM4, &TIM_OCInitStructure);
+
+  // pixel window as trigger output (gate for Timer1)
+  TIM_SelectOutputTrigger(TIM4, TIM_TRGOSource_OC1Ref);
+
+
+  //---------------------------------------------
+  // init Timer3 as line counter
+  // clocked by Timer2 Update (ITR1)
+  //---------------------------------------------
+
+  // Clock enable
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+
+  // Timer3 init (one frame)
+  TIM_TimeBaseStructure.TIM_Period = VGA_VSYNC_PERIODE-1;
+  TIM_TimeBaseStructure.TIM_Prescaler = 0;
+  TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+  TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+  TIM_TimeBaseInit(TIM3, &TIM_TimeBaseStructure);
+
+  TIM_SelectInputTrigger(TIM3, TIM_TS_ITR1);
+  TIM_SelectSlaveMode(TIM3, TIM_SlaveMode_External1);
+
+  // Timer3 Channel 1 (line interrupts on, before the first picture line)
+  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+  TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Disable;
+  TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+  TIM_OCInitStructure.TIM_Pulse = VGA_VSYNC_LINE_IRQ;
+  TIM_OC1Init(TIM3, &TIM_OCInitStructure);
+
+#if VGA_VSYNC_TIMER
+  // Timer3 Channel 3 (for VSYNC)
+  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+  TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+  TIM_OCInitStructure.TIM_Pulse = VGA_VSYNC_IMP;
+  TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_Low;
+  TIM_OC3Init(TIM3, &TIM_OCInitStructure);
+#else
+  // Timer3 Channel 4 (end of VSYNC)
+  TIM_OCInitStructure.TIM_Pulse = VGA_VSYNC_IMP;
+  TIM_OC4Init(TIM3, &TIM_OCInitStructure);
+#endif
+
+
   //---------------------------------------------
   // enable all Timers
   //---------------------------------------------
 
-  // Timer1 enable
+  // Timer1 enable, counts only while the gate is open
+  // (DMA requests are switched on in P_VGA_StartDMA)
   TIM_ARRPreloadConfig(TIM1, ENABLE);
+  TIM_Cmd(TIM1, ENABLE);
+
+  // Timer3 enable (counts as soon as Timer2 runs)
+  TIM_ARRPreloadConfig(TIM3, ENABLE);
+  TIM_Cmd(TIM3, ENABLE);
 
   // Timer2 enable
   TIM_ARRPreloadConfig(TIM2, ENABLE);
@@ -247,12 +1048,12 @@ void P_VGA_InitINT(void)
 
   //---------------------------------------------
   // init from DMA Interrupt
-  // for TransferComplete Interrupt
+  // Transfer Complete at the end of every line
+  // (switched on by Timer3 CH1, off after the picture)
+  // and Transfer- and DirectMode-Errors
   // DMA2, Stream5, Channel6
   //---------------------------------------------
 
-  DMA_ITConfig(DMA2_Stream5, DMA_IT_TC, ENABLE);
-
   // NVIC config
   NVIC_InitStructure.NVIC_IRQChannel = DMA2_Stream5_IRQn;
   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
@@ -262,15 +1063,20 @@ void P_VGA_InitINT(void)
 
 
   //---------------------------------------------
-  // init of Timer2 Interrupt
-  // for HSync-Counter using Update
-  // for DMA Trigger START using CH3
+  // init of Timer3 Interrupt
+  // for frame start using Update
+  // for line interrupts on using CH1
+  // for VSync end using CH4 (VSync on PB12)
   //---------------------------------------------
 
-  TIM_ITConfig(TIM2,TIM_IT_CC3,ENABLE);
+#if VGA_VSYNC_TIMER
+  TIM_ITConfig(TIM3,TIM_IT_Update | TIM_IT_CC1,ENABLE);
+#else
+  TIM_ITConfig(TIM3,TIM_IT_Update | TIM_IT_CC1 | TIM_IT_CC4,ENABLE);
+#endif
 
   // NVIC config
-  NVIC_InitStructure.NVIC_IRQChannel = TIM2_IRQn;
+  NVIC_InitStructure.NVIC_IRQChannel = TIM3_IRQn;
   NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
@@ -300,14 +1106,14 @@ void P_VGA_InitDMA(void)
   DMA_DeInit(DMA2_Stream5);
   DMA_InitStructure.DMA_Channel = DMA_Channel_6;
   DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)VGA_GPIOE_ODR_ADDRESS;
-  DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)&VGA_RAM1;
+  DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)&VGA_BLACK_LINE[0];
   DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
   DMA_InitStructure.DMA_BufferSize = VGA_DISPLAY_X+1;
   DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
   DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
   DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
   DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
-  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
   DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
   DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
   DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_HalfFull;
@@ -315,103 +1121,182 @@ void P_VGA_InitDMA(void)
   DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
   DMA_Init(DMA2_Stream5, &DMA_InitStructure);
 
-  // DMA-Timer1 enable
-  TIM_DMACmd(TIM1,TIM_DMA_Update,ENABLE);
-}
+  // double buffer : one line per buffer, the stream switches
+  // to the other buffer by itself at the end of a line
+  DMA_DoubleBufferModeConfig(DMA2_Stream5, (uint32_t)&VGA_BLACK_LINE[0], DMA_Memory_0);
+  DMA_DoubleBufferModeCmd(DMA2_Stream5, ENABLE);
 
+  // DMA error interrupts (TransferComplete is switched on by Timer3 CH1)
+  DMA_ITConfig(DMA2_Stream5, DMA_IT_TE | DMA_IT_DME, ENABLE);
+}
 
 
 //--------------------------------------------------------------
-// Interrupt of Timer2
-//
-//   CC3-Interrupt    -> starts from DMA
-// Watch it.. higher troughput when interrupt flag is left alone
+// internal Function
+// start the stopped DMA before the pixel window, both buffers black
+// (from the frame start : the first frame and after a DMA error)
+// too late in the line (other interrupts first) : next frame
 //--------------------------------------------------------------
-void TIM2_IRQHandler(void)
+void P_VGA_StartDMA(void)
 {
+  // Timer1 stands still until the pixel window, keep a margin
+  if(TIM2->CNT>=VGA_TIM2_PIXEL_START/2) return;
+
+  // Timer1 requests off : a request pending from before
+  // would move every line of the picture by one pixel
+  TIM1->DIER&=(uint16_t)~TIM_DMA_Update;
+  DMA2_Stream5->CR&=~DMA_SxCR_TCIE;
+
+  DMA2->HIFCR=VGA_DMA_FLAGS;
+  DMA2_Stream5->NDTR=VGA_DISPLAY_X+1;
+  DMA2_Stream5->M0AR=(uint32_t)&VGA_BLACK_LINE[0];
+  DMA2_Stream5->M1AR=(uint32_t)&VGA_BLACK_LINE[0];
+  DMA2_Stream5->CR&=~DMA_SxCR_CT;
+  DMA2_Stream5->CR|=DMA_SxCR_EN;
+
+  // same pixel phase in every window, then the requests on
+  TIM1->CNT=VGA_TIM1_PHASE;
+  TIM1->DIER|=TIM_DMA_Update;
+}
 
-  // Interrupt of Timer2 CH3 occurred (for Trigger start)
-  TIM_ClearITPendingBit(TIM2, TIM_IT_CC3);
-//  TIM2->SR |= ~TIM_SR_CC3IF; //Clear pending bit interrupt
-//  NVIC->ISPR[0] = 0x10000000;
-//  NVIC->ICPR[0] = 0x10000000;
-//  TIM2->SR = (uint16_t)~((uint16_t)0x0008);
 
 
-  VGA.hsync_cnt++;
-  if(VGA.hsync_cnt>=VGA_VSYNC_PERIODE) {
-    // -----------
-    VGA.hsync_cnt=0;
-    // Adresspointer first dot
-    VGA.start_adr=(uint32_t)(&VGA_RAM1[0]);
-  }
+//--------------------------------------------------------------
+// Interrupt of Timer3 (line counter)
+//
+//   Update-Interrupt -> frame start (VSync low, mode/page latch)
+//   CC1-Interrupt    -> picture follows, line interrupts on
+//   CC4-Interrupt    -> VSync high (VSync on PB12)
+//--------------------------------------------------------------
+void TIM3_IRQHandler(void)
+{
+  uint32_t cycles=DWT->CYCCNT;
+  uint16_t status=TIM3->SR & TIM3->DIER;
+
+  TIM3->SR=(uint16_t)~status;
 
-  // HSync-Pixel
-  if(VGA.hsync_cnt<VGA_VSYNC_IMP) {
-    // HSync low
+  if(status & TIM_IT_Update) {
+#if !VGA_VSYNC_TIMER
+    // VSync low
     GPIOB->BSRRH = GPIO_Pin_12;
+#endif
+    // ISR load of the last frame
+    VGA.isr_load=VGA.isr_cycles;
+    VGA.isr_cycles=0;
+
+    // line interrupt jitter of the last frame
+    VGA.jitter_min=VGA.lat_min;
+    VGA.jitter_max=VGA.lat_max;
+    VGA.lat_min=0xFFFF;
+    VGA.lat_max=0;
+    VGA.frame_cnt++;
+
+    // mode and page change only between two frames
+    VGA.scan_mode=VGA.mode;
+    if(VGA.flip_pending) {
+      VGA.show_page^=0x01;
+      VGA.flip_pending=0;
+    }
+
+    // stream not running (first frame, DMA error) : start in the blank lines
+    if((DMA2_Stream5->CR & DMA_SxCR_EN)==0) {
+      P_VGA_StartDMA();
+    }
   }
-  else {
-    // HSync High
+#if !VGA_VSYNC_TIMER
+  if(status & TIM_IT_CC4) {
+    // VSync high
     GPIOB->BSRRL = GPIO_Pin_12;
   }
-
-  // Test for DMA start
-  if((VGA.hsync_cnt>=VGA_VSYNC_BILD_START) && (VGA.hsync_cnt<=VGA_VSYNC_BILD_STOP)) {
-    // DMA2 init
-	DMA2_Stream5->CR=VGA.dma2_cr_reg;
-    // set address
-    DMA2_Stream5->M0AR=VGA.start_adr;
-    // Timer1 start
-    TIM1->CR1|=TIM_CR1_CEN;
-    // DMA2 enable
-    DMA2_Stream5->CR|=DMA_SxCR_EN;
-
-    // Test Adrespointer for high
-    if((VGA.hsync_cnt & 0x01)!=0) {
-      // inc after Hsync
-      VGA.start_adr+=(VGA_DISPLAY_X+1);
-    }
+#endif
+  if(status & TIM_IT_CC1) {
+    // picture follows, an old Transfer Complete must not count
+    VGA.hsync_cnt=VGA_VSYNC_LINE_IRQ-1;
+    DMA2->HIFCR=DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5;
+    DMA2_Stream5->CR|=DMA_SxCR_TCIE;
   }
 
+  VGA.isr_cycles+=DWT->CYCCNT-cycles;
 }
 
 
 //--------------------------------------------------------------
 // DMA Interrupt ISR
-//   after TransferCompleteInterrupt -> stop DMA
 //
-// still a bit buggy
+//   Transfer Complete -> a line is done and the stream runs on
+//                        with the other buffer : the buffer just
+//                        done gets the address of the line after
+//                        next (one line time to do it)
+//   Transfer- or DirectMode-Error -> count, the stream is
+//                        disabled by hardware and started again
+//                        at the next frame start
 //--------------------------------------------------------------
 void DMA2_Stream5_IRQHandler(void)
 {
-  if(DMA_GetITStatus(DMA2_Stream5, DMA_IT_TCIF5))
-  {
-    // TransferInterruptComplete Interrupt from DMA2
-    DMA_ClearITPendingBit(DMA2_Stream5, DMA_IT_TCIF5);
-//    if(((((DMA_IT_TCIF5) & 0x30000000) != 0x30000000) && \
-//                             (((DMA_IT_TCIF5) & 0x30000000) != 0) && ((DMA_IT_TCIF5) != 0x00) && \
-//                             (((DMA_IT_TCIF5) & 0x40820082) != 0x00))){
-//    	DMA2->HISR = (uint32_t)(((uint32_t)0x20008800) & (uint32_t)0x0F7D0F7D );
-//    }
-//    DMA2->HIFCR = (uint32_t)(((uint32_t)0x20008800) & (uint32_t)0x0F7D0F7D );
-
-//	  DMA_Hisr |= ~DMA_HISR_TCIF5;
-//	  DMA_HISR |= ~DMA_HISR_TCIF5;
-//	  DMA2->HISR |= ~DMA_HISR_TCIF5;
-//    DMA2->HISR |= (uint32_t)(DMA_IT_TCIF5 & ((uint32_t)0x0F7D0F7D ));
-//    DMA2->LISR |= (uint32_t)(DMA_IT_TCIF5 & ((uint32_t)0x0F7D0F7D ));
-//    DMA2->HISR = 0x440;
-//    DMA2->HISR = (uint32_t)(((uint32_t)0x20008800) & (uint32_t)0x0F7D0F7D );
-    // stop after all pixels => DMA Transfer stop
-
-    // Timer1 stop
-    TIM1->CR1&=~TIM_CR1_CEN;
-    // DMA2 disable
-    DMA2_Stream5->CR=0;
-    // switch on black
+  uint32_t cycles=DWT->CYCCNT;
+  uint32_t status=DMA2->HISR & VGA_DMA_FLAGS;
+  uint32_t adr;
+  uint16_t line,cnt,next,yp,latency;
+
+  DMA2->HIFCR=status;
+
+  if(status & (DMA_HISR_TEIF5 | DMA_HISR_DMEIF5)) {
+    // black until the stream runs again
     GPIOE->BSRRH = VGA_GPIO_HINIBBLE;
+    VGA.dma_err_cnt++;
   }
-}
 
+  if((status & DMA_HISR_TCIF5) && (DMA2_Stream5->CR & DMA_SxCR_EN)) {
+    // line number from Timer3, same moment as Timer2
+    do {
+      line=TIM3->CNT;
+      cnt=TIM2->CNT;
+    } while(line!=TIM3->CNT);
+
+    // Timer3 already counts the next line once Timer2 passed the line end
+    if(cnt<VGA_TIM2_PIXEL_END-VGA_TIM1_PHASE) line--;
+
+    // a line interrupt missed : that line kept the address of two lines before
+    if(line!=(uint16_t)(VGA.hsync_cnt+1)) VGA.underrun_cnt++;
+    VGA.hsync_cnt=line;
+
+    // Timer2 ticks from the end of the pixel window (the last pixel is just before it)
+    if(cnt>=VGA_TIM2_PIXEL_END-VGA_TIM1_PHASE) latency=cnt-(VGA_TIM2_PIXEL_END-VGA_TIM1_PHASE);
+    else latency=cnt+(VGA_TIM2_HSYNC_PERIODE+1)-(VGA_TIM2_PIXEL_END-VGA_TIM1_PHASE);
+    if(latency<VGA.lat_min) VGA.lat_min=latency;
+    if(latency>VGA.lat_max) VGA.lat_max=latency;
+    if(latency>VGA.lat_peak) VGA.lat_peak=latency;
+
+    next=line+2;
+    if((next>=VGA_VSYNC_BILD_START) && (next<=VGA_VSYNC_BILD_STOP)) {
+      yp=(next-VGA_VSYNC_BILD_START)>>1;
+      if(VGA.scan_mode!=VGA_MODE_8BPP) {
+        // first of the two lines : expand into the line buffer not scanned out
+        if(((next-VGA_VSYNC_BILD_START) & 0x01)==0) {
+          P_VGA_ScanLine(VGA_LINE_BUF[yp & 0x01],yp);
+        }
+        adr=(uint32_t)(&VGA_LINE_BUF[yp & 0x01][0]);
+      }
+      else {
+        adr=(uint32_t)(&VGA_RAM1[yp*(VGA_DISPLAY_X+1)]);
+      }
+    }
+    else {
+      adr=(uint32_t)(&VGA_BLACK_LINE[0]);
+      if(next>VGA_VSYNC_BILD_STOP+1) {
+        // both buffers black, no more line interrupts until Timer3 CH1
+        DMA2_Stream5->CR&=~DMA_SxCR_TCIE;
+      }
+    }
 
+    // only the buffer not in use may be written (CT = buffer in use)
+    if(DMA2_Stream5->CR & DMA_SxCR_CT) {
+      DMA2_Stream5->M0AR=adr;
+    }
+    else {
+      DMA2_Stream5->M1AR=adr;
+    }
+  }
+
+  VGA.isr_cycles+=DWT->CYCCNT-cycles;
+}
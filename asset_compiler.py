@@ -0,0 +1,373 @@
+"""This python script compiles the PNG images in a manifest into Core/Inc/Bitmaps.h
+
+Usage: python asset_compiler.py [manifest] [output]
+       (default assets/manifest.txt and Core/Inc/Bitmaps.h)
+
+Every manifest line is one asset, empty lines and lines starting with # are skipped:
+    bitmap, <name>, <file.png>, <raw|rle|1bpp|4bpp|auto>, <none|ordered|fs>[, <palette>]
+    alias,  <name>, <bitmap name>, <0|90|180|270>
+    font,   <name>, <file.png>, <first char>, <columns>, <rows>, <spacing>
+
+Bitmaps are quantized to RGB332, pixels with alpha < 128 become transparent (0x01).
+Paletted bitmaps with the same palette name share one palette.
+An alias is a rotated copy of a bitmap that costs no pixel data.
+A font sheet is a grid of glyph cells, dark opaque pixels are set. Fonts are
+written as <name>.bin next to the manifest, in the blob format of Font.h
+(upload with lettertype,<id>,<name>,<size> and data).
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+TRANSPARENT = 0x01
+
+ENCODINGS = {"raw": "ASSET_FMT_RAW", "rle": "ASSET_FMT_RLE", "1bpp": "ASSET_FMT_1BPP", "4bpp": "ASSET_FMT_4BPP"}
+ROTATIONS = {"0": "0", "90": "ASSET_ROT_90", "180": "ASSET_ROT_180", "270": "ASSET_ROT_270"}
+
+# Same 4x4 thresholds as the QOI upload (Upload.c)
+BAYER = [[0, 8, 2, 10], [12, 4, 14, 6], [3, 11, 1, 9], [15, 7, 13, 5]]
+
+# Size of ASSET_Bitmap_t on the target (bitmaps[] entry)
+DESCRIPTOR_SIZE = 20
+
+def read_png(path):
+    """"This function reads a PNG file and returns (width, height, rows of (r, g, b, a))."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(path + ": not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    alpha = []
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            alpha = list(body)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError(path + ": interlaced PNG is not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    if depth != 8 and not (color in (0, 3) and depth in (1, 2, 4)):
+        raise ValueError(path + ": bit depth " + str(depth) + " is not supported")
+
+    stride = (width * channels * depth + 7) // 8
+    bpp = max(1, channels * depth // 8)
+    raw = zlib.decompress(idat)
+    prior = bytearray(stride)
+    rows = []
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = line[i - bpp] if i >= bpp else 0
+            up = prior[i]
+            corner = prior[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                pred = left if pa <= pb and pa <= pc else (up if pb <= pc else corner)
+                line[i] = (line[i] + pred) & 0xFF
+        prior = line
+
+        if depth < 8:
+            per = 8 // depth
+            values = [(line[x // per] >> (8 - depth * (x % per + 1))) & ((1 << depth) - 1) for x in range(width)]
+        else:
+            values = list(line)
+
+        row = []
+        for x in range(width):
+            if color == 0:
+                v = values[x] * 255 // ((1 << depth) - 1)
+                row.append((v, v, v, 255))
+            elif color == 3:
+                index = values[x]
+                row.append(palette[index] + (alpha[index] if index < len(alpha) else 255,))
+            elif color == 4:
+                v = values[x * 2]
+                row.append((v, v, v, values[x * 2 + 1]))
+            elif color == 2:
+                row.append(tuple(values[x * 3:x * 3 + 3]) + (255,))
+            else:
+                row.append(tuple(values[x * 4:x * 4 + 4]))
+        rows.append(row)
+    return width, height, rows
+
+def to_rgb332(r, g, b, t):
+    """"This function quantizes one color to RGB332, t = 8 rounds (same as Upload.c)."""
+    bias = (t << 4) + 8
+    color = ((((r * 7) + bias) >> 8) << 5) | ((((g * 7) + bias) >> 8) << 2) | (((b * 3) + bias) >> 8)
+    # An opaque pixel may not become the transparent color
+    return 0x00 if color == TRANSPARENT else color
+
+def quantize(width, height, rows, dither):
+    """"This function converts RGBA rows to a list of RGB332 pixels."""
+    pixels = []
+    error = [[0.0, 0.0, 0.0] for _ in range(width + 2)]
+    for y in range(height):
+        next_error = [[0.0, 0.0, 0.0] for _ in range(width + 2)]
+        for x in range(width):
+            r, g, b, a = rows[y][x]
+            if a < 128:
+                pixels.append(TRANSPARENT)
+                continue
+            if dither == "ordered":
+                pixels.append(to_rgb332(r, g, b, BAYER[y & 3][x & 3]))
+            elif dither == "fs":
+                want = [min(255.0, max(0.0, c + e)) for c, e in zip((r, g, b), error[x + 1])]
+                color = to_rgb332(int(want[0] + 0.5), int(want[1] + 0.5), int(want[2] + 0.5), 8)
+                got = [((color >> 5) & 7) * 255 / 7, ((color >> 2) & 7) * 255 / 7, (color & 3) * 255 / 3]
+                for c in range(3):
+                    diff = want[c] - got[c]
+                    error[x + 2][c] += diff * 7 / 16
+                    next_error[x][c] += diff * 3 / 16
+                    next_error[x + 1][c] += diff * 5 / 16
+                    next_error[x + 2][c] += diff * 1 / 16
+                pixels.append(color)
+            else:
+                pixels.append(to_rgb332(r, g, b, 8))
+        error = next_error
+    return pixels
+
+def encode_rle(width, height, pixels):
+    """"This function encodes pixels in the RLE format of Assets.h, transparent pixels are always a repeat run."""
+    out = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        x = 0
+        while x < width:
+            run = 1
+            while x + run < width and row[x + run] == row[x] and run < 128:
+                run += 1
+            if run >= 3 or row[x] == TRANSPARENT:
+                out += [0x80 | (run - 1), row[x]]
+                x += run
+                continue
+            literal = []
+            while x < width and len(literal) < 128:
+                run = 1
+                while x + run < width and row[x + run] == row[x] and run < 3:
+                    run += 1
+                if run >= 3 or row[x] == TRANSPARENT:
+                    break
+                literal.append(row[x])
+                x += 1
+            out += [len(literal) - 1] + literal
+    return out
+
+def encode_indexed(width, height, pixels, palette, bits):
+    """"This function packs palette indices, MSB first, every row padded to a byte."""
+    out = []
+    per = 8 // bits
+    for y in range(height):
+        row = [palette.index(p) for p in pixels[y * width:(y + 1) * width]]
+        row += [0] * ((-width) % per)
+        for i in range(0, len(row), per):
+            value = 0
+            for index in row[i:i + per]:
+                value = (value << bits) | index
+            out.append(value)
+    return out
+
+def build_palette(pixels):
+    """"This function returns the colors of a bitmap in order of appearance, entry 0 is transparent."""
+    palette = [TRANSPARENT]
+    for p in pixels:
+        if p not in palette:
+            palette.append(p)
+    return palette
+
+def compile_font(path, first, columns, rows, spacing):
+    """"This function converts a font sheet to a font blob (Font.h)."""
+    width, height, sheet = read_png(path)
+    cell_w = width // columns
+    cell_h = height // rows
+    widths = []
+    glyphs = []
+    for n in range(columns * rows):
+        cx = (n % columns) * cell_w
+        cy = (n // columns) * cell_h
+        bits = [[1 if sheet[cy + y][cx + x][3] >= 128 and sum(sheet[cy + y][cx + x][:3]) < 384 else 0
+                 for x in range(cell_w)] for y in range(cell_h)]
+        used = [x for x in range(cell_w) if any(bits[y][x] for y in range(cell_h))]
+        # An empty cell (space) gets a third of the cell width
+        glyph_w = used[-1] + 1 if used else max(1, cell_w // 3)
+        widths.append(glyph_w)
+        for y in range(cell_h):
+            row = bits[y][:glyph_w] + [0] * ((-glyph_w) % 8)
+            for i in range(0, len(row), 8):
+                value = 0
+                for bit in row[i:i + 8]:
+                    value = (value << 1) | bit
+                glyphs.append(value)
+    if cell_h > 255 or columns * rows > 96:
+        raise ValueError(path + ": max. 96 glyphs of 255 rows")
+    return bytes([cell_h, first, columns * rows, spacing] + widths + glyphs)
+
+def c_array(name, data):
+    """"This function formats a byte list as a C array, 16 values per line."""
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    return "const uint8_t %s[%d] = {\n%s\n};\n" % (name, len(data), "\n".join(lines))
+
+def read_manifest(path):
+    """"This function returns the manifest lines as lists of fields."""
+    entries = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = [field.strip() for field in line.split(",")]
+            entries.append((number, fields))
+    return entries
+
+def main():
+    manifest = sys.argv[1] if len(sys.argv) > 1 else "assets/manifest.txt"
+    output = sys.argv[2] if len(sys.argv) > 2 else "Core/Inc/Bitmaps.h"
+    folder = os.path.dirname(manifest)
+
+    bitmaps = []    # dicts in bitmap number order
+    by_name = {}
+    palettes = {}   # palette name -> list of colors
+    report = []
+
+    for number, fields in read_manifest(manifest):
+        kind = fields[0]
+        where = manifest + ":" + str(number)
+        if kind == "bitmap":
+            name, file, encoding, dither = fields[1:5]
+            if encoding not in ENCODINGS and encoding != "auto":
+                raise ValueError(where + ": unknown encoding " + encoding)
+            if dither not in ("none", "ordered", "fs"):
+                raise ValueError(where + ": unknown dither " + dither)
+            width, height, rows = read_png(os.path.join(folder, file))
+            pixels = quantize(width, height, rows, dither)
+            bitmap = {"name": name, "width": width, "height": height, "pixels": pixels,
+                      "encoding": encoding, "dither": dither, "transform": "0",
+                      "palette": "palette_" + (fields[5] if len(fields) > 5 else name)}
+            bitmaps.append(bitmap)
+            by_name[name] = bitmap
+        elif kind == "alias":
+            name, source, rotation = fields[1:4]
+            if source not in by_name or rotation not in ROTATIONS:
+                raise ValueError(where + ": unknown bitmap or rotation")
+            bitmap = dict(by_name[source], name=name, transform=ROTATIONS[rotation], alias=source)
+            bitmaps.append(bitmap)
+            by_name[name] = bitmap
+        elif kind == "font":
+            name, file = fields[1:3]
+            first, columns, rows, spacing = [int(field, 0) if field[0].isdigit() else ord(field) for field in fields[3:7]]
+            blob = compile_font(os.path.join(folder, file), first, columns, rows, spacing)
+            with open(os.path.join(folder, name + ".bin"), "wb") as f:
+                f.write(blob)
+            report.append((name + ".bin", "font", "%d glyphs" % (columns * rows), len(blob), 0))
+        else:
+            raise ValueError(where + ": unknown asset type " + kind)
+
+    # Colors of every palette group, over all bitmaps that share it
+    for bitmap in bitmaps:
+        if "alias" in bitmap:
+            continue
+        if bitmap["encoding"] == "auto":
+            colors = build_palette(bitmap["pixels"])
+            bitmap["encoding"] = "1bpp" if len(colors) <= 2 else ("4bpp" if len(colors) <= 16 else "rle")
+            if bitmap["encoding"] == "rle" and len(encode_rle(bitmap["width"], bitmap["height"], bitmap["pixels"])) > len(bitmap["pixels"]):
+                bitmap["encoding"] = "raw"
+        if bitmap["encoding"] in ("1bpp", "4bpp"):
+            group = palettes.setdefault(bitmap["palette"], [TRANSPARENT])
+            for color in build_palette(bitmap["pixels"]):
+                if color not in group:
+                    group.append(color)
+
+    body = []
+    emitted = set()
+    for name, colors in palettes.items():
+        users = [b for b in bitmaps if b["palette"] == name and b["encoding"] in ("1bpp", "4bpp")]
+        size = 2 if all(b["encoding"] == "1bpp" for b in users) else 16
+        if len(colors) > size:
+            raise ValueError("palette " + name + " has " + str(len(colors)) + " colors, max. " + str(size))
+        palettes[name] = colors + [TRANSPARENT] * (size - len(colors))
+        body.append("const uint8_t %s[%d] = {%s};\n" % (name, size, ", ".join("0x%02x" % c for c in palettes[name])))
+    if body:
+        body = ["// Palettes, entry 0 is transparent\n\n"] + body + ["\n"]
+
+    table = []
+    notes = []
+    for number, bitmap in enumerate(bitmaps):
+        width, height, pixels = bitmap["width"], bitmap["height"], bitmap["pixels"]
+        encoding = bitmap["encoding"]
+        array = "bitmap_" + bitmap.get("alias", bitmap["name"])
+        palette = "0"
+        flags = "0"
+
+        if encoding in ("1bpp", "4bpp"):
+            palette = bitmap["palette"]
+            data = encode_indexed(width, height, pixels, palettes[palette], 1 if encoding == "1bpp" else 4)
+        elif encoding == "rle":
+            data = encode_rle(width, height, pixels)
+        else:
+            data = pixels
+        if encoding in ("raw", "rle") and TRANSPARENT not in pixels:
+            flags = "ASSET_FLAG_OPAQUE"
+
+        cost = 0
+        if array not in emitted:
+            body.append(c_array(array, data) + "\n")
+            emitted.add(array)
+            cost = len(data)
+
+        transform = "" if bitmap["transform"] == "0" else ", " + bitmap["transform"]
+        table.append("\t{%d, %d, %s, %s, sizeof(%s), %s, %s%s}" % (width, height, ENCODINGS[encoding], flags, array, array, palette, transform))
+        notes.append(" * @note %d. %s (%dx%d, %s%s)\n" % (number, bitmap["name"], width, height, encoding,
+                     ", alias of " + bitmap["alias"] if "alias" in bitmap else ""))
+        report.append((bitmap["name"], encoding, "%dx%d" % (width, height), cost + DESCRIPTOR_SIZE, width * height))
+
+    guard = "INC_BITMAPS_H_"
+    text = ["/*\n * Bitmaps.h\n *\n * Generated by asset_compiler.py from " + manifest.replace("\\", "/") + ", do not edit.\n */\n\n",
+            "#ifndef " + guard + "\n#define " + guard + "\n\n#include \"Assets.h\"\n\n",
+            "/**\n * @brief Bitmap library\n *\n *\n * @param bitmaps The index of the bitmaps, see note\n *\n",
+            " * @note Generated data, edit the PNG files or the manifest instead\n"] + notes + [" */\n\n"]
+    text += body
+    text.append("const ASSET_Bitmap_t bitmaps[] = {\n" + ",\n".join(table) + "\n};\n\n")
+    text.append("#define BITMAP_COUNT (sizeof(bitmaps)/sizeof(bitmaps[0]))\n\n")
+    text.append("// Bitmap names, bitmap,<name>,x,y draws bitmap_names[n]\n")
+    text.append("const char * const bitmap_names[] = {\n" + ",\n".join("\t\"%s\"" % b["name"] for b in bitmaps) + "\n};\n\n")
+    text.append("#endif /* " + guard + " */\n")
+    palette_bytes = sum(len(colors) for colors in palettes.values())
+
+    with open(output, "w", newline="\n") as f:
+        f.write("".join(text))
+
+    print("%-16s %-6s %-9s %8s %8s" % ("Asset", "Format", "Size", "Flash", "8 bpp"))
+    for name, encoding, size, flash, plain in report:
+        print("%-16s %-6s %-9s %8d %8s" % (name, encoding, size, flash, plain if plain else "-"))
+    print("%-16s %-6s %-9s %8d" % ("palettes", "", "", palette_bytes))
+    print("Total flash: %d bytes (%d bytes as 8 bpp)" % (sum(r[3] for r in report) + palette_bytes,
+          sum(r[4] + DESCRIPTOR_SIZE for r in report if r[4])))
+    print("Written: " + output)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+"""This python script uploads a .qoi image over UART"""
+
+import base64
+import os
+import serial
+import serial.tools.list_ports
+
+# 384 base64 characters = 288 file bytes, fits the 512 byte command buffer
+CHUNK_SIZE = 384
+
+def choose_from_list(question, options):
+    """"This function asks for user input until a valid input from the given list is provided."""
+    choice = None
+    for option in options:
+        print(option)
+
+    while choice not in options:
+        print(str(question))
+        choice = input()
+    print()
+    return choice
+
+def open_serial_port():
+    """"This function asks which COM port to use and opens it."""
+    ports = serial.tools.list_ports.comports()
+    coms = []
+    for port in ports:
+        coms.append(port.device)
+
+    com_port = choose_from_list("Please choose one of the ports listed above:", coms)
+
+    return serial.Serial(com_port, 115200, timeout=1000)
+
+def send_command(ser, command):
+    """"This function sends one command and returns the error code of the reply."""
+    ser.write(bytearray(command + "\n", 'ascii'))
+
+    line = ser.readline()
+    while line and b"ERROR:" not in line:
+        print("Reply: " + str(line)[2:-5])
+        line = ser.readline()
+    if not line:
+        print("No reply")
+        return -1
+    received = str(line)
+    return int(received[received.find(" "):-5])
+
+def test_huge_width(ser):
+    """"This function sends a QOI header whose width wraps past the screen edge and expects it to be refused."""
+    x_lup = 10
+    width = 2**32 - x_lup + 100
+    header = b"qoif" + width.to_bytes(4, "big") + (1).to_bytes(4, "big") + bytes([3, 0])
+
+    error_code = send_command(ser, "upload," + str(x_lup) + ",0")
+    if error_code == 0:
+        error_code = send_command(ser, "data," + base64.b64encode(header).decode('ascii'))
+
+    if error_code == ERR_UPLOAD_INVALID:
+        print("Huge width test passed")
+    else:
+        print("Huge width test FAILED, error code: " + str(error_code))
+    return error_code == ERR_UPLOAD_INVALID
+
+IMAGES_PATH = "images/"
+ERR_UPLOAD_INVALID = 609
+
+ser = open_serial_port()
+
+if choose_from_list("Send an image or run the header test?", ["image", "test"]) == "test":
+    test_huge_width(ser)
+    raise SystemExit
+
+image_titles = [name for name in os.listdir(IMAGES_PATH) if name.endswith(".qoi")]
+
+file_wanted = choose_from_list("Please choose an image from the list above:", image_titles)
+
+print("Upper-left x, y and dither (e.g. 10,20,dither):")
+position = input()
+
+with open(IMAGES_PATH + file_wanted, "rb") as f:
+    data = base64.b64encode(f.read()).decode('ascii')
+
+error_code = send_command(ser, "upload," + position)
+print("Error code: " + str(error_code))
+
+for start in range(0, len(data), CHUNK_SIZE):
+    if error_code:
+        break
+    error_code = send_command(ser, "data," + data[start:start + CHUNK_SIZE])
+    print("Sent " + str(min(start + CHUNK_SIZE, len(data))) + "/" + str(len(data)) + ", error code: " + str(error_code))
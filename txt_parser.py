@@ -41,7 +41,15 @@ with open(SCRIPTS_PATH + file_wanted) as f:
         print("Sent: " + command[:-1])
         ser.write(bytearray(command,'ascii'))
 
-        received = str(ser.readline())
+        # Query commands (e.g. status) reply with extra lines before the error code
+        line = ser.readline()
+        while line and b"ERROR:" not in line:
+            print("Reply: " + str(line)[2:-5])
+            line = ser.readline()
+        if not line:
+            print("No reply")
+            break
+        received = str(line)
         error_code = received[received.find(" "):-5]
         print("Error code: " + error_code)
 